@@ -17,6 +17,7 @@ __description__ = "Finds all source files '.cc', '.h', '.ui' and '.qrc' in subdi
 GPLATES_SUB_DIRECTORIES = [
     'api',
     'app-logic',
+    'bench',
     'canvas-tools',
     'cli',
     'data-mining',
@@ -0,0 +1,651 @@
+#!/usr/bin/env python
+#
+# Generates the GPGIM tables source file ('GpgimTables.cc') from the core GPGIM XML file ('gpgim.xml').
+#
+# This is run at build time (see 'src/CMakeLists.txt') so that GPlates (and pygplates) can create the
+# GPGIM feature classes, properties and property structural types (see 'src/model/Gpgim.cc') without
+# parsing the GPGIM XML file at startup. The GPGIM XML file remains the source of truth.
+#
+# The GPGIM XML file is validated here (with the same rules that GPlates previously applied when
+# parsing it at startup) and any error (along with its line number) fails the build.
+#
+
+from __future__ import print_function
+
+import io
+import re
+import sys
+import xml.parsers.expat
+from optparse import OptionParser
+
+
+__usage__ = "%prog [-h --help] <gpgim_xml_filename> <output_source_filename>"
+__description__ = "Generates the GPGIM tables source file (compiled into GPlates and pygplates) "\
+                  "from the GPGIM XML file."
+
+
+GPGIM_NAMESPACE = u'http://www.gplates.org/gpgim'
+GPML_NAMESPACE = u'http://www.gplates.org/gplates'
+GML_NAMESPACE = u'http://www.opengis.net/gml'
+XSI_NAMESPACE = u'http://www.w3.org/XMLSchema-instance'
+
+# Mirrors 'GPlatesUtils::XmlNamespaces::get_namespace_for_standard_alias()'.
+STANDARD_ALIAS_TO_NAMESPACE = {
+    u'gpgim': GPGIM_NAMESPACE,
+    u'gpml': GPML_NAMESPACE,
+    u'gml': GML_NAMESPACE,
+    u'xsi': XSI_NAMESPACE }
+
+# Mirrors the enumeration 'GPlatesModel::GpgimProperty::MultiplicityType'.
+MULTIPLICITIES = {
+    u'0..1': 'GpgimProperty::ZERO_OR_ONE',
+    u'1': 'GpgimProperty::ONE',
+    u'0..*': 'GpgimProperty::ZERO_OR_MORE',
+    u'1..*': 'GpgimProperty::ONE_OR_MORE' }
+
+TIME_DEPENDENT_TYPES = (u'ConstantValue', u'PiecewiseAggregation', u'IrregularSampling')
+
+# The special-case feature type that GPlates adds itself (it should not be in the GPGIM XML file).
+UNCLASSIFIED_FEATURE_TYPE = (GPML_NAMESPACE, u'UnclassifiedFeature')
+
+# Maximum number of bytes in each piece of a (concatenated) string literal.
+# Some compilers (eg, MSVC) limit the length of a single string literal.
+MAX_STRING_LITERAL_PIECE_LENGTH = 1024
+
+
+class GpgimError(Exception):
+    def __init__(self, line_number, message):
+        Exception.__init__(self, message)
+        self.line_number = line_number
+
+
+class QualifiedName(object):
+    """A qualified XML name (equality, like 'GPlatesModel::QualifiedXmlName', ignores the namespace alias)."""
+
+    def __init__(self, namespace_uri, namespace_alias, name):
+        self.namespace_uri = namespace_uri
+        self.namespace_alias = namespace_alias
+        self.name = name
+
+    def key(self):
+        return (self.namespace_uri, self.name)
+
+    def __str__(self):
+        return u'{0}:{1}'.format(self.namespace_alias, self.name)
+
+
+class Element(object):
+    """An XML element node (the subset of 'GPlatesModel::XmlElementNode' used to read the GPGIM)."""
+
+    def __init__(self, name, attributes, alias_to_namespace_map, line_number):
+        # The (namespace, local name) tuple.
+        self.name = name
+        # Map of (namespace, local name) tuples to attribute values.
+        self.attributes = attributes
+        self.alias_to_namespace_map = alias_to_namespace_map
+        self.line_number = line_number
+        self.children = []
+        self.text_pieces = []
+
+    def is_named(self, local_name):
+        return self.name == (GPGIM_NAMESPACE, local_name)
+
+    def has_text(self):
+        return any(text.strip() for text in self.text_pieces)
+
+    def get_text(self):
+        if self.children:
+            raise GpgimError(self.line_number,
+                u"unable to get text string from XML element '{0}'".format(self.name[1]))
+        return u''.join(self.text_pieces).strip()
+
+    def get_qualified_name(self):
+        text = self.get_text()
+        # Mirrors 'GPlatesModel::XmlNodeUtils::get_qualified_xml_name()'.
+        namespace_alias, _, name = text.partition(u':')
+        namespace_uri = self.alias_to_namespace_map.get(namespace_alias)
+        if namespace_uri is None or not name:
+            raise GpgimError(self.line_number,
+                u"unable to get qualified XML name from XML element '{0}'".format(self.name[1]))
+        return QualifiedName(namespace_uri, namespace_alias, name)
+
+    def get_attribute(self, local_name):
+        return self.attributes.get((GPGIM_NAMESPACE, local_name))
+
+    def find_children(self, local_name):
+        return [child for child in self.children if child.is_named(local_name)]
+
+    def find_zero_or_one_child(self, local_name):
+        children = self.find_children(local_name)
+        if len(children) > 1:
+            raise GpgimError(children[1].line_number,
+                u"duplicate 'gpgim:{0}' element found".format(local_name))
+        return children[0] if children else None
+
+    def find_one_child(self, local_name):
+        child = self.find_zero_or_one_child(local_name)
+        if child is None:
+            raise GpgimError(self.line_number,
+                u"'gpgim:{0}' element not found in element '{1}'".format(local_name, self.name[1]))
+        return child
+
+
+def read_xml_document(gpgim_xml_filename):
+    """Parses the GPGIM XML file and returns the root element."""
+
+    parser = xml.parsers.expat.ParserCreate(namespace_separator=' ')
+    parser.buffer_text = True
+
+    element_stack = []
+    root_elements = []
+    # Namespace declarations of the element currently being started.
+    pending_namespace_declarations = {}
+
+    def split_name(name):
+        namespace_uri, _, local_name = name.rpartition(' ')
+        return (namespace_uri, local_name)
+
+    def start_namespace_declaration(prefix, uri):
+        pending_namespace_declarations[prefix or u''] = uri
+
+    def start_element(name, attributes):
+        alias_to_namespace_map = dict(element_stack[-1].alias_to_namespace_map) if element_stack else {}
+        alias_to_namespace_map.update(pending_namespace_declarations)
+        pending_namespace_declarations.clear()
+
+        element = Element(
+            split_name(name),
+            dict((split_name(attribute_name), value) for attribute_name, value in attributes.items()),
+            alias_to_namespace_map,
+            parser.CurrentLineNumber)
+        if element_stack:
+            element_stack[-1].children.append(element)
+        else:
+            root_elements.append(element)
+        element_stack.append(element)
+
+    def end_element(name):
+        element_stack.pop()
+
+    def character_data(data):
+        if element_stack:
+            element_stack[-1].text_pieces.append(data)
+
+    parser.StartNamespaceDeclHandler = start_namespace_declaration
+    parser.StartElementHandler = start_element
+    parser.EndElementHandler = end_element
+    parser.CharacterDataHandler = character_data
+
+    with open(gpgim_xml_filename, 'rb') as gpgim_xml_file:
+        try:
+            parser.ParseFile(gpgim_xml_file)
+        except xml.parsers.expat.ExpatError as error:
+            raise GpgimError(error.lineno, u'XML parse error: {0}'.format(xml.parsers.expat.ErrorString(error.code)))
+
+    if not root_elements:
+        raise GpgimError(1, u'failed to find root XML element')
+
+    return root_elements[0]
+
+
+def parse_standard_qualified_name(qualified_string):
+    """Mirrors 'GPlatesModel::convert_qstring_to_qualified_xml_name()' (used for attribute values)."""
+
+    tokens = qualified_string.split(u':')
+    if len(tokens) == 2:
+        return QualifiedName(
+            STANDARD_ALIAS_TO_NAMESPACE.get(tokens[0], GPML_NAMESPACE), tokens[0], tokens[1])
+    if len(tokens) == 1:
+        return QualifiedName(GPML_NAMESPACE, u'gpml', tokens[0])
+    return None
+
+
+def check_only_child_elements(list_element, *allowed_local_names):
+    if list_element.has_text():
+        raise GpgimError(list_element.line_number,
+            u"the '{0}' element should only contain elements, not text".format(list_element.name[1]))
+    for child in list_element.children:
+        if child.name[0] != GPGIM_NAMESPACE or child.name[1] not in allowed_local_names:
+            raise GpgimError(child.line_number,
+                u"the element '{0}' inside the '{1}' is not one of {2}".format(
+                    child.name[1], list_element.name[1], u', '.join(allowed_local_names)))
+
+
+class GpgimTables(object):
+    """The GPGIM tables written to the generated source file (see 'src/model/GpgimTables.h')."""
+
+    def __init__(self):
+        self.version = None
+        self.enumeration_contents = []
+        self.structural_types = []
+        self.property_structural_types = []
+        self.properties = []
+        self.feature_class_properties = []
+        self.feature_classes = []
+
+        # Map of structural type key to index into 'structural_types'.
+        self.structural_type_indices = {}
+        # Map of property name key to index into 'properties'.
+        self.property_indices = {}
+
+
+def read_version(gpgim_element, tables):
+    version = gpgim_element.get_attribute(u'version')
+    # Mirrors 'GPlatesModel::GpgimVersion::create()'.
+    match = re.match(r'^([1-9])\.(\d+)(\.(\d+))?$', version.strip()) if version is not None else None
+    if not match:
+        raise GpgimError(gpgim_element.line_number, u'failed to read a valid GPGIM version')
+    tables.version = version.strip()
+
+
+def read_property_types(property_type_list_element, tables):
+    check_only_child_elements(property_type_list_element, u'Enumeration', u'NativeProperty')
+
+    for property_type_element in property_type_list_element.children:
+        is_enumeration = property_type_element.is_named(u'Enumeration')
+
+        structural_type = property_type_element.find_one_child(u'Type').get_qualified_name()
+        description = property_type_element.find_one_child(u'Description').get_text()
+
+        is_geometry = False
+        enumeration_contents_begin = len(tables.enumeration_contents)
+        if is_enumeration:
+            content_elements = property_type_element.find_children(u'Content')
+            if not content_elements:
+                raise GpgimError(property_type_element.line_number,
+                    u"'gpgim:Content' element not found in element 'Enumeration'")
+            for content_element in content_elements:
+                tables.enumeration_contents.append((
+                    content_element.find_one_child(u'Value').get_text(),
+                    content_element.find_one_child(u'Description').get_text()))
+        else:
+            is_geometry_value = property_type_element.get_attribute(u'isGeometry')
+            if is_geometry_value is not None:
+                if is_geometry_value in (u'true', u'1'):
+                    is_geometry = True
+                elif is_geometry_value not in (u'false', u'0'):
+                    raise GpgimError(property_type_element.line_number,
+                        u"incorrect attribute value 'gpgim:isGeometry'='{0}' - "
+                        u"should be 'false', 'true', '0' or '1'".format(is_geometry_value))
+
+        if structural_type.key() in tables.structural_type_indices:
+            raise GpgimError(property_type_element.line_number,
+                u"duplicate property structural type '{0}'".format(structural_type))
+        tables.structural_type_indices[structural_type.key()] = len(tables.structural_types)
+
+        tables.structural_types.append((
+            structural_type,
+            description,
+            is_geometry,
+            is_enumeration,
+            enumeration_contents_begin,
+            len(tables.enumeration_contents)))
+
+
+def find_structural_type_index(type_element, structural_type, tables):
+    structural_type_index = tables.structural_type_indices.get(structural_type.key())
+    if structural_type_index is None:
+        raise GpgimError(type_element.line_number,
+            u"'{0}' is not a recognised property structural type".format(structural_type))
+    return structural_type_index
+
+
+def read_property(property_element, tables):
+    property_name = property_element.find_one_child(u'Name').get_qualified_name()
+
+    user_friendly_name_element = property_element.find_zero_or_one_child(u'UserFriendlyName')
+    user_friendly_name = user_friendly_name_element.get_text() \
+        if user_friendly_name_element is not None else property_name.name
+
+    description = property_element.find_one_child(u'Description').get_text()
+
+    multiplicity_element = property_element.find_one_child(u'Multiplicity')
+    multiplicity = MULTIPLICITIES.get(multiplicity_element.get_text())
+    if multiplicity is None:
+        raise GpgimError(multiplicity_element.line_number,
+            u"XML element 'gpgim:Multiplicity' should contain one of '0..1', '1', '0..*' or '1..*'")
+
+    # The non-template types are listed before the template types (regardless of their order in the file).
+    type_elements = property_element.find_children(u'Type')
+    template_type_elements = property_element.find_children(u'TemplateType')
+    if not type_elements and not template_type_elements:
+        raise GpgimError(property_element.line_number,
+            u"There were no 'gpgim:Type' or 'gpgim:TemplateType' elements found in element 'Property'")
+
+    # The 'gpgim:defaultType' attribute is expected if more than one structural type is listed.
+    default_structural_type = None
+    if len(type_elements) + len(template_type_elements) > 1:
+        default_type_value = property_element.get_attribute(u'defaultType')
+        if default_type_value is None:
+            raise GpgimError(property_element.line_number,
+                u"properties with multiple types should have the 'gpgim:defaultType' attribute")
+        default_structural_type = parse_standard_qualified_name(default_type_value)
+        if default_structural_type is None:
+            raise GpgimError(property_element.line_number,
+                u"failed to read attribute 'gpgim:defaultType'='{0}' as a qualified structural type".format(
+                    default_type_value))
+
+    structural_types_begin = len(tables.property_structural_types)
+    default_structural_type_index = None
+
+    for type_element in type_elements:
+        structural_type = type_element.get_qualified_name()
+        structural_type_index = find_structural_type_index(type_element, structural_type, tables)
+        if default_structural_type is not None and default_structural_type.key() == structural_type.key():
+            default_structural_type_index = len(tables.property_structural_types) - structural_types_begin
+        tables.property_structural_types.append((structural_type_index, None))
+
+    for template_type_element in template_type_elements:
+        type_element = template_type_element.find_one_child(u'Type')
+        structural_type = type_element.get_qualified_name()
+        value_type = template_type_element.find_one_child(u'ValueType').get_qualified_name()
+        structural_type_index = find_structural_type_index(type_element, structural_type, tables)
+        if default_structural_type is not None and default_structural_type.key() == structural_type.key():
+            default_structural_type_index = len(tables.property_structural_types) - structural_types_begin
+        tables.property_structural_types.append((structural_type_index, value_type))
+
+    if default_structural_type is not None and default_structural_type_index is None:
+        raise GpgimError(property_element.line_number,
+            u"the default structural type '{0}' was not listed in the structural types".format(
+                default_structural_type))
+
+    time_dependent_flags = set()
+    for time_dependent_element in property_element.find_children(u'TimeDependent'):
+        time_dependent_type = time_dependent_element.get_qualified_name()
+        if time_dependent_type.namespace_uri != GPML_NAMESPACE or \
+                time_dependent_type.name not in TIME_DEPENDENT_TYPES:
+            raise GpgimError(time_dependent_element.line_number,
+                u"XML element 'gpgim:TimeDependent' should contain one of "
+                u"'gpml:ConstantValue', 'gpml:PiecewiseAggregation' or 'gpml:IrregularSampling'")
+        time_dependent_flags.add(time_dependent_type.name)
+
+    if property_name.key() in tables.property_indices:
+        raise GpgimError(property_element.line_number,
+            u"duplicate property name '{0}'".format(property_name))
+    tables.property_indices[property_name.key()] = len(tables.properties)
+
+    tables.properties.append((
+        property_name,
+        user_friendly_name,
+        description,
+        multiplicity,
+        structural_types_begin,
+        len(tables.property_structural_types),
+        default_structural_type_index or 0,
+        [flag in time_dependent_flags for flag in TIME_DEPENDENT_TYPES]))
+
+
+def read_properties(property_list_element, tables):
+    check_only_child_elements(property_list_element, u'Property')
+
+    for property_element in property_list_element.children:
+        read_property(property_element, tables)
+
+
+def read_feature_classes(feature_class_list_element, tables):
+    check_only_child_elements(feature_class_list_element, u'FeatureClass')
+
+    # Map of feature type key to feature class element (and the list of keys in document order).
+    feature_class_elements = {}
+    feature_types = []
+    for feature_class_element in feature_class_list_element.children:
+        name_element = feature_class_element.find_one_child(u'Name')
+        feature_type = name_element.get_qualified_name()
+        if feature_type.key() == UNCLASSIFIED_FEATURE_TYPE:
+            raise GpgimError(name_element.line_number,
+                u"'{0}' is a special-case feature type - it should not be added to the file".format(feature_type))
+        if feature_type.key() in feature_class_elements:
+            raise GpgimError(name_element.line_number,
+                u"duplicate feature class name '{0}'".format(feature_type))
+        feature_class_elements[feature_type.key()] = (feature_type, feature_class_element)
+        feature_types.append(feature_type.key())
+
+    # Map of feature type key to index into 'tables.feature_classes'.
+    # Feature classes are written in inheritance order (a parent class is written before its child classes).
+    feature_class_indices = {}
+    # Feature classes currently being written (used to detect cyclic inheritance).
+    feature_classes_in_progress = set()
+
+    def write_feature_class(feature_type_key, reference_element):
+        if feature_type_key in feature_class_indices:
+            return feature_class_indices[feature_type_key]
+
+        if feature_type_key not in feature_class_elements:
+            raise GpgimError(reference_element.line_number,
+                u"Feature class '{0}' is not defined".format(reference_element.get_text()))
+        if feature_type_key in feature_classes_in_progress:
+            raise GpgimError(reference_element.line_number,
+                u"Feature class '{0}' inherits from itself".format(reference_element.get_text()))
+        feature_classes_in_progress.add(feature_type_key)
+
+        feature_type, feature_class_element = feature_class_elements[feature_type_key]
+
+        description = feature_class_element.find_one_child(u'Description').get_text()
+
+        parent_feature_class_index = -1
+        inherits_element = feature_class_element.find_zero_or_one_child(u'Inherits')
+        if inherits_element is not None:
+            parent_feature_class_index = write_feature_class(
+                inherits_element.get_qualified_name().key(), inherits_element)
+
+        properties_begin = len(tables.feature_class_properties)
+        for property_element in feature_class_element.find_children(u'Property'):
+            property_name = property_element.get_qualified_name()
+            property_index = tables.property_indices.get(property_name.key())
+            if property_index is None:
+                raise GpgimError(property_element.line_number,
+                    u"'{0}' is not a recognised property name".format(property_name))
+            tables.feature_class_properties.append(property_index)
+        properties_end = len(tables.feature_class_properties)
+
+        # The default geometry property must be one of the feature's listed (not inherited) properties.
+        default_geometry_property_index = -1
+        default_geometry_property_value = feature_class_element.get_attribute(u'defaultGeometryProperty')
+        if default_geometry_property_value is not None:
+            default_geometry_property_name = parse_standard_qualified_name(default_geometry_property_value)
+            if default_geometry_property_name is not None:
+                for property_index in range(properties_begin, properties_end):
+                    property_name = tables.properties[tables.feature_class_properties[property_index]][0]
+                    if property_name.key() == default_geometry_property_name.key():
+                        default_geometry_property_index = property_index - properties_begin
+                        break
+                if default_geometry_property_index < 0:
+                    raise GpgimError(feature_class_element.line_number,
+                        u"failed to find default geometry property '{0}' in list of feature properties".format(
+                            default_geometry_property_name))
+
+        class_type_element = feature_class_element.find_one_child(u'ClassType')
+        class_type = class_type_element.get_text()
+        if class_type not in (u'abstract', u'concrete'):
+            raise GpgimError(class_type_element.line_number,
+                u"XML element 'gpgim:ClassType' should contain either 'abstract' or 'concrete'")
+
+        feature_classes_in_progress.remove(feature_type_key)
+        feature_class_indices[feature_type_key] = len(tables.feature_classes)
+
+        tables.feature_classes.append((
+            feature_type,
+            description,
+            parent_feature_class_index,
+            properties_begin,
+            properties_end,
+            default_geometry_property_index,
+            class_type == u'concrete'))
+
+        return feature_class_indices[feature_type_key]
+
+    for feature_type_key in feature_types:
+        write_feature_class(feature_type_key, feature_class_elements[feature_type_key][1])
+
+
+def read_gpgim(gpgim_xml_filename):
+    gpgim_element = read_xml_document(gpgim_xml_filename)
+    if gpgim_element.name != (GPGIM_NAMESPACE, u'GPGIM'):
+        raise GpgimError(gpgim_element.line_number, u"the GPGIM document root element was not a 'gpgim:GPGIM'")
+
+    tables = GpgimTables()
+    read_version(gpgim_element, tables)
+
+    # The property type list, property list and feature class list (in that order).
+    list_local_names = (u'PropertyTypeList', u'PropertyList', u'FeatureClassList')
+    if len(gpgim_element.children) < len(list_local_names):
+        raise GpgimError(gpgim_element.line_number,
+            u"the 'gpgim:GPGIM' element should contain {0} elements".format(u', '.join(list_local_names)))
+    for list_element, list_local_name in zip(gpgim_element.children, list_local_names):
+        if not list_element.is_named(list_local_name):
+            raise GpgimError(list_element.line_number,
+                u"the element '{0}' inside the 'gpgim:GPGIM' is expected to be 'gpgim:{1}'".format(
+                    list_element.name[1], list_local_name))
+
+    read_property_types(gpgim_element.children[0], tables)
+    read_properties(gpgim_element.children[1], tables)
+    read_feature_classes(gpgim_element.children[2], tables)
+
+    return tables
+
+
+def string_literal(text):
+    """Returns a C++ string literal of the UTF-8 encoding of 'text' (or 0 if 'text' is None)."""
+
+    if text is None:
+        return '0'
+
+    pieces = []
+    piece = []
+    piece_length = 0
+    for byte in bytearray(text.encode('utf-8')):
+        if byte == ord('"') or byte == ord('\\'):
+            escaped = '\\' + chr(byte)
+        elif byte == ord('?'):
+            # Avoid trigraphs.
+            escaped = '\\?'
+        elif 0x20 <= byte < 0x7f:
+            escaped = chr(byte)
+        else:
+            # Always use three octal digits so the next character is not part of the escape sequence.
+            escaped = '\\{0:03o}'.format(byte)
+
+        if piece_length + len(escaped) > MAX_STRING_LITERAL_PIECE_LENGTH:
+            pieces.append(''.join(piece))
+            piece = []
+            piece_length = 0
+        piece.append(escaped)
+        piece_length += len(escaped)
+    pieces.append(''.join(piece))
+
+    return ' '.join('"{0}"'.format(piece) for piece in pieces)
+
+
+def qualified_name_initialiser(qualified_name):
+    if qualified_name is None:
+        return '{ 0, 0, 0 }'
+    return '{{ {0}, {1}, {2} }}'.format(
+        string_literal(qualified_name.namespace_uri),
+        string_literal(qualified_name.namespace_alias),
+        string_literal(qualified_name.name))
+
+
+def bool_literal(value):
+    return 'true' if value else 'false'
+
+
+def write_table(lines, table_type, table_name, initialisers):
+    # C++ does not allow zero-sized arrays, so an empty table contains one (unused) entry.
+    lines.append('const GpgimTables::{0} GpgimTables::{1}[] =\n{{\n'.format(table_type, table_name))
+    lines.append(',\n'.join('\t{0}'.format(initialiser) for initialiser in initialisers) if initialisers else '\t{}')
+    lines.append('\n};\n\n')
+    lines.append('const unsigned int GpgimTables::NUM_{0} = {1};\n\n\n'.format(table_name, len(initialisers)))
+
+
+def write_source(tables, output_source_filename):
+    lines = []
+    lines.append(
+        '/**\n'
+        ' * \\file\n'
+        ' *\n'
+        ' * NOTE: This file is generated by \'cmake/generate_gpgim_tables.py\' from the GPGIM XML file\n'
+        ' * \'src/qt-resources/gpgim/gpgim.xml\' - do not edit (edit the GPGIM XML file instead).\n'
+        ' */\n\n'
+        '#include "model/GpgimTables.h"\n\n\n'
+        'namespace GPlatesModel\n{\n\n\n')
+
+    lines.append('const char *const GpgimTables::GPGIM_VERSION = {0};\n\n\n'.format(string_literal(tables.version)))
+
+    write_table(lines, 'EnumerationContent', 'ENUMERATION_CONTENTS', [
+        '{{ {0}, {1} }}'.format(string_literal(value), string_literal(description))
+        for value, description in tables.enumeration_contents])
+
+    write_table(lines, 'StructuralType', 'STRUCTURAL_TYPES', [
+        '{{ {0}, {1}, {2}, {3}, {4}, {5} }}'.format(
+            qualified_name_initialiser(structural_type),
+            string_literal(description),
+            bool_literal(is_geometry),
+            bool_literal(is_enumeration),
+            enumeration_contents_begin,
+            enumeration_contents_end)
+        for (structural_type, description, is_geometry, is_enumeration,
+            enumeration_contents_begin, enumeration_contents_end) in tables.structural_types])
+
+    write_table(lines, 'PropertyStructuralType', 'PROPERTY_STRUCTURAL_TYPES', [
+        '{{ {0}, {1} }}'.format(structural_type_index, qualified_name_initialiser(value_type))
+        for structural_type_index, value_type in tables.property_structural_types])
+
+    write_table(lines, 'Property', 'PROPERTIES', [
+        '{{ {0}, {1}, {2}, {3}, {4}, {5}, {6}, {7}, {8}, {9} }}'.format(
+            qualified_name_initialiser(property_name),
+            string_literal(user_friendly_name),
+            string_literal(description),
+            multiplicity,
+            structural_types_begin,
+            structural_types_end,
+            default_structural_type_index,
+            bool_literal(time_dependent_flags[0]),
+            bool_literal(time_dependent_flags[1]),
+            bool_literal(time_dependent_flags[2]))
+        for (property_name, user_friendly_name, description, multiplicity, structural_types_begin,
+            structural_types_end, default_structural_type_index, time_dependent_flags) in tables.properties])
+
+    write_table(lines, 'unsigned int', 'FEATURE_CLASS_PROPERTIES', [
+        '{0}'.format(property_index) for property_index in tables.feature_class_properties])
+
+    write_table(lines, 'FeatureClass', 'FEATURE_CLASSES', [
+        '{{ {0}, {1}, {2}, {3}, {4}, {5}, {6} }}'.format(
+            qualified_name_initialiser(feature_type),
+            string_literal(description),
+            parent_feature_class_index,
+            properties_begin,
+            properties_end,
+            default_geometry_property_index,
+            bool_literal(is_concrete))
+        for (feature_type, description, parent_feature_class_index, properties_begin, properties_end,
+            default_geometry_property_index, is_concrete) in tables.feature_classes])
+
+    lines.append('}\n')
+
+    source = ''.join(lines)
+
+    with io.open(output_source_filename, 'w', encoding='ascii', newline='\n') as output_source_file:
+        output_source_file.write(source if isinstance(source, type(u'')) else source.decode('ascii'))
+
+
+def main():
+    parser = OptionParser(usage=__usage__, description=__description__)
+    (options, args) = parser.parse_args()
+
+    if len(args) != 2:
+        parser.error('incorrect number of arguments')
+
+    gpgim_xml_filename, output_source_filename = args
+
+    try:
+        tables = read_gpgim(gpgim_xml_filename)
+    except GpgimError as error:
+        print(u'{0}:{1}: error: {2}'.format(gpgim_xml_filename, error.line_number, error), file=sys.stderr)
+        return 1
+
+    write_source(tables, output_source_filename)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
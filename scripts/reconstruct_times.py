@@ -0,0 +1,61 @@
+'''
+ * 
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+'''
+
+#!/usr/bin/env python
+#
+# Reconstructs the same features to a sequence of reconstruction times using a 'RotationModel'
+# (rotation files loaded once, reconstruction trees cached) and 'LoadedFeatureCollections'
+# (reconstructable files loaded once).
+#
+# Also doubles as a smoke test - it exits with a non-zero status if an expected export is missing.
+#
+import os
+import sys
+import pygplates
+
+if __name__ == "__main__":
+	path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "sample-data", "unit-test-data")
+
+	rotation_model = pygplates.RotationModel([os.path.join(path, "coreg_rotation.rot")], 0)
+	reconstructable_features = pygplates.LoadedFeatureCollections(
+		[os.path.join(path, "coreg_target.gpml"), os.path.join(path, "coreg_seed_points.gpml")])
+
+	times = [0.0, 10.0, 20.0, 30.0]
+
+	# One export file per time ("output_<time>Ma.xy").
+	pygplates.reconstruct_times(reconstructable_features, rotation_model, times, "output.xy")
+
+	# The same, but on another thread while this script continues.
+	future = pygplates.reconstruct_times_async(reconstructable_features, rotation_model, times, "output_async.xy")
+	future.result()
+
+	missing = []
+	for basename in ["output", "output_async"]:
+		for time in times:
+			filename = "%s_%.2fMa.xy" % (basename, time)
+			if not os.path.isfile(filename):
+				missing.append(filename)
+	if missing:
+		print "Missing exports: %s" % ", ".join(missing)
+		sys.exit(1)
+
+	print "Reconstructed %d feature collections to %d times" % (
+		len(reconstructable_features.feature_collections()), len(times))
@@ -138,6 +138,8 @@ export_coregistration_layer_proxy()
 		.def("get_associations",		&PyCoregistrationLayerProxy::get_associations)
 		.def("get_coregistration_data", get_current_coreg_data)
 		.def("get_coregistration_data", get_coreg_data)
+		.def("get_num_worker_threads",	&PyCoregistrationLayerProxy::get_num_worker_threads)
+		.def("set_num_worker_threads",	&PyCoregistrationLayerProxy::set_num_worker_threads)
 		;
 
 }
@@ -63,6 +63,24 @@ namespace GPlatesApi
 		
 		bp::list
 		get_coregistration_data();
+
+
+		/**
+		 * The number of threads used to co-register (zero means the global default).
+		 */
+		unsigned int
+		get_num_worker_threads()
+		{
+			return d_proxy->get_current_num_worker_threads();
+		}
+
+
+		void
+		set_num_worker_threads(
+				unsigned int num_worker_threads)
+		{
+			d_proxy->set_current_num_worker_threads(num_worker_threads);
+		}
 	
 	private:
 		GPlatesAppLogic::CoRegistrationLayerProxy::non_null_ptr_type d_proxy;		
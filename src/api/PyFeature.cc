@@ -53,9 +53,59 @@ export_feature()
 }
 
 
+GPlatesApi::Feature::Feature(
+		const GPlatesModel::FeatureHandle::weak_ref &w_ref,
+		const reconstruct_mutex_ptr_type &reconstruct_mutex) :
+	d_reconstruct_mutex(reconstruct_mutex)
+{
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+	d_handle = w_ref;
+}
+
+
+GPlatesApi::Feature::Feature(
+		const Feature &other) :
+	d_reconstruct_mutex(other.d_reconstruct_mutex)
+{
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+	d_handle = other.d_handle;
+}
+
+
+GPlatesApi::Feature &
+GPlatesApi::Feature::operator=(
+		const Feature &other)
+{
+	if (this != &other)
+	{
+		// Unsubscribe from our feature, and then subscribe to the other feature, with each
+		// feature's model locked (one at a time, so there's no lock ordering to get wrong).
+		{
+			ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+			d_handle = GPlatesModel::FeatureHandle::weak_ref();
+		}
+
+		d_reconstruct_mutex = other.d_reconstruct_mutex;
+		ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+		d_handle = other.d_handle;
+	}
+	return *this;
+}
+
+
+GPlatesApi::Feature::~Feature()
+{
+	// Unsubscribe from the feature while locked (the member's destructor then has nothing to do).
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+	d_handle = GPlatesModel::FeatureHandle::weak_ref();
+}
+
+
 bp::list
 GPlatesApi::Feature::get_properties()
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	bp::list ret;
 	
 	if(!d_handle.is_valid())
@@ -76,6 +126,8 @@ bp::list
 GPlatesApi::Feature::get_properties_by_name(
 		bp::object prop_name)
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	bp::list ret;
 
 	if(!d_handle.is_valid())
@@ -165,6 +217,8 @@ GPlatesApi::Feature::get_properties_by_name(
 bp::list
 GPlatesApi::Feature::get_all_property_names()
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	using namespace GPlatesModel;
 	bp::list ret;
 	
@@ -215,6 +269,8 @@ GPlatesApi::Feature::get_all_property_names()
 bp::object
 GPlatesApi::Feature::feature_id()
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	if(!d_handle.is_valid())
 		return bp::object();
 
@@ -226,6 +282,8 @@ GPlatesApi::Feature::feature_id()
 bp::tuple
 GPlatesApi::Feature::valid_time()
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	if(!d_handle.is_valid())
 		return bp::tuple();
 
@@ -238,6 +296,8 @@ GPlatesApi::Feature::valid_time()
 bp::object
 GPlatesApi::Feature::begin_time()
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	if(!d_handle.is_valid())
 		return bp::object();
 
@@ -248,6 +308,8 @@ GPlatesApi::Feature::begin_time()
 bp::object
 GPlatesApi::Feature::end_time()
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	if(!d_handle.is_valid())
 		return bp::object();
 
@@ -259,6 +321,8 @@ GPlatesApi::Feature::end_time()
 bp::object
 GPlatesApi::Feature::feature_type()
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	if(!d_handle.is_valid())
 		return bp::object();
 
@@ -270,6 +334,8 @@ GPlatesApi::Feature::feature_type()
 unsigned long
 GPlatesApi::Feature::plate_id()
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	if(!d_handle.is_valid())
 		return 0;
 
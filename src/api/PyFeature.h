@@ -25,6 +25,8 @@
 #ifndef GPLATES_API_FEATURE_H
 #define GPLATES_API_FEATURE_H
 
+#include "PyReconstructLock.h"
+
 #include "global/python.h"
 #include "model/FeatureHandle.h"
 #include "utils/FeatureUtils.h"
@@ -36,14 +38,37 @@ namespace bp=boost::python;
 
 namespace GPlatesApi
 {
+	/**
+	 * Wrapper around FeatureHandle for exposing to Python.
+	 *
+	 * All methods lock the mutex of the model containing the feature (see @a reconstruct_mutex_ptr_type).
+	 * That includes copying, assigning and destroying since the wrapped weak reference subscribes to
+	 * (and unsubscribes from) the feature, and a 'Future' operation might be creating weak references
+	 * to the same feature on another thread. So, like all other methods, these must be called with
+	 * the GIL held.
+	 */
 	class Feature
 	{
 	public:
 		Feature(){ }
 
-		Feature(GPlatesModel::FeatureHandle::weak_ref w_ref) :
-			d_handle(w_ref)
-		{ }
+		/**
+		 * Wraps the feature @a w_ref contained in the model whose mutex is @a reconstruct_mutex.
+		 *
+		 * The mutex is NULL for features in the GPlates application model (see @a reconstruct_mutex_ptr_type).
+		 */
+		Feature(
+				const GPlatesModel::FeatureHandle::weak_ref &w_ref,
+				const reconstruct_mutex_ptr_type &reconstruct_mutex = reconstruct_mutex_ptr_type());
+
+		Feature(
+				const Feature &other);
+
+		Feature &
+		operator=(
+				const Feature &other);
+
+		~Feature();
 
 
 		/*
@@ -90,6 +115,7 @@ namespace GPlatesApi
 
 		operator GPlatesModel::FeatureHandle::weak_ref()
 		{
+			ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
 			return d_handle;
 		}
 	//protected:
@@ -104,6 +130,8 @@ namespace GPlatesApi
 		{
 			using namespace GPlatesDataMining;
 			QString name = QString::fromUtf8(bp::extract<const char*>(name_));
+
+			ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
 			OpaqueData data = DataMiningUtils::get_property_value_by_name(d_handle, name);
 			
 			if(is_empty_opaque(data))
@@ -131,6 +159,7 @@ namespace GPlatesApi
 		}
 
 	private:
+		reconstruct_mutex_ptr_type d_reconstruct_mutex;
 		GPlatesModel::FeatureHandle::weak_ref d_handle;
 	};
 }
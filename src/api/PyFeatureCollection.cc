@@ -25,14 +25,57 @@
 #include "PyFeatureCollection.h"
 
 GPlatesApi::FeatureCollection::FeatureCollection(
-		GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection) :
-	d_feature_collection(feature_collection)
-{  }
+		GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+		const reconstruct_mutex_ptr_type &reconstruct_mutex) :
+	d_reconstruct_mutex(reconstruct_mutex)
+{
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+	d_feature_collection = feature_collection;
+}
+
+
+GPlatesApi::FeatureCollection::FeatureCollection(
+		const FeatureCollection &other) :
+	d_reconstruct_mutex(other.d_reconstruct_mutex)
+{
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+	d_feature_collection = other.d_feature_collection;
+}
+
+
+GPlatesApi::FeatureCollection &
+GPlatesApi::FeatureCollection::operator=(
+		const FeatureCollection &other)
+{
+	if (this != &other)
+	{
+		// Like Feature::operator=, lock each model in turn (rather than both at once).
+		{
+			ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+			d_feature_collection = GPlatesModel::FeatureCollectionHandle::weak_ref();
+		}
+
+		d_reconstruct_mutex = other.d_reconstruct_mutex;
+		ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+		d_feature_collection = other.d_feature_collection;
+	}
+	return *this;
+}
+
+
+GPlatesApi::FeatureCollection::~FeatureCollection()
+{
+	// Unsubscribe from the feature collection while locked.
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+	d_feature_collection = GPlatesModel::FeatureCollectionHandle::weak_ref();
+}
 
 
 std::size_t
 GPlatesApi::FeatureCollection::size() const
 {
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 	if(!d_feature_collection.is_valid())
 		return 0;
 	else
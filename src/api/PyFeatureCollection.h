@@ -39,25 +39,45 @@ namespace GPlatesApi
 	/**
 	 * Wrapper around FeatureCollectionHandle for exposing to Python.
 	 *
+	 * Like @a Feature, all methods (including copying, assigning and destroying) lock the mutex of
+	 * the model containing the feature collection and so must be called with the GIL held.
 	 */
 	class FeatureCollection 
 	{
 	public:
 
+		/**
+		 * Wraps @a feature_collection contained in the model whose mutex is @a reconstruct_mutex.
+		 *
+		 * The mutex is NULL for feature collections in the GPlates application model
+		 * (see @a reconstruct_mutex_ptr_type).
+		 */
 		static
 		FeatureCollection
 		create(
-				GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection)
+				GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection,
+				const reconstruct_mutex_ptr_type &reconstruct_mutex = reconstruct_mutex_ptr_type())
 		{
-			return FeatureCollection(feature_collection);
+			return FeatureCollection(feature_collection, reconstruct_mutex);
 		}
 
+		FeatureCollection(
+				const FeatureCollection &other);
+
+		FeatureCollection &
+		operator=(
+				const FeatureCollection &other);
+
+		~FeatureCollection();
+
 		std::size_t
 		size() const;
 
 		boost::python::list
 		features()
 		{
+			ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
 			boost::python::list result;
 			if(d_feature_collection.is_valid())
 			{
@@ -66,7 +86,7 @@ namespace GPlatesApi
 					it_end = d_feature_collection->end();
 				for(; it != it_end; it++)
 				{
-					result.append(Feature((*it)->reference()));
+					result.append(Feature((*it)->reference(), d_reconstruct_mutex));
 				}
 			}
 			return result;
@@ -74,10 +94,11 @@ namespace GPlatesApi
 
 	private:
 
-		explicit
 		FeatureCollection(
-				GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection);
+				GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+				const reconstruct_mutex_ptr_type &reconstruct_mutex);
 
+		reconstruct_mutex_ptr_type d_reconstruct_mutex;
 		GPlatesModel::FeatureCollectionHandle::weak_ref d_feature_collection;
 	};
 }
@@ -30,10 +30,19 @@
 #include "global/python.h"
 
 #include <boost/foreach.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
 #include <QString>
 
+#include "PyFuture.h"
+#include "PyLoadedFeatureCollections.h"
+#include "PyReconstructLock.h"
+#include "PyRotationModel.h"
+#include "PythonInterpreterUnlocker.h"
 #include "PythonUtils.h"
 
+#include "app-logic/ReconstructContext.h"
+#include "app-logic/ReconstructMethodRegistry.h"
 #include "app-logic/ReconstructUtils.h"
 
 #include "data-mining/DataMiningUtils.h"
@@ -46,6 +55,8 @@
 
 #include "model/Gpgim.h"
 
+#include "utils/ParallelUtils.h"
+
 namespace bp = boost::python;
 namespace utils = GPlatesDataMining::DataMiningUtils;
 
@@ -63,6 +74,18 @@ namespace
 		return ret;
 	}
 
+	const std::vector<double>
+	to_double_vector(const bp::list& objs)
+	{
+		std::vector<double> ret;
+		bp::ssize_t n = bp::len(objs);
+		for(bp::ssize_t i=0; i<n; i++)
+		{
+			ret.push_back(bp::extract<double>(objs[i]));
+		}
+		return ret;
+	}
+
 	GPlatesFileIO::ReconstructedFeatureGeometryExport::Format
 	get_format(QString file_name)
 	{
@@ -81,19 +104,17 @@ namespace
 	}
 
 	void
-	reconstruct(
-			bp::list recon_files,
-			bp::list rot_files,
-			bp::object time,
-			bp::object anchor_plate_id,
-			bp::object export_file_name)
+	reconstruct_files(
+			const std::vector<QString> &s_recon_files,
+			const std::vector<QString> &s_rot_files,
+			const double &recon_time,
+			unsigned long anchor_pid,
+			const QString &export_file_name_q)
 	{
 		using namespace GPlatesFileIO;
 
+		// No locking is needed since the files are loaded into their own model.
 		std::vector<File::non_null_ptr_type> p_rot_files, p_recon_files;
-		
-		const std::vector<QString> s_rot_files = to_str_vector(rot_files);
-		const std::vector<QString> s_recon_files = to_str_vector(recon_files);
 	
 		boost::scoped_ptr<FeatureCollectionFileFormat::Registry> registry(new FeatureCollectionFileFormat::Registry());
 		
@@ -104,9 +125,6 @@ namespace
 		std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> rot_fc = 
 			utils::load_files(s_rot_files, p_rot_files,*registry);
 
-		double recon_time = bp::extract<double>(time);
-		unsigned long anchor_pid = bp::extract<unsigned long>(anchor_plate_id);
-
 		std::vector<GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type> rfgs;
 		GPlatesAppLogic::ReconstructUtils::reconstruct(
 				rfgs,
@@ -142,8 +160,6 @@ namespace
 		{
 			reconstruction_file_ptrs.push_back(&(*file_iter)->get_reference());
 		}
-		
-		QString export_file_name_q = QString(bp::extract<const char *>(export_file_name));
 
 		ReconstructedFeatureGeometryExport::Format format = get_format(export_file_name_q);
 
@@ -163,6 +179,199 @@ namespace
 	}
 
 
+	void
+	reconstruct(
+			bp::list recon_files,
+			bp::list rot_files,
+			bp::object time,
+			bp::object anchor_plate_id,
+			bp::object export_file_name)
+	{
+		const std::vector<QString> s_recon_files = to_str_vector(recon_files);
+		const std::vector<QString> s_rot_files = to_str_vector(rot_files);
+		const double recon_time = bp::extract<double>(time);
+		const unsigned long anchor_pid = bp::extract<unsigned long>(anchor_plate_id);
+		const QString export_file_name_q = QString(bp::extract<const char *>(export_file_name));
+
+		// Release the GIL while loading, reconstructing and exporting.
+		GPlatesApi::PythonInterpreterUnlocker interpreter_unlocker;
+
+		reconstruct_files(s_recon_files, s_rot_files, recon_time, anchor_pid, export_file_name_q);
+	}
+
+
+	/**
+	 * Same as @a reconstruct but returns immediately with a 'Future' (the reconstruction runs on its own thread).
+	 *
+	 * NOTE: This is not fire-and-forget - discarding the returned 'Future' waits for the reconstruction to finish.
+	 */
+	GPlatesApi::Future
+	reconstruct_async(
+			bp::list recon_files,
+			bp::list rot_files,
+			bp::object time,
+			bp::object anchor_plate_id,
+			bp::object export_file_name)
+	{
+		const std::vector<QString> s_recon_files = to_str_vector(recon_files);
+		const std::vector<QString> s_rot_files = to_str_vector(rot_files);
+		const double recon_time = bp::extract<double>(time);
+		const unsigned long anchor_pid = bp::extract<unsigned long>(anchor_plate_id);
+		const QString export_file_name_q = QString(bp::extract<const char *>(export_file_name));
+
+		return GPlatesApi::Future::create(
+				[=]()
+				{
+					reconstruct_files(s_recon_files, s_rot_files, recon_time, anchor_pid, export_file_name_q);
+				});
+	}
+
+
+	/**
+	 * Reconstructs the features in @a reconstructable_features, using @a rotation_model, to each
+	 * reconstruction time in @a times and exports each time to its own file.
+	 *
+	 * The export filename of each time is @a export_file_name with "_<time>Ma" inserted before
+	 * the filename extension (eg, "reconstructed.shp" becomes "reconstructed_10.00Ma.shp").
+	 *
+	 * Unlike @a reconstruct, the files are not re-loaded for each call (or time), and the reconstruction
+	 * trees cached by @a rotation_model and the features' reconstruct methods are re-used across times.
+	 *
+	 * Since @a reconstructable_features and @a rotation_model can be shared by other Python threads
+	 * (and 'reconstruct_times_async' calls), both are locked for the duration of the reconstructions.
+	 */
+	void
+	reconstruct_to_times(
+			const GPlatesApi::LoadedFeatureCollections &reconstructable_features,
+			const GPlatesApi::RotationModel &rotation_model,
+			const std::vector<double> &times,
+			const QString &export_file_name)
+	{
+		using namespace GPlatesFileIO;
+
+		// Always lock the reconstructable features before the rotation model (to avoid deadlock).
+		boost::lock_guard<boost::recursive_mutex> reconstructable_features_lock(
+				*reconstructable_features.get_reconstruct_mutex());
+		boost::lock_guard<boost::recursive_mutex> rotation_model_lock(
+				*rotation_model.get_reconstruct_mutex());
+
+		const ReconstructedFeatureGeometryExport::Format format = get_format(export_file_name);
+
+		// Split the export filename so the reconstruction time can be inserted before the extension.
+		const int export_file_extension_index = export_file_name.lastIndexOf('.');
+		const QString export_file_basename = (export_file_extension_index < 0)
+				? export_file_name
+				: export_file_name.left(export_file_extension_index);
+		const QString export_file_extension = (export_file_extension_index < 0)
+				? QString()
+				: export_file_name.mid(export_file_extension_index);
+
+		// Get the sequence of reconstructable files as File pointers.
+		std::vector<const File::Reference *> reconstructable_file_ptrs;
+		BOOST_FOREACH(const File::non_null_ptr_type &file, reconstructable_features.get_files())
+		{
+			reconstructable_file_ptrs.push_back(&file->get_reference());
+		}
+
+		// Get the sequence of reconstruction files as File pointers.
+		std::vector<const File::Reference *> reconstruction_file_ptrs;
+		BOOST_FOREACH(const File::non_null_ptr_type &file, rotation_model.get_loaded_feature_collections().get_files())
+		{
+			reconstruction_file_ptrs.push_back(&file->get_reference());
+		}
+
+		// Determine the reconstruct method of each feature once (rather than for each time).
+		const GPlatesAppLogic::ReconstructMethodRegistry reconstruct_method_registry;
+		GPlatesAppLogic::ReconstructContext reconstruct_context(reconstruct_method_registry);
+		reconstruct_context.set_features(reconstructable_features.get_feature_collections());
+		const GPlatesAppLogic::ReconstructContext::context_state_reference_type context_state =
+				reconstruct_context.create_context_state(
+						GPlatesAppLogic::ReconstructMethodInterface::Context(
+								GPlatesAppLogic::ReconstructParams(),
+								rotation_model.get_reconstruction_tree_creator()));
+
+		BOOST_FOREACH(const double &time, times)
+		{
+			std::vector<GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type> rfgs;
+			reconstruct_context.get_reconstructed_feature_geometries(rfgs, context_state, time);
+
+			// Converts to raw pointers.
+			std::vector<const GPlatesAppLogic::ReconstructedFeatureGeometry *> rfgs_p;
+			rfgs_p.reserve(rfgs.size());
+			BOOST_FOREACH(
+					const GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type &rfg,
+					rfgs)
+			{
+				rfgs_p.push_back(rfg.get());
+			}
+
+			// Export the reconstructed feature geometries.
+			ReconstructedFeatureGeometryExport::export_reconstructed_feature_geometries(
+						export_file_basename + "_" + QString::number(time, 'f', 2) + "Ma" + export_file_extension,
+						format,
+						rfgs_p,
+						reconstructable_file_ptrs,
+						reconstruction_file_ptrs,
+						rotation_model.get_anchor_plate_id(),
+						time,
+						true/*export_single_output_file*/,
+						false/*export_per_input_file*/,
+						false/*export_separate_output_directory_per_input_file*/,
+						format == ReconstructedFeatureGeometryExport::SHAPEFILE/*wrap_to_dateline*/);
+		}
+	}
+
+
+	void
+	reconstruct_times(
+			const GPlatesApi::LoadedFeatureCollections &reconstructable_features,
+			const GPlatesApi::RotationModel &rotation_model,
+			bp::list python_times,
+			bp::object python_export_file_name)
+	{
+		const std::vector<double> times = to_double_vector(python_times);
+		const QString export_file_name = QString(bp::extract<const char *>(python_export_file_name));
+
+		// Release the GIL while reconstructing and exporting.
+		GPlatesApi::PythonInterpreterUnlocker interpreter_unlocker;
+
+		reconstruct_to_times(reconstructable_features, rotation_model, times, export_file_name);
+	}
+
+
+	/**
+	 * Same as @a reconstruct_times but returns immediately with a 'Future' (the reconstructions run on their own thread).
+	 *
+	 * The loaded features and rotation model are kept alive (by the returned 'Future') until the reconstructions finish.
+	 * In the meantime their 'feature_collections()' methods block until the reconstructions finish.
+	 */
+	GPlatesApi::Future
+	reconstruct_times_async(
+			bp::object python_reconstructable_features,
+			bp::object python_rotation_model,
+			bp::list python_times,
+			bp::object python_export_file_name)
+	{
+		const GPlatesApi::LoadedFeatureCollections *reconstructable_features =
+				&bp::extract<const GPlatesApi::LoadedFeatureCollections &>(python_reconstructable_features)();
+		const GPlatesApi::RotationModel *rotation_model =
+				&bp::extract<const GPlatesApi::RotationModel &>(python_rotation_model)();
+		const std::vector<double> times = to_double_vector(python_times);
+		const QString export_file_name = QString(bp::extract<const char *>(python_export_file_name));
+
+		bp::list keep_alive;
+		keep_alive.append(python_reconstructable_features);
+		keep_alive.append(python_rotation_model);
+
+		return GPlatesApi::Future::create(
+				[=]()
+				{
+					reconstruct_to_times(*reconstructable_features, *rotation_model, times, export_file_name);
+				},
+				keep_alive);
+	}
+
+
 	/**
 	 * Loads reconstructable features from files @a python_reconstructable_filenames and assumes
 	 * each feature geometry is *not* present day geometry but instead is the reconstructed geometry
@@ -195,6 +404,10 @@ namespace
 		const QString output_file_format = QString(bp::extract<const char *>(python_output_file_format));
 		const QString output_file_basename_suffix = QString(bp::extract<const char *>(python_output_file_basename_suffix));
 
+		// Release the GIL while loading, reverse reconstructing and saving.
+		// No locking is needed since the files are loaded into their own model.
+		GPlatesApi::PythonInterpreterUnlocker interpreter_unlocker;
+
 		GPlatesFileIO::FeatureCollectionFileFormat::Registry feature_collection_file_format_registry;
 		GPlatesModel::ModelInterface model;
 
@@ -292,6 +505,28 @@ namespace
 			feature_collection_file_format_registry.write_feature_collection(*output_file_ref);
 		}
 	}
+
+	/**
+	 * Sets the number of threads used to speed up lengthy calculations.
+	 *
+	 * Zero means use the number of processor cores.
+	 * This is the same setting as the GPlates user preference "app_logic/num_worker_threads".
+	 */
+	void
+	set_num_worker_threads(
+			unsigned int num_worker_threads)
+	{
+		GPlatesUtils::ParallelUtils::set_num_worker_threads(num_worker_threads);
+	}
+
+	/**
+	 * Returns the number of threads used to speed up lengthy calculations.
+	 */
+	unsigned int
+	get_num_worker_threads()
+	{
+		return GPlatesUtils::ParallelUtils::get_num_worker_threads();
+	}
 }
 
 	
@@ -299,5 +534,10 @@ void
 export_functions()
 {
 	bp::def("reconstruct", &reconstruct);
+	bp::def("reconstruct_async", &reconstruct_async);
+	bp::def("reconstruct_times", &reconstruct_times);
+	bp::def("reconstruct_times_async", &reconstruct_times_async);
 	bp::def("reverse_reconstruct", &reverse_reconstruct);
+	bp::def("set_num_worker_threads", &set_num_worker_threads);
+	bp::def("get_num_worker_threads", &get_num_worker_threads);
 }
@@ -0,0 +1,79 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+// Workaround for compile error in <pyport.h> for Python versions less than 2.7.13 and 3.5.3.
+// See https://bugs.python.org/issue10910
+// Workaround involves including "global/python.h" at the top of some source files
+// to ensure <Python.h> is included before <ctype.h>.
+#include "global/python.h"
+
+#include <chrono>
+
+#include "PyFuture.h"
+
+#include "PythonInterpreterUnlocker.h"
+
+
+GPlatesApi::Future::State::~State()
+{
+	// Release the GIL while waiting so that other Python threads can run.
+	PythonInterpreterUnlocker interpreter_unlocker;
+
+	future.wait();
+}
+
+
+bool
+GPlatesApi::Future::done() const
+{
+	return d_state->future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+
+void
+GPlatesApi::Future::result() const
+{
+	{
+		// Release the GIL while waiting so that other Python threads can run.
+		PythonInterpreterUnlocker interpreter_unlocker;
+
+		d_state->future.wait();
+	}
+
+	// Re-throws any exception thrown by the operation (which then gets translated to a Python exception).
+	d_state->future.get();
+}
+
+
+void
+export_future()
+{
+	using namespace boost::python;
+
+	class_<GPlatesApi::Future>("Future", no_init)
+		.def("done", &GPlatesApi::Future::done)
+		.def("result", &GPlatesApi::Future::result)
+		;
+}
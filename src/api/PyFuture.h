@@ -0,0 +1,130 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_API_PYFUTURE_H
+#define GPLATES_API_PYFUTURE_H
+
+#include <future>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "global/python.h"
+
+
+namespace GPlatesApi
+{
+	/**
+	 * The result of a C++ operation that is running asynchronously on its own thread
+	 * (exposed to Python as 'Future').
+	 *
+	 * The operation runs without the Python Global Interpreter Lock (GIL) and so must not access
+	 * any Python objects. Any Python objects that it (indirectly) depends on should be passed in
+	 * @a keep_alive so they are not destroyed while the operation is still running.
+	 *
+	 * NOTE: An operation cannot be fire-and-forget. When the last reference to a 'Future' is
+	 * destroyed it waits for the operation to finish (with the GIL released so other Python
+	 * threads can run in the meantime). So a discarded 'Future' (eg, not assigning the result of
+	 * 'reconstruct_async' to a variable) effectively turns the call into a synchronous call.
+	 */
+	class Future
+	{
+	public:
+
+		/**
+		 * Runs @a function (with signature 'void ()') asynchronously on a new thread.
+		 */
+		template <typename FunctionType>
+		static
+		Future
+		create(
+				const FunctionType &function,
+				boost::python::list keep_alive = boost::python::list())
+		{
+			return Future(
+					boost::shared_ptr<State>(
+							new State(std::async(std::launch::async, function).share(), keep_alive)));
+		}
+
+
+		/**
+		 * Returns true if the operation has finished (successfully or not).
+		 */
+		bool
+		done() const;
+
+		/**
+		 * Waits for the operation to finish (with the GIL released) and re-raises any exception it threw.
+		 */
+		void
+		result() const;
+
+	private:
+
+		/**
+		 * State shared by all copies of a 'Future' (Python can copy the C++ object).
+		 */
+		class State :
+				private boost::noncopyable
+		{
+		public:
+
+			State(
+					const std::shared_future<void> &future_,
+					boost::python::list keep_alive_) :
+				keep_alive(keep_alive_),
+				future(future_)
+			{  }
+
+			/**
+			 * Waits for the operation to finish with the GIL released.
+			 *
+			 * Destroying the last reference to a future returned by 'std::async' blocks until the
+			 * operation finishes - without this the wait would happen with the GIL held and stall
+			 * all other Python threads (and the embedded console).
+			 */
+			~State();
+
+			/**
+			 * Python objects the operation depends on.
+			 *
+			 * NOTE: This is declared before @a future so that it's destroyed *after* @a future.
+			 */
+			boost::python::list keep_alive;
+
+			std::shared_future<void> future;
+		};
+
+		boost::shared_ptr<State> d_state;
+
+
+		explicit
+		Future(
+				const boost::shared_ptr<State> &state) :
+			d_state(state)
+		{  }
+	};
+}
+
+#endif // GPLATES_API_PYFUTURE_H
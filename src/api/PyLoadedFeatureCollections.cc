@@ -0,0 +1,109 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+// Workaround for compile error in <pyport.h> for Python versions less than 2.7.13 and 3.5.3.
+// See https://bugs.python.org/issue10910
+// Workaround involves including "global/python.h" at the top of some source files
+// to ensure <Python.h> is included before <ctype.h>.
+#include "global/python.h"
+
+#include <boost/foreach.hpp>
+#include <QString>
+
+#include "PyLoadedFeatureCollections.h"
+
+#include "PyFeatureCollection.h"
+#include "PyReconstructLock.h"
+#include "PythonInterpreterUnlocker.h"
+
+#include "data-mining/DataMiningUtils.h"
+
+#include "file-io/FeatureCollectionFileFormatRegistry.h"
+
+
+GPlatesApi::LoadedFeatureCollections::LoadedFeatureCollections(
+		boost::python::list python_filenames) :
+	d_reconstruct_mutex(create_reconstruct_mutex())
+{
+	std::vector<QString> filenames;
+	const boost::python::ssize_t num_filenames = boost::python::len(python_filenames);
+	for (boost::python::ssize_t n = 0; n < num_filenames; ++n)
+	{
+		filenames.push_back(QString(boost::python::extract<const char *>(python_filenames[n])));
+	}
+
+	// Release the GIL while loading (other Python threads can run in the meantime).
+	PythonInterpreterUnlocker interpreter_unlocker;
+
+	// The registry is only needed for reading the files.
+	GPlatesFileIO::FeatureCollectionFileFormat::Registry file_format_registry;
+	d_feature_collections = GPlatesDataMining::DataMiningUtils::load_files(
+			filenames,
+			d_files,
+			file_format_registry);
+}
+
+
+GPlatesApi::LoadedFeatureCollections::~LoadedFeatureCollections()
+{
+	// Unloading the features deactivates the weak references of any Python wrappers still referencing them.
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
+	d_feature_collections.clear();
+	d_files.clear();
+}
+
+
+boost::python::list
+GPlatesApi::LoadedFeatureCollections::feature_collections() const
+{
+	boost::python::list python_feature_collections;
+
+	// Wait for any reconstruction of these feature collections (on another thread) to finish.
+	ReconstructLocker reconstruct_locker(d_reconstruct_mutex);
+
+	BOOST_FOREACH(
+			const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection,
+			d_feature_collections)
+	{
+		python_feature_collections.append(
+				FeatureCollection::create(feature_collection, d_reconstruct_mutex));
+	}
+
+	return python_feature_collections;
+}
+
+
+void
+export_loaded_feature_collections()
+{
+	using namespace boost::python;
+
+	class_<GPlatesApi::LoadedFeatureCollections, boost::noncopyable>(
+			"LoadedFeatureCollections",
+			init<list>())
+		.def("feature_collections", &GPlatesApi::LoadedFeatureCollections::feature_collections)
+		;
+}
@@ -0,0 +1,122 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_API_PYLOADEDFEATURECOLLECTIONS_H
+#define GPLATES_API_PYLOADEDFEATURECOLLECTIONS_H
+
+#include <vector>
+
+#include "PyReconstructLock.h"
+
+#include "global/python.h"
+
+#include "file-io/File.h"
+
+#include "model/FeatureCollectionHandle.h"
+
+
+namespace GPlatesApi
+{
+	/**
+	 * Feature collections loaded from files that remain loaded for the lifetime of this object.
+	 *
+	 * This enables Python scripts to load reconstructable files once and then reconstruct them
+	 * to many reconstruction times (instead of re-loading them for each reconstruction time).
+	 */
+	class LoadedFeatureCollections
+	{
+	public:
+
+		/**
+		 * Loads the feature collections from the files @a python_filenames (a list of strings).
+		 *
+		 * The files are loaded with the GIL released.
+		 */
+		explicit
+		LoadedFeatureCollections(
+				boost::python::list python_filenames);
+
+		/**
+		 * Unloads the feature collections (with this model's mutex locked).
+		 */
+		~LoadedFeatureCollections();
+
+
+		/**
+		 * Returns the loaded feature collections (in the order their files were specified).
+		 */
+		const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &
+		get_feature_collections() const
+		{
+			return d_feature_collections;
+		}
+
+		/**
+		 * Returns the loaded files (in the order they were specified).
+		 */
+		const std::vector<GPlatesFileIO::File::non_null_ptr_type> &
+		get_files() const
+		{
+			return d_files;
+		}
+
+		/**
+		 * Returns the loaded feature collections as a Python list of @a FeatureCollection.
+		 *
+		 * This blocks (with the GIL released) until any C++ reconstruction using these feature
+		 * collections has finished (such as one started by 'reconstruct_times_async').
+		 * The returned feature collections should not be modified while such a reconstruction is in progress.
+		 */
+		boost::python::list
+		feature_collections() const;
+
+		/**
+		 * Returns the mutex that C++ code must lock while it accesses these feature collections
+		 * with the GIL released (for example, when reconstructing them on another thread).
+		 *
+		 * The Python wrappers of these feature collections (and their features) also lock it.
+		 *
+		 * If more than one instance is locked then this instance should be locked first
+		 * (before the @a RotationModel).
+		 */
+		const reconstruct_mutex_ptr_type &
+		get_reconstruct_mutex() const
+		{
+			return d_reconstruct_mutex;
+		}
+
+	private:
+
+		//! Guards access to the loaded feature collections (see @a get_reconstruct_mutex).
+		reconstruct_mutex_ptr_type d_reconstruct_mutex;
+
+		//! The loaded files (these own the loaded feature collections).
+		std::vector<GPlatesFileIO::File::non_null_ptr_type> d_files;
+
+		std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> d_feature_collections;
+	};
+}
+
+#endif // GPLATES_API_PYLOADEDFEATURECOLLECTIONS_H
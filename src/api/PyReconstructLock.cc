@@ -0,0 +1,58 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+// Workaround for compile error in <pyport.h> for Python versions less than 2.7.13 and 3.5.3.
+// See https://bugs.python.org/issue10910
+// Workaround involves including "global/python.h" at the top of some source files
+// to ensure <Python.h> is included before <ctype.h>.
+#include "global/python.h"
+
+#include "PyReconstructLock.h"
+
+#include "PythonInterpreterUnlocker.h"
+
+
+GPlatesApi::reconstruct_mutex_ptr_type
+GPlatesApi::create_reconstruct_mutex()
+{
+	return reconstruct_mutex_ptr_type(new boost::recursive_mutex());
+}
+
+
+GPlatesApi::ReconstructLocker::ReconstructLocker(
+		const reconstruct_mutex_ptr_type &reconstruct_mutex)
+{
+	if (!reconstruct_mutex)
+	{
+		return;
+	}
+
+	d_lock = boost::unique_lock<boost::recursive_mutex>(*reconstruct_mutex, boost::defer_lock);
+
+	// Release the GIL while waiting (the lock holder might be waiting for the GIL).
+	PythonInterpreterUnlocker interpreter_unlocker;
+
+	d_lock.lock();
+}
@@ -0,0 +1,96 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_API_PYRECONSTRUCTLOCK_H
+#define GPLATES_API_PYRECONSTRUCTLOCK_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/recursive_mutex.hpp>
+
+
+namespace GPlatesApi
+{
+	/**
+	 * Serialises access to the features loaded by one Python API model - the files loaded by a
+	 * @a LoadedFeatureCollections (or by a @a RotationModel, which owns one).
+	 *
+	 * Each model has its own mutex, so operations on different models (such as concurrent
+	 * 'reconstruct_async' calls) run in parallel. That's possible because the state shared by
+	 * all models (the model's string sets) is internally thread-safe.
+	 *
+	 * So a model's mutex must be locked by:
+	 *  - operations on the model running with the GIL released (including those run by a 'Future'), and
+	 *  - the Python wrappers of the model's features and feature collections (including their
+	 *    copy/destruction since their weak references subscribe to the wrapped model objects).
+	 *
+	 * To avoid deadlock the GIL must never be held while *waiting* for this mutex - use
+	 * @a ReconstructLocker when the GIL is held. Holding this mutex while (re)acquiring the GIL is fine.
+	 *
+	 * It's a recursive mutex since entry points can call each other (and copy wrappers).
+	 *
+	 * The wrappers of features in the GPlates application model (when embedded in GPlates) have
+	 * no mutex. That model is accessed by the GUI thread (which doesn't lock a mutex), and no
+	 * 'Future' operation accesses it, so it's used by Python scripts just as it was before the
+	 * Python API could release the GIL.
+	 */
+	typedef boost::shared_ptr<boost::recursive_mutex> reconstruct_mutex_ptr_type;
+
+
+	/**
+	 * Creates the mutex of a new Python API model (see @a reconstruct_mutex_ptr_type).
+	 */
+	reconstruct_mutex_ptr_type
+	create_reconstruct_mutex();
+
+
+	/**
+	 * Locks a model's mutex for the lifetime of this object, from a thread holding the GIL.
+	 *
+	 * The GIL is released while waiting for the lock (so that other Python threads can run while,
+	 * for example, a 'Future' operation on the same model finishes) and is re-acquired before the
+	 * constructor returns.
+	 *
+	 * Nothing is locked (and the GIL is not released) if @a reconstruct_mutex is NULL.
+	 *
+	 * Precondition: The current thread must hold the GIL.
+	 */
+	class ReconstructLocker :
+			private boost::noncopyable
+	{
+	public:
+
+		explicit
+		ReconstructLocker(
+				const reconstruct_mutex_ptr_type &reconstruct_mutex);
+
+	private:
+
+		boost::unique_lock<boost::recursive_mutex> d_lock;
+	};
+}
+
+#endif // GPLATES_API_PYRECONSTRUCTLOCK_H
@@ -0,0 +1,62 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+// Workaround for compile error in <pyport.h> for Python versions less than 2.7.13 and 3.5.3.
+// See https://bugs.python.org/issue10910
+// Workaround involves including "global/python.h" at the top of some source files
+// to ensure <Python.h> is included before <ctype.h>.
+#include "global/python.h"
+
+#include "PyRotationModel.h"
+
+
+GPlatesApi::RotationModel::RotationModel(
+		boost::python::list python_rotation_filenames,
+		GPlatesModel::integer_plate_id_type anchor_plate_id,
+		unsigned int reconstruction_tree_cache_size) :
+	d_loaded_feature_collections(python_rotation_filenames),
+	d_anchor_plate_id(anchor_plate_id),
+	d_reconstruction_tree_creator(
+			GPlatesAppLogic::create_cached_reconstruction_tree_creator(
+					d_loaded_feature_collections.get_feature_collections(),
+					false/*extend_total_reconstruction_poles_to_distant_past*/,
+					anchor_plate_id,
+					reconstruction_tree_cache_size))
+{
+}
+
+
+void
+export_rotation_model()
+{
+	using namespace boost::python;
+
+	class_<GPlatesApi::RotationModel, boost::noncopyable>(
+			"RotationModel",
+			init< list, optional<GPlatesModel::integer_plate_id_type, unsigned int> >())
+		.def("feature_collections", &GPlatesApi::RotationModel::feature_collections)
+		.def("get_anchor_plate_id", &GPlatesApi::RotationModel::get_anchor_plate_id)
+		;
+}
@@ -0,0 +1,125 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_API_PYROTATIONMODEL_H
+#define GPLATES_API_PYROTATIONMODEL_H
+
+#include "PyLoadedFeatureCollections.h"
+
+#include "global/python.h"
+
+#include "app-logic/ReconstructionTreeCreator.h"
+
+#include "model/types.h"
+
+
+namespace GPlatesApi
+{
+	/**
+	 * Rotation (reconstruction) features loaded from files, and a cache of the reconstruction
+	 * trees created from them, that remain alive for the lifetime of this object.
+	 *
+	 * This enables Python scripts to reconstruct to many reconstruction times without re-loading
+	 * the rotation files (or re-building reconstruction trees) for each reconstruction time.
+	 */
+	class RotationModel
+	{
+	public:
+
+		/**
+		 * The default number of reconstruction trees cached.
+		 *
+		 * This is a single least-recently used cache (see CachedReconstructionTreeCreatorImpl), so
+		 * reconstructing to a sequence of times re-uses the trees of the most recent 16 times.
+		 */
+		static const unsigned int DEFAULT_RECONSTRUCTION_TREE_CACHE_SIZE = 16;
+
+
+		/**
+		 * Loads the rotation features from the files @a python_rotation_filenames (a list of strings).
+		 *
+		 * Like @a LoadedFeatureCollections, the files are loaded with the GIL released.
+		 */
+		explicit
+		RotationModel(
+				boost::python::list python_rotation_filenames,
+				GPlatesModel::integer_plate_id_type anchor_plate_id = 0,
+				unsigned int reconstruction_tree_cache_size = DEFAULT_RECONSTRUCTION_TREE_CACHE_SIZE);
+
+
+		//! Returns the loaded rotation files.
+		const LoadedFeatureCollections &
+		get_loaded_feature_collections() const
+		{
+			return d_loaded_feature_collections;
+		}
+
+		//! Returns the (cached) reconstruction tree creator.
+		const GPlatesAppLogic::ReconstructionTreeCreator &
+		get_reconstruction_tree_creator() const
+		{
+			return d_reconstruction_tree_creator;
+		}
+
+		GPlatesModel::integer_plate_id_type
+		get_anchor_plate_id() const
+		{
+			return d_anchor_plate_id;
+		}
+
+		/**
+		 * Returns the rotation feature collections as a Python list of @a FeatureCollection.
+		 *
+		 * Like LoadedFeatureCollections::feature_collections, this waits for any C++ reconstruction
+		 * using this rotation model to finish.
+		 */
+		boost::python::list
+		feature_collections() const
+		{
+			return d_loaded_feature_collections.feature_collections();
+		}
+
+		/**
+		 * Returns the mutex that C++ code must lock while it accesses the rotation features
+		 * (including creating reconstruction trees) with the GIL released.
+		 *
+		 * This is the mutex of the loaded rotation feature collections, so there's one per rotation model.
+		 * If a reconstructable @a LoadedFeatureCollections is also locked then it should be locked first.
+		 */
+		const reconstruct_mutex_ptr_type &
+		get_reconstruct_mutex() const
+		{
+			return d_loaded_feature_collections.get_reconstruct_mutex();
+		}
+
+	private:
+
+		LoadedFeatureCollections d_loaded_feature_collections;
+		GPlatesModel::integer_plate_id_type d_anchor_plate_id;
+		GPlatesAppLogic::ReconstructionTreeCreator d_reconstruction_tree_creator;
+	};
+}
+
+#endif // GPLATES_API_PYROTATIONMODEL_H
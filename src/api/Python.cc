@@ -25,6 +25,11 @@
 
 #include "global/python.h"
 
+#include "file-io/RotationAttributesRegistry.h"
+
+#include "model/Gpgim.h"
+#include "model/StringSetSingletons.h"
+
 //
 // Note: this .cc file has no corresponding .h file.
 //
@@ -34,6 +39,9 @@
 void export_console_reader();
 void export_console_writer();
 void export_feature_collection();
+void export_future();
+void export_loaded_feature_collections();
+void export_rotation_model();
 
 // presentation directory.
 void export_instance();
@@ -55,6 +63,12 @@ void export_coregistration_layer_proxy();
 
 BOOST_PYTHON_MODULE(pygplates)
 {
+	// Files can be loaded concurrently on Python threads (see 'reconstruct_async'), so create
+	// the process-wide model singletons now because their creation on first access is not thread-safe.
+	GPlatesModel::StringSetSingletons::create_instances();
+	GPlatesModel::Gpgim::instance();
+	GPlatesFileIO::RotationMetadataRegistry::instance();
+
 #ifdef GPLATES_PYTHON_EMBEDDING
 	// api directory.
 	export_console_reader();
@@ -73,6 +87,9 @@ BOOST_PYTHON_MODULE(pygplates)
 	export_coregistration_layer_proxy();
 #endif	
 	export_feature_collection();
+	export_future();
+	export_loaded_feature_collections();
+	export_rotation_model();
 	export_feature();
 	//export_co_registration();
 	export_functions();
@@ -51,6 +51,7 @@
 
 #include "model/NotificationGuard.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
 namespace
@@ -66,6 +67,12 @@ namespace
 	}
 
 
+	/**
+	 * User preference for the number of threads used by parallel algorithms (zero means number of processor cores).
+	 */
+	const QString NUM_WORKER_THREADS_USER_PREFERENCE_KEY = "app_logic/num_worker_threads";
+
+
 	bool
 	has_anchor_plate_id_changed(
 			GPlatesModel::integer_plate_id_type old_anchor_plate_id,
@@ -110,6 +117,9 @@ GPlatesAppLogic::ApplicationState::ApplicationState() :
 
 	mediate_signal_slot_connections();
 
+	// Set the number of threads used by parallel algorithms (eg, reconstructing using topologies).
+	handle_user_preference_changed(NUM_WORKER_THREADS_USER_PREFERENCE_KEY);
+
 	// Register a model callback so we can reconstruct whenever the feature store is modified.
 	d_callback_feature_store.attach_callback(new FeatureStoreIsModified(*this));
 }
@@ -441,6 +451,22 @@ GPlatesAppLogic::ApplicationState::find_current_topological_sections() const
 }
 
 
+void
+GPlatesAppLogic::ApplicationState::handle_user_preference_changed(
+		QString key)
+{
+	if (key == NUM_WORKER_THREADS_USER_PREFERENCE_KEY)
+	{
+		bool ok = false;
+		const int num_worker_threads = get_user_preferences().get_value(key).toInt(&ok);
+
+		// Zero (or an invalid value) means use the number of processor cores.
+		GPlatesUtils::ParallelUtils::set_num_worker_threads(
+				(ok && num_worker_threads > 0) ? num_worker_threads : 0);
+	}
+}
+
+
 void
 GPlatesAppLogic::ApplicationState::mediate_signal_slot_connections()
 {
@@ -473,6 +499,15 @@ GPlatesAppLogic::ApplicationState::mediate_signal_slot_connections()
 			SLOT(handle_file_state_changed(
 					GPlatesAppLogic::FeatureCollectionFileState &)));
 
+	//
+	// Apply user preferences that affect application logic when they change.
+	//
+	QObject::connect(
+			d_user_preferences_ptr.get(),
+			SIGNAL(key_value_updated(QString)),
+			this,
+			SLOT(handle_user_preference_changed(QString)));
+
 	//
 	// Perform a new reconstruction whenever layers are modified.
 	//
@@ -420,6 +420,10 @@ namespace GPlatesAppLogic
 		handle_file_state_changed(
 				GPlatesAppLogic::FeatureCollectionFileState &file_state);
 
+		void
+		handle_user_preference_changed(
+				QString key);
+
 	private:
 
 		/**
@@ -23,6 +23,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <boost/foreach.hpp>
 
 #include "AssignPlateIds.h"
@@ -46,8 +47,35 @@
 
 #include "model/NotificationGuard.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
+
+namespace GPlatesAppLogic
+{
+	namespace
+	{
+		/**
+		 * A feature extracted by a partition task (waiting to be partitioned and assigned the results).
+		 */
+		struct ExtractedFeature
+		{
+			ExtractedFeature(
+					unsigned int feature_index_,
+					PartitionFeatureTask &partition_feature_task_,
+					const PartitionFeatureTask::extracted_feature_ptr_type &extracted_feature_) :
+				feature_index(feature_index_),
+				partition_feature_task(&partition_feature_task_),
+				extracted_feature(extracted_feature_)
+			{  }
+
+			unsigned int feature_index;
+			PartitionFeatureTask *partition_feature_task;
+			PartitionFeatureTask::extracted_feature_ptr_type extracted_feature;
+		};
+	}
+}
+
 const GPlatesAppLogic::AssignPlateIds::feature_property_flags_type
 		GPlatesAppLogic::AssignPlateIds::RECONSTRUCTION_PLATE_ID_PROPERTY_FLAG =
 				GPlatesAppLogic::AssignPlateIds::feature_property_flags_type().set(
@@ -68,7 +96,8 @@ GPlatesAppLogic::AssignPlateIds::AssignPlateIds(
 			ReconstructParams(),
 			default_reconstruction_tree_creator),
 	d_reconstruction_time(reconstruction_time),
-	d_respect_feature_time_period(respect_feature_time_period)
+	d_respect_feature_time_period(respect_feature_time_period),
+	d_num_worker_threads(0)
 {
 	ReconstructMethodRegistry reconstruct_method_registry;
 
@@ -107,7 +136,8 @@ GPlatesAppLogic::AssignPlateIds::AssignPlateIds(
 			ReconstructParams(),
 			default_reconstruction_tree_creator),
 	d_reconstruction_time(reconstruction_time),
-	d_respect_feature_time_period(respect_feature_time_period)
+	d_respect_feature_time_period(respect_feature_time_period),
+	d_num_worker_threads(0)
 {
 	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
 			!partitioning_layer_proxies.empty(),
@@ -206,15 +236,20 @@ GPlatesAppLogic::AssignPlateIds::assign_reconstruction_plate_ids(
 		return;
 	}
 
+	// Note that any features created (by partitioning) get added to the feature collection
+	// but they are not themselves partitioned.
+	std::vector<GPlatesModel::FeatureHandle::weak_ref> feature_refs;
 	GPlatesModel::FeatureCollectionHandle::iterator feature_iter = feature_collection_ref->begin();
 	GPlatesModel::FeatureCollectionHandle::iterator feature_end = feature_collection_ref->end();
 	for ( ; feature_iter != feature_end; ++feature_iter)
 	{
-		assign_reconstruction_plate_id(
-				(*feature_iter)->reference(),
-				feature_collection_ref,
-				reconstruct_method_context);
+		feature_refs.push_back((*feature_iter)->reference());
 	}
+
+	assign_reconstruction_plate_ids(
+			feature_refs,
+			feature_collection_ref,
+			reconstruct_method_context);
 }
 
 
@@ -224,19 +259,12 @@ GPlatesAppLogic::AssignPlateIds::assign_reconstruction_plate_ids(
 		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
 		boost::optional<const ReconstructMethodInterface::Context &> reconstruct_method_context)
 {
-	typedef std::vector<GPlatesModel::FeatureHandle::weak_ref> feature_ref_seq_type;
-
-	for (feature_ref_seq_type::const_iterator feature_ref_iter = feature_refs.begin();
-		feature_ref_iter != feature_refs.end();
-		++feature_ref_iter)
-	{
-		const GPlatesModel::FeatureHandle::weak_ref &feature_ref = *feature_ref_iter;
-
-		assign_reconstruction_plate_id(
-				feature_ref,
-				feature_collection_ref,
-				reconstruct_method_context);
-	}
+	assign_reconstruction_plate_ids_internal(
+			feature_refs,
+			feature_collection_ref,
+			reconstruct_method_context
+				? reconstruct_method_context.get()
+				: d_default_reconstruct_method_context);
 }
 
 
@@ -255,6 +283,101 @@ GPlatesAppLogic::AssignPlateIds::assign_reconstruction_plate_id(
 }
 
 
+void
+GPlatesAppLogic::AssignPlateIds::assign_reconstruction_plate_ids_internal(
+		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &feature_refs,
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
+		const ReconstructMethodInterface::Context &reconstruct_method_context)
+{
+	const unsigned int num_worker_threads = (d_num_worker_threads != 0)
+			? d_num_worker_threads
+			: GPlatesUtils::ParallelUtils::get_num_worker_threads();
+
+	// If there's only one thread then partition, and assign to, one feature at a time.
+	if (num_worker_threads <= 1 ||
+		feature_refs.size() <= 1)
+	{
+		BOOST_FOREACH(const GPlatesModel::FeatureHandle::weak_ref &feature_ref, feature_refs)
+		{
+			assign_reconstruction_plate_id_internal(
+					feature_ref,
+					feature_collection_ref,
+					reconstruct_method_context);
+		}
+
+		return;
+	}
+
+	PROFILE_FUNC();
+
+	// The partitioning polygons must not set up their point-in-polygon structures on demand
+	// while being used by multiple threads.
+	d_geometry_cookie_cutter->prepare_for_concurrent_partitioning();
+
+	// Process the features in batches to limit the memory used by the partitioned results.
+	const unsigned int num_features = feature_refs.size();
+	for (unsigned int batch_begin = 0; batch_begin < num_features; batch_begin += MAX_FEATURES_PER_PARTITION_BATCH)
+	{
+		const unsigned int batch_end = (std::min)(batch_begin + MAX_FEATURES_PER_PARTITION_BATCH, num_features);
+
+		// Extract the features in the current batch.
+		// This accesses the model (which is not thread-safe) so it's done on the calling thread.
+		std::vector<ExtractedFeature> extracted_features;
+		for (unsigned int feature_index = batch_begin; feature_index < batch_end; ++feature_index)
+		{
+			const GPlatesModel::FeatureHandle::weak_ref &feature_ref = feature_refs[feature_index];
+			if (!feature_ref.is_valid())
+			{
+				continue;
+			}
+
+			boost::optional<PartitionFeatureTask &> partition_feature_task = get_partition_feature_task(feature_ref);
+			if (!partition_feature_task)
+			{
+				continue;
+			}
+
+			const PartitionFeatureTask::extracted_feature_ptr_type extracted_feature =
+					partition_feature_task->extract_feature(
+							feature_ref,
+							*d_geometry_cookie_cutter,
+							d_respect_feature_time_period);
+			if (extracted_feature)
+			{
+				extracted_features.push_back(
+						ExtractedFeature(feature_index, partition_feature_task.get(), extracted_feature));
+			}
+		}
+
+		// Partition the extracted features concurrently (this does not access the model).
+		GPlatesUtils::ParallelUtils::parallel_for(
+				extracted_features.size(),
+				[&](unsigned int extracted_feature_index)
+				{
+					extracted_features[extracted_feature_index].extracted_feature->partition();
+				},
+				num_worker_threads);
+
+		// Assign the partitioned results to the features on the calling thread (in the original feature order).
+		BOOST_FOREACH(const ExtractedFeature &extracted_feature, extracted_features)
+		{
+			const GPlatesModel::FeatureHandle::weak_ref &feature_ref = feature_refs[extracted_feature.feature_index];
+
+			// Merge model events across this scope to avoid excessive number of model callbacks
+			// due to modifying features by partitioning them.
+			GPlatesModel::NotificationGuard model_notification_guard(*feature_ref->model_ptr());
+
+			extracted_feature.partition_feature_task->assign_extracted_feature(
+					*extracted_feature.extracted_feature,
+					feature_ref,
+					feature_collection_ref,
+					reconstruct_method_context,
+					d_reconstruction_time);
+		}
+	}
+}
+
+
 void
 GPlatesAppLogic::AssignPlateIds::assign_reconstruction_plate_id_internal(
 		const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
@@ -270,6 +393,24 @@ GPlatesAppLogic::AssignPlateIds::assign_reconstruction_plate_id_internal(
 	// due to modifying features by partitioning them.
 	GPlatesModel::NotificationGuard model_notification_guard(*feature_ref->model_ptr());
 
+	boost::optional<PartitionFeatureTask &> assign_task = get_partition_feature_task(feature_ref);
+	if (assign_task)
+	{
+		assign_task->partition_feature(
+				feature_ref,
+				feature_collection_ref,
+				*d_geometry_cookie_cutter,
+				reconstruct_method_context,
+				d_reconstruction_time,
+				d_respect_feature_time_period);
+	}
+}
+
+
+boost::optional<GPlatesAppLogic::PartitionFeatureTask &>
+GPlatesAppLogic::AssignPlateIds::get_partition_feature_task(
+		const GPlatesModel::FeatureHandle::weak_ref &feature_ref) const
+{
 	// Iterate through the tasks until we find one that can partition the feature.
 	partition_feature_task_ptr_seq_type::const_iterator assign_task_iter = d_partition_feature_tasks.begin();
 	partition_feature_task_ptr_seq_type::const_iterator assign_task_end = d_partition_feature_tasks.end();
@@ -279,15 +420,9 @@ GPlatesAppLogic::AssignPlateIds::assign_reconstruction_plate_id_internal(
 
 		if (assign_task->can_partition_feature(feature_ref))
 		{
-			assign_task->partition_feature(
-					feature_ref,
-					feature_collection_ref,
-					*d_geometry_cookie_cutter,
-					reconstruct_method_context,
-					d_reconstruction_time,
-					d_respect_feature_time_period);
-
-			return;
+			return *assign_task;
 		}
 	}
+
+	return boost::none;
 }
@@ -303,7 +303,44 @@ namespace GPlatesAppLogic
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
 				boost::optional<const ReconstructMethodInterface::Context &> reconstruct_method_context = boost::none);
 
+
+		/**
+		 * Sets the number of threads used to partition features by @a assign_reconstruction_plate_ids.
+		 *
+		 * A value of zero (the default) means use 'GPlatesUtils::ParallelUtils::get_num_worker_threads()'.
+		 * A value of one partitions, and assigns to, one feature at a time on the calling thread.
+		 *
+		 * Only the partitioning of feature geometries is done concurrently. The features are still read
+		 * and modified on the calling thread (in their original order), so the results do not depend
+		 * on the number of threads.
+		 */
+		void
+		set_num_worker_threads(
+				unsigned int num_worker_threads)
+		{
+			d_num_worker_threads = num_worker_threads;
+		}
+
+		/**
+		 * Returns the number of threads used to partition features (zero means the global default).
+		 */
+		unsigned int
+		get_num_worker_threads() const
+		{
+			return d_num_worker_threads;
+		}
+
 	private:
+
+		/**
+		 * The maximum number of features that are partitioned together by
+		 * @a assign_reconstruction_plate_ids_internal before being assigned the results.
+		 *
+		 * This limits the memory used by the partitioned results.
+		 */
+		static const unsigned int MAX_FEATURES_PER_PARTITION_BATCH = 1024;
+
+
 		/**
 		 * The method used to assign plate ids to features.
 		 */
@@ -341,6 +378,11 @@ namespace GPlatesAppLogic
 		 */
 		bool d_respect_feature_time_period;
 
+		/**
+		 * The number of threads used to partition features (zero means the global default).
+		 */
+		unsigned int d_num_worker_threads;
+
 
 		/**
 		 * Create an internal @a Reconstruction using @a partitioning_feature_collections,
@@ -377,11 +419,27 @@ namespace GPlatesAppLogic
 				bool verify_information_model,
 				bool respect_feature_time_period);
 
+		/**
+		 * Assigns to multiple features, partitioning them concurrently if more than one thread is used.
+		 */
+		void
+		assign_reconstruction_plate_ids_internal(
+				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &feature_refs,
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
+				const ReconstructMethodInterface::Context &reconstruct_method_context);
+
 		void
 		assign_reconstruction_plate_id_internal(
 				const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
 				const ReconstructMethodInterface::Context &reconstruct_method_context);
+
+		/**
+		 * Returns the first task that can partition @a feature_ref (if any).
+		 */
+		boost::optional<PartitionFeatureTask &>
+		get_partition_feature_task(
+				const GPlatesModel::FeatureHandle::weak_ref &feature_ref) const;
 	};
 }
 
@@ -40,3 +40,19 @@ GPlatesAppLogic::CoRegistrationLayerParams::set_cfg_table(
 	Q_EMIT modified_cfg_table(*this);
 	emit_modified();
 }
+
+
+void
+GPlatesAppLogic::CoRegistrationLayerParams::set_num_worker_threads(
+		unsigned int num_worker_threads)
+{
+	if (d_num_worker_threads == num_worker_threads)
+	{
+		return;
+	}
+
+	d_num_worker_threads = num_worker_threads;
+
+	Q_EMIT modified_num_worker_threads(*this);
+	emit_modified();
+}
@@ -75,6 +75,27 @@ namespace GPlatesAppLogic
 				const GPlatesDataMining::CoRegConfigurationTable &table);
 
 
+		/**
+		 * Returns the number of threads used to co-register seed features with target geometries.
+		 *
+		 * A value of zero (the default) means use 'GPlatesUtils::ParallelUtils::get_num_worker_threads()'.
+		 */
+		unsigned int
+		get_num_worker_threads() const
+		{
+			return d_num_worker_threads;
+		}
+
+		/**
+		 * Sets the number of threads used to co-register seed features with target geometries.
+		 *
+		 * Emits signals 'modified_num_worker_threads' and 'modified' if a change detected.
+		 */
+		void
+		set_num_worker_threads(
+				unsigned int num_worker_threads);
+
+
 		/**
 		 * Override of virtual method in LayerParams base.
 		 */
@@ -106,12 +127,21 @@ namespace GPlatesAppLogic
 		modified_cfg_table(
 				GPlatesAppLogic::CoRegistrationLayerParams &layer_params);
 
+		/**
+		 * Emitted when @a set_num_worker_threads has been called (if a change detected).
+		 */
+		void
+		modified_num_worker_threads(
+				GPlatesAppLogic::CoRegistrationLayerParams &layer_params);
+
 	private:
 
 		GPlatesDataMining::CoRegConfigurationTable d_cfg_table;
+		unsigned int d_num_worker_threads;
 
 
-		CoRegistrationLayerParams()
+		CoRegistrationLayerParams() :
+			d_num_worker_threads(0)
 		{  }
 	};
 }
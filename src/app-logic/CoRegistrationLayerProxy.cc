@@ -43,7 +43,8 @@
 #include "utils/FeatureUtils.h"
 
 GPlatesAppLogic::CoRegistrationLayerProxy::CoRegistrationLayerProxy() :
-	d_current_reconstruction_time(0)
+	d_current_reconstruction_time(0),
+	d_current_num_worker_threads(0)
 {
 	// Defined in ".cc" file because...
 	// non_null_ptr destructors require complete type of class they're referring to.
@@ -117,7 +118,8 @@ GPlatesAppLogic::CoRegistrationLayerProxy::get_coregistration_data(
 		// Does the actual co-registration work.
 		boost::shared_ptr<GPlatesDataMining::DataSelector> selector =
 				GPlatesDataMining::DataSelector::create(
-						d_current_coregistration_configuration_table);
+						d_current_coregistration_configuration_table,
+						d_current_num_worker_threads);
 
 		// Co-register rasters if we can (if the run-time system supports it).
 		boost::optional<GPlatesDataMining::DataSelector::RasterCoRegistration> co_register_rasters;
@@ -245,7 +247,8 @@ GPlatesAppLogic::CoRegistrationLayerProxy::get_birth_attribute_data(
 	// Does the actual co-registration work.
 	boost::shared_ptr<GPlatesDataMining::DataSelector> selector =
 			GPlatesDataMining::DataSelector::create(
-					d_current_coregistration_configuration_table);
+					d_current_coregistration_configuration_table,
+					d_current_num_worker_threads);
 	
 	// Fill the co-registration data table with results.
 	selector->select(
@@ -240,6 +240,30 @@ namespace GPlatesAppLogic
 			return d_current_coregistration_configuration_table;
 		}
 
+		/**
+		 * Sets the number of threads used to co-register seed features with target geometries.
+		 *
+		 * A value of zero means use 'GPlatesUtils::ParallelUtils::get_num_worker_threads()'.
+		 *
+		 * This does not invalidate any cached co-registration data since the results do not
+		 * depend on the number of threads.
+		 */
+		void
+		set_current_num_worker_threads(
+				unsigned int num_worker_threads)
+		{
+			d_current_num_worker_threads = num_worker_threads;
+		}
+
+		/**
+		 * Returns the number of threads used to co-register seed features with target geometries.
+		 */
+		unsigned int
+		get_current_num_worker_threads() const
+		{
+			return d_current_num_worker_threads;
+		}
+
 	private:
 
 		/**
@@ -267,6 +291,11 @@ namespace GPlatesAppLogic
 		 */
 		double d_current_reconstruction_time;
 
+		/**
+		 * The number of threads used to co-register (zero means the global default).
+		 */
+		unsigned int d_current_num_worker_threads;
+
 		/**
 		 * Used to co-register rasters.
 		 *
@@ -46,6 +46,9 @@ GPlatesAppLogic::CoRegistrationLayerTask::CoRegistrationLayerTask() :
 	QObject::connect(
 			d_layer_params.get(), SIGNAL(modified_cfg_table(GPlatesAppLogic::CoRegistrationLayerParams &)),
 			this, SLOT(handle_cfg_table_modified(GPlatesAppLogic::CoRegistrationLayerParams &)));
+	QObject::connect(
+			d_layer_params.get(), SIGNAL(modified_num_worker_threads(GPlatesAppLogic::CoRegistrationLayerParams &)),
+			this, SLOT(handle_num_worker_threads_modified(GPlatesAppLogic::CoRegistrationLayerParams &)));
 }
 
 
@@ -247,3 +250,12 @@ GPlatesAppLogic::CoRegistrationLayerTask::handle_cfg_table_modified(
 	// Update our co-registration layer proxy.
 	d_coregistration_layer_proxy->set_current_coregistration_configuration_table(layer_params.get_cfg_table());
 }
+
+
+void
+GPlatesAppLogic::CoRegistrationLayerTask::handle_num_worker_threads_modified(
+		CoRegistrationLayerParams &layer_params)
+{
+	// Update our co-registration layer proxy.
+	d_coregistration_layer_proxy->set_current_num_worker_threads(layer_params.get_num_worker_threads());
+}
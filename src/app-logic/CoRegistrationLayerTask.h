@@ -148,6 +148,10 @@ namespace GPlatesAppLogic
 		handle_cfg_table_modified(
 				GPlatesAppLogic::CoRegistrationLayerParams &layer_params);
 
+		void
+		handle_num_worker_threads_modified(
+				GPlatesAppLogic::CoRegistrationLayerParams &layer_params);
+
 	private:
 		CoRegistrationLayerParams::non_null_ptr_type d_layer_params;
 
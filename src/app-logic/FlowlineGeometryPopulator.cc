@@ -35,6 +35,7 @@
 #include "Reconstruction.h"
 #include "ReconstructedFlowline.h"
 #include "ReconstructionGeometryUtils.h"
+#include "ReconstructionRotationTable.h"
 #include "ReconstructionTree.h"
 #include "RotationUtils.h"
 
@@ -173,38 +174,28 @@ GPlatesAppLogic::FlowlineGeometryPopulator::initialise_pre_feature_properties(
 			current_time,
 			d_flowline_property_finder->get_times());
 
-		// We'll work from the current time, backwards in time.
-		std::vector<double>::const_iterator
-			iter = times.begin(),
-			end = times.end();
-
-		// Save the "previous" tree for use in the loop.
-		GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_prev_time_ptr =
-				d_reconstruction_tree_creator.get_reconstruction_tree(*iter);
+		// Calculate the rotations at all times in one pass (rather than creating a reconstruction tree per time).
+		const ReconstructionRotationTable::non_null_ptr_to_const_type rotation_table =
+				ReconstructionRotationTable::create(d_reconstruction_tree_creator, times);
 
-		// Step forward beyond the current time
-		++iter;
-
-		for (; iter != end ; ++iter)
+		// We'll work from the current time, backwards in time.
+		for (unsigned int time_index = 1; time_index < times.size(); ++time_index)
 		{
-
-			GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_time_t_ptr =
-				d_reconstruction_tree_creator.get_reconstruction_tree(*iter);
-
-
 			// The stage pole for the right plate w.r.t. the left plate
 			GPlatesMaths::FiniteRotation stage_pole_left =
 				GPlatesAppLogic::RotationUtils::get_stage_pole(
-				*tree_at_prev_time_ptr,
-				*tree_at_time_t_ptr,
+				*rotation_table,
+				time_index - 1,
+				time_index,
 				*d_flowline_property_finder->get_right_plate(),
 				*d_flowline_property_finder->get_left_plate());
 
 
 			GPlatesMaths::FiniteRotation stage_pole_right =
 				GPlatesAppLogic::RotationUtils::get_stage_pole(
-				*tree_at_prev_time_ptr,
-				*tree_at_time_t_ptr,
+				*rotation_table,
+				time_index - 1,
+				time_index,
 				*d_flowline_property_finder->get_left_plate(),
 				*d_flowline_property_finder->get_right_plate());
 
@@ -214,9 +205,6 @@ GPlatesAppLogic::FlowlineGeometryPopulator::initialise_pre_feature_properties(
 
 			d_left_rotations.push_back(stage_pole_left);
 			d_right_rotations.push_back(stage_pole_right);
-
-			tree_at_prev_time_ptr = tree_at_time_t_ptr;
-
 		}
     }
     return true;
@@ -31,6 +31,7 @@
 #include "FlowlineUtils.h"
 
 #include "app-logic/AppLogicUtils.h"
+#include "app-logic/ReconstructionRotationTable.h"
 #include "app-logic/ReconstructionTree.h"
 #include "app-logic/RotationUtils.h"
 #include "maths/FiniteRotation.h"
@@ -411,35 +412,36 @@ GPlatesAppLogic::FlowlineUtils::fill_seed_point_rotations(
 	const ReconstructionTreeCreator &reconstruction_tree_creator,
     std::vector<GPlatesMaths::FiniteRotation> &seed_point_rotations)
 {
-	// The reconstruction tree for the current reconstruction time.
-	ReconstructionTree::non_null_ptr_to_const_type reconstruction_tree =
-			reconstruction_tree_creator.get_reconstruction_tree(current_time);
-
-    std::vector<double>::const_iterator
-            t_iter = flowline_times.begin(),
-            t_prev_iter = flowline_times.begin();
-
-    ++t_iter;
-
     if (current_time > flowline_times.back())
     {
         return;
     }
 
-    for (; *t_iter < current_time; ++t_iter, ++t_prev_iter)
+    // The flowline times younger than the current time (and always the first flowline time),
+    // followed by the current time.
+    std::vector<double> rotation_times(1, flowline_times.front());
+
+    std::vector<double>::const_iterator t_iter = flowline_times.begin();
+    for (++t_iter; *t_iter < current_time; ++t_iter)
     {
+        rotation_times.push_back(*t_iter);
+    }
 
-        GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_time_t_ptr =
-                reconstruction_tree_creator.get_reconstruction_tree(*t_iter);
+    const unsigned int num_flowline_times = rotation_times.size();
+    rotation_times.push_back(current_time);
 
-        GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_prev_time_ptr =
-				reconstruction_tree_creator.get_reconstruction_tree(*t_prev_iter);
+    // Calculate the rotations at all times in one pass (rather than creating a reconstruction tree per time).
+    const ReconstructionRotationTable::non_null_ptr_to_const_type rotation_table =
+            ReconstructionRotationTable::create(reconstruction_tree_creator, rotation_times);
 
+    for (unsigned int time_index = 1; time_index < num_flowline_times; ++time_index)
+    {
         // The stage pole for the moving plate w.r.t. the fixed plate, from t_prev to t
         GPlatesMaths::FiniteRotation stage_pole =
                 GPlatesAppLogic::RotationUtils::get_stage_pole(
-                    *tree_at_prev_time_ptr,
-                    *tree_at_time_t_ptr,
+                    *rotation_table,
+                    time_index - 1,
+                    time_index,
                     right_plate_id,
                     left_plate_id);
 
@@ -450,19 +452,14 @@ GPlatesAppLogic::FlowlineUtils::fill_seed_point_rotations(
 
     }
 
-    if (*t_prev_iter < current_time)
+    if (rotation_times[num_flowline_times - 1] < current_time)
     {
         // And one more, from the last time reached to the current time.
-        GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_time_t_ptr =
- 				reconstruction_tree_creator.get_reconstruction_tree(*t_prev_iter);
-
-        GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_current_time_ptr =
- 				reconstruction_tree_creator.get_reconstruction_tree(current_time);
-
         GPlatesMaths::FiniteRotation stage_pole =
                 GPlatesAppLogic::RotationUtils::get_stage_pole(
-                    *tree_at_time_t_ptr,
-                    *tree_at_current_time_ptr,
+                    *rotation_table,
+                    num_flowline_times - 1,
+                    num_flowline_times/*current time*/,
                     right_plate_id,
                     left_plate_id);
 
@@ -541,28 +538,19 @@ GPlatesAppLogic::FlowlineUtils::correct_end_point_to_centre(
 
     // FIXME: This (almost) duplicates code from the FlowlineGeometryPopulator. Refactor.
 
-    // We'll work from the current time, backwards in time.
-    std::vector<double>::const_iterator
-	    iter = times.begin(),
-	    end = times.end();
+    // Calculate the rotations at all times in one pass (rather than creating a reconstruction tree per time).
+    // Note that the first time is the current reconstruction time.
+    const ReconstructionRotationTable::non_null_ptr_to_const_type rotation_table =
+	    ReconstructionRotationTable::create(reconstruction_tree_creator, times);
 
-    // Save the "previous" tree for use in the loop.
-    GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_prev_time_ptr =
-	    reconstruction_tree_creator.get_reconstruction_tree(*iter);
-
-    // Step forward beyond the current time
-    ++iter;
-
-    for (; iter != end ; ++iter)
+    // We'll work from the current time, backwards in time.
+    for (unsigned int time_index = 1; time_index < times.size(); ++time_index)
     {
-
-	    GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_time_t_ptr =
-		    reconstruction_tree_creator.get_reconstruction_tree(*iter);
-
 	    GPlatesMaths::FiniteRotation stage_pole =
 		    GPlatesAppLogic::RotationUtils::get_stage_pole(
-		    *tree_at_prev_time_ptr,
-		    *tree_at_time_t_ptr,
+		    *rotation_table,
+		    time_index - 1,
+		    time_index,
 		    plate_2,
 		    plate_1);
 
@@ -570,17 +558,10 @@ GPlatesAppLogic::FlowlineUtils::correct_end_point_to_centre(
 	    // Halve the stage pole and store it.
 	    FlowlineUtils::get_half_angle_rotation(stage_pole);
 	    flowline_rotations.push_back(stage_pole);
-
-	    tree_at_prev_time_ptr = tree_at_time_t_ptr;
-
     }
 
- 	// The reconstruction tree for the current reconstruction time.
-	ReconstructionTree::non_null_ptr_to_const_type reconstruction_tree =
-			reconstruction_tree_creator.get_reconstruction_tree(reconstruction_time);
-
     GPlatesMaths::FiniteRotation correction =
-	    reconstruction_tree->get_composed_absolute_rotation(plate_1);
+	    rotation_table->get_composed_absolute_rotation(0/*reconstruction_time*/, plate_1);
 
 
     geometry_ = get_reverse(correction) * geometry_;
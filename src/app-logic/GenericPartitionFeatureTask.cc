@@ -38,6 +38,36 @@
 #include "utils/Profile.h"
 
 
+namespace GPlatesAppLogic
+{
+	namespace
+	{
+		/**
+		 * The geometry properties of a feature extracted by @a GenericPartitionFeatureTask.
+		 */
+		class GenericExtractedFeature :
+				public PartitionFeatureTask::ExtractedFeature
+		{
+		public:
+
+			virtual
+			void
+			partition()
+			{
+				feature_geometry_partitioner->partition();
+			}
+
+
+			//! Partitions the feature's geometries.
+			boost::shared_ptr<PartitionFeatureUtils::FeatureGeometryPartitioner> feature_geometry_partitioner;
+
+			//! The geometry properties (and associated ranges) that are partitioned.
+			std::vector<GPlatesModel::FeatureHandle::iterator> partitioned_properties;
+		};
+	}
+}
+
+
 GPlatesAppLogic::GenericPartitionFeatureTask::GenericPartitionFeatureTask(
 		GPlatesAppLogic::AssignPlateIds::AssignPlateIdMethodType assign_plate_id_method,
 		const GPlatesAppLogic::AssignPlateIds::feature_property_flags_type &feature_property_types_to_assign,
@@ -49,44 +79,62 @@ GPlatesAppLogic::GenericPartitionFeatureTask::GenericPartitionFeatureTask(
 }
 
 
-void
-GPlatesAppLogic::GenericPartitionFeatureTask::partition_feature(
+GPlatesAppLogic::PartitionFeatureTask::extracted_feature_ptr_type
+GPlatesAppLogic::GenericPartitionFeatureTask::extract_feature(
 		const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
-		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
 		const GeometryCookieCutter &geometry_cookie_cutter,
-		const ReconstructMethodInterface::Context &reconstruct_method_context,
-		const double &reconstruction_time,
 		bool respect_feature_time_period)
 {
-	//PROFILE_FUNC();
-
-	// Merge model events across this scope to avoid excessive number of model callbacks.
-	GPlatesModel::NotificationGuard model_notification_guard(*feature_ref->model_ptr());
+	boost::shared_ptr<GenericExtractedFeature> extracted_feature(new GenericExtractedFeature());
 
-	// Partition the feature and get the partitioned results in return.
+	// Record the feature's geometry properties for partitioning.
 	//
 	// NOTE: This does not modify the feature referenced by 'feature_ref'.
 	// NOTE: We call this here before any modifications (such as removing geometry domain/range properties)
 	// are made to the feature - later on we can modify the feature knowing that we have all the partitioning results.
-	std::vector<GPlatesModel::FeatureHandle::iterator> partitioned_properties;
-	const boost::shared_ptr<const PartitionFeatureUtils::PartitionedFeature> partitioned_feature =
-			PartitionFeatureUtils::partition_feature(
+	extracted_feature->feature_geometry_partitioner =
+			PartitionFeatureUtils::FeatureGeometryPartitioner::create(
 					feature_ref,
 					geometry_cookie_cutter,
 					// Determines if partition feature wen not defined at the reconstruction time...
 					respect_feature_time_period,
-					partitioned_properties);
+					extracted_feature->partitioned_properties);
 
 	// If the feature being partitioned does not exist at the reconstruction time of
-	// the cookie cutter then return early and do nothing.
-	if (!partitioned_feature)
+	// the cookie cutter then there's nothing to partition.
+	if (!extracted_feature->feature_geometry_partitioner)
 	{
-		return;
+		return extracted_feature_ptr_type();
 	}
 
+	return extracted_feature;
+}
+
+
+void
+GPlatesAppLogic::GenericPartitionFeatureTask::assign_extracted_feature(
+		ExtractedFeature &extracted_feature,
+		const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
+		const ReconstructMethodInterface::Context &reconstruct_method_context,
+		const double &reconstruction_time)
+{
+	//PROFILE_FUNC();
+
+	GenericExtractedFeature &generic_extracted_feature = dynamic_cast<GenericExtractedFeature &>(extracted_feature);
+
+	// Merge model events across this scope to avoid excessive number of model callbacks.
+	GPlatesModel::NotificationGuard model_notification_guard(*feature_ref->model_ptr());
+
+	// Get the partitioned results.
+	const boost::shared_ptr<const PartitionFeatureUtils::PartitionedFeature> partitioned_feature =
+			generic_extracted_feature.feature_geometry_partitioner->get_partitioned_feature();
+
 	// Now that we've partitioned the feature's geometry properties we can strip off all
 	// geometry properties (and associated scalar coverages) from the feature.
 	// This is so we can add new geometry properties later using the above partitioned information.
+	const std::vector<GPlatesModel::FeatureHandle::iterator> &partitioned_properties =
+			generic_extracted_feature.partitioned_properties;
 	for (unsigned int n = 0; n < partitioned_properties.size(); ++n)
 	{
 		feature_ref->remove(partitioned_properties[n]);
@@ -66,15 +66,22 @@ namespace GPlatesAppLogic
 		}
 
 
+		virtual
+		extracted_feature_ptr_type
+		extract_feature(
+				const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+				const GeometryCookieCutter &geometry_cookie_cutter,
+				bool respect_feature_time_period);
+
+
 		virtual
 		void
-		partition_feature(
+		assign_extracted_feature(
+				ExtractedFeature &extracted_feature,
 				const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
 				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
-				const GeometryCookieCutter &geometry_cookie_cutter,
 				const ReconstructMethodInterface::Context &reconstruct_method_context,
-				const double &reconstruction_time,
-				bool respect_feature_time_period);
+				const double &reconstruction_time);
 
 	private:
 		bool d_verify_information_model;
@@ -45,6 +45,7 @@
 #include "global/GPlatesAssert.h"
 
 #include "maths/ConstGeometryOnSphereVisitor.h"
+#include "maths/CubeQuadTreePartitionUtils.h"
 
 #include "model/FeatureVisitor.h"
 
@@ -106,6 +107,8 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 		boost::optional<const std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &> resolved_topological_networks,
 		boost::optional<SortPlates> sort_plates,
 		GPlatesMaths::PolygonOnSphere::PointInPolygonSpeedAndMemory partition_point_speed_and_memory) :
+	d_partitioning_geometry_spatial_partition(
+			partitioning_geometry_spatial_partition_type::create(PARTITIONING_GEOMETRY_SPATIAL_PARTITION_DEPTH)),
 	d_reconstruction_time(reconstruction_time),
 	d_partition_point_speed_and_memory(partition_point_speed_and_memory)
 {
@@ -125,6 +128,8 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 	{
 		add_partitioning_reconstructed_feature_polygons(reconstructed_static_polygons.get(), sort_plates);
 	}
+
+	build_partitioning_geometry_spatial_partition();
 }
 
 
@@ -134,6 +139,8 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 		bool group_networks_then_boundaries_then_static_polygons,
 		boost::optional<SortPlates> sort_plates,
 		GPlatesMaths::PolygonOnSphere::PointInPolygonSpeedAndMemory partition_point_speed_and_memory) :
+	d_partitioning_geometry_spatial_partition(
+			partitioning_geometry_spatial_partition_type::create(PARTITIONING_GEOMETRY_SPATIAL_PARTITION_DEPTH)),
 	d_reconstruction_time(reconstruction_time),
 	d_partition_point_speed_and_memory(partition_point_speed_and_memory)
 {
@@ -164,6 +171,8 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 	{
 		add_partitioning_reconstruction_geometries(reconstruction_geometries, sort_plates);
 	}
+
+	build_partitioning_geometry_spatial_partition();
 }
 
 
@@ -175,6 +184,8 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 		bool group_networks_then_boundaries_then_static_polygons,
 		boost::optional<SortPlates> sort_plates,
 		GPlatesMaths::PolygonOnSphere::PointInPolygonSpeedAndMemory partition_point_speed_and_memory) :
+	d_partitioning_geometry_spatial_partition(
+			partitioning_geometry_spatial_partition_type::create(PARTITIONING_GEOMETRY_SPATIAL_PARTITION_DEPTH)),
 	d_reconstruction_time(reconstruction_time),
 	d_partition_point_speed_and_memory(partition_point_speed_and_memory)
 {
@@ -203,7 +214,9 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 					reconstruction_tree_creator, 
 					reconstruction_time,
 					// Resolved topo lines use the reconstructed non-topo geometries...
-					reconstruct_handles);
+					reconstruct_handles,
+					boost::none/*topological_lines_referenced*/,
+					0/*num_worker_threads: use the default number of threads*/);
 	reconstruct_handles.push_back(resolved_topological_lines_handle);
 
 	// Contains the resolved topological polygons used for cookie-cutting.
@@ -214,7 +227,8 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 			reconstruction_tree_creator, 
 			reconstruction_time,
 			// Resolved topo boundaries use the resolved topo lines *and* the reconstructed non-topo geometries...
-			reconstruct_handles);
+			reconstruct_handles,
+			0/*num_worker_threads: use the default number of threads*/);
 
 	// Contains the resolved topological networks used for cookie-cutting.
 	// See comment in header for why a deforming region is currently used to assign plate ids.
@@ -224,7 +238,9 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 			reconstruction_time,
 			feature_collections,
 			// Resolved topo networks use the resolved topo lines *and* the reconstructed non-topo geometries...
-			reconstruct_handles);
+			reconstruct_handles,
+			TopologyNetworkParams(),
+			0/*num_worker_threads: use the default number of threads*/);
 
 	if (group_networks_then_boundaries_then_static_polygons)
 	{
@@ -314,6 +330,8 @@ GPlatesAppLogic::GeometryCookieCutter::GeometryCookieCutter(
 
 		add_partitioning_reconstruction_geometries(reconstruction_geometries, sort_plates);
 	}
+
+	build_partitioning_geometry_spatial_partition();
 }
 
 
@@ -465,14 +483,25 @@ GPlatesAppLogic::GeometryCookieCutter::partition_point(
 		return boost::none;
 	}
 
-	// Iterate through the partitioning polygons and return the first one that contains the point.
-	partitioning_geometry_seq_type::const_iterator partition_iter =
-			d_partitioning_geometries.begin();
-	partitioning_geometry_seq_type::const_iterator partition_end =
-			d_partitioning_geometries.end();
-	for ( ; partition_iter != partition_end; ++partition_iter)
+	// Find those partitioning polygons whose bounding small circles potentially contain the point.
+	std::vector<unsigned int> candidate_partitioning_geometry_indices;
+	GPlatesMaths::CubeQuadTreePartitionUtils::visit_elements_potentially_containing_point(
+			*d_partitioning_geometry_spatial_partition,
+			point.position_vector(),
+			[&](const unsigned int &partitioning_geometry_index)
+			{
+				candidate_partitioning_geometry_indices.push_back(partitioning_geometry_index);
+			});
+
+	// The spatial partition does not visit its elements in the order they were added, so sort the
+	// candidates back into the (plate id / plate area) order of the partitioning polygons.
+	// That way we still return the *first* partitioning polygon containing the point.
+	std::sort(candidate_partitioning_geometry_indices.begin(), candidate_partitioning_geometry_indices.end());
+
+	// Iterate through the candidate partitioning polygons and return the first one that contains the point.
+	for (const unsigned int partitioning_geometry_index : candidate_partitioning_geometry_indices)
 	{
-		const PartitioningGeometry &partitioning_geometry = *partition_iter;
+		const PartitioningGeometry &partitioning_geometry = d_partitioning_geometries[partitioning_geometry_index];
 
 		if (partitioning_geometry.d_polygon_partitioner->partition_point(point) !=
 			GPlatesMaths::PolygonPartitioner::GEOMETRY_OUTSIDE)
@@ -485,6 +514,40 @@ GPlatesAppLogic::GeometryCookieCutter::partition_point(
 }
 
 
+void
+GPlatesAppLogic::GeometryCookieCutter::prepare_for_concurrent_partitioning() const
+{
+	// The adaptive speed keeps modifying the polygon until the high speed structure is set up.
+	// And the low speed test does not cache anything (so there's nothing to set up).
+	GPlatesMaths::PolygonOnSphere::PointInPolygonSpeedAndMemory partition_point_speed_and_memory =
+			d_partition_point_speed_and_memory;
+	if (partition_point_speed_and_memory == GPlatesMaths::PolygonOnSphere::ADAPTIVE)
+	{
+		partition_point_speed_and_memory = GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE;
+	}
+
+	BOOST_FOREACH(const PartitioningGeometry &partitioning_geometry, d_partitioning_geometries)
+	{
+		const GPlatesMaths::PolygonOnSphere &partitioning_polygon =
+				*partitioning_geometry.d_polygon_partitioner->get_partitioning_polygon();
+
+		// Set up the point-in-polygon structure by testing an arbitrary point.
+		if (partition_point_speed_and_memory != GPlatesMaths::PolygonOnSphere::LOW_SPEED_NO_SETUP_NO_MEMORY_USAGE)
+		{
+			partitioning_polygon.is_point_in_polygon(
+					GPlatesMaths::PointOnSphere(partitioning_polygon.get_boundary_centroid()),
+					partition_point_speed_and_memory);
+		}
+
+		// Partitioning polylines and polygons intersects them with the partitioning polygon
+		// (see PolylineIntersections and GeometryIntersect) which uses the polygon's bounding tree
+		// and bounding small circle. These are otherwise created on demand (ie, not thread-safe).
+		partitioning_polygon.get_bounding_tree();
+		partitioning_polygon.get_inner_outer_bounding_small_circle();
+	}
+}
+
+
 void
 GPlatesAppLogic::GeometryCookieCutter::add_partitioning_reconstruction_geometries(
 		const std::vector<ReconstructionGeometry::non_null_ptr_type> &reconstruction_geometries,
@@ -645,6 +708,24 @@ GPlatesAppLogic::GeometryCookieCutter::add_partitioning_reconstructed_feature_po
 }
 
 
+void
+GPlatesAppLogic::GeometryCookieCutter::build_partitioning_geometry_spatial_partition()
+{
+	// Each partitioning polygon is added using its index in the final (sorted) ordering.
+	const unsigned int num_partitioning_geometries = d_partitioning_geometries.size();
+	for (unsigned int partitioning_geometry_index = 0;
+		partitioning_geometry_index < num_partitioning_geometries;
+		++partitioning_geometry_index)
+	{
+		const PartitioningGeometry &partitioning_geometry = d_partitioning_geometries[partitioning_geometry_index];
+
+		d_partitioning_geometry_spatial_partition->add(
+				partitioning_geometry_index,
+				*partitioning_geometry.d_polygon_partitioner->get_partitioning_polygon());
+	}
+}
+
+
 void
 GPlatesAppLogic::GeometryCookieCutter::sort_plates_in_partitioning_group(
 		const partitioning_geometry_seq_type::iterator &partitioning_group_begin,
@@ -37,6 +37,7 @@
 #include "ResolvedTopologicalBoundary.h"
 #include "ResolvedTopologicalNetwork.h"
 
+#include "maths/CubeQuadTreePartition.h"
 #include "maths/PolygonOnSphere.h"
 #include "maths/PolygonPartitioner.h"
 
@@ -235,6 +236,19 @@ namespace GPlatesAppLogic
 				const GPlatesMaths::PointOnSphere &point) const;
 
 
+		/**
+		 * Sets up the point-in-polygon structures, bounding trees and bounding small circles
+		 * (cached by the partitioning polygons) that are otherwise set up on demand by
+		 * @a partition_geometry, @a partition_geometries and @a partition_point.
+		 *
+		 * After this those methods no longer modify the partitioning polygons and hence can be called
+		 * concurrently by multiple threads (provided the geometries being partitioned are not shared
+		 * with another thread that modifies them).
+		 */
+		void
+		prepare_for_concurrent_partitioning() const;
+
+
 		/**
 		 * Returns the reconstruction time of the reconstructed partitioning polygons
 		 * used to partition geometry with.
@@ -323,9 +337,34 @@ namespace GPlatesAppLogic
 		};
 
 
+		/**
+		 * Spatial partition of the partitioning polygons (by their bounding small circles).
+		 *
+		 * Each element is an index into @a d_partitioning_geometries.
+		 */
+		typedef GPlatesMaths::CubeQuadTreePartition<unsigned int> partitioning_geometry_spatial_partition_type;
+
+
+		/**
+		 * Depth of @a d_partitioning_geometry_spatial_partition.
+		 *
+		 * Partitioning polygons are typically large (plates) so they don't need a deep quad tree,
+		 * but a moderate depth still separates the many small polygons of a static polygon dataset.
+		 */
+		static const unsigned int PARTITIONING_GEOMETRY_SPATIAL_PARTITION_DEPTH = 6;
+
+
 		//! The partitioning geometries.
 		partitioning_geometry_seq_type d_partitioning_geometries;
 
+		/**
+		 * Used by @a partition_point to only test those partitioning polygons near the point.
+		 *
+		 * Built (by @a build_partitioning_geometry_spatial_partition) once all partitioning geometries
+		 * have been added (and sorted).
+		 */
+		partitioning_geometry_spatial_partition_type::non_null_ptr_type d_partitioning_geometry_spatial_partition;
+
 		double d_reconstruction_time;
 
 		GPlatesMaths::PolygonOnSphere::PointInPolygonSpeedAndMemory d_partition_point_speed_and_memory;
@@ -388,6 +427,15 @@ namespace GPlatesAppLogic
 				const ReconstructedFeatureGeometry::non_null_ptr_type &reconstructed_feature_geometry);
 
 
+		/**
+		 * Adds the final (sorted) partitioning geometries to @a d_partitioning_geometry_spatial_partition.
+		 *
+		 * Must be called (once) after all partitioning geometries have been added.
+		 */
+		void
+		build_partitioning_geometry_spatial_partition();
+
+
 		/**
 		 * Sort plates within a partitioning group.
 		 */
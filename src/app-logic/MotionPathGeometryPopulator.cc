@@ -35,6 +35,7 @@
 #include "Reconstruction.h"
 #include "ReconstructedFlowline.h"
 #include "ReconstructionGeometryUtils.h"
+#include "ReconstructionRotationTable.h"
 #include "ReconstructionTree.h"
 #include "ReconstructUtils.h"
 
@@ -103,20 +104,18 @@ GPlatesAppLogic::MotionPathGeometryPopulator::initialise_pre_feature_properties(
 			d_recon_time.value(),
 			d_motion_track_property_finder->get_times());
 
-		// We'll work from the current time, backwards in time.		
-		std::vector<double>::const_iterator 
-			iter = times.begin(),
-			end = times.end();
-
-		for (; iter != end ; ++iter)
-		{
-
-			GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type tree_at_time_t_ptr =
-				d_reconstruction_tree_creator.get_reconstruction_tree(
-						*iter,
+		// Calculate the rotations at all times in one pass (rather than creating a reconstruction tree per time).
+		const ReconstructionRotationTable::non_null_ptr_to_const_type rotation_table =
+				ReconstructionRotationTable::create(
+						d_reconstruction_tree_creator,
+						times,
 						*d_motion_track_property_finder->get_relative_plate_id());
 
-			GPlatesMaths::FiniteRotation rot = tree_at_time_t_ptr->get_composed_absolute_rotation(
+		// We'll work from the current time, backwards in time.		
+		for (unsigned int time_index = 0; time_index < times.size(); ++time_index)
+		{
+			GPlatesMaths::FiniteRotation rot = rotation_table->get_composed_absolute_rotation(
+				time_index,
 				*d_motion_track_property_finder->get_reconstruction_plate_id());
 
 			d_rotations.push_back(rot);
@@ -56,3 +56,30 @@ GPlatesAppLogic::get_partition_feature_tasks(
 
 	return tasks;
 }
+
+
+void
+GPlatesAppLogic::PartitionFeatureTask::partition_feature(
+		const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
+		const GeometryCookieCutter &geometry_cookie_cutter,
+		const ReconstructMethodInterface::Context &reconstruct_method_context,
+		const double &reconstruction_time,
+		bool respect_feature_time_period)
+{
+	const extracted_feature_ptr_type extracted_feature =
+			extract_feature(feature_ref, geometry_cookie_cutter, respect_feature_time_period);
+	if (!extracted_feature)
+	{
+		return;
+	}
+
+	extracted_feature->partition();
+
+	assign_extracted_feature(
+			*extracted_feature,
+			feature_ref,
+			feature_collection_ref,
+			reconstruct_method_context,
+			reconstruction_time);
+}
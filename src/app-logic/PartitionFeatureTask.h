@@ -66,10 +66,43 @@ namespace GPlatesAppLogic
 	/**
 	 * Interface for a task that can be queried to see if it can assign a plate id
 	 * to a specific feature and asked to assign the plate id.
+	 *
+	 * A feature can be partitioned in one call (@a partition_feature) or in three stages
+	 * (@a extract_feature, 'ExtractedFeature::partition()' and @a assign_extracted_feature).
+	 * The first and last stages access the model (and so should be done on the thread owning the model)
+	 * whereas the middle stage does not and so can be done concurrently for different features.
 	 */
 	class PartitionFeatureTask
 	{
 	public:
+
+		/**
+		 * A feature extracted (from the model) by @a extract_feature that is ready to be partitioned.
+		 */
+		class ExtractedFeature
+		{
+		public:
+			virtual
+			~ExtractedFeature()
+			{  }
+
+			/**
+			 * Partitions the extracted feature using the partitioning polygons of the
+			 * 'GeometryCookieCutter' passed to @a extract_feature.
+			 *
+			 * This does not access the model and so can be called concurrently for different
+			 * extracted features, provided the geometry cookie cutter has been prepared
+			 * (see 'GeometryCookieCutter::prepare_for_concurrent_partitioning()').
+			 */
+			virtual
+			void
+			partition() = 0;
+		};
+
+		//! Typedef for a shared pointer to an extracted feature.
+		typedef boost::shared_ptr<ExtractedFeature> extracted_feature_ptr_type;
+
+
 		virtual
 		~PartitionFeatureTask()
 		{  }
@@ -96,8 +129,10 @@ namespace GPlatesAppLogic
 		 * NOTE: Currently @a feature_ref can be modified to hold one of geometries
 		 * resulting from partitioning while clones of it can hold the other
 		 * partitioned geometries.
+		 *
+		 * This is the same as calling @a extract_feature, 'ExtractedFeature::partition()' and
+		 * @a assign_extracted_feature in succession.
 		 */
-		virtual
 		void
 		partition_feature(
 				const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
@@ -105,7 +140,42 @@ namespace GPlatesAppLogic
 				const GeometryCookieCutter &geometry_cookie_cutter,
 				const ReconstructMethodInterface::Context &reconstruct_method_context,
 				const double &reconstruction_time,
+				bool respect_feature_time_period = true);
+
+
+		/**
+		 * Extracts what is needed to partition @a feature_ref (such as its geometries).
+		 *
+		 * Returns NULL if there is nothing to partition (for example, if @a respect_feature_time_period
+		 * is true and the reconstruction time of @a geometry_cookie_cutter is outside the time period
+		 * of the feature).
+		 *
+		 * NOTE: This does not modify @a feature_ref, and @a geometry_cookie_cutter must remain alive
+		 * until the returned extracted feature has been partitioned.
+		 */
+		virtual
+		extracted_feature_ptr_type
+		extract_feature(
+				const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+				const GeometryCookieCutter &geometry_cookie_cutter,
 				bool respect_feature_time_period = true) = 0;
+
+
+		/**
+		 * Assigns properties of the partitioning polygons to @a feature_ref (and any clones of it
+		 * that hold partitioned geometry) using the results of partitioning @a extracted_feature.
+		 *
+		 * @a extracted_feature must have been returned by @a extract_feature (of this task) for
+		 * @a feature_ref and then partitioned.
+		 */
+		virtual
+		void
+		assign_extracted_feature(
+				ExtractedFeature &extracted_feature,
+				const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
+				const ReconstructMethodInterface::Context &reconstruct_method_context,
+				const double &reconstruction_time) = 0;
 	};
 }
 
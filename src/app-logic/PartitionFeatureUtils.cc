@@ -24,8 +24,10 @@
  */
 
 #include <algorithm>
+#include <list>
 #include <map>
 #include <vector>
+#include <boost/foreach.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/optional.hpp>
 #include <boost/utility/in_place_factory.hpp>
@@ -71,11 +73,14 @@ namespace GPlatesAppLogic
 {
 	namespace PartitionFeatureUtils
 	{
-		namespace
+		namespace Implementation
 		{
 			/**
-			 * Visit a feature property and, if it contains geometry, partitions it
-			 * using partitioning polygons and stores results for later retrieval.
+			 * Visit a feature property and, if it contains geometry, records it for partitioning
+			 * using partitioning polygons.
+			 *
+			 * The recorded geometries are partitioned by @a partition (which does not access the model)
+			 * and the results are then retrieved with @a get_partitioned_feature_geometries.
 			 */
 			class PartitionFeatureGeometryProperties :
 					// TODO: Change this to ConstFeatureVisitor once the new bubble-up model
@@ -97,9 +102,34 @@ namespace GPlatesAppLogic
 				}
 
 
+				/**
+				 * Partitions the geometries recorded while visiting the feature.
+				 *
+				 * This does not access the model (or create any property values).
+				 */
+				void
+				partition()
+				{
+					BOOST_FOREACH(GeometryToPartition &geometry_to_partition, d_geometries_to_partition)
+					{
+						d_cookie_cut_geometry.partition_geometry(
+								geometry_to_partition.geometry_domain,
+								geometry_to_partition.partitioned_inside_domains,
+								geometry_to_partition.partitioned_outside_domains);
+					}
+				}
+
+
 				boost::shared_ptr<const PartitionedFeature>
-				get_partitioned_feature_geometries() const
+				get_partitioned_feature_geometries()
 				{
+					// Add the partitioned geometries (and any associated partitioned ranges) to the results.
+					BOOST_FOREACH(const GeometryToPartition &geometry_to_partition, d_geometries_to_partition)
+					{
+						add_partitioned_geometry(geometry_to_partition);
+					}
+					d_geometries_to_partition.clear();
+
 					return d_partition_results;
 				}
 
@@ -251,23 +281,46 @@ namespace GPlatesAppLogic
 					geometry_range_type range;
 				};
 
+				//! A geometry (of a geometry property) to partition.
+				struct GeometryToPartition
+				{
+					explicit
+					GeometryToPartition(
+							const geometry_domain_type &geometry_domain_) :
+						geometry_domain(geometry_domain_),
+						partitioned_geometry_property(NULL)
+					{  }
+
+					geometry_domain_type geometry_domain;
+
+					//! The geometry domain may also have a range (scalar coverage).
+					boost::optional<Range> geometry_range;
+
+					//! The partition entry of the geometry property.
+					PartitionedFeature::GeometryProperty *partitioned_geometry_property;
+
+					// The results of partitioning the geometry domain.
+					GeometryCookieCutter::partition_seq_type partitioned_inside_domains;
+					GeometryCookieCutter::partitioned_geometry_seq_type partitioned_outside_domains;
+				};
+
+				//! The geometries recorded while visiting the feature (that are partitioned by @a partition).
+				std::list<GeometryToPartition> d_geometries_to_partition;
+
 
 				/**
-				 * Partition the geometry @a geometry of the current geometry property.
+				 * Record the geometry @a geometry of the current geometry property for partitioning.
 				 */
 				void
 				add_geometry(
 						const geometry_domain_type &geometry_domain)
 				{
-					// The geometry domain may also have a range (scalar coverage).
-					boost::optional<Range> geometry_range;
+					d_geometries_to_partition.push_back(GeometryToPartition(geometry_domain));
+					GeometryToPartition &geometry_to_partition = d_geometries_to_partition.back();
 
 					// Create a new partition entry for the current geometry property.
-					PartitionedFeature::GeometryProperty &partitioned_geometry_property =
-							get_geometry_property(geometry_domain, geometry_range);
-
-					// Partition the current geometry property and store results.
-					partition_geometry(geometry_domain, geometry_range, partitioned_geometry_property);
+					geometry_to_partition.partitioned_geometry_property =
+							&get_geometry_property(geometry_domain, geometry_to_partition.geometry_range);
 				}
 
 				PartitionedFeature::GeometryProperty &
@@ -355,25 +408,23 @@ namespace GPlatesAppLogic
 					return geometry_property;
 				}
 
+				/**
+				 * Add the partitioned results of a geometry (of a geometry property) to its partition entry.
+				 */
 				void
-				partition_geometry(
-						const geometry_domain_type &geometry_domain,
-						const boost::optional<Range> &geometry_range,
-						PartitionedFeature::GeometryProperty &partitioned_geometry_property)
+				add_partitioned_geometry(
+						const GeometryToPartition &geometry_to_partition)
 				{
-					// Partition the current geometry property and store results.
-					GeometryCookieCutter::partition_seq_type partitioned_inside_domains;
-					GeometryCookieCutter::partitioned_geometry_seq_type partitioned_outside_domains;
-					d_cookie_cut_geometry.partition_geometry(
-							geometry_domain,
-							partitioned_inside_domains,
-							partitioned_outside_domains);
+					const geometry_domain_type &geometry_domain = geometry_to_partition.geometry_domain;
+					const boost::optional<Range> &geometry_range = geometry_to_partition.geometry_range;
+					PartitionedFeature::GeometryProperty &partitioned_geometry_property =
+							*geometry_to_partition.partitioned_geometry_property;
 
 					// Iterate over the partitioned polygons and add the partitioned *inside* geometries.
 					GeometryCookieCutter::partition_seq_type::const_iterator partitioned_inside_domains_iter =
-							partitioned_inside_domains.begin();
+							geometry_to_partition.partitioned_inside_domains.begin();
 					GeometryCookieCutter::partition_seq_type::const_iterator partitioned_inside_domains_end =
-							partitioned_inside_domains.end();
+							geometry_to_partition.partitioned_inside_domains.end();
 					for ( ; partitioned_inside_domains_iter != partitioned_inside_domains_end; ++partitioned_inside_domains_iter)
 					{
 						const GeometryCookieCutter::Partition &partitioned_inside_domain = *partitioned_inside_domains_iter;
@@ -394,7 +445,7 @@ namespace GPlatesAppLogic
 					partition_geometries(
 							geometry_domain,
 							geometry_range,
-							partitioned_outside_domains,
+							geometry_to_partition.partitioned_outside_domains,
 							partitioned_geometry_property.partitioned_outside_geometries);
 				}
 
@@ -595,7 +646,11 @@ namespace GPlatesAppLogic
 
 			const GPlatesMaths::AngularExtent PartitionFeatureGeometryProperties::POLY_GEOMETRY_DISTANCE_THRESHOLD =
 					GPlatesMaths::AngularExtent::create_from_angle(GPlatesMaths::convert_deg_to_rad(0.5));
+		}
+
 
+		namespace
+		{
 
 			/**
 			 * Calculate polyline distance along unit radius sphere.
@@ -826,6 +881,35 @@ GPlatesAppLogic::PartitionFeatureUtils::partition_feature(
 		return boost::shared_ptr<const PartitionedFeature>();
 	}
 
+	const boost::shared_ptr<FeatureGeometryPartitioner> feature_geometry_partitioner =
+			FeatureGeometryPartitioner::create(
+					feature_ref,
+					geometry_cookie_cutter,
+					false/*respect_feature_time_period*/, // Already checked above.
+					partitioned_properties);
+
+	feature_geometry_partitioner->partition();
+
+	return feature_geometry_partitioner->get_partitioned_feature();
+}
+
+
+boost::shared_ptr<GPlatesAppLogic::PartitionFeatureUtils::FeatureGeometryPartitioner>
+GPlatesAppLogic::PartitionFeatureUtils::FeatureGeometryPartitioner::create(
+		const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+		const GeometryCookieCutter &geometry_cookie_cutter,
+		bool respect_feature_time_period,
+		boost::optional< std::vector<GPlatesModel::FeatureHandle::iterator> &> partitioned_properties)
+{
+	// Only partition features that exist at the partitioning reconstruction time if we've been requested.
+	if (respect_feature_time_period &&
+		!does_feature_exist_at_reconstruction_time(
+			feature_ref,
+			geometry_cookie_cutter.get_reconstruction_time()))
+	{
+		return boost::shared_ptr<FeatureGeometryPartitioner>();
+	}
+
 	// Get any scalar coverages associated with the feature's geometry properties.
 	std::vector<ScalarCoverageFeatureProperties::Coverage> geometry_coverages;
 	ScalarCoverageFeatureProperties::get_coverages(
@@ -833,13 +917,49 @@ GPlatesAppLogic::PartitionFeatureUtils::partition_feature(
 			feature_ref,
 			geometry_cookie_cutter.get_reconstruction_time());
 
-	PartitionFeatureGeometryProperties feature_partitioner(
-			geometry_cookie_cutter,
-			geometry_coverages,
-			partitioned_properties);
-	feature_partitioner.visit_feature(feature_ref);
+	boost::shared_ptr<FeatureGeometryPartitioner> feature_geometry_partitioner(
+			new FeatureGeometryPartitioner(
+					geometry_cookie_cutter,
+					geometry_coverages,
+					partitioned_properties));
 
-	return feature_partitioner.get_partitioned_feature_geometries();
+	// Record the feature's geometries (and associated scalar coverages).
+	feature_geometry_partitioner->d_feature_geometry_properties->visit_feature(feature_ref);
+
+	return feature_geometry_partitioner;
+}
+
+
+GPlatesAppLogic::PartitionFeatureUtils::FeatureGeometryPartitioner::FeatureGeometryPartitioner(
+		const GeometryCookieCutter &geometry_cookie_cutter,
+		const std::vector<ScalarCoverageFeatureProperties::Coverage> &geometry_coverages,
+		boost::optional< std::vector<GPlatesModel::FeatureHandle::iterator> &> partitioned_properties) :
+	d_feature_geometry_properties(
+			new Implementation::PartitionFeatureGeometryProperties(
+					geometry_cookie_cutter,
+					geometry_coverages,
+					partitioned_properties))
+{
+}
+
+
+GPlatesAppLogic::PartitionFeatureUtils::FeatureGeometryPartitioner::~FeatureGeometryPartitioner()
+{
+	// Destructor defined in '.cc' so boost::scoped_ptr has access to complete type.
+}
+
+
+void
+GPlatesAppLogic::PartitionFeatureUtils::FeatureGeometryPartitioner::partition()
+{
+	d_feature_geometry_properties->partition();
+}
+
+
+boost::shared_ptr<const GPlatesAppLogic::PartitionFeatureUtils::PartitionedFeature>
+GPlatesAppLogic::PartitionFeatureUtils::FeatureGeometryPartitioner::get_partitioned_feature()
+{
+	return d_feature_geometry_properties->get_partitioned_feature_geometries();
 }
 
 
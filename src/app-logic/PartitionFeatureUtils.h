@@ -31,8 +31,10 @@
 #include <map>
 #include <utility>
 #include <vector>
+#include <boost/noncopyable.hpp>
 #include <boost/operators.hpp>
 #include <boost/optional.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include "AssignPlateIds.h"
@@ -40,6 +42,7 @@
 #include "Reconstruction.h"
 #include "ReconstructionGeometry.h"
 #include "ReconstructMethodInterface.h"
+#include "ScalarCoverageFeatureProperties.h"
 
 #include "maths/GeometryOnSphere.h"
 
@@ -190,6 +193,72 @@ namespace GPlatesAppLogic
 				boost::optional< std::vector<GPlatesModel::FeatureHandle::iterator> &> partitioned_properties = boost::none);
 
 
+		namespace Implementation
+		{
+			class PartitionFeatureGeometryProperties;
+		}
+
+		/**
+		 * Does the same as @a partition_feature but in three stages so that the partitioning of
+		 * the feature's geometries can be done on a different thread than the one owning the model.
+		 *
+		 * The first stage (@a create) records the geometries of the feature's geometry properties and
+		 * the last stage (@a get_partitioned_feature) creates the partitioning results. These access
+		 * the model (and create property values) which is not thread-safe.
+		 *
+		 * The middle stage (@a partition) partitions the recorded geometries. It does not access the model
+		 * and so can be called concurrently for different features, provided the partitioning polygons
+		 * are not modified (see 'GeometryCookieCutter::prepare_for_concurrent_partitioning()').
+		 */
+		class FeatureGeometryPartitioner :
+				private boost::noncopyable
+		{
+		public:
+
+			/**
+			 * Records the geometries of the geometry properties of @a feature_ref.
+			 *
+			 * Returns NULL if @a feature_ref doesn't exist at the reconstruction time of
+			 * @a geometry_cookie_cutter (and @a respect_feature_time_period is true).
+			 *
+			 * The remaining arguments are the same as for @a partition_feature.
+			 *
+			 * NOTE: @a geometry_cookie_cutter must remain alive until @a partition has been called.
+			 */
+			static
+			boost::shared_ptr<FeatureGeometryPartitioner>
+			create(
+					const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+					const GeometryCookieCutter &geometry_cookie_cutter,
+					bool respect_feature_time_period = true,
+					boost::optional< std::vector<GPlatesModel::FeatureHandle::iterator> &> partitioned_properties = boost::none);
+
+			~FeatureGeometryPartitioner();
+
+			/**
+			 * Partitions the recorded geometries using the partitioning polygons.
+			 */
+			void
+			partition();
+
+			/**
+			 * Returns the partitioning results (must be called after @a partition).
+			 */
+			boost::shared_ptr<const PartitionedFeature>
+			get_partitioned_feature();
+
+		private:
+
+			boost::scoped_ptr<Implementation::PartitionFeatureGeometryProperties> d_feature_geometry_properties;
+
+
+			FeatureGeometryPartitioner(
+					const GeometryCookieCutter &geometry_cookie_cutter,
+					const std::vector<ScalarCoverageFeatureProperties::Coverage> &geometry_coverages,
+					boost::optional< std::vector<GPlatesModel::FeatureHandle::iterator> &> partitioned_properties);
+		};
+
+
 		/**
 		 * Abstract base class for copying property values from a partitioning polygon
 		 * feature to a partitioned feature.
@@ -23,7 +23,9 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <map>
 #include <boost/foreach.hpp>
 #include <boost/lambda/bind.hpp>
 #include <boost/lambda/construct.hpp>
@@ -77,6 +79,7 @@
 #include "property-values/GpmlPlateId.h"
 #include "property-values/GpmlTimeSample.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
 
@@ -233,6 +236,175 @@ namespace GPlatesAppLogic
 		};
 
 
+		/**
+		 * Queries the rigid plates (resolved topological boundaries and static polygons) at domain points.
+		 *
+		 * The plate id and stage rotation of each rigid plate are calculated once up front, instead of
+		 * for each domain point inside it. This also means querying does not access the reconstruction
+		 * tree creators (which are not thread-safe), so it can be done concurrently by multiple threads
+		 * (after @a prepare_for_concurrent_queries is called).
+		 */
+		class RigidPlatesQuery :
+				private boost::noncopyable
+		{
+		public:
+
+			//! The velocity information of a rigid plate.
+			struct RigidPlate
+			{
+				RigidPlate(
+						const ReconstructionGeometry *reconstruction_geometry_,
+						boost::optional<GPlatesModel::integer_plate_id_type> plate_id_,
+						boost::optional<GPlatesMaths::FiniteRotation> stage_rotation_) :
+					reconstruction_geometry(reconstruction_geometry_),
+					plate_id(plate_id_),
+					stage_rotation(stage_rotation_)
+				{  }
+
+				const ReconstructionGeometry *reconstruction_geometry;
+
+				//! Is none if the rigid plate has no plate id (and hence has zero velocity).
+				boost::optional<GPlatesModel::integer_plate_id_type> plate_id;
+
+				//! Is none if the rigid plate has zero velocity (no plate id or no reconstruction tree).
+				boost::optional<GPlatesMaths::FiniteRotation> stage_rotation;
+			};
+
+
+			RigidPlatesQuery(
+					const double &reconstruction_time,
+					const std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> &reconstructed_static_polygons,
+					const std::vector<ResolvedTopologicalBoundary::non_null_ptr_type> &resolved_topological_boundaries,
+					const double &velocity_delta_time,
+					VelocityDeltaTime::Type velocity_delta_time_type) :
+				d_rigid_plates_cookie_cutter(
+						reconstruction_time,
+						reconstructed_static_polygons,
+						resolved_topological_boundaries,
+						boost::none/*resolved_topological_networks*/,
+						GeometryCookieCutter::SORT_BY_PLATE_ID,
+						// Use high speed point-in-poly testing since very dense velocity meshes containing
+						// lots of points can go through this path...
+						GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE)
+			{
+				BOOST_FOREACH(
+						const ReconstructedFeatureGeometry::non_null_ptr_type &reconstructed_static_polygon,
+						reconstructed_static_polygons)
+				{
+					add_rigid_plate(
+							reconstructed_static_polygon.get(),
+							reconstruction_time,
+							velocity_delta_time,
+							velocity_delta_time_type);
+				}
+
+				BOOST_FOREACH(
+						const ResolvedTopologicalBoundary::non_null_ptr_type &resolved_topological_boundary,
+						resolved_topological_boundaries)
+				{
+					add_rigid_plate(
+							resolved_topological_boundary.get(),
+							reconstruction_time,
+							velocity_delta_time,
+							velocity_delta_time_type);
+				}
+			}
+
+
+			/**
+			 * Returns the rigid plate containing @a point, or none if not inside any rigid plates.
+			 */
+			boost::optional<const RigidPlate &>
+			partition_point(
+					const GPlatesMaths::PointOnSphere &point) const
+			{
+				const boost::optional<const ReconstructionGeometry *> rigid_plate_containing_point =
+						d_rigid_plates_cookie_cutter.partition_point(point);
+				if (!rigid_plate_containing_point)
+				{
+					return boost::none;
+				}
+
+				const rigid_plate_map_type::const_iterator rigid_plate_iter =
+						d_rigid_plates.find(rigid_plate_containing_point.get());
+
+				// All partitioning reconstruction geometries were added as rigid plates.
+				GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+						rigid_plate_iter != d_rigid_plates.end(),
+						GPLATES_ASSERTION_SOURCE);
+
+				return rigid_plate_iter->second;
+			}
+
+
+			/**
+			 * Sets up the point-in-polygon structures and bounding small circles of the rigid plate
+			 * polygons so that they are no longer modified when querying (or smoothing) domain points.
+			 */
+			void
+			prepare_for_concurrent_queries() const
+			{
+				d_rigid_plates_cookie_cutter.prepare_for_concurrent_partitioning();
+
+				BOOST_FOREACH(const rigid_plate_map_type::value_type &rigid_plate, d_rigid_plates)
+				{
+					boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> rigid_plate_polygon =
+							ReconstructionGeometryUtils::get_boundary_polygon(rigid_plate.first);
+					if (rigid_plate_polygon)
+					{
+						rigid_plate_polygon.get()->get_inner_outer_bounding_small_circle();
+					}
+				}
+			}
+
+		private:
+
+			typedef std::map<const ReconstructionGeometry *, RigidPlate> rigid_plate_map_type;
+
+
+			GeometryCookieCutter d_rigid_plates_cookie_cutter;
+			rigid_plate_map_type d_rigid_plates;
+
+
+			void
+			add_rigid_plate(
+					const ReconstructionGeometry *rigid_plate,
+					const double &reconstruction_time,
+					const double &velocity_delta_time,
+					VelocityDeltaTime::Type velocity_delta_time_type)
+			{
+				const boost::optional<GPlatesModel::integer_plate_id_type> plate_id =
+						ReconstructionGeometryUtils::get_plate_id(rigid_plate);
+
+				// Get the reconstruction tree creator to calculate the stage rotation with.
+				// This should succeed since resolved topological boundaries and RFGs (static polygons)
+				// support reconstruction trees.
+				boost::optional<ReconstructionTreeCreator> reconstruction_tree_creator;
+				if (plate_id)
+				{
+					reconstruction_tree_creator =
+							ReconstructionGeometryUtils::get_reconstruction_tree_creator(rigid_plate);
+				}
+
+				boost::optional<GPlatesMaths::FiniteRotation> stage_rotation;
+				if (reconstruction_tree_creator)
+				{
+					stage_rotation = PlateVelocityUtils::calculate_stage_rotation(
+							plate_id.get(),
+							reconstruction_tree_creator.get(),
+							reconstruction_time,
+							velocity_delta_time,
+							velocity_delta_time_type);
+				}
+
+				d_rigid_plates.insert(
+						rigid_plate_map_type::value_type(
+								rigid_plate,
+								RigidPlate(rigid_plate, plate_id, stage_rotation)));
+			}
+		};
+
+
 		/**
 		 * Test the domain point against the resolved topological network.
 		 *
@@ -294,11 +466,10 @@ namespace GPlatesAppLogic
 		solve_velocities_on_rigid_plates(
 				const GPlatesMaths::PointOnSphere &domain_point,
 				boost::optional<MultiPointVectorField::CodomainElement> &range_element,
-				const GeometryCookieCutter &rigid_plates_query,
-				const double &velocity_delta_time,
-				VelocityDeltaTime::Type velocity_delta_time_type)
+				const RigidPlatesQuery &rigid_plates_query,
+				const double &velocity_delta_time)
 		{
-			const boost::optional<const ReconstructionGeometry *> rigid_plate_containing_point =
+			const boost::optional<const RigidPlatesQuery::RigidPlate &> rigid_plate_containing_point =
 					rigid_plates_query.partition_point(domain_point);
 			if (!rigid_plate_containing_point)
 			{
@@ -311,10 +482,8 @@ GPlatesMaths::LatLonPoint llp = GPlatesMaths::make_lat_lon_point(domain_point);
 qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 #endif
 
-			const boost::optional<GPlatesModel::integer_plate_id_type> recon_plate_id_opt =
-					ReconstructionGeometryUtils::get_plate_id(
-							rigid_plate_containing_point.get());
-			if (!recon_plate_id_opt)
+			// If the rigid plate has no plate id (or no reconstruction tree) then revert to zero velocity.
+			if (!rigid_plate_containing_point->stage_rotation)
 			{
 				GPlatesMaths::Vector3D zero_velocity(0, 0, 0);
 				range_element = MultiPointVectorField::CodomainElement(
@@ -324,48 +493,25 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 				return true;
 			}
 
-			GPlatesModel::integer_plate_id_type recon_plate_id = recon_plate_id_opt.get();
-
-			const double reconstruction_time = rigid_plate_containing_point.get()->get_reconstruction_time();
-
-			// Get the reconstruction tree creator to calculate velocity with.
-			boost::optional<ReconstructionTreeCreator> recon_tree_creator =
-				ReconstructionGeometryUtils::get_reconstruction_tree_creator(
-						rigid_plate_containing_point.get());
-			// This should succeed since resolved topological boundaries and RFGs (static polygons)
-			// support reconstruction trees.
-			if (!recon_tree_creator)
-			{
-				GPlatesMaths::Vector3D zero_velocity(0, 0, 0);
-				range_element = MultiPointVectorField::CodomainElement(
-						zero_velocity,
-						MultiPointVectorField::CodomainElement::NotInAnyBoundaryOrNetwork);
-
-				return true;
-			}
-
-			// Compute the velocity for this domain point.
+			// Compute the velocity for this domain point using the rigid plate's stage rotation.
 			const GPlatesMaths::Vector3D vector_xyz =
-					PlateVelocityUtils::calculate_velocity_vector(
+					GPlatesMaths::calculate_velocity_vector(
 							domain_point,
-							recon_plate_id,
-							recon_tree_creator.get(),
-							reconstruction_time,
-							velocity_delta_time,
-							velocity_delta_time_type);
+							rigid_plate_containing_point->stage_rotation.get(),
+							velocity_delta_time);
 
 			// Determine if point was in a resolved topological boundary or RFG (static polygon).
 			const MultiPointVectorField::CodomainElement::Reason codomain_element_reason =
 					ReconstructionGeometryUtils::get_reconstruction_geometry_derived_type<
-							const ResolvedTopologicalBoundary *>(rigid_plate_containing_point.get())
+							const ResolvedTopologicalBoundary *>(rigid_plate_containing_point->reconstruction_geometry)
 					? MultiPointVectorField::CodomainElement::InPlateBoundary
 					: MultiPointVectorField::CodomainElement::InStaticPolygon;
 
 			range_element = MultiPointVectorField::CodomainElement(
 					vector_xyz,
 					codomain_element_reason,
-					recon_plate_id,
-					rigid_plate_containing_point.get());
+					rigid_plate_containing_point->plate_id.get(),
+					rigid_plate_containing_point->reconstruction_geometry);
 
 			return true;
 		}
@@ -380,7 +526,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 		solve_velocity_on_surfaces(
 				const GPlatesMaths::PointOnSphere &domain_point,
 				boost::optional<MultiPointVectorField::CodomainElement> &range_element,
-				const GeometryCookieCutter &rigid_plates_query,
+				const RigidPlatesQuery &rigid_plates_query,
 				const PlateVelocityUtils::TopologicalNetworksVelocities &resolved_networks_query,
 				const double &velocity_delta_time,
 				VelocityDeltaTime::Type velocity_delta_time_type)
@@ -407,8 +553,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 					domain_point,
 					range_element,
 					rigid_plates_query,
-					velocity_delta_time,
-					velocity_delta_time_type))
+					velocity_delta_time))
 			{
 				return true;
 			}
@@ -443,7 +588,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 				boost::optional<GPlatesMaths::Vector3D> &velocity_inside_polygon_boundary,
 				boost::optional<GPlatesMaths::Vector3D> &velocity_outside_polygon_boundary,
 				const ReconstructionGeometry *polygon_recon_geom_containing_domain_point,
-				const GeometryCookieCutter &rigid_plates_query,
+				const RigidPlatesQuery &rigid_plates_query,
 				const PlateVelocityUtils::TopologicalNetworksVelocities &resolved_networks_query,
 				const double &velocity_delta_time,
 				VelocityDeltaTime::Type velocity_delta_time_type)
@@ -500,7 +645,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 				const GPlatesMaths::PointOnSphere &polygon_boundary_point,
 				const GPlatesMaths::PointOnSphere &domain_point,
 				const ReconstructionGeometry *polygon_recon_geom_containing_domain_point,
-				const GeometryCookieCutter &rigid_plates_query,
+				const RigidPlatesQuery &rigid_plates_query,
 				const PlateVelocityUtils::TopologicalNetworksVelocities &resolved_networks_query,
 				const double &velocity_delta_time,
 				VelocityDeltaTime::Type velocity_delta_time_type)
@@ -715,7 +860,7 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 		solve_velocity_on_surfaces_with_boundary_smoothing(
 				const GPlatesMaths::PointOnSphere &domain_point,
 				boost::optional<MultiPointVectorField::CodomainElement> &range_element,
-				const GeometryCookieCutter &rigid_plates_query,
+				const RigidPlatesQuery &rigid_plates_query,
 				const PlateVelocityUtils::TopologicalNetworksVelocities &resolved_networks_query,
 				const double &velocity_delta_time,
 				VelocityDeltaTime::Type velocity_delta_time_type,
@@ -839,6 +984,87 @@ qDebug() << "solve_velocities_on_rigid_plates: " << llp;
 
 			return true;
 		}
+
+
+		/**
+		 * Calculates the stage rotation (see 'PlateVelocityUtils::calculate_stage_rotation()') using the
+		 * composed absolute rotations (of the plate) returned by @a get_rotation_or_none at a reconstruction time.
+		 */
+		template <typename GetRotationOrNoneType>
+		GPlatesMaths::FiniteRotation
+		calculate_stage_rotation_from_rotations(
+				const GetRotationOrNoneType &get_rotation_or_none,
+				const double &reconstruction_time,
+				const double &velocity_delta_time,
+				VelocityDeltaTime::Type velocity_delta_time_type)
+		{
+			const std::pair<double, double> time_range = VelocityDeltaTime::get_time_range(
+					velocity_delta_time_type, reconstruction_time, velocity_delta_time);
+
+			// Get the finite rotation results for the plate id.
+			boost::optional<GPlatesMaths::FiniteRotation> fr_young = get_rotation_or_none(time_range.second/*young*/);
+			boost::optional<GPlatesMaths::FiniteRotation> fr_old = get_rotation_or_none(time_range.first/*old*/);
+
+			// If both times found then calculate velocity as normal.
+			if (fr_young && fr_old)
+			{
+				// Calculate the stage rotation.
+				return GPlatesMaths::calculate_stage_rotation(fr_young.get(), fr_old.get());
+			}
+
+			// If the youngest time in the delta time interval is negative *and* the oldest time
+			// is non-negative *and* the oldest time found a plate ID match.
+			// This happens when the reconstruction time is non-negative but happens samples a negative time
+			// when calculating the velocity - if only the negative time matches no plate ID then we will
+			// shift the delta time interval to (velocity_delta_time, 0) and try again.
+			// This enables rare users to support negative (future) times in rotation files if they wish
+			// but also supports most users having only non-negative rotations yet still supplying a valid
+			// velocity at/near present day when using a delta time interval such as (T-dt, T) instead of (T+dt, T).
+			if (!fr_young &&
+				fr_old &&
+				time_range.second/*young*/ < 0 &&
+				time_range.first/*old*/ >= 0)
+			{
+				// Shift velocity calculation such that the time interval [velocity_delta_time, 0] is non-negative.
+				boost::optional<GPlatesMaths::FiniteRotation> fr_zero = get_rotation_or_none(0);
+				boost::optional<GPlatesMaths::FiniteRotation> fr_delta = get_rotation_or_none(velocity_delta_time);
+
+				// If both times found then calculate velocity.
+				if (fr_zero && fr_delta)
+				{
+					// Calculate the stage rotation.
+					return GPlatesMaths::calculate_stage_rotation(fr_zero.get(), fr_delta.get());
+				}
+			}
+
+			// A valid finite rotation might not be defined for times older than 'reconstruction_time' since
+			// a feature might not exist at that time and hence the rotation file may not include that time
+			// in its rotation sequence (for the plate ID).
+			//
+			// If not then we will try a time range of [reconstruction_time, reconstruction_time - velocity_delta_time].
+			if (velocity_delta_time_type != VelocityDeltaTime::T_TO_T_MINUS_DELTA_T &&
+				fr_young &&
+				!fr_old)
+			{
+				// Next try shifting the velocity calculation such that the time interval is now
+				// [reconstruction_time, reconstruction_time - velocity_delta_time].
+				const std::pair<double, double> new_time_range = VelocityDeltaTime::get_time_range(
+						VelocityDeltaTime::T_TO_T_MINUS_DELTA_T, reconstruction_time, velocity_delta_time);
+
+				boost::optional<GPlatesMaths::FiniteRotation> fr_new_young = get_rotation_or_none(new_time_range.second/*young*/);
+				boost::optional<GPlatesMaths::FiniteRotation> fr_new_old = get_rotation_or_none(new_time_range.first/*old*/);
+
+				// If both times found then calculate velocity.
+				if (fr_new_young && fr_new_old)
+				{
+					// Calculate the stage rotation.
+					return GPlatesMaths::calculate_stage_rotation(fr_new_young.get(), fr_new_old.get());
+				}
+			}
+
+			// Unable to calculate stage rotation - return identity rotation.
+			return GPlatesMaths::FiniteRotation::create_identity_rotation();
+		}
 	}
 }
 
@@ -916,7 +1142,8 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 		const std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &velocity_surface_resolved_topological_networks,
 		const double &velocity_delta_time,
 		VelocityDeltaTime::Type velocity_delta_time_type,
-		const boost::optional<VelocitySmoothingOptions> &velocity_smoothing_options)
+		const boost::optional<VelocitySmoothingOptions> &velocity_smoothing_options,
+		unsigned int num_worker_threads)
 {
 	PROFILE_FUNC();
 
@@ -928,15 +1155,14 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 
 	// Get the rigid plate features (resolved topological boundaries and static polygons) and wrap
 	// them in a structure that can do point-in-polygon tests so we can query them at domain points.
-	GeometryCookieCutter rigid_plates_query(
+	//
+	// This also calculates the stage rotation of each rigid plate (used for all domain points in the plate).
+	const RigidPlatesQuery rigid_plates_query(
 			reconstruction_time,
 			velocity_surface_reconstructed_static_polygons,
 			velocity_surface_resolved_topological_boundaries,
-			boost::none/*velocity_surface_resolved_topological_networks*/,
-			GeometryCookieCutter::SORT_BY_PLATE_ID,
-			// Use high speed point-in-poly testing since very dense velocity meshes containing
-			// lots of points can go through this path...
-			GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE);
+			velocity_delta_time,
+			velocity_delta_time_type);
 
 	// Get the resolved topological networks so we can query them for interpolated velocity at domain points.
 	const TopologicalNetworksVelocities resolved_networks_query(
@@ -952,7 +1178,28 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 		exclude_deforming_regions_from_smoothing = velocity_smoothing_options->exclude_deforming_regions;
 	}
 
+	// The domain points of each velocity domain and the velocity field they are solved into.
+	std::vector<GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type> velocity_domain_multi_points;
+	std::vector<MultiPointVectorField::non_null_ptr_type> vector_fields;
+	velocity_domain_multi_points.reserve(velocity_domains.size());
+	vector_fields.reserve(velocity_domains.size());
+
+	// The domain points are solved in chunks (a range of points within a velocity domain).
+	struct DomainPointChunk
+	{
+		unsigned int velocity_domain_index;
+		unsigned int domain_points_begin;
+		unsigned int domain_points_end;
+	};
+	std::vector<DomainPointChunk> domain_point_chunks;
+
+	// Large enough to amortise the cost of distributing tasks across threads, but small enough to
+	// balance the load (domain points near boundaries are more expensive when smoothing).
+	const unsigned int MAX_NUM_DOMAIN_POINTS_PER_CHUNK = 1024;
+
 	// Iterate over the velocity domain RFGs.
+	//
+	// This creates the velocity fields (in the calling thread since they reference the domain features).
 	std::vector<ReconstructedFeatureGeometry::non_null_ptr_type>::const_iterator velocity_domains_iter =
 			velocity_domains.begin();
 	std::vector<ReconstructedFeatureGeometry::non_null_ptr_type>::const_iterator velocity_domains_end =
@@ -982,9 +1229,6 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 				GeometryUtils::convert_geometry_to_multi_point(
 						*velocity_domain_rfg->reconstructed_geometry());
 
-		GPlatesMaths::MultiPointOnSphere::const_iterator domain_iter = velocity_domain_multi_point->begin();
-		GPlatesMaths::MultiPointOnSphere::const_iterator domain_end = velocity_domain_multi_point->end();
-
 		MultiPointVectorField::non_null_ptr_type vector_field =
 				MultiPointVectorField::create_empty(
 						reconstruction_time,
@@ -993,41 +1237,99 @@ GPlatesAppLogic::PlateVelocityUtils::solve_velocities_on_surfaces(
 						// For now using the domain...
 						*velocity_domain_rfg->property().handle_weak_ref(),
 						velocity_domain_rfg->property());
-		MultiPointVectorField::codomain_type::iterator field_iter = vector_field->begin();
 
-		// Iterate over the domain points and calculate their velocities.
-		for ( ; domain_iter != domain_end; ++domain_iter, ++field_iter)
-		{
-			const GPlatesMaths::PointOnSphere &domain_point = *domain_iter;
-			boost::optional<MultiPointVectorField::CodomainElement> &range_element = *field_iter;
+		const unsigned int velocity_domain_index = velocity_domain_multi_points.size();
+		const unsigned int num_domain_points = velocity_domain_multi_point->number_of_points();
 
-			if (velocity_smoothing_options)
-			{
-				solve_velocity_on_surfaces_with_boundary_smoothing(
-						domain_point,
-						range_element,
-						rigid_plates_query,
-						resolved_networks_query,
-						velocity_delta_time,
-						velocity_delta_time_type,
-						velocity_smoothing_options->angular_half_extent_radians,
-						boundary_smoothing_angular_half_extent,
-						exclude_deforming_regions_from_smoothing);
-			}
-			else
+		for (unsigned int domain_points_begin = 0;
+			domain_points_begin < num_domain_points;
+			domain_points_begin += MAX_NUM_DOMAIN_POINTS_PER_CHUNK)
+		{
+			const DomainPointChunk domain_point_chunk =
 			{
-				solve_velocity_on_surfaces(
-						domain_point,
-						range_element,
-						rigid_plates_query,
-						resolved_networks_query,
-						velocity_delta_time,
-						velocity_delta_time_type);
-			}
+				velocity_domain_index,
+				domain_points_begin,
+				(std::min)(domain_points_begin + MAX_NUM_DOMAIN_POINTS_PER_CHUNK, num_domain_points)
+			};
+			domain_point_chunks.push_back(domain_point_chunk);
 		}
 
-		multi_point_velocity_fields.push_back(vector_field);
+		velocity_domain_multi_points.push_back(velocity_domain_multi_point);
+		vector_fields.push_back(vector_field);
+	}
+
+	if (num_worker_threads == 0)
+	{
+		num_worker_threads = GPlatesUtils::ParallelUtils::get_num_worker_threads();
+	}
+
+	// Set up the lazily-created structures in the rigid plates and networks now, so that they're not
+	// modified while solving domain points concurrently.
+	if (num_worker_threads > 1 &&
+		domain_point_chunks.size() > 1)
+	{
+		rigid_plates_query.prepare_for_concurrent_queries();
+		resolved_networks_query.prepare_for_concurrent_queries(velocity_delta_time, velocity_delta_time_type);
 	}
+
+	// Iterate over the chunks of domain points and calculate their velocities.
+	//
+	// Each chunk writes to a separate range of a velocity field, so the results do not depend on
+	// the number of threads.
+	GPlatesUtils::ParallelUtils::parallel_for(
+			domain_point_chunks.size(),
+			[&](unsigned int domain_point_chunk_index)
+			{
+				const DomainPointChunk &domain_point_chunk = domain_point_chunks[domain_point_chunk_index];
+
+				const GPlatesMaths::MultiPointOnSphere &velocity_domain_multi_point =
+						*velocity_domain_multi_points[domain_point_chunk.velocity_domain_index];
+				MultiPointVectorField &vector_field = *vector_fields[domain_point_chunk.velocity_domain_index];
+
+				GPlatesMaths::MultiPointOnSphere::const_iterator domain_iter =
+						velocity_domain_multi_point.begin() + domain_point_chunk.domain_points_begin;
+				GPlatesMaths::MultiPointOnSphere::const_iterator domain_end =
+						velocity_domain_multi_point.begin() + domain_point_chunk.domain_points_end;
+				MultiPointVectorField::codomain_type::iterator field_iter =
+						vector_field.begin() + domain_point_chunk.domain_points_begin;
+
+				// Iterate over the domain points and calculate their velocities.
+				for ( ; domain_iter != domain_end; ++domain_iter, ++field_iter)
+				{
+					const GPlatesMaths::PointOnSphere &domain_point = *domain_iter;
+					boost::optional<MultiPointVectorField::CodomainElement> &range_element = *field_iter;
+
+					if (velocity_smoothing_options)
+					{
+						solve_velocity_on_surfaces_with_boundary_smoothing(
+								domain_point,
+								range_element,
+								rigid_plates_query,
+								resolved_networks_query,
+								velocity_delta_time,
+								velocity_delta_time_type,
+								velocity_smoothing_options->angular_half_extent_radians,
+								boundary_smoothing_angular_half_extent,
+								exclude_deforming_regions_from_smoothing);
+					}
+					else
+					{
+						solve_velocity_on_surfaces(
+								domain_point,
+								range_element,
+								rigid_plates_query,
+								resolved_networks_query,
+								velocity_delta_time,
+								velocity_delta_time_type);
+					}
+				}
+			},
+			num_worker_threads);
+
+	multi_point_velocity_fields.insert(
+			multi_point_velocity_fields.end(),
+			vector_fields.begin(),
+			vector_fields.end());
 }
 
 
@@ -1059,84 +1361,74 @@ GPlatesAppLogic::PlateVelocityUtils::calculate_stage_rotation(
 		const double &velocity_delta_time,
 		VelocityDeltaTime::Type velocity_delta_time_type)
 {
-	const std::pair<double, double> time_range = VelocityDeltaTime::get_time_range(
-			velocity_delta_time_type, reconstruction_time, velocity_delta_time);
+	return calculate_stage_rotation_from_rotations(
+			[&](const double &time)
+			{
+				return reconstruction_tree_creator.get_reconstruction_tree(time)
+						->get_composed_absolute_rotation_or_none(reconstruction_plate_id);
+			},
+			reconstruction_time,
+			velocity_delta_time,
+			velocity_delta_time_type);
+}
 
-	// Get the finite rotation results for the plate id.
-	boost::optional<GPlatesMaths::FiniteRotation> fr_young =
-			reconstruction_tree_creator.get_reconstruction_tree(time_range.second/*young*/)
-					->get_composed_absolute_rotation_or_none(reconstruction_plate_id);
-	boost::optional<GPlatesMaths::FiniteRotation> fr_old =
-			reconstruction_tree_creator.get_reconstruction_tree(time_range.first/*old*/)
-					->get_composed_absolute_rotation_or_none(reconstruction_plate_id);
 
-	// If both times found then calculate velocity as normal.
-	if (fr_young && fr_old)
-	{
-		// Calculate the stage rotation.
-		return GPlatesMaths::calculate_stage_rotation(fr_young.get(), fr_old.get());
-	}
+GPlatesMaths::FiniteRotation
+GPlatesAppLogic::PlateVelocityUtils::calculate_stage_rotation(
+		const GPlatesModel::integer_plate_id_type &reconstruction_plate_id,
+		const ReconstructionRotationTable &rotation_table,
+		const ReconstructionTreeCreator &reconstruction_tree_creator,
+		const double &reconstruction_time,
+		const double &velocity_delta_time,
+		VelocityDeltaTime::Type velocity_delta_time_type)
+{
+	return calculate_stage_rotation_from_rotations(
+			[&](const double &time)
+			{
+				const boost::optional<unsigned int> time_index = rotation_table.get_reconstruction_time_index(time);
+				if (time_index)
+				{
+					return rotation_table.get_composed_absolute_rotation_or_none(time_index.get(), reconstruction_plate_id);
+				}
 
-	// If the youngest time in the delta time interval is negative *and* the oldest time
-	// is non-negative *and* the oldest time found a plate ID match.
-	// This happens when the reconstruction time is non-negative but happens samples a negative time
-	// when calculating the velocity - if only the negative time matches no plate ID then we will
-	// shift the delta time interval to (velocity_delta_time, 0) and try again.
-	// This enables rare users to support negative (future) times in rotation files if they wish
-	// but also supports most users having only non-negative rotations yet still supplying a valid
-	// velocity at/near present day when using a delta time interval such as (T-dt, T) instead of (T+dt, T).
-	if (!fr_young &&
-		fr_old &&
-		time_range.second/*young*/ < 0 &&
-		time_range.first/*old*/ >= 0)
-	{
-		// Shift velocity calculation such that the time interval [velocity_delta_time, 0] is non-negative.
-		boost::optional<GPlatesMaths::FiniteRotation> fr_zero =
-				reconstruction_tree_creator.get_reconstruction_tree(0)
-						->get_composed_absolute_rotation_or_none(reconstruction_plate_id);
-		boost::optional<GPlatesMaths::FiniteRotation> fr_delta =
-				reconstruction_tree_creator.get_reconstruction_tree(velocity_delta_time)
+				// The time is not in the table so get the rotation from a reconstruction tree instead.
+				return reconstruction_tree_creator.get_reconstruction_tree(time)
 						->get_composed_absolute_rotation_or_none(reconstruction_plate_id);
+			},
+			reconstruction_time,
+			velocity_delta_time,
+			velocity_delta_time_type);
+}
 
-		// If both times found then calculate velocity.
-		if (fr_zero && fr_delta)
-		{
-			// Calculate the stage rotation.
-			return GPlatesMaths::calculate_stage_rotation(fr_zero.get(), fr_delta.get());
-		}
+
+void
+GPlatesAppLogic::PlateVelocityUtils::get_stage_rotation_times(
+		std::vector<double> &stage_rotation_times,
+		const double &reconstruction_time,
+		const double &velocity_delta_time,
+		VelocityDeltaTime::Type velocity_delta_time_type)
+{
+	// These mirror the times accessed by 'calculate_stage_rotation_from_rotations()'.
+
+	const std::pair<double, double> time_range = VelocityDeltaTime::get_time_range(
+			velocity_delta_time_type, reconstruction_time, velocity_delta_time);
+	stage_rotation_times.push_back(time_range.second/*young*/);
+	stage_rotation_times.push_back(time_range.first/*old*/);
+
+	if (time_range.second/*young*/ < 0 &&
+		time_range.first/*old*/ >= 0)
+	{
+		stage_rotation_times.push_back(0);
+		stage_rotation_times.push_back(velocity_delta_time);
 	}
 
-	// A valid finite rotation might not be defined for times older than 'reconstruction_time' since
-	// a feature might not exist at that time and hence the rotation file may not include that time
-	// in its rotation sequence (for the plate ID).
-	//
-	// If not then we will try a time range of [reconstruction_time, reconstruction_time - velocity_delta_time].
-	if (velocity_delta_time_type != VelocityDeltaTime::T_TO_T_MINUS_DELTA_T &&
-		fr_young &&
-		!fr_old)
+	if (velocity_delta_time_type != VelocityDeltaTime::T_TO_T_MINUS_DELTA_T)
 	{
-		// Next try shifting the velocity calculation such that the time interval is now
-		// [reconstruction_time, reconstruction_time - velocity_delta_time].
 		const std::pair<double, double> new_time_range = VelocityDeltaTime::get_time_range(
 				VelocityDeltaTime::T_TO_T_MINUS_DELTA_T, reconstruction_time, velocity_delta_time);
-
-		boost::optional<GPlatesMaths::FiniteRotation> fr_new_young =
-				reconstruction_tree_creator.get_reconstruction_tree(new_time_range.second/*young*/)
-						->get_composed_absolute_rotation_or_none(reconstruction_plate_id);
-		boost::optional<GPlatesMaths::FiniteRotation> fr_new_old =
-				reconstruction_tree_creator.get_reconstruction_tree(new_time_range.first/*old*/)
-						->get_composed_absolute_rotation_or_none(reconstruction_plate_id);
-
-		// If both times found then calculate velocity.
-		if (fr_new_young && fr_new_old)
-		{
-			// Calculate the stage rotation.
-			return GPlatesMaths::calculate_stage_rotation(fr_new_young.get(), fr_new_old.get());
-		}
+		stage_rotation_times.push_back(new_time_range.second/*young*/);
+		stage_rotation_times.push_back(new_time_range.first/*old*/);
 	}
-
-	// Unable to calculate stage rotation - return identity rotation.
-	return GPlatesMaths::FiniteRotation::create_identity_rotation();
 }
 
 
@@ -1182,6 +1474,43 @@ GPlatesAppLogic::PlateVelocityUtils::TopologicalNetworksVelocities::TopologicalN
 }
 
 
+void
+GPlatesAppLogic::PlateVelocityUtils::TopologicalNetworksVelocities::prepare_for_concurrent_queries(
+		const double &velocity_delta_time,
+		VelocityDeltaTime::Type velocity_delta_time_type) const
+{
+	d_prepared_velocity_delta_time_params = std::make_pair(velocity_delta_time, velocity_delta_time_type);
+
+	BOOST_FOREACH(const ResolvedTopologicalNetwork::non_null_ptr_type &network, d_networks)
+	{
+		const ResolvedTriangulation::Network &triangulation_network = network->get_triangulation_network();
+
+		// Set up the triangulation, point-in-polygon structures, vertex velocities and
+		// rigid block stage rotations of the network.
+		triangulation_network.prepare_for_concurrent_velocities(velocity_delta_time, velocity_delta_time_type);
+
+		const GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type network_boundary_polygon =
+				triangulation_network.get_boundary_polygon();
+
+		// The bounding small circles of the network boundary and its interior rigid blocks are used
+		// when smoothing velocities near boundaries.
+		network_boundary_polygon->get_inner_outer_bounding_small_circle();
+		BOOST_FOREACH(
+				const ResolvedTriangulation::Network::RigidBlock &rigid_block,
+				triangulation_network.get_rigid_blocks())
+		{
+			boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> rigid_block_polygon =
+					ReconstructionGeometryUtils::get_boundary_polygon(
+							rigid_block.get_reconstructed_feature_geometry());
+			if (rigid_block_polygon)
+			{
+				rigid_block_polygon.get()->get_inner_outer_bounding_small_circle();
+			}
+		}
+	}
+}
+
+
 boost::optional<
 		std::pair<
 				const GPlatesAppLogic::ReconstructionGeometry *,
@@ -1193,11 +1522,31 @@ GPlatesAppLogic::PlateVelocityUtils::TopologicalNetworksVelocities::calculate_ve
 {
 	BOOST_FOREACH(const ResolvedTopologicalNetwork::non_null_ptr_type &network, d_networks)
 	{
+		const ResolvedTriangulation::Network &triangulation_network = network->get_triangulation_network();
+
+		// Most points are outside any given network, so test the network boundary first
+		// (this can be done concurrently once the network boundaries have been prepared).
+		if (!triangulation_network.is_point_in_network(point))
+		{
+			continue;
+		}
+
+		// If prepared for concurrent queries then the network must not calculate anything on demand
+		// (it would query reconstruction trees, which are not thread-safe).
+		if (d_prepared_velocity_delta_time_params)
+		{
+			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+					triangulation_network.is_prepared_for_concurrent_velocities(
+							velocity_delta_time,
+							velocity_delta_time_type),
+					GPLATES_ASSERTION_SOURCE);
+		}
+
 		boost::optional<
 				std::pair<
 						GPlatesMaths::Vector3D,
 						ResolvedTriangulation::Network::PointLocation> >
-				velocity = network->get_triangulation_network().calculate_velocity(
+				velocity = triangulation_network.calculate_velocity(
 						point,
 						velocity_delta_time,
 						velocity_delta_time_type);
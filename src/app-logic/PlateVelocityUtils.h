@@ -31,10 +31,12 @@
 #include <utility>
 #include <vector>
 #include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/optional.hpp>
 
 #include "MultiPointVectorField.h"
 #include "ReconstructedFeatureGeometry.h"
+#include "ReconstructionRotationTable.h"
 #include "ReconstructionTreeCreator.h"
 #include "ResolvedTopologicalBoundary.h"
 #include "VelocityDeltaTime.h"
@@ -162,6 +164,10 @@ namespace GPlatesAppLogic
 		 * Note that all @a ReconstructionGeometry derived objects (domains and surfaces) have a
 		 * reconstruction time of @a reconstruction_time so it is simply provided to avoid having
 		 * to retrieve it from any of those @a ReconstructionGeometry objects.
+		 *
+		 * The domain points are solved in chunks using @a num_worker_threads threads
+		 * (zero means 'GPlatesUtils::ParallelUtils::get_num_worker_threads()' and one means serially).
+		 * The calculated velocities do not depend on the number of threads.
 		 */
 		void
 		solve_velocities_on_surfaces(
@@ -176,7 +182,8 @@ namespace GPlatesAppLogic
 				const std::vector<GPlatesGlobal::PointerTraits<ResolvedTopologicalNetwork>::non_null_ptr_type> &velocity_surface_resolved_topological_networks,
 				const double &velocity_delta_time = 1.0,
 				VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_MINUS_HALF_DELTA_T,
-				const boost::optional<VelocitySmoothingOptions> &velocity_smoothing_options = boost::none);
+				const boost::optional<VelocitySmoothingOptions> &velocity_smoothing_options = boost::none,
+				unsigned int num_worker_threads = 1);
 
 
 		//////////////////////////////
@@ -287,6 +294,39 @@ namespace GPlatesAppLogic
 				VelocityDeltaTime::Type velocity_delta_time_type);
 
 
+		/**
+		 * Same as the other overload of @a calculate_stage_rotation but gets the rotations from @a rotation_table.
+		 *
+		 * This avoids creating reconstruction trees when calculating stage rotations at many reconstruction times.
+		 *
+		 * Rotations at times not in @a rotation_table (see @a get_stage_rotation_times) are obtained
+		 * from reconstruction trees created by @a reconstruction_tree_creator instead.
+		 */
+		GPlatesMaths::FiniteRotation
+		calculate_stage_rotation(
+				const GPlatesModel::integer_plate_id_type &reconstruction_plate_id,
+				const ReconstructionRotationTable &rotation_table,
+				const ReconstructionTreeCreator &reconstruction_tree_creator,
+				const double &reconstruction_time,
+				const double &velocity_delta_time,
+				VelocityDeltaTime::Type velocity_delta_time_type);
+
+
+		/**
+		 * Appends to @a stage_rotation_times the reconstruction times that @a calculate_stage_rotation
+		 * might need rotations at (for the specified parameters).
+		 *
+		 * This includes the times used when the velocity delta time interval gets adjusted (for example,
+		 * if it extends into negative times, or past the oldest rotation of the plate).
+		 */
+		void
+		get_stage_rotation_times(
+				std::vector<double> &stage_rotation_times,
+				const double &reconstruction_time,
+				const double &velocity_delta_time,
+				VelocityDeltaTime::Type velocity_delta_time_type);
+
+
 		////////////////////////////////////////////////
 		// Utilities relevant to topological networks //
 		////////////////////////////////////////////////
@@ -295,7 +335,8 @@ namespace GPlatesAppLogic
 		/**
 		 * Calculates of velocities at arbitrary points within a topological network.
 		 */
-		class TopologicalNetworksVelocities
+		class TopologicalNetworksVelocities :
+				private boost::noncopyable
 		{
 		public:
 
@@ -303,6 +344,20 @@ namespace GPlatesAppLogic
 			TopologicalNetworksVelocities(
 					const std::vector<GPlatesGlobal::PointerTraits<ResolvedTopologicalNetwork>::non_null_ptr_type> &networks);
 
+			/**
+			 * Sets up the lazily-created structures of the networks (point-in-polygon structures,
+			 * triangulations, vertex velocities and rigid block stage rotations) so that
+			 * @a calculate_velocity can be called concurrently by multiple threads.
+			 *
+			 * After this, all calls to @a calculate_velocity must use the same velocity delta time
+			 * parameters as specified here (this is asserted since otherwise the vertex velocities
+			 * would be calculated on demand, which queries reconstruction trees).
+			 */
+			void
+			prepare_for_concurrent_queries(
+					const double &velocity_delta_time = 1.0,
+					VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_DELTA_T_TO_T) const;
+
 			/**
 			 * Returns the velocity at location @a point if it's inside any network's boundary,
 			 * otherwise returns false.
@@ -326,6 +381,11 @@ namespace GPlatesAppLogic
 			typedef std::vector<GPlatesGlobal::PointerTraits<ResolvedTopologicalNetwork>::non_null_ptr_type> network_seq_type;
 
 			network_seq_type d_networks;
+
+			/**
+			 * The velocity delta time parameters the networks were prepared with (if prepared).
+			 */
+			mutable boost::optional< std::pair<double, VelocityDeltaTime::Type> > d_prepared_velocity_delta_time_params;
 		};
 	}
 }
@@ -27,6 +27,7 @@
 #include <cstddef> // std::size_t
 #include <boost/bind/bind.hpp>
 #include <boost/foreach.hpp>
+#include <boost/function.hpp>
 
 #include "ReconstructContext.h"
 
@@ -37,6 +38,7 @@
 #include "global/AssertionFailureException.h"
 #include "global/GPlatesAssert.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
 
@@ -261,6 +263,10 @@ GPlatesAppLogic::ReconstructContext::get_reconstructed_feature_geometries(
 {
 	PROFILE_FUNC();
 
+	// If reconstructing using topologies then create the topology-reconstructed geometry time spans
+	// of all features up front (using multiple threads).
+	create_topology_reconstructed_geometry_time_spans(context_state_ref);
+
 	// Get the next global reconstruct handle - it'll be stored in each RFG.
 	const ReconstructHandle::type reconstruct_handle = ReconstructHandle::get_next_reconstruct_handle();
 
@@ -292,6 +298,10 @@ GPlatesAppLogic::ReconstructContext::get_reconstructions(
 {
 	PROFILE_FUNC();
 
+	// If reconstructing using topologies then create the topology-reconstructed geometry time spans
+	// of all features up front (using multiple threads).
+	create_topology_reconstructed_geometry_time_spans(context_state_ref);
+
 	// Since we're mapping RFGs to geometry property handles we need to ensure
 	// that the handles have been assigned.
 	if (!have_assigned_geometry_property_handles())
@@ -347,6 +357,10 @@ GPlatesAppLogic::ReconstructContext::get_reconstructed_features(
 {
 	PROFILE_FUNC();
 
+	// If reconstructing using topologies then create the topology-reconstructed geometry time spans
+	// of all features up front (using multiple threads).
+	create_topology_reconstructed_geometry_time_spans(context_state_ref);
+
 	// Since we're mapping RFGs to geometry property handles we need to ensure
 	// that the handles have been assigned.
 	if (!have_assigned_geometry_property_handles())
@@ -407,6 +421,77 @@ GPlatesAppLogic::ReconstructContext::get_reconstructed_features(
 }
 
 
+void
+GPlatesAppLogic::ReconstructContext::get_bulk_reconstruction(
+		BulkReconstruction &bulk_reconstruction,
+		const context_state_reference_type &context_state_ref,
+		const double &reconstruction_time)
+{
+	PROFILE_FUNC();
+
+	// If reconstructing using topologies then create the topology-reconstructed geometry time spans
+	// of all features up front (using multiple threads).
+	create_topology_reconstructed_geometry_time_spans(context_state_ref);
+
+	// Since we're mapping reconstructed geometries to geometry property handles we need to ensure
+	// that the handles have been assigned.
+	if (!have_assigned_geometry_property_handles())
+	{
+		assign_geometry_property_handles();
+	}
+
+	// The context state should have the same number of features (reconstruct methods).
+	const unsigned int num_features = d_reconstruct_method_feature_seq.size();
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			context_state_ref->d_reconstruct_methods.size() == num_features,
+			GPLATES_ASSERTION_SOURCE);
+
+	// Re-use the same array for the reconstructed geometries of each feature.
+	std::vector<ReconstructMethodInterface::BulkReconstructedGeometry> feature_reconstructed_geometries;
+
+	// Iterate over the reconstruct methods of the current context state and reconstruct.
+	for (unsigned int feature_index = 0; feature_index < num_features; ++feature_index)
+	{
+		const ReconstructMethodFeature &reconstruct_method_feature = d_reconstruct_method_feature_seq[feature_index];
+		if (!reconstruct_method_feature.feature_ref.is_valid())
+		{
+			continue;
+		}
+
+		// Reconstruct the current feature (its points get appended directly to the caller's points).
+		feature_reconstructed_geometries.clear();
+		context_state_ref->d_reconstruct_methods[feature_index]->reconstruct_feature_geometries_bulk(
+				feature_reconstructed_geometries,
+				bulk_reconstruction.points,
+				context_state_ref->d_reconstruct_method_context,
+				reconstruction_time);
+
+		BOOST_FOREACH(
+				const ReconstructMethodInterface::BulkReconstructedGeometry &feature_reconstructed_geometry,
+				feature_reconstructed_geometries)
+		{
+			// The present day geometries of the feature are in the same order as its geometry property handles.
+			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+					feature_reconstructed_geometry.present_day_geometry_index <
+						reconstruct_method_feature.geometry_property_to_handle_seq.size(),
+					GPLATES_ASSERTION_SOURCE);
+
+			const BulkReconstruction::Geometry reconstructed_geometry =
+			{
+				feature_index,
+				reconstruct_method_feature.geometry_property_to_handle_seq[
+						feature_reconstructed_geometry.present_day_geometry_index].geometry_property_handle,
+				feature_reconstructed_geometry.reconstruction_plate_id,
+				feature_reconstructed_geometry.geometry_type,
+				feature_reconstructed_geometry.points_begin,
+				feature_reconstructed_geometry.points_end
+			};
+			bulk_reconstruction.geometries.push_back(reconstructed_geometry);
+		}
+	}
+}
+
+
 GPlatesAppLogic::ReconstructHandle::type
 GPlatesAppLogic::ReconstructContext::get_reconstruction_time_spans(
 		std::vector<ReconstructionTimeSpan> &reconstruction_time_spans,
@@ -415,6 +500,10 @@ GPlatesAppLogic::ReconstructContext::get_reconstruction_time_spans(
 {
 	PROFILE_FUNC();
 
+	// If reconstructing using topologies then create the topology-reconstructed geometry time spans
+	// of all features up front (using multiple threads).
+	create_topology_reconstructed_geometry_time_spans(context_state_ref);
+
 	// Since we're mapping RFGs to geometry property handles we need to ensure
 	// that the handles have been assigned.
 	if (!have_assigned_geometry_property_handles())
@@ -488,6 +577,10 @@ GPlatesAppLogic::ReconstructContext::get_reconstructed_feature_time_spans(
 {
 	PROFILE_FUNC();
 
+	// If reconstructing using topologies then create the topology-reconstructed geometry time spans
+	// of all features up front (using multiple threads).
+	create_topology_reconstructed_geometry_time_spans(context_state_ref);
+
 	// Since we're mapping RFGs to geometry property handles we need to ensure
 	// that the handles have been assigned.
 	if (!have_assigned_geometry_property_handles())
@@ -567,6 +660,9 @@ GPlatesAppLogic::ReconstructContext::get_topology_reconstructed_feature_time_spa
 		return;
 	}
 
+	// Create the topology-reconstructed geometry time spans of all features up front (using multiple threads).
+	create_topology_reconstructed_geometry_time_spans(context_state_ref);
+
 	// Optimisation: Count the number of features so we can size the caller's array to avoid
 	// unnecessary copying/re-allocation as we add features to it.
 	const unsigned int num_features = d_reconstruct_method_feature_seq.size();
@@ -666,6 +762,10 @@ GPlatesAppLogic::ReconstructContext::reconstruct_feature_velocities(
 {
 	PROFILE_FUNC();
 
+	// If reconstructing using topologies then create the topology-reconstructed geometry time spans
+	// of all features up front (using multiple threads).
+	create_topology_reconstructed_geometry_time_spans(context_state_ref);
+
 	// Get the next global reconstruct handle - it'll be stored in each velocity field.
 	const ReconstructHandle::type reconstruct_handle = ReconstructHandle::get_next_reconstruct_handle();
 
@@ -821,6 +921,60 @@ GPlatesAppLogic::ReconstructContext::build_feature_reconstruction_time_spans(
 }
 
 
+void
+GPlatesAppLogic::ReconstructContext::create_topology_reconstructed_geometry_time_spans(
+		const context_state_reference_type &context_state_ref)
+{
+	// We only create topology-reconstructed geometry time spans if we're reconstructing using topologies.
+	if (!context_state_ref->d_reconstruct_method_context.topology_reconstruct)
+	{
+		return;
+	}
+
+	// Gather the tasks that create the geometry time spans (that have not already been created).
+	//
+	// Note that this accesses the features (which must be done on this thread since the model is not thread-safe).
+	std::vector< boost::function<void ()> > tasks;
+	BOOST_FOREACH(
+			const ReconstructMethodInterface::non_null_ptr_type &context_state_reconstruct_method,
+			context_state_ref->d_reconstruct_methods)
+	{
+		if (context_state_reconstruct_method->get_feature_ref().is_valid())
+		{
+			context_state_reconstruct_method->get_topology_reconstructed_geometry_time_span_tasks(
+					tasks,
+					context_state_ref->d_reconstruct_method_context);
+		}
+	}
+
+	if (tasks.empty())
+	{
+		return;
+	}
+
+	PROFILE_BLOCK("ReconstructContext: create topology-reconstructed geometry time spans");
+
+	// If the tasks will run concurrently then the data shared by the tasks (that is otherwise created
+	// on demand) is created up front, for all time slots, so the tasks can read it without locking.
+	if (tasks.size() > 1 &&
+		GPlatesUtils::ParallelUtils::get_num_worker_threads() > 1 &&
+		!GPlatesUtils::ParallelUtils::is_in_parallel_task())
+	{
+		context_state_ref->d_reconstruct_method_context.topology_reconstruct.get()
+				->prepare_for_concurrent_geometry_time_spans();
+	}
+
+	// Each task reconstructs a geometry over the entire time range using topologies.
+	// The number of threads is the number of worker threads configured by the user.
+	GPlatesUtils::ParallelUtils::parallel_for(
+			tasks.size(),
+			[&tasks](unsigned int task_index)
+			{
+				tasks[task_index]();
+			});
+}
+
+
 void
 GPlatesAppLogic::ReconstructContext::assign_geometry_property_handles()
 {
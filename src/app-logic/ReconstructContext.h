@@ -45,9 +45,12 @@
 #include "VelocityDeltaTime.h"
 
 #include "maths/GeometryOnSphere.h"
+#include "maths/GeometryType.h"
+#include "maths/PointOnSphere.h"
 
 #include "model/FeatureCollectionHandle.h"
 #include "model/FeatureId.h"
+#include "model/types.h"
 
 
 namespace GPlatesAppLogic
@@ -400,6 +403,63 @@ namespace GPlatesAppLogic
 		};
 
 
+		/**
+		 * The reconstructed geometries of all features stored in flat arrays.
+		 *
+		 * This is a lightweight alternative to @a ReconstructedFeatureGeometry (and @a Reconstruction)
+		 * for clients that reconstruct a large number of features but only need the reconstructed
+		 * positions (such as exporters). Each reconstructed geometry is a plain value that does not
+		 * reference its feature (ie, no weak references are registered with the features).
+		 */
+		struct BulkReconstruction
+		{
+			/**
+			 * A reconstructed geometry.
+			 */
+			struct Geometry
+			{
+				/**
+				 * Index of the feature in the reconstructable features returned by @a set_features.
+				 */
+				unsigned int feature_index;
+
+				/**
+				 * Can be used to index into the sequence returned by @a get_present_day_feature_geometries.
+				 */
+				geometry_property_handle_type geometry_property_handle;
+
+				GPlatesModel::integer_plate_id_type reconstruction_plate_id;
+
+				GPlatesMaths::GeometryType::Value geometry_type;
+
+				/**
+				 * The reconstructed points are in the half-open range [points_begin, points_end) of @a points.
+				 *
+				 * For polygons the exterior ring points are followed by the interior ring points.
+				 */
+				unsigned int points_begin;
+				unsigned int points_end;
+			};
+
+			//! Typedef for a sequence of reconstructed geometries.
+			typedef std::vector<Geometry> geometry_seq_type;
+
+			//! Typedef for a sequence of reconstructed points.
+			typedef std::vector<GPlatesMaths::PointOnSphere> point_seq_type;
+
+
+			void
+			clear()
+			{
+				geometries.clear();
+				points.clear();
+			}
+
+			geometry_seq_type geometries;
+			point_seq_type points;
+		};
+
+
 		/**
 		 * Extrinsic reconstruction state that features are reconstructed with.
 		 *
@@ -586,6 +646,22 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time);
 
 
+		/**
+		 * Reconstructs the features, specified in the most recent call to @a set_features, to the
+		 * specified reconstruction time using the specified reconstruct context state, and appends
+		 * the reconstructed geometries to @a bulk_reconstruction.
+		 *
+		 * This differs from @a get_reconstructions in that no @a ReconstructedFeatureGeometry objects
+		 * are created for features reconstructed by plate ID (the most common reconstruct method).
+		 * Other reconstruct methods still create them internally (but they are released before returning).
+		 */
+		void
+		get_bulk_reconstruction(
+				BulkReconstruction &bulk_reconstruction,
+				const context_state_reference_type &context_state_ref,
+				const double &reconstruction_time);
+
+
 		/**
 		 * This is similar to @a get_reconstructions but reconstructs over a time range of
 		 * reconstruction times instead of a single reconstruction time.
@@ -755,6 +831,16 @@ namespace GPlatesAppLogic
 			return static_cast<bool>(d_cached_present_day_geometries);
 		}
 
+		/**
+		 * Creates the topology-reconstructed geometry time spans (if reconstructing using topologies)
+		 * of all features in the specified context state using multiple threads.
+		 *
+		 * Time spans that have already been created are not re-created.
+		 */
+		void
+		create_topology_reconstructed_geometry_time_spans(
+				const context_state_reference_type &context_state_ref);
+
 		/**
 		 * Iterates over the assigned features and assigns geometry property handles.
 		 */
@@ -26,6 +26,8 @@
 #ifndef GPLATES_APP_LOGIC_RECONSTRUCTHANDLE_H
 #define GPLATES_APP_LOGIC_RECONSTRUCTHANDLE_H
 
+#include <atomic>
+
 #include "utils/Counter64.h"
 
 
@@ -61,17 +63,29 @@ namespace GPlatesAppLogic
 		 * If the feature has been reconstructed several times, in different situations, then it will
 		 * have several @a ReconstructedFeatureGeometry observers and the handle can then be used to
 		 * identify the @a ReconstructedFeatureGeometry from the desired reconstruction situation.
+		 *
+		 * This can be called concurrently by multiple threads (each call returns a unique handle).
 		 */
 		inline
 		type
 		get_next_reconstruct_handle()
 		{
-			// TODO: Will need to be thread-protected or converted to singleton if GPlates becomes multi-threaded.
-			static type global_reconstruct_handle(0);
+			// Counter64 is trivially copyable so it can be atomically incremented (without locking)
+			// using compare-and-swap.
+			static std::atomic<type> global_reconstruct_handle(type(0));
 
-			++global_reconstruct_handle;
+			type current_reconstruct_handle = global_reconstruct_handle.load();
+			type next_reconstruct_handle;
+			do
+			{
+				next_reconstruct_handle = current_reconstruct_handle;
+				++next_reconstruct_handle;
+			}
+			while (!global_reconstruct_handle.compare_exchange_weak(
+					current_reconstruct_handle,
+					next_reconstruct_handle));
 
-			return global_reconstruct_handle;
+			return next_reconstruct_handle;
 		}
 	}
 }
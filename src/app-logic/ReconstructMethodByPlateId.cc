@@ -28,6 +28,7 @@
 
 #include "ReconstructMethodByPlateId.h"
 
+#include "GeometryUtils.h"
 #include "PlateVelocityUtils.h"
 #include "ReconstructionGeometryUtils.h"
 #include "ReconstructMethodFiniteRotation.h"
@@ -45,6 +46,7 @@
 #include "maths/PointOnSphere.h"
 #include "maths/PolygonOnSphere.h"
 #include "maths/PolylineOnSphere.h"
+#include "maths/RotationMatrix.h"
 
 #include "model/FeatureVisitor.h"
 #include "model/types.h"
@@ -356,20 +358,13 @@ void
 GPlatesAppLogic::ReconstructMethodByPlateId::get_present_day_feature_geometries(
 		std::vector<Geometry> &present_day_geometries) const
 {
-	// Cache present day geometries (if not already).
-	if (!d_present_day_geometries)
-	{
-		d_present_day_geometries = std::vector<Geometry>();
-
-		GetPresentDayGeometries visitor(d_present_day_geometries.get());
-		visitor.visit_feature(get_feature_ref());
-	}
+	const std::vector<Geometry> &cached_present_day_geometries = get_cached_present_day_feature_geometries();
 
 	// Copy to caller's sequence.
 	present_day_geometries.insert(
 			present_day_geometries.end(),
-			d_present_day_geometries->begin(),
-			d_present_day_geometries->end());
+			cached_present_day_geometries.begin(),
+			cached_present_day_geometries.end());
 }
 
 
@@ -469,6 +464,70 @@ GPlatesAppLogic::ReconstructMethodByPlateId::reconstruct_feature_geometries(
 }
 
 
+void
+GPlatesAppLogic::ReconstructMethodByPlateId::reconstruct_feature_geometries_bulk(
+		std::vector<BulkReconstructedGeometry> &reconstructed_geometries,
+		std::vector<GPlatesMaths::PointOnSphere> &reconstructed_points,
+		const Context &context,
+		const double &reconstruction_time)
+{
+	// Topology reconstructed geometries are not rigidly rotated so just use the default implementation.
+	if (get_topology_reconstruction_info(context))
+	{
+		ReconstructMethodInterface::reconstruct_feature_geometries_bulk(
+				reconstructed_geometries,
+				reconstructed_points,
+				context,
+				reconstruction_time);
+		return;
+	}
+
+	const ReconstructionInfo &reconstruction_info = get_reconstruction_info(context);
+
+	// The feature must be defined at the reconstruction time, *unless* we've been requested to
+	// reconstruct for all times (even times when the feature is not defined).
+	if (!context.reconstruct_params.get_reconstruct_by_plate_id_outside_active_time_period())
+	{
+		if (!reconstruction_info.valid_time.is_valid_at_recon_time(reconstruction_time))
+		{
+			return;
+		}
+	}
+
+	// Convert the rotation to a matrix once and rotate all points of the feature with the batch kernel.
+	const GPlatesMaths::RotationMatrix rotation_matrix(
+			context.reconstruction_tree_creator.get_reconstruction_tree(reconstruction_time)
+					->get_composed_absolute_rotation(reconstruction_info.reconstruction_plate_id));
+
+	// Iterate over the feature's present day geometries and rotate the points of each one.
+	//
+	// Note that we don't copy the present day geometries (like 'get_present_day_feature_geometries()' does)
+	// since that would also copy their property iterators (each of which is a weak reference to the feature).
+	const std::vector<Geometry> &present_day_geometries = get_cached_present_day_feature_geometries();
+	const unsigned int num_present_day_geometries = present_day_geometries.size();
+	for (unsigned int present_day_geometry_index = 0;
+		present_day_geometry_index < num_present_day_geometries;
+		++present_day_geometry_index)
+	{
+		BulkReconstructedGeometry reconstructed_geometry;
+		reconstructed_geometry.present_day_geometry_index = present_day_geometry_index;
+		reconstructed_geometry.reconstruction_plate_id = reconstruction_info.reconstruction_plate_id;
+		reconstructed_geometry.points_begin = reconstructed_points.size();
+		reconstructed_geometry.geometry_type = GeometryUtils::get_geometry_points(
+				*present_day_geometries[present_day_geometry_index].geometry,
+				reconstructed_points);
+		reconstructed_geometry.points_end = reconstructed_points.size();
+
+		// Rotate the present day points in place.
+		rotation_matrix.rotate(
+				reconstructed_points.begin() + reconstructed_geometry.points_begin,
+				reconstructed_points.begin() + reconstructed_geometry.points_end);
+
+		reconstructed_geometries.push_back(reconstructed_geometry);
+	}
+}
+
+
 void
 GPlatesAppLogic::ReconstructMethodByPlateId::reconstruct_feature_velocities(
 		std::vector<MultiPointVectorField::non_null_ptr_type> &reconstructed_feature_velocities,
@@ -658,6 +717,22 @@ GPlatesAppLogic::ReconstructMethodByPlateId::get_topology_reconstructed_geometry
 }
 
 
+const std::vector<GPlatesAppLogic::ReconstructMethodInterface::Geometry> &
+GPlatesAppLogic::ReconstructMethodByPlateId::get_cached_present_day_feature_geometries() const
+{
+	// Cache present day geometries (if not already).
+	if (!d_present_day_geometries)
+	{
+		d_present_day_geometries = std::vector<Geometry>();
+
+		GetPresentDayGeometries visitor(d_present_day_geometries.get());
+		visitor.visit_feature(get_feature_ref());
+	}
+
+	return d_present_day_geometries.get();
+}
+
+
 const GPlatesAppLogic::ReconstructMethodByPlateId::ReconstructionInfo &
 GPlatesAppLogic::ReconstructMethodByPlateId::get_reconstruction_info(
 		const Context &context) const
@@ -724,52 +799,128 @@ GPlatesAppLogic::ReconstructMethodByPlateId::get_topology_reconstruction_info(
 	{
 		d_topology_reconstructed_geometry_time_spans = topology_reconstructed_geometry_time_span_sequence_type();
 
-		const ReconstructionInfo &reconstruction_info = get_reconstruction_info(context);
-
-		// Tessellation of polylines/polygons.
-		boost::optional<double> line_tessellation_radians;
-		if (context.reconstruct_params.get_topology_reconstruction_enable_line_tessellation())
-		{
-			// Convert degrees to radians.
-			line_tessellation_radians = GPlatesMaths::convert_deg_to_rad(
-					context.reconstruct_params.get_topology_reconstruction_line_tessellation_degrees());
-		}
-
-		// Lifetime detection of individual points in the reconstructed/deformed geometries.
-		boost::optional<TopologyReconstruct::DeactivatePoint::non_null_ptr_to_const_type> deactivate_points;
-		if (context.reconstruct_params.get_topology_reconstruction_enable_lifetime_detection())
-		{
-			deactivate_points = TopologyReconstruct::DefaultDeactivatePoint::create(
-					context.reconstruct_params.get_topology_reconstruction_lifetime_detection_threshold_velocity_delta(),
-					context.reconstruct_params.get_topology_reconstruction_lifetime_detection_threshold_distance_to_boundary(),
-					context.reconstruct_params.get_topology_reconstruction_deactivate_points_that_fall_outside_a_network());
-		}
-
-		// Use natural neighbour coordinates when deforming points in topological networks.
-		const bool deformation_use_natural_neighbour_interpolation =
-				context.reconstruct_params.get_topology_deformation_use_natural_neighbour_interpolation();
+		const create_geometry_time_span_function_type create_geometry_time_span =
+				get_create_geometry_time_span_function(context);
 
 		// Iterate over the feature's present day geometries and generate a topology reconstructed geometry
 		// time span for each geometry.
 		std::vector<Geometry> present_day_geometries;
 		get_present_day_feature_geometries(present_day_geometries);
-		BOOST_FOREACH(const Geometry &present_day_geometry, present_day_geometries)
+		for (unsigned int geometry_index = 0; geometry_index < present_day_geometries.size(); ++geometry_index)
 		{
+			const Geometry &present_day_geometry = present_day_geometries[geometry_index];
+
+			// Use the geometry time span created by a task (if any), otherwise create it now.
 			const TopologyReconstruct::GeometryTimeSpan::non_null_ptr_type topology_reconstructed_geometry_time_span =
-					context.topology_reconstruct.get()->create_geometry_time_span(
-							present_day_geometry.geometry,
-							reconstruction_info.reconstruction_plate_id,
-							reconstruction_info.geometry_import_time,
-							deactivate_points,
-							line_tessellation_radians,
-							deformation_use_natural_neighbour_interpolation);
+					(geometry_index < d_task_topology_reconstructed_geometry_time_spans.size() &&
+						d_task_topology_reconstructed_geometry_time_spans[geometry_index])
+					? d_task_topology_reconstructed_geometry_time_spans[geometry_index].get()
+					: create_geometry_time_span(present_day_geometry.geometry);
 
 			d_topology_reconstructed_geometry_time_spans->push_back(
 					TopologyReconstructedGeometryTimeSpan(
 							present_day_geometry.property_iterator,
 							topology_reconstructed_geometry_time_span));
 		}
+
+		// Release the task results (we've transferred them).
+		d_task_topology_reconstructed_geometry_time_spans.clear();
 	}
 
 	return d_topology_reconstructed_geometry_time_spans.get();
 }
+
+
+void
+GPlatesAppLogic::ReconstructMethodByPlateId::get_topology_reconstructed_geometry_time_span_tasks(
+		std::vector< boost::function<void ()> > &tasks,
+		const Context &context)
+{
+	if (!context.topology_reconstruct ||
+		// Already created...
+		d_topology_reconstructed_geometry_time_spans)
+	{
+		return;
+	}
+
+	// Access the feature now since the tasks can be run on other threads (and the model is not thread-safe).
+	const create_geometry_time_span_function_type create_geometry_time_span =
+			get_create_geometry_time_span_function(context);
+
+	std::vector<Geometry> present_day_geometries;
+	get_present_day_feature_geometries(present_day_geometries);
+
+	// Each task stores its result in its own slot (so tasks don't access each other's results).
+	d_task_topology_reconstructed_geometry_time_spans.clear();
+	d_task_topology_reconstructed_geometry_time_spans.resize(present_day_geometries.size());
+
+	for (unsigned int geometry_index = 0; geometry_index < present_day_geometries.size(); ++geometry_index)
+	{
+		const GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type present_day_geometry =
+				present_day_geometries[geometry_index].geometry;
+		boost::optional<TopologyReconstruct::GeometryTimeSpan::non_null_ptr_type> &geometry_time_span =
+				d_task_topology_reconstructed_geometry_time_spans[geometry_index];
+
+		tasks.push_back(
+				[create_geometry_time_span, present_day_geometry, &geometry_time_span]()
+				{
+					geometry_time_span = create_geometry_time_span(present_day_geometry);
+				});
+	}
+}
+
+
+GPlatesAppLogic::ReconstructMethodByPlateId::create_geometry_time_span_function_type
+GPlatesAppLogic::ReconstructMethodByPlateId::get_create_geometry_time_span_function(
+		const Context &context) const
+{
+	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+			context.topology_reconstruct,
+			GPLATES_ASSERTION_SOURCE);
+
+	const ReconstructionInfo &reconstruction_info = get_reconstruction_info(context);
+
+	// Tessellation of polylines/polygons.
+	boost::optional<double> line_tessellation_radians;
+	if (context.reconstruct_params.get_topology_reconstruction_enable_line_tessellation())
+	{
+		// Convert degrees to radians.
+		line_tessellation_radians = GPlatesMaths::convert_deg_to_rad(
+				context.reconstruct_params.get_topology_reconstruction_line_tessellation_degrees());
+	}
+
+	// Lifetime detection of individual points in the reconstructed/deformed geometries.
+	boost::optional<TopologyReconstruct::DeactivatePoint::non_null_ptr_to_const_type> deactivate_points;
+	if (context.reconstruct_params.get_topology_reconstruction_enable_lifetime_detection())
+	{
+		deactivate_points = TopologyReconstruct::DefaultDeactivatePoint::create(
+				context.reconstruct_params.get_topology_reconstruction_lifetime_detection_threshold_velocity_delta(),
+				context.reconstruct_params.get_topology_reconstruction_lifetime_detection_threshold_distance_to_boundary(),
+				context.reconstruct_params.get_topology_reconstruction_deactivate_points_that_fall_outside_a_network());
+	}
+
+	// Use natural neighbour coordinates when deforming points in topological networks.
+	const bool deformation_use_natural_neighbour_interpolation =
+			context.reconstruct_params.get_topology_deformation_use_natural_neighbour_interpolation();
+
+	const TopologyReconstruct::non_null_ptr_to_const_type topology_reconstruct = context.topology_reconstruct.get();
+	const GPlatesModel::integer_plate_id_type reconstruction_plate_id = reconstruction_info.reconstruction_plate_id;
+	const double geometry_import_time = reconstruction_info.geometry_import_time;
+
+	return [topology_reconstruct,
+			reconstruction_plate_id,
+			geometry_import_time,
+			deactivate_points,
+			line_tessellation_radians,
+			deformation_use_natural_neighbour_interpolation](
+					const GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type &present_day_geometry)
+	{
+		return topology_reconstruct->create_geometry_time_span(
+				present_day_geometry,
+				reconstruction_plate_id,
+				geometry_import_time,
+				deactivate_points,
+				line_tessellation_radians,
+				deformation_use_natural_neighbour_interpolation);
+	};
+}
@@ -101,6 +101,21 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time);
 
 
+		/**
+		 * Same as @a reconstruct_feature_geometries except the rotated points are appended directly
+		 * to @a reconstructed_points (without creating reconstructed feature geometries).
+		 *
+		 * Features reconstructed using topologies fall back to the default (base class) implementation.
+		 */
+		virtual
+		void
+		reconstruct_feature_geometries_bulk(
+				std::vector<BulkReconstructedGeometry> &reconstructed_geometries,
+				std::vector<GPlatesMaths::PointOnSphere> &reconstructed_points,
+				const Context &context,
+				const double &reconstruction_time);
+
+
 		/**
 		 * Calculates velocities at the positions of the reconstructed feature geometries, of the feature
 		 * associated with this reconstruct method, at the specified reconstruction time and returns
@@ -148,6 +163,18 @@ namespace GPlatesAppLogic
 				topology_reconstructed_geometry_time_span_sequence_type &topology_reconstructed_geometry_time_spans,
 				const Context &context);
 
+
+		/**
+		 * Appends tasks that create the topology-reconstructed geometry time spans (if they've not yet been created).
+		 *
+		 * The tasks can be run concurrently.
+		 */
+		virtual
+		void
+		get_topology_reconstructed_geometry_time_span_tasks(
+				std::vector< boost::function<void ()> > &tasks,
+				const Context &context);
+
 	private:
 
 		/**
@@ -180,12 +207,34 @@ namespace GPlatesAppLogic
 		 */
 		mutable boost::optional<topology_reconstructed_geometry_time_span_sequence_type> d_topology_reconstructed_geometry_time_spans;
 
+		/**
+		 * Topology reconstructed geometry time spans created by tasks (see @a get_topology_reconstructed_geometry_time_span_tasks).
+		 *
+		 * There's one entry for each feature geometry property (and it's none until its task has run).
+		 * These are transferred to @a d_topology_reconstructed_geometry_time_spans when it is next accessed.
+		 */
+		mutable std::vector< boost::optional<TopologyReconstruct::GeometryTimeSpan::non_null_ptr_type> >
+				d_task_topology_reconstructed_geometry_time_spans;
+
+
+		//! Typedef for a function that creates a topology reconstructed time span from a present day geometry.
+		typedef boost::function<
+				TopologyReconstruct::GeometryTimeSpan::non_null_ptr_type (
+						const GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type &)>
+								create_geometry_time_span_function_type;
+
 
 		explicit
 		ReconstructMethodByPlateId(
 				const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
 				const Context &context);
 
+		/**
+		 * Returns the cached present day geometries (gathering them first if not already cached).
+		 */
+		const std::vector<Geometry> &
+		get_cached_present_day_feature_geometries() const;
+
 		const ReconstructionInfo &
 		get_reconstruction_info(
 				const Context &context) const;
@@ -193,6 +242,16 @@ namespace GPlatesAppLogic
 		boost::optional<const topology_reconstructed_geometry_time_span_sequence_type &>
 		get_topology_reconstruction_info(
 				const Context &context) const;
+
+		/**
+		 * Returns a function that creates a topology reconstructed time span from a present day geometry.
+		 *
+		 * The feature properties are accessed by this method (not by the returned function) which means
+		 * the returned function can be called concurrently by multiple threads.
+		 */
+		create_geometry_time_span_function_type
+		get_create_geometry_time_span_function(
+				const Context &context) const;
 	};
 }
 
@@ -24,6 +24,7 @@
  */
 
 #include <boost/foreach.hpp>
+#include <boost/optional.hpp>
 
 #include "ReconstructMethodInterface.h"
 
@@ -36,6 +37,76 @@
 #include "model/types.h"
 
 
+void
+GPlatesAppLogic::ReconstructMethodInterface::reconstruct_feature_geometries_bulk(
+		std::vector<BulkReconstructedGeometry> &reconstructed_geometries,
+		std::vector<GPlatesMaths::PointOnSphere> &reconstructed_points,
+		const Context &context,
+		const double &reconstruction_time)
+{
+	std::vector<ReconstructedFeatureGeometry::non_null_ptr_type> reconstructed_feature_geometries;
+	reconstruct_feature_geometries(
+			reconstructed_feature_geometries,
+			ReconstructHandle::get_next_reconstruct_handle(),
+			context,
+			reconstruction_time);
+	if (reconstructed_feature_geometries.empty())
+	{
+		return;
+	}
+
+	// Used to map each RFG's geometry property to its present day geometry index.
+	std::vector<Geometry> present_day_geometries;
+	get_present_day_feature_geometries(present_day_geometries);
+	const unsigned int num_present_day_geometries = present_day_geometries.size();
+
+	// The RFGs are typically generated in the same order as the present day geometries, so start
+	// searching at the present day geometry following the previous match (and wrap around).
+	// This avoids a quadratic search for features with many geometry properties.
+	unsigned int next_present_day_geometry_index = 0;
+
+	BOOST_FOREACH(
+			const ReconstructedFeatureGeometry::non_null_ptr_type &rfg,
+			reconstructed_feature_geometries)
+	{
+		const GPlatesModel::FeatureHandle::iterator rfg_geometry_property_iterator = rfg->property();
+
+		boost::optional<unsigned int> present_day_geometry_index;
+		for (unsigned int n = 0; n < num_present_day_geometries; ++n)
+		{
+			const unsigned int index = (next_present_day_geometry_index + n) % num_present_day_geometries;
+			if (present_day_geometries[index].property_iterator == rfg_geometry_property_iterator)
+			{
+				present_day_geometry_index = index;
+				break;
+			}
+		}
+
+		// Skip any RFG that did not come from a present day geometry (shouldn't happen).
+		if (!present_day_geometry_index)
+		{
+			continue;
+		}
+
+		next_present_day_geometry_index = (present_day_geometry_index.get() + 1) % num_present_day_geometries;
+
+		BulkReconstructedGeometry reconstructed_geometry;
+		reconstructed_geometry.present_day_geometry_index = present_day_geometry_index.get();
+		// If there's no reconstruction plate ID then the identity rotation was used (plate zero).
+		reconstructed_geometry.reconstruction_plate_id = rfg->reconstruction_plate_id()
+				? rfg->reconstruction_plate_id().get()
+				: 0;
+		reconstructed_geometry.points_begin = reconstructed_points.size();
+		reconstructed_geometry.geometry_type = GeometryUtils::get_geometry_points(
+				*rfg->reconstructed_geometry(),
+				reconstructed_points);
+		reconstructed_geometry.points_end = reconstructed_points.size();
+
+		reconstructed_geometries.push_back(reconstructed_geometry);
+	}
+}
+
+
 void
 GPlatesAppLogic::ReconstructMethodInterface::reconstruct_feature_velocities_by_plate_id(
 		std::vector<MultiPointVectorField::non_null_ptr_type> &reconstructed_feature_velocities,
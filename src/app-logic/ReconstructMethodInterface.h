@@ -41,8 +41,11 @@
 #include "VelocityDeltaTime.h"
 
 #include "maths/GeometryOnSphere.h"
+#include "maths/GeometryType.h"
+#include "maths/PointOnSphere.h"
 
 #include "model/FeatureHandle.h"
+#include "model/types.h"
 
 #include "utils/ReferenceCount.h"
 
@@ -104,6 +107,33 @@ namespace GPlatesAppLogic
 		typedef std::vector<TopologyReconstructedGeometryTimeSpan> topology_reconstructed_geometry_time_span_sequence_type;
 
 
+		/**
+		 * A reconstructed geometry whose points are stored in a flat array shared by all reconstructed
+		 * geometries (see @a reconstruct_feature_geometries_bulk).
+		 *
+		 * Unlike @a ReconstructedFeatureGeometry this is a plain value (no heap allocation and no
+		 * reference to the feature).
+		 */
+		struct BulkReconstructedGeometry
+		{
+			//! Index into the geometries returned by @a get_present_day_feature_geometries.
+			unsigned int present_day_geometry_index;
+
+			GPlatesModel::integer_plate_id_type reconstruction_plate_id;
+
+			GPlatesMaths::GeometryType::Value geometry_type;
+
+			/**
+			 * The reconstructed points are in the half-open range [points_begin, points_end) of the points array.
+			 *
+			 * For polygons the exterior ring points are followed by the interior ring points
+			 * (see GeometryUtils::get_geometry_points).
+			 */
+			unsigned int points_begin;
+			unsigned int points_end;
+		};
+
+
 		/**
 		 * Extrinsic reconstruction state that features are reconstructed with - this is information
 		 * that is "passed into" a reconstruct method during reconstruction (and initialisation).
@@ -225,6 +255,24 @@ namespace GPlatesAppLogic
 				const Context &context,
 				const double &reconstruction_time) = 0;
 
+		/**
+		 * Same as @a reconstruct_feature_geometries except the reconstructed geometries are appended
+		 * to @a reconstructed_geometries and their points are appended to @a reconstructed_points.
+		 *
+		 * This is intended for clients (such as exporters) that only need the reconstructed positions
+		 * of a large number of features and not the per-geometry @a ReconstructedFeatureGeometry objects.
+		 *
+		 * The default implementation reconstructs @a ReconstructedFeatureGeometry objects and copies
+		 * their points (derived classes can override to avoid creating them).
+		 */
+		virtual
+		void
+		reconstruct_feature_geometries_bulk(
+				std::vector<BulkReconstructedGeometry> &reconstructed_geometries,
+				std::vector<GPlatesMaths::PointOnSphere> &reconstructed_points,
+				const Context &context,
+				const double &reconstruction_time);
+
 
 		/**
 		 * Calculates velocities at the positions of the reconstructed feature geometries, of the feature
@@ -303,6 +351,28 @@ namespace GPlatesAppLogic
 			// By default, does nothing. Currently overridden by @a ReconstructMethodByPlateId.
 		}
 
+
+		/**
+		 * Appends tasks that create any topology-reconstructed geometry time spans that have not yet
+		 * been created (see @a get_topology_reconstructed_geometry_time_spans).
+		 *
+		 * Creating the time spans is expensive (every geometry point is reconstructed over every time step)
+		 * so this enables the time spans of all features to be created using multiple threads.
+		 * The features are accessed when the tasks are *appended* (since the model is not thread-safe),
+		 * so the tasks themselves can be run concurrently. The tasks must be run before any other
+		 * methods are called on this reconstruct method.
+		 *
+		 * Any time spans not created by a task are instead created when they are first needed.
+		 */
+		virtual
+		void
+		get_topology_reconstructed_geometry_time_span_tasks(
+				std::vector< boost::function<void ()> > &tasks,
+				const Context &context)
+		{
+			// By default, does nothing. Currently overridden by @a ReconstructMethodByPlateId.
+		}
+
 	protected:
 
 		/**
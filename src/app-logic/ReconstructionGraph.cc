@@ -0,0 +1,122 @@
+/* $Id$ */
+
+/**
+ * \file 
+ * $Revision$
+ * $Date$
+ * 
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+
+#include "ReconstructionGraph.h"
+
+
+GPlatesMaths::FiniteRotation
+GPlatesAppLogic::ReconstructionGraph::Edge::calculate_relative_rotation(
+		const GPlatesPropertyValues::GeoTimeInstant &time_instant) const
+{
+	const pole_sample_seq_type &pole = d_pole;
+
+	// The pole samples are sorted from youngest to oldest, so binary search for the first pole sample
+	// (after the youngest) such that the time is later than (ie, less far in the past than) the pole sample time.
+	// The time must then lie between the previous and current time samples
+	// (or be coincident with previous time sample).
+	// Note that we have been guaranteed to have at least two time samples.
+	const pole_sample_seq_type::const_iterator pole_iter = std::partition_point(
+			pole.begin() + 1,
+			pole.end(),
+			[&time_instant](const PoleSample &pole_sample)
+			{
+				return !time_instant.is_strictly_later_than(pole_sample.get_time_instant());
+			});
+	if (pole_iter != pole.end())
+	{
+		const PoleSample &pole_sample = *pole_iter;
+		const PoleSample &prev_pole_sample = *(pole_iter - 1);
+
+		if (time_instant.is_coincident_with(prev_pole_sample.get_time_instant()))
+		{
+			// An exact match!  Hence, we can use the FiniteRotation of the previous time
+			// sample directly, without need for interpolation.
+			return prev_pole_sample.get_finite_rotation();
+		}
+		else if (pole_sample.get_time_instant().is_distant_past())
+		{
+			// We now allow the oldest time sample to be distant-past (+Infinity).
+			//
+			// Since the pole is infinitely far in the past it essentially would get ignored if we
+			// interpolated between it and the previous pole (at the requested time).
+			// In other words the interpolation ratio would be '(t - t_prev) / (Inf - t_prev)'
+			// which is zero, and so the distant-past (current) pole would get zero weighting.
+			//
+			// So we just use the previous pole.
+			//
+			// This path should only happen when ReconstructionGraph creates extra graph edges
+			// that extend to the distant past, and it keeps the pole constant during this
+			// extended time range, so both previous and current poles should be the same anyway.
+			return prev_pole_sample.get_finite_rotation();
+		}
+		else if (prev_pole_sample.get_time_instant().is_distant_future())
+		{
+			// We now allow the youngest time sample to be distant-future (-Infinity).
+			//
+			// Since the previous pole is infinitely far in the future it essentially would get ignored
+			// if we interpolated between it and the current pole (at the requested time).
+			// In other words the interpolation ratio would be '(t - -Inf) / (t_curr - -Inf)'
+			// which is one, and so the distant-future (prev) pole would get zero (1.0 - 1.0 = 0.0) weighting.
+			//
+			// So we just use the current pole.
+			//
+			// It is assumed that the user is only creating a pole sample at the distant-future
+			// to extend, for example, a present-day pole sample into the future.
+			// In other words, the total rotation is constant from present day to the distant future.
+			// If this is not the case then essentially the present-day pole sample will be extended
+			// as if it was constant in the distant future.
+			return pole_sample.get_finite_rotation();
+		}
+
+		const GPlatesMaths::FiniteRotation &prev_finite_rotation = prev_pole_sample.get_finite_rotation();
+		const GPlatesMaths::FiniteRotation &finite_rotation = pole_sample.get_finite_rotation();
+
+		// If either of the finite rotations has an axis hint, use it.
+		boost::optional<GPlatesMaths::UnitVector3D> axis_hint;
+		if (prev_finite_rotation.axis_hint())
+		{
+			axis_hint = prev_finite_rotation.axis_hint();
+		}
+		else if (finite_rotation.axis_hint())
+		{
+			axis_hint = finite_rotation.axis_hint();
+		}
+
+		// Interpolate between the previous and current finite rotations.
+		return GPlatesMaths::interpolate(
+				prev_finite_rotation,
+				finite_rotation,
+				prev_pole_sample.get_time_instant().value(),
+				pole_sample.get_time_instant().value(),
+				time_instant.value(),
+				axis_hint);
+	}
+
+	// The time must coincide with the time of the last pole sample because
+	// the caller ensures the time is contained in the inclusive time bounds of the pole.
+	return pole.back().get_finite_rotation();
+}
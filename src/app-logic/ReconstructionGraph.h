@@ -28,7 +28,10 @@
 #ifndef GPLATES_APP_LOGIC_RECONSTRUCTIONGRAPH_H
 #define GPLATES_APP_LOGIC_RECONSTRUCTIONGRAPH_H
 
+#include <algorithm>
 #include <map>
+#include <utility>
+#include <vector>
 #include <boost/intrusive/slist.hpp>
 #include <boost/optional.hpp>
 #include <boost/pool/object_pool.hpp>
@@ -73,24 +76,10 @@ namespace GPlatesAppLogic
 		//
 
 
-		// Some setup needed for an intrusive list of pole samples.
-		typedef boost::intrusive::slist_base_hook<
-				// Turn off safe linking (the default link mode) because it asserts if we destroy
-				// a pole sample before removing it from a list (eg, a list inside an edge).
-				// Well, we actually destroy all edges before pole samples, so this never actually happens.
-				// But since we're destroying the entire graph in one go, we don't want the list destructors
-				// to go to the extra (unnecessary) effort of setting each hook in list to default hook state...
-				//
-				// NOTE: This should be changed back to 'safe_link' if debugging a problem though...
-				boost::intrusive::link_mode<boost::intrusive::normal_link> >
-						pole_sample_list_base_hook_type;
-
 		/**
 		 * Represents the finite rotation value of a pole at a specific time instant.
 		 */
-		class PoleSample :
-				// Using an intrusive list avoids extra memory allocations and is generally faster...
-				public pole_sample_list_base_hook_type
+		class PoleSample
 		{
 		public:
 
@@ -112,7 +101,6 @@ namespace GPlatesAppLogic
 		private:
 
 			friend class ReconstructionGraphBuilder;
-			friend class boost::object_pool<PoleSample>;  // Access to Pole constructor.
 
 			PoleSample(
 					const GPlatesPropertyValues::GeoTimeInstant &time_instant,
@@ -126,14 +114,12 @@ namespace GPlatesAppLogic
 		};
 
 		/**
-		 * Typedef for a list of pole samples.
+		 * Typedef for a sequence of pole samples.
 		 *
-		 * Note: Using a *singly*-linked list since don't need to do insertions (saves a small amount of memory).
+		 * Note: Using a contiguous array (rather than a list) so that the pole samples bracketing
+		 * a reconstruction time can be found with a binary search.
 		 */
-		typedef boost::intrusive::slist<PoleSample,
-				boost::intrusive::base_hook<pole_sample_list_base_hook_type>,
-				boost::intrusive::cache_last<true>/*enable push_back() and back()*/>
-						pole_sample_list_type;
+		typedef std::vector<PoleSample> pole_sample_seq_type;
 
 
 		// Some setup needed for an intrusive list of plate *incoming* edges.
@@ -193,11 +179,11 @@ namespace GPlatesAppLogic
 			/**
 			 * Return the sequence of pole time samples.
 			 *
-			 * These are ordered from youngest to oldest (same as in a rotation feature or file).
+			 * These are sorted from youngest to oldest (typically the same order as in a rotation feature or file).
 			 *
 			 * Note: This is guaranteed to be at least two time samples.
 			 */
-			const pole_sample_list_type &
+			const pole_sample_seq_type &
 			get_pole() const
 			{
 				return d_pole;
@@ -221,6 +207,16 @@ namespace GPlatesAppLogic
 				return d_pole.front().get_time_instant();
 			}
 
+			/**
+			 * Calculate the relative rotation (of the moving plate relative to the fixed plate) at the
+			 * specified time by interpolating the pole samples.
+			 *
+			 * Note: @a time_instant should be inside the [begin,end] time range of this edge.
+			 */
+			GPlatesMaths::FiniteRotation
+			calculate_relative_rotation(
+					const GPlatesPropertyValues::GeoTimeInstant &time_instant) const;
+
 		private:
 
 			friend class ReconstructionGraphBuilder;
@@ -235,7 +231,135 @@ namespace GPlatesAppLogic
 
 			Plate *d_fixed_plate;
 			Plate *d_moving_plate;
-			pole_sample_list_type d_pole;
+			pole_sample_seq_type d_pole;
+		};
+
+
+		/**
+		 * Indexes the edges of a plate by time so that the edges whose time range contains a particular
+		 * reconstruction time can be found without testing every edge of the plate.
+		 *
+		 * The distinct begin/end times of the edges (sorted youngest to oldest) divide time into slots,
+		 * where each distinct time is a slot and each interval between adjacent distinct times is a slot.
+		 * Each slot lists the edges whose inclusive [begin,end] time range contains that slot.
+		 *
+		 * Within each slot the edges are in the same order as the plate's edge list, so that
+		 * @a ReconstructionTree visits the edges in the same order regardless of whether it uses
+		 * this index or the plate's edge list.
+		 */
+		class EdgeTimeIndex
+		{
+		public:
+
+			//! Typedef for a sequence of edges.
+			typedef std::vector<const Edge *> edge_seq_type;
+
+			//! Typedef for an iterator over a sequence of edges.
+			typedef edge_seq_type::const_iterator edge_iterator;
+
+			/**
+			 * Return the edges whose inclusive [begin,end] time range contains @a time_instant.
+			 */
+			std::pair<edge_iterator, edge_iterator>
+			get_edges(
+					const GPlatesPropertyValues::GeoTimeInstant &time_instant) const
+			{
+				// The number of distinct times that are strictly later (younger) than the time instant.
+				const unsigned int num_later_times = get_num_later_times(time_instant);
+
+				// Slots alternate between the interval before each distinct time and the distinct time itself.
+				unsigned int slot = 2 * num_later_times;
+				if (num_later_times < d_times.size() &&
+					d_times[num_later_times].is_coincident_with(time_instant))
+				{
+					++slot;
+				}
+
+				return std::make_pair(
+						d_edges.begin() + d_slot_offsets[slot],
+						d_edges.begin() + d_slot_offsets[slot + 1]);
+			}
+
+			/**
+			 * Return the distinct edge times bounding the slot containing @a time_instant
+			 * (as a pair of the later bound followed by the earlier bound).
+			 *
+			 * @a get_edges returns the same edges for all times in the slot.
+			 *
+			 * If @a time_instant coincides with a distinct edge time then the slot is that time
+			 * (and both bounds are that time). Otherwise the slot is the open interval between the bounds,
+			 * where a missing bound means the slot extends to the distant future (or distant past).
+			 */
+			std::pair<
+					boost::optional<GPlatesPropertyValues::GeoTimeInstant>,
+					boost::optional<GPlatesPropertyValues::GeoTimeInstant> >
+			get_time_slot_bounds(
+					const GPlatesPropertyValues::GeoTimeInstant &time_instant) const
+			{
+				const unsigned int num_later_times = get_num_later_times(time_instant);
+
+				if (num_later_times < d_times.size() &&
+					d_times[num_later_times].is_coincident_with(time_instant))
+				{
+					return std::make_pair(
+							boost::optional<GPlatesPropertyValues::GeoTimeInstant>(d_times[num_later_times]),
+							boost::optional<GPlatesPropertyValues::GeoTimeInstant>(d_times[num_later_times]));
+				}
+
+				boost::optional<GPlatesPropertyValues::GeoTimeInstant> later_bound;
+				if (num_later_times > 0)
+				{
+					later_bound = d_times[num_later_times - 1];
+				}
+
+				boost::optional<GPlatesPropertyValues::GeoTimeInstant> earlier_bound;
+				if (num_later_times < d_times.size())
+				{
+					earlier_bound = d_times[num_later_times];
+				}
+
+				return std::make_pair(later_bound, earlier_bound);
+			}
+
+		private:
+
+			friend class ReconstructionGraphBuilder;
+			friend class Plate;  // Access to EdgeTimeIndex constructor.
+
+			EdgeTimeIndex() :
+				// An empty index has a single (empty) slot...
+				d_slot_offsets(2, 0)
+			{  }
+
+			unsigned int
+			get_num_later_times(
+					const GPlatesPropertyValues::GeoTimeInstant &time_instant) const
+			{
+				return std::partition_point(
+						d_times.begin(),
+						d_times.end(),
+						[&time_instant](const GPlatesPropertyValues::GeoTimeInstant &time)
+						{
+							return time.is_strictly_later_than(time_instant);
+						}) - d_times.begin();
+			}
+
+			/**
+			 * The distinct begin/end times of the edges sorted from youngest to oldest.
+			 */
+			std::vector<GPlatesPropertyValues::GeoTimeInstant> d_times;
+
+			/**
+			 * The edges of slot 'n' are in the range [d_slot_offsets[n], d_slot_offsets[n+1]) of @a d_edges.
+			 *
+			 * There are '2 * d_times.size() + 1' slots.
+			 */
+			std::vector<unsigned int> d_slot_offsets;
+
+			/**
+			 * The edges of all slots.
+			 */
+			edge_seq_type d_edges;
 		};
 
 
@@ -296,6 +420,28 @@ namespace GPlatesAppLogic
 				return d_outgoing_edges;
 			}
 
+			/**
+			 * Index of the edges going *into* this plate by time.
+			 *
+			 * Used to find those incoming edges whose time range contains a reconstruction time.
+			 */
+			const EdgeTimeIndex &
+			get_incoming_edge_time_index() const
+			{
+				return d_incoming_edge_time_index;
+			}
+
+			/**
+			 * Index of the edges going *out* of this plate by time.
+			 *
+			 * Used to find those outgoing edges whose time range contains a reconstruction time.
+			 */
+			const EdgeTimeIndex &
+			get_outgoing_edge_time_index() const
+			{
+				return d_outgoing_edge_time_index;
+			}
+
 		private:
 
 			friend class ReconstructionGraphBuilder;
@@ -310,6 +456,10 @@ namespace GPlatesAppLogic
 			GPlatesModel::integer_plate_id_type d_plate_id;
 			plate_incoming_edge_list_type d_incoming_edges;
 			plate_outgoing_edge_list_type d_outgoing_edges;
+
+			// These are built (by ReconstructionGraphBuilder) after all edges have been added.
+			EdgeTimeIndex d_incoming_edge_time_index;
+			EdgeTimeIndex d_outgoing_edge_time_index;
 		};
 
 
@@ -350,8 +500,7 @@ namespace GPlatesAppLogic
 		//! Typedef for mapping plate IDs to @a Plate objects.
 		typedef std::map<GPlatesModel::integer_plate_id_type, Plate *> plate_map_type;
 
-		// Storage for the pole samples, edges and plates.
-		boost::object_pool<PoleSample> d_pole_sample_pool;
+		// Storage for the edges and plates.
 		boost::object_pool<Edge> d_edge_pool;
 		boost::object_pool<Plate> d_plate_pool;
 
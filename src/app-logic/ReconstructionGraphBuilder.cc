@@ -23,11 +23,50 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <new>
 
 #include "ReconstructionGraphBuilder.h"
 
 
+namespace GPlatesAppLogic
+{
+	namespace
+	{
+		/**
+		 * Returns true if the time of pole sample @a lhs is strictly later (younger) than that of @a rhs.
+		 */
+		bool
+		is_pole_sample_strictly_later_than(
+				const ReconstructionGraphBuilder::total_reconstruction_pole_time_sample_type &lhs,
+				const ReconstructionGraphBuilder::total_reconstruction_pole_time_sample_type &rhs)
+		{
+			return lhs.first.is_strictly_later_than(rhs.first);
+		}
+
+		/**
+		 * Returns the edges in the specified edge list as a sequence of edge pointers.
+		 */
+		template <class EdgeListType>
+		ReconstructionGraph::EdgeTimeIndex::edge_seq_type
+		get_edge_seq(
+				const EdgeListType &edge_list)
+		{
+			ReconstructionGraph::EdgeTimeIndex::edge_seq_type edges;
+
+			typename EdgeListType::const_iterator edge_iter = edge_list.begin();
+			typename EdgeListType::const_iterator edge_end = edge_list.end();
+			for ( ; edge_iter != edge_end; ++edge_iter)
+			{
+				edges.push_back(&*edge_iter);
+			}
+
+			return edges;
+		}
+	}
+}
+
+
 GPlatesAppLogic::ReconstructionGraphBuilder::ReconstructionGraphBuilder(
 		bool extend_total_reconstruction_poles_to_distant_past_) :
 	d_reconstruction_graph(ReconstructionGraph::create()),
@@ -107,19 +146,25 @@ GPlatesAppLogic::ReconstructionGraphBuilder::insert_total_reconstruction_sequenc
 		throw std::bad_alloc();
 	}
 
+	// The pole samples of a graph edge are searched (by ReconstructionTree) using a binary search,
+	// so they must be sorted from youngest to oldest. They usually are already (in a rotation feature or file).
+	const total_reconstruction_pole_type *sorted_pole = &pole;
+	total_reconstruction_pole_type sorted_pole_storage;
+	if (!std::is_sorted(pole.begin(), pole.end(), &is_pole_sample_strictly_later_than))
+	{
+		sorted_pole_storage = pole;
+		std::stable_sort(sorted_pole_storage.begin(), sorted_pole_storage.end(), &is_pole_sample_strictly_later_than);
+		sorted_pole = &sorted_pole_storage;
+	}
+
 	// Add the total reconstruction pole samples to the edge.
-	total_reconstruction_pole_type::const_iterator pole_iter = pole.begin();
-	total_reconstruction_pole_type::const_iterator pole_end = pole.end();
+	edge->d_pole.reserve(sorted_pole->size());
+	total_reconstruction_pole_type::const_iterator pole_iter = sorted_pole->begin();
+	total_reconstruction_pole_type::const_iterator pole_end = sorted_pole->end();
 	for ( ; pole_iter != pole_end; ++pole_iter)
 	{
-		ReconstructionGraph::PoleSample *pole_sample = d_reconstruction_graph->d_pole_sample_pool.construct(
-				pole_iter->first, pole_iter->second);
-		if (pole_sample == NULL)
-		{
-			throw std::bad_alloc();
-		}
-
-		edge->d_pole.push_back(*pole_sample);
+		edge->d_pole.push_back(
+				ReconstructionGraph::PoleSample(pole_iter->first, pole_iter->second));
 	}
 
 	// Add the edge to the fixed and moving plates.
@@ -148,6 +193,9 @@ GPlatesAppLogic::ReconstructionGraphBuilder::build_graph()
 		extend_total_reconstruction_poles_to_distant_past();
 	}
 
+	// Now that all edges have been added we can index them by time.
+	build_edge_time_indices();
+
 	// The built reconstruction graph to return.
 	ReconstructionGraph::non_null_ptr_type built_reconstruction_graph = d_reconstruction_graph;
 
@@ -222,32 +270,144 @@ GPlatesAppLogic::ReconstructionGraphBuilder::extend_total_reconstruction_poles_t
 			throw std::bad_alloc();
 		}
 
-		const ReconstructionGraph::PoleSample &oldest_pole_sample = oldest_incoming_edge->get_pole().back();
+		// Note: Copy (rather than reference) since we're about to add to another edge's pole sample array.
+		const ReconstructionGraph::PoleSample oldest_pole_sample = oldest_incoming_edge->get_pole().back();
+
+		distant_past_edge->d_pole.reserve(2);
 
 		// The youngest pole sample of new distant-past edge equals the oldest pole sample.
 		// And its time instant is also equal.
-		ReconstructionGraph::PoleSample *distant_past_edge_youngest_pole_sample = d_reconstruction_graph->d_pole_sample_pool.construct(
-				oldest_pole_sample.get_time_instant(),
-				oldest_pole_sample.get_finite_rotation());
-		if (distant_past_edge_youngest_pole_sample == NULL)
-		{
-			throw std::bad_alloc();
-		}
-		distant_past_edge->d_pole.push_back(*distant_past_edge_youngest_pole_sample);
+		distant_past_edge->d_pole.push_back(
+				ReconstructionGraph::PoleSample(
+						oldest_pole_sample.get_time_instant(),
+						oldest_pole_sample.get_finite_rotation()));
 
 		// The oldest pole sample of new distant-past edge also equals its youngest pole sample.
 		// But its time instant is the distant past.
-		ReconstructionGraph::PoleSample *distant_past_edge_oldest_pole_sample = d_reconstruction_graph->d_pole_sample_pool.construct(
-				GPlatesPropertyValues::GeoTimeInstant::create_distant_past(),
-				oldest_pole_sample.get_finite_rotation());
-		if (distant_past_edge_oldest_pole_sample == NULL)
-		{
-			throw std::bad_alloc();
-		}
-		distant_past_edge->d_pole.push_back(*distant_past_edge_oldest_pole_sample);
+		distant_past_edge->d_pole.push_back(
+				ReconstructionGraph::PoleSample(
+						GPlatesPropertyValues::GeoTimeInstant::create_distant_past(),
+						oldest_pole_sample.get_finite_rotation()));
 
 		// Add the distant-past edge to the fixed and moving plates.
 		fixed_plate.d_outgoing_edges.push_front(*distant_past_edge);
 		moving_plate.d_incoming_edges.push_front(*distant_past_edge);
 	}
 }
+
+
+void
+GPlatesAppLogic::ReconstructionGraphBuilder::build_edge_time_indices()
+{
+	// Iterate over all plates in the graph.
+	ReconstructionGraph::plate_map_type::const_iterator plate_iter = d_reconstruction_graph->d_plate_map.begin();
+	ReconstructionGraph::plate_map_type::const_iterator plate_end = d_reconstruction_graph->d_plate_map.end();
+	for( ; plate_iter != plate_end; ++plate_iter)
+	{
+		ReconstructionGraph::Plate &plate = *plate_iter->second;
+
+		build_edge_time_index(
+				plate.d_incoming_edge_time_index,
+				get_edge_seq(plate.get_incoming_edges()));
+		build_edge_time_index(
+				plate.d_outgoing_edge_time_index,
+				get_edge_seq(plate.get_outgoing_edges()));
+	}
+}
+
+
+void
+GPlatesAppLogic::ReconstructionGraphBuilder::build_edge_time_index(
+		ReconstructionGraph::EdgeTimeIndex &edge_time_index,
+		const ReconstructionGraph::EdgeTimeIndex::edge_seq_type &edges)
+{
+	typedef ReconstructionGraph::EdgeTimeIndex::edge_seq_type edge_seq_type;
+
+	//
+	// Gather the distinct begin/end times of the edges and sort them from youngest to oldest.
+	//
+
+	std::vector<GPlatesPropertyValues::GeoTimeInstant> &times = edge_time_index.d_times;
+	times.clear();
+	times.reserve(2 * edges.size());
+
+	edge_seq_type::const_iterator edges_iter = edges.begin();
+	edge_seq_type::const_iterator edges_end = edges.end();
+	for ( ; edges_iter != edges_end; ++edges_iter)
+	{
+		const ReconstructionGraph::Edge *edge = *edges_iter;
+
+		times.push_back(edge->get_end_time());
+		times.push_back(edge->get_begin_time());
+	}
+
+	std::sort(
+			times.begin(),
+			times.end(),
+			[](const GPlatesPropertyValues::GeoTimeInstant &lhs, const GPlatesPropertyValues::GeoTimeInstant &rhs)
+			{
+				return lhs.is_strictly_later_than(rhs);
+			});
+	times.erase(
+			std::unique(
+					times.begin(),
+					times.end(),
+					[](const GPlatesPropertyValues::GeoTimeInstant &lhs, const GPlatesPropertyValues::GeoTimeInstant &rhs)
+					{
+						return lhs.is_coincident_with(rhs);
+					}),
+			times.end());
+
+	//
+	// Each edge is active over a contiguous range of slots, from the slot of its end (youngest) time
+	// to the slot of its begin (oldest) time. Slot '2*n+1' is the distinct time 'n' and slot '2*n'
+	// is the interval between distinct times 'n-1' and 'n'.
+	//
+
+	const unsigned int num_slots = 2 * times.size() + 1;
+
+	std::vector< std::pair<unsigned int, unsigned int> > edge_slot_ranges;
+	edge_slot_ranges.reserve(edges.size());
+
+	// Record the change in the number of edges from one slot to the next.
+	std::vector<int> slot_edge_count_differences(num_slots + 1, 0);
+	for (edges_iter = edges.begin(); edges_iter != edges_end; ++edges_iter)
+	{
+		const ReconstructionGraph::Edge *edge = *edges_iter;
+
+		const unsigned int first_slot = 2 * edge_time_index.get_num_later_times(edge->get_end_time()) + 1;
+		const unsigned int last_slot = 2 * edge_time_index.get_num_later_times(edge->get_begin_time()) + 1;
+		edge_slot_ranges.push_back(std::make_pair(first_slot, last_slot));
+
+		++slot_edge_count_differences[first_slot];
+		--slot_edge_count_differences[last_slot + 1];
+	}
+
+	// Convert the slot edge count differences to slot offsets.
+	std::vector<unsigned int> &slot_offsets = edge_time_index.d_slot_offsets;
+	slot_offsets.resize(num_slots + 1);
+	int num_edges_in_slot = 0;
+	unsigned int slot_offset = 0;
+	for (unsigned int slot = 0; slot < num_slots; ++slot)
+	{
+		num_edges_in_slot += slot_edge_count_differences[slot];
+
+		slot_offsets[slot] = slot_offset;
+		slot_offset += num_edges_in_slot;
+	}
+	slot_offsets[num_slots] = slot_offset;
+
+	// Fill the slots with edges (in edge list order within each slot).
+	edge_seq_type &slot_edges = edge_time_index.d_edges;
+	slot_edges.assign(slot_offset, NULL);
+	std::vector<unsigned int> slot_fill_offsets(slot_offsets.begin(), slot_offsets.end() - 1);
+	for (unsigned int edge_index = 0; edge_index < edges.size(); ++edge_index)
+	{
+		for (unsigned int slot = edge_slot_ranges[edge_index].first;
+			slot <= edge_slot_ranges[edge_index].second;
+			++slot)
+		{
+			slot_edges[slot_fill_offsets[slot]++] = edges[edge_index];
+		}
+	}
+}
@@ -111,6 +111,18 @@ namespace GPlatesAppLogic
 
 		void
 		extend_total_reconstruction_poles_to_distant_past();
+
+		/**
+		 * Index the incoming and outgoing edges of each plate by time.
+		 */
+		void
+		build_edge_time_indices();
+
+		static
+		void
+		build_edge_time_index(
+				ReconstructionGraph::EdgeTimeIndex &edge_time_index,
+				const ReconstructionGraph::EdgeTimeIndex::edge_seq_type &edges);
 	};
 }
 
@@ -0,0 +1,467 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+
+#include "ReconstructionRotationTable.h"
+
+#include "ReconstructionTree.h"
+#include "ReconstructionTreeCreator.h"
+
+#include "global/GPlatesAssert.h"
+#include "global/PreconditionViolationError.h"
+
+#include "property-values/GeoTimeInstant.h"
+
+#include "utils/Profile.h"
+
+
+namespace GPlatesAppLogic
+{
+	namespace
+	{
+		/**
+		 * An edge in the structure (plate circuit paths) of a reconstruction tree.
+		 */
+		struct TreeTopologyEdge
+		{
+			TreeTopologyEdge(
+					const ReconstructionGraph::Edge &graph_edge_,
+					bool is_reversed_,
+					int parent_edge_index_,
+					GPlatesModel::integer_plate_id_type moving_plate_id_) :
+				graph_edge(&graph_edge_),
+				is_reversed(is_reversed_),
+				parent_edge_index(parent_edge_index_),
+				moving_plate_id(moving_plate_id_),
+				plate_index(0)
+			{  }
+
+			const ReconstructionGraph::Edge *graph_edge;
+
+			//! Whether the tree edge is the reverse of the graph edge.
+			bool is_reversed;
+
+			//! Index of parent edge (edges are ordered parent before child), or -1 if attached to anchor plate.
+			int parent_edge_index;
+
+			GPlatesModel::integer_plate_id_type moving_plate_id;
+
+			//! Index of the moving plate into the plate IDs of the table.
+			unsigned int plate_index;
+		};
+
+
+		/**
+		 * The structure (plate circuit paths) of a reconstruction tree, and the range of times over
+		 * which the structure does not change.
+		 *
+		 * The structure only depends on the edges that are active (at the reconstruction time) in the
+		 * plates visited when the tree was created, so it remains the same as long as all those plates
+		 * have the same active edges (as determined by their @a ReconstructionGraph::EdgeTimeIndex).
+		 */
+		class TreeTopology
+		{
+		public:
+
+			TreeTopology(
+					const ReconstructionGraph::non_null_ptr_to_const_type &reconstruction_graph,
+					const GPlatesPropertyValues::GeoTimeInstant &reconstruction_time,
+					GPlatesModel::integer_plate_id_type anchor_plate_id)
+			{
+				// Use a reconstruction tree to determine the structure so that the same path is taken
+				// through crossovers (as a reconstruction tree created directly at each time).
+				const ReconstructionTree::non_null_ptr_to_const_type reconstruction_tree =
+						ReconstructionTree::create(
+								reconstruction_graph,
+								reconstruction_time.value(),
+								anchor_plate_id);
+
+				// The incoming and outgoing edges of the anchor plate are visited.
+				boost::optional<const ReconstructionGraph::Plate &> anchor_plate =
+						reconstruction_graph->get_plate(anchor_plate_id);
+				if (anchor_plate)
+				{
+					restrict_time_range(anchor_plate->get_incoming_edge_time_index(), reconstruction_time);
+					restrict_time_range(anchor_plate->get_outgoing_edge_time_index(), reconstruction_time);
+				}
+
+				const ReconstructionTree::edge_list_type &anchor_plate_edges = reconstruction_tree->get_anchor_plate_edges();
+				ReconstructionTree::edge_list_type::const_iterator anchor_plate_edges_iter = anchor_plate_edges.begin();
+				ReconstructionTree::edge_list_type::const_iterator anchor_plate_edges_end = anchor_plate_edges.end();
+				for ( ; anchor_plate_edges_iter != anchor_plate_edges_end; ++anchor_plate_edges_iter)
+				{
+					add_sub_tree(*anchor_plate_edges_iter, -1/*parent_edge_index*/, reconstruction_time);
+				}
+			}
+
+			/**
+			 * Returns true if the structure is the same at the specified reconstruction time.
+			 */
+			bool
+			contains(
+					const GPlatesPropertyValues::GeoTimeInstant &reconstruction_time) const
+			{
+				if (d_coincident_time)
+				{
+					return reconstruction_time.is_coincident_with(d_coincident_time.get());
+				}
+
+				return (!d_later_bound || reconstruction_time.is_strictly_earlier_than(d_later_bound.get())) &&
+						(!d_earlier_bound || reconstruction_time.is_strictly_later_than(d_earlier_bound.get()));
+			}
+
+			std::vector<TreeTopologyEdge> &
+			get_edges()
+			{
+				return d_edges;
+			}
+
+			const std::vector<TreeTopologyEdge> &
+			get_edges() const
+			{
+				return d_edges;
+			}
+
+		private:
+
+			std::vector<TreeTopologyEdge> d_edges;
+
+			// The range of times over which the structure does not change.
+			// This is either a single time (if coincident with an edge begin/end time of a visited plate),
+			// or an open interval (where a missing bound extends to the distant future/past).
+			boost::optional<GPlatesPropertyValues::GeoTimeInstant> d_coincident_time;
+			boost::optional<GPlatesPropertyValues::GeoTimeInstant> d_later_bound;
+			boost::optional<GPlatesPropertyValues::GeoTimeInstant> d_earlier_bound;
+
+
+			void
+			add_sub_tree(
+					const ReconstructionTree::Edge &tree_edge,
+					int parent_edge_index,
+					const GPlatesPropertyValues::GeoTimeInstant &reconstruction_time)
+			{
+				const ReconstructionGraph::Edge &graph_edge = tree_edge.get_graph_edge();
+
+				const int edge_index = d_edges.size();
+				d_edges.push_back(
+						TreeTopologyEdge(
+								graph_edge,
+								tree_edge.is_reversed(),
+								parent_edge_index,
+								tree_edge.get_moving_plate()));
+
+				// The graph plate associated with the tree edge's moving plate was visited.
+				// Its incoming edges are only visited if the tree edge is reversed (see ReconstructionTree).
+				const ReconstructionGraph::Plate &graph_plate =
+						tree_edge.is_reversed() ? graph_edge.get_fixed_plate() : graph_edge.get_moving_plate();
+				if (tree_edge.is_reversed())
+				{
+					restrict_time_range(graph_plate.get_incoming_edge_time_index(), reconstruction_time);
+				}
+				restrict_time_range(graph_plate.get_outgoing_edge_time_index(), reconstruction_time);
+
+				const ReconstructionTree::edge_list_type &child_edges = tree_edge.get_child_edges();
+				ReconstructionTree::edge_list_type::const_iterator child_edges_iter = child_edges.begin();
+				ReconstructionTree::edge_list_type::const_iterator child_edges_end = child_edges.end();
+				for ( ; child_edges_iter != child_edges_end; ++child_edges_iter)
+				{
+					add_sub_tree(*child_edges_iter, edge_index, reconstruction_time);
+				}
+			}
+
+			void
+			restrict_time_range(
+					const ReconstructionGraph::EdgeTimeIndex &edge_time_index,
+					const GPlatesPropertyValues::GeoTimeInstant &reconstruction_time)
+			{
+				const std::pair<
+						boost::optional<GPlatesPropertyValues::GeoTimeInstant>,
+						boost::optional<GPlatesPropertyValues::GeoTimeInstant> > time_slot_bounds =
+								edge_time_index.get_time_slot_bounds(reconstruction_time);
+
+				// If the time slot is a single time then so is our time range.
+				if (time_slot_bounds.first &&
+					time_slot_bounds.second &&
+					time_slot_bounds.first->is_coincident_with(time_slot_bounds.second.get()))
+				{
+					d_coincident_time = time_slot_bounds.first.get();
+					return;
+				}
+
+				// Otherwise intersect the open intervals.
+				if (time_slot_bounds.first &&
+					(!d_later_bound || time_slot_bounds.first->is_strictly_earlier_than(d_later_bound.get())))
+				{
+					d_later_bound = time_slot_bounds.first.get();
+				}
+				if (time_slot_bounds.second &&
+					(!d_earlier_bound || time_slot_bounds.second->is_strictly_later_than(d_earlier_bound.get())))
+				{
+					d_earlier_bound = time_slot_bounds.second.get();
+				}
+			}
+		};
+	}
+}
+
+
+GPlatesAppLogic::ReconstructionRotationTable::non_null_ptr_type
+GPlatesAppLogic::ReconstructionRotationTable::create(
+		ReconstructionGraph::non_null_ptr_to_const_type reconstruction_graph,
+		const std::vector<double> &reconstruction_times,
+		GPlatesModel::integer_plate_id_type anchor_plate_id)
+{
+	return non_null_ptr_type(
+			new ReconstructionRotationTable(reconstruction_graph, reconstruction_times, anchor_plate_id));
+}
+
+
+GPlatesAppLogic::ReconstructionRotationTable::non_null_ptr_type
+GPlatesAppLogic::ReconstructionRotationTable::create(
+		const ReconstructionTreeCreator &reconstruction_tree_creator,
+		const std::vector<double> &reconstruction_times,
+		boost::optional<GPlatesModel::integer_plate_id_type> anchor_plate_id)
+{
+	if (!anchor_plate_id)
+	{
+		anchor_plate_id = reconstruction_tree_creator.get_default_anchor_plate_id();
+	}
+
+	// All reconstruction trees created by the reconstruction tree creator reference the same reconstruction graph.
+	// Request a tree at one of our reconstruction times since the creator might cache it for other clients.
+	const ReconstructionGraph::non_null_ptr_to_const_type reconstruction_graph =
+			reconstruction_tree_creator.get_reconstruction_tree(
+					reconstruction_times.empty() ? 0.0 : reconstruction_times.front(),
+					anchor_plate_id.get())->get_reconstruction_graph();
+
+	return create(reconstruction_graph, reconstruction_times, anchor_plate_id.get());
+}
+
+
+GPlatesAppLogic::ReconstructionRotationTable::ReconstructionRotationTable(
+		ReconstructionGraph::non_null_ptr_to_const_type reconstruction_graph,
+		const std::vector<double> &reconstruction_times,
+		GPlatesModel::integer_plate_id_type anchor_plate_id) :
+	d_reconstruction_times(reconstruction_times),
+	d_anchor_plate_id(anchor_plate_id)
+{
+	PROFILE_FUNC();
+
+	const unsigned int num_reconstruction_times = d_reconstruction_times.size();
+
+	d_sorted_reconstruction_times.reserve(num_reconstruction_times);
+	for (unsigned int time_index = 0; time_index < num_reconstruction_times; ++time_index)
+	{
+		d_sorted_reconstruction_times.push_back(std::make_pair(d_reconstruction_times[time_index], time_index));
+	}
+	std::sort(d_sorted_reconstruction_times.begin(), d_sorted_reconstruction_times.end());
+
+	//
+	// Determine the tree structure at each reconstruction time.
+	//
+	// Consecutive reconstruction times share the same structure if it doesn't change between them.
+	//
+
+	std::vector<TreeTopology> tree_topologies;
+	std::vector<unsigned int> reconstruction_time_tree_topology_indices;
+	reconstruction_time_tree_topology_indices.reserve(num_reconstruction_times);
+
+	for (unsigned int time_index = 0; time_index < num_reconstruction_times; ++time_index)
+	{
+		const GPlatesPropertyValues::GeoTimeInstant reconstruction_time(d_reconstruction_times[time_index]);
+
+		if (tree_topologies.empty() ||
+			!tree_topologies.back().contains(reconstruction_time))
+		{
+			tree_topologies.push_back(
+					TreeTopology(reconstruction_graph, reconstruction_time, anchor_plate_id));
+		}
+
+		reconstruction_time_tree_topology_indices.push_back(tree_topologies.size() - 1);
+	}
+
+	//
+	// Gather the plates in all tree structures and index them.
+	//
+
+	std::vector<TreeTopology>::iterator tree_topologies_iter;
+	for (tree_topologies_iter = tree_topologies.begin(); tree_topologies_iter != tree_topologies.end(); ++tree_topologies_iter)
+	{
+		const std::vector<TreeTopologyEdge> &tree_topology_edges = tree_topologies_iter->get_edges();
+		for (unsigned int edge_index = 0; edge_index < tree_topology_edges.size(); ++edge_index)
+		{
+			d_plate_ids.push_back(tree_topology_edges[edge_index].moving_plate_id);
+		}
+	}
+	std::sort(d_plate_ids.begin(), d_plate_ids.end());
+	d_plate_ids.erase(std::unique(d_plate_ids.begin(), d_plate_ids.end()), d_plate_ids.end());
+
+	for (tree_topologies_iter = tree_topologies.begin(); tree_topologies_iter != tree_topologies.end(); ++tree_topologies_iter)
+	{
+		std::vector<TreeTopologyEdge> &tree_topology_edges = tree_topologies_iter->get_edges();
+		for (unsigned int edge_index = 0; edge_index < tree_topology_edges.size(); ++edge_index)
+		{
+			TreeTopologyEdge &tree_topology_edge = tree_topology_edges[edge_index];
+			tree_topology_edge.plate_index =
+					std::lower_bound(d_plate_ids.begin(), d_plate_ids.end(), tree_topology_edge.moving_plate_id) -
+						d_plate_ids.begin();
+		}
+	}
+
+	//
+	// Calculate the composed absolute rotations at each reconstruction time.
+	//
+
+	const unsigned int num_entries = d_plate_ids.size() * num_reconstruction_times;
+	d_rotations.assign(num_entries, GPlatesMaths::UnitQuaternion3D::create_identity_rotation());
+	d_has_rotations.assign(num_entries, false);
+
+	std::vector<GPlatesMaths::FiniteRotation> composed_absolute_rotations;
+	for (unsigned int time_index = 0; time_index < num_reconstruction_times; ++time_index)
+	{
+		const GPlatesPropertyValues::GeoTimeInstant reconstruction_time(d_reconstruction_times[time_index]);
+
+		const std::vector<TreeTopologyEdge> &tree_topology_edges =
+				tree_topologies[reconstruction_time_tree_topology_indices[time_index]].get_edges();
+
+		// Parent edges are ordered before their child edges, so their composed rotations are calculated first.
+		composed_absolute_rotations.clear();
+		composed_absolute_rotations.reserve(tree_topology_edges.size());
+		for (unsigned int edge_index = 0; edge_index < tree_topology_edges.size(); ++edge_index)
+		{
+			const TreeTopologyEdge &tree_topology_edge = tree_topology_edges[edge_index];
+
+			// Reverse the relative rotation if the tree edge is reversed wrt the graph edge.
+			GPlatesMaths::FiniteRotation relative_rotation =
+					tree_topology_edge.graph_edge->calculate_relative_rotation(reconstruction_time);
+			if (tree_topology_edge.is_reversed)
+			{
+				relative_rotation = GPlatesMaths::get_reverse(relative_rotation);
+			}
+
+			// Compose our relative rotation with the absolute rotation of the parent edge (if there is one).
+			if (tree_topology_edge.parent_edge_index >= 0)
+			{
+				composed_absolute_rotations.push_back(
+						compose(
+								composed_absolute_rotations[tree_topology_edge.parent_edge_index],
+								relative_rotation));
+			}
+			else
+			{
+				composed_absolute_rotations.push_back(relative_rotation);
+			}
+
+			const unsigned int entry_index = tree_topology_edge.plate_index * num_reconstruction_times + time_index;
+			d_rotations[entry_index] = composed_absolute_rotations.back().unit_quat();
+			d_has_rotations[entry_index] = true;
+		}
+	}
+}
+
+
+boost::optional<unsigned int>
+GPlatesAppLogic::ReconstructionRotationTable::get_reconstruction_time_index(
+		const double &reconstruction_time) const
+{
+	const GPlatesPropertyValues::GeoTimeInstant geo_reconstruction_time(reconstruction_time);
+
+	// The first sorted time not less than the reconstruction time.
+	std::vector< std::pair<double, unsigned int> >::const_iterator sorted_times_iter =
+			std::lower_bound(
+					d_sorted_reconstruction_times.begin(),
+					d_sorted_reconstruction_times.end(),
+					std::make_pair(reconstruction_time, 0U));
+
+	// A matching time is within epsilon so it's either the time found or the time just before it.
+	if (sorted_times_iter != d_sorted_reconstruction_times.end() &&
+		geo_reconstruction_time.is_coincident_with(
+				GPlatesPropertyValues::GeoTimeInstant(sorted_times_iter->first)))
+	{
+		return sorted_times_iter->second;
+	}
+	if (sorted_times_iter != d_sorted_reconstruction_times.begin())
+	{
+		--sorted_times_iter;
+		if (geo_reconstruction_time.is_coincident_with(
+				GPlatesPropertyValues::GeoTimeInstant(sorted_times_iter->first)))
+		{
+			return sorted_times_iter->second;
+		}
+	}
+
+	return boost::none;
+}
+
+
+boost::optional<GPlatesMaths::FiniteRotation>
+GPlatesAppLogic::ReconstructionRotationTable::get_composed_absolute_rotation_or_none(
+		unsigned int reconstruction_time_index,
+		GPlatesModel::integer_plate_id_type moving_plate_id) const
+{
+	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+			reconstruction_time_index < d_reconstruction_times.size(),
+			GPLATES_ASSERTION_SOURCE);
+
+	// A rotation of the anchor plate relative to itself is the identity rotation.
+	if (moving_plate_id == d_anchor_plate_id)
+	{
+		return GPlatesMaths::FiniteRotation::create_identity_rotation();
+	}
+
+	const std::vector<GPlatesModel::integer_plate_id_type>::const_iterator plate_id_iter =
+			std::lower_bound(d_plate_ids.begin(), d_plate_ids.end(), moving_plate_id);
+	if (plate_id_iter == d_plate_ids.end() ||
+		*plate_id_iter != moving_plate_id)
+	{
+		return boost::none;
+	}
+
+	const unsigned int entry_index =
+			(plate_id_iter - d_plate_ids.begin()) * d_reconstruction_times.size() + reconstruction_time_index;
+	if (!d_has_rotations[entry_index])
+	{
+		return boost::none;
+	}
+
+	return GPlatesMaths::FiniteRotation::create(d_rotations[entry_index], boost::none);
+}
+
+
+GPlatesMaths::FiniteRotation
+GPlatesAppLogic::ReconstructionRotationTable::get_composed_absolute_rotation(
+		unsigned int reconstruction_time_index,
+		GPlatesModel::integer_plate_id_type moving_plate_id) const
+{
+	boost::optional<GPlatesMaths::FiniteRotation> composed_absolute_rotation =
+			get_composed_absolute_rotation_or_none(reconstruction_time_index, moving_plate_id);
+	if (!composed_absolute_rotation)
+	{
+		return GPlatesMaths::FiniteRotation::create_identity_rotation();
+	}
+
+	return composed_absolute_rotation.get();
+}
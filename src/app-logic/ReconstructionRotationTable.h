@@ -0,0 +1,198 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_APP_LOGIC_RECONSTRUCTIONROTATIONTABLE_H
+#define GPLATES_APP_LOGIC_RECONSTRUCTIONROTATIONTABLE_H
+
+#include <utility>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "ReconstructionGraph.h"
+
+#include "maths/FiniteRotation.h"
+#include "maths/UnitQuaternion3D.h"
+
+#include "model/types.h"
+
+#include "utils/ReferenceCount.h"
+
+
+namespace GPlatesAppLogic
+{
+	class ReconstructionTreeCreator;
+
+	/**
+	 * A table of the composed absolute rotations (relative to an anchor plate) of plates at a sequence
+	 * of reconstruction times.
+	 *
+	 * This is equivalent to creating a @a ReconstructionTree at each reconstruction time and querying
+	 * its composed absolute rotations, but is much faster when there are many reconstruction times
+	 * (such as when calculating motion paths, flowlines or velocities, or exporting over a time range).
+	 * This is because the structure of a reconstruction tree (its plate circuit paths) only changes when
+	 * the set of active edges (total reconstruction sequences) changes, so the tree structure is only
+	 * rebuilt at those times and otherwise only the rotations of its edges are re-interpolated.
+	 *
+	 * Reconstruction times do not need to be sorted, but the tree structure is shared across
+	 * *consecutive* reconstruction times so sorted (or mostly sorted) times are the most efficient.
+	 *
+	 * Note: Only the rotations (unit quaternions) are stored, so the axis hints of rotations
+	 * (that a @a ReconstructionTree would return) are not retained.
+	 */
+	class ReconstructionRotationTable :
+			public GPlatesUtils::ReferenceCount<ReconstructionRotationTable>
+	{
+	public:
+
+		typedef GPlatesUtils::non_null_intrusive_ptr<ReconstructionRotationTable> non_null_ptr_type;
+		typedef GPlatesUtils::non_null_intrusive_ptr<const ReconstructionRotationTable> non_null_ptr_to_const_type;
+
+
+		/**
+		 * Create a table of rotations of all plates in @a reconstruction_graph, relative to
+		 * @a anchor_plate_id, at each time in @a reconstruction_times.
+		 */
+		static
+		non_null_ptr_type
+		create(
+				ReconstructionGraph::non_null_ptr_to_const_type reconstruction_graph,
+				const std::vector<double> &reconstruction_times,
+				GPlatesModel::integer_plate_id_type anchor_plate_id);
+
+		/**
+		 * Same as the other overload of @a create but uses the reconstruction graph associated with
+		 * the reconstruction trees created by @a reconstruction_tree_creator.
+		 *
+		 * If @a anchor_plate_id is not specified then the default anchor plate of
+		 * @a reconstruction_tree_creator is used.
+		 */
+		static
+		non_null_ptr_type
+		create(
+				const ReconstructionTreeCreator &reconstruction_tree_creator,
+				const std::vector<double> &reconstruction_times,
+				boost::optional<GPlatesModel::integer_plate_id_type> anchor_plate_id = boost::none);
+
+
+		/**
+		 * Return the reconstruction times (in the order they were specified when this table was created).
+		 */
+		const std::vector<double> &
+		get_reconstruction_times() const
+		{
+			return d_reconstruction_times;
+		}
+
+		/**
+		 * Returns the index of the reconstruction time that matches (within epsilon) @a reconstruction_time,
+		 * or none if there's no match.
+		 *
+		 * If the same time was specified more than once then any one of its indices is returned.
+		 */
+		boost::optional<unsigned int>
+		get_reconstruction_time_index(
+				const double &reconstruction_time) const;
+
+		/**
+		 * Returns the plate id of the anchor plate that all rotations are calculated relative to.
+		 */
+		GPlatesModel::integer_plate_id_type
+		get_anchor_plate_id() const
+		{
+			return d_anchor_plate_id;
+		}
+
+		/**
+		 * Return the (sorted) IDs of the plates that have a rotation at one or more reconstruction times.
+		 *
+		 * This excludes the anchor plate (which always has the identity rotation).
+		 */
+		const std::vector<GPlatesModel::integer_plate_id_type> &
+		get_plate_ids() const
+		{
+			return d_plate_ids;
+		}
+
+		/**
+		 * Get the composed absolute rotation of @a moving_plate_id relative to the anchor plate at
+		 * the reconstruction time at index @a reconstruction_time_index.
+		 *
+		 * Returns none if the motion of @a moving_plate_id is not described by the reconstruction tree
+		 * at that reconstruction time.
+		 *
+		 * @throws PreconditionViolationError if @a reconstruction_time_index is not less than the
+		 * number of reconstruction times.
+		 */
+		boost::optional<GPlatesMaths::FiniteRotation>
+		get_composed_absolute_rotation_or_none(
+				unsigned int reconstruction_time_index,
+				GPlatesModel::integer_plate_id_type moving_plate_id) const;
+
+		/**
+		 * Same as @a get_composed_absolute_rotation_or_none except returns the identity rotation if
+		 * the motion of @a moving_plate_id is not described by the reconstruction tree at that time.
+		 */
+		GPlatesMaths::FiniteRotation
+		get_composed_absolute_rotation(
+				unsigned int reconstruction_time_index,
+				GPlatesModel::integer_plate_id_type moving_plate_id) const;
+
+	private:
+
+		std::vector<double> d_reconstruction_times;
+		GPlatesModel::integer_plate_id_type d_anchor_plate_id;
+
+		/**
+		 * The reconstruction times (paired with their indices) sorted by time, for looking up times.
+		 */
+		std::vector< std::pair<double, unsigned int> > d_sorted_reconstruction_times;
+
+		/**
+		 * Sorted plate IDs (each plate ID is a column of the table).
+		 */
+		std::vector<GPlatesModel::integer_plate_id_type> d_plate_ids;
+
+		/**
+		 * The rotations stored by plate (column) and then by reconstruction time (row).
+		 *
+		 * So all rotations of a plate are contiguous.
+		 */
+		std::vector<GPlatesMaths::UnitQuaternion3D> d_rotations;
+
+		/**
+		 * Whether each entry in @a d_rotations has a rotation (ie, whether the plate was in the
+		 * reconstruction tree at the reconstruction time).
+		 */
+		std::vector<bool> d_has_rotations;
+
+
+		ReconstructionRotationTable(
+				ReconstructionGraph::non_null_ptr_to_const_type reconstruction_graph,
+				const std::vector<double> &reconstruction_times,
+				GPlatesModel::integer_plate_id_type anchor_plate_id);
+	};
+}
+
+#endif // GPLATES_APP_LOGIC_RECONSTRUCTIONROTATIONTABLE_H
@@ -27,6 +27,7 @@
 
 #include <deque>
 #include <new>
+#include <boost/thread/thread.hpp>
 
 #include "ReconstructionTree.h"
 
@@ -36,110 +37,83 @@
 GPlatesMaths::FiniteRotation
 GPlatesAppLogic::ReconstructionTree::Edge::calculate_graph_edge_relative_rotation() const
 {
-	// Get the pole samples from the graph edge.
-	const ReconstructionGraph::pole_sample_list_type &pole = d_graph_edge.get_pole();
-	ReconstructionGraph::pole_sample_list_type::const_iterator pole_iter = pole.begin();
-	ReconstructionGraph::pole_sample_list_type::const_iterator pole_end = pole.end();
-
-	// Iterate over the pole samples to determine where our reconstruction time lies.
-	// Note that we have been guaranteed to have at least two time samples.
-	ReconstructionGraph::pole_sample_list_type::const_iterator prev_pole_iter = pole_iter;
-	for (++pole_iter; pole_iter != pole_end; ++pole_iter, ++prev_pole_iter)
-	{
-		const ReconstructionGraph::PoleSample &pole_sample = *pole_iter;
-
-		// See if the reconstruction time is later than (ie, less far in the past than)
-		// the time of the current time sample, which must mean that it lies between the previous
-		// and current time samples (or is coincident with previous time sample).
-		if (d_reconstruction_time_instant.is_strictly_later_than(pole_sample.get_time_instant()))
-		{
-			const ReconstructionGraph::PoleSample &prev_pole_sample = *prev_pole_iter;
-			if (d_reconstruction_time_instant.is_coincident_with(prev_pole_sample.get_time_instant()))
-			{
-				// An exact match!  Hence, we can use the FiniteRotation of the previous time
-				// sample directly, without need for interpolation.
-				return prev_pole_sample.get_finite_rotation();
-			}
-			else if (pole_sample.get_time_instant().is_distant_past())
-			{
-				// We now allow the oldest time sample to be distant-past (+Infinity).
-				//
-				// Since the pole is infinitely far in the past it essentially would get ignored if we
-				// interpolated between it and the previous pole (at the reconstruction time).
-				// In other words the interpolation ratio would be '(t - t_prev) / (Inf - t_prev)'
-				// which is zero, and so the distant-past (current) pole would get zero weighting.
-				//
-				// So we just use the previous pole.
-				//
-				// This path should only happen when ReconstructionGraph creates extra graph edges
-				// that extend to the distant past, and it keeps the pole constant during this
-				// extended time range, so both previous and current poles should be the same anyway.
-				return prev_pole_sample.get_finite_rotation();
-			}
-			else if (prev_pole_sample.get_time_instant().is_distant_future())
-			{
-				// We now allow the youngest time sample to be distant-future (-Infinity).
-				//
-				// Since the previous pole is infinitely far in the future it essentially would get ignored
-				// if we interpolated between it and the current pole (at the reconstruction time).
-				// In other words the interpolation ratio would be '(t - -Inf) / (t_curr - -Inf)'
-				// which is one, and so the distant-future (prev) pole would get zero (1.0 - 1.0 = 0.0) weighting.
-				//
-				// So we just use the current pole.
-				//
-				// It is assumed that the user is only creating a pole sample at the distant-future
-				// to extend, for example, a present-day pole sample into the future.
-				// In other words, the total rotation is constant from present day to the distant future.
-				// If this is not the case then essentially the present-day pole sample will be extended
-				// as if it was constant in the distant future.
-				return pole_sample.get_finite_rotation();
-			}
+	return d_graph_edge.calculate_relative_rotation(d_reconstruction_time_instant);
+}
 
-			const GPlatesMaths::FiniteRotation &prev_finite_rotation = prev_pole_sample.get_finite_rotation();
-			const GPlatesMaths::FiniteRotation &finite_rotation = pole_sample.get_finite_rotation();
 
-			// If either of the finite rotations has an axis hint, use it.
-			boost::optional<GPlatesMaths::UnitVector3D> axis_hint;
-			if (prev_finite_rotation.axis_hint())
-			{
-				axis_hint = prev_finite_rotation.axis_hint();
-			}
-			else if (finite_rotation.axis_hint())
+template <typename CalculateRotationFunctionType>
+void
+GPlatesAppLogic::ReconstructionTree::Edge::cache_rotation(
+		std::atomic<int> &rotation_state,
+		boost::optional<GPlatesMaths::FiniteRotation> &rotation,
+		const CalculateRotationFunctionType &calculate_rotation)
+{
+	int state = rotation_state.load(std::memory_order_acquire);
+	while (state != ROTATION_CACHED)
+	{
+		if (state == ROTATION_NOT_CACHED)
+		{
+			// Attempt to become the thread that calculates the rotation.
+			if (rotation_state.compare_exchange_strong(state, ROTATION_CACHING, std::memory_order_acquire))
 			{
-				axis_hint = finite_rotation.axis_hint();
+				try
+				{
+					rotation = calculate_rotation();
+				}
+				catch (...)
+				{
+					// Let another request try again.
+					rotation_state.store(ROTATION_NOT_CACHED, std::memory_order_release);
+					throw;
+				}
+
+				// Publish the rotation to other threads.
+				rotation_state.store(ROTATION_CACHED, std::memory_order_release);
+				return;
 			}
 
-			// Interpolate between the previous and current finite rotations.
-			return GPlatesMaths::interpolate(
-					prev_finite_rotation,
-					finite_rotation,
-					prev_pole_sample.get_time_instant().value(),
-					pole_sample.get_time_instant().value(),
-					d_reconstruction_time_instant.value(),
-					axis_hint);
+			// Another thread got in first ('state' now contains its state).
+			continue;
 		}
+
+		// Another thread is calculating the rotation (which does not take long).
+		boost::this_thread::yield();
+		state = rotation_state.load(std::memory_order_acquire);
 	}
+}
+
+
+void
+GPlatesAppLogic::ReconstructionTree::Edge::cache_relative_rotation() const
+{
+	cache_rotation(
+			d_relative_rotation_state,
+			d_relative_rotation,
+			[this]() -> GPlatesMaths::FiniteRotation
+			{
+				const GPlatesMaths::FiniteRotation relative_rotation = calculate_graph_edge_relative_rotation();
 
-	// The reconstruction time must coincide with the time of the last pole sample because
-	// we know that the reconstruction time is contained in the inclusive time bounds of the pole.
-	return pole.back().get_finite_rotation();
+				// Reverse the relative rotation if we are reversed wrt the *graph* edge.
+				return is_reversed()
+						? GPlatesMaths::get_reverse(relative_rotation)
+						: relative_rotation;
+			});
 }
 
 
 void
 GPlatesAppLogic::ReconstructionTree::Edge::cache_composed_absolute_rotation() const
 {
-	// Compose our relative rotation with the absolute rotation of the parent edge (if there is one).
-	if (d_parent_edge)
-	{
-		d_composed_absolute_rotation = compose(
-				d_parent_edge->get_composed_absolute_rotation(),
-				get_relative_rotation());
-	}
-	else
-	{
-		d_composed_absolute_rotation = get_relative_rotation();
-	}
+	cache_rotation(
+			d_composed_absolute_rotation_state,
+			d_composed_absolute_rotation,
+			[this]() -> GPlatesMaths::FiniteRotation
+			{
+				// Compose our relative rotation with the absolute rotation of the parent edge (if there is one).
+				return d_parent_edge
+						? compose(d_parent_edge->get_composed_absolute_rotation(), get_relative_rotation())
+						: get_relative_rotation();
+			});
 }
 
 
@@ -315,18 +289,20 @@ GPlatesAppLogic::ReconstructionTree::create_sub_trees_from_graph_plate(
 	if (parent_tree_edge == NULL ||
 		parent_tree_edge->is_reversed())
 	{
-		// Iterate over the edges going *into* the plate.
-		const ReconstructionGraph::plate_incoming_edge_list_type &incoming_graph_edges = graph_plate.get_incoming_edges();
-		ReconstructionGraph::plate_incoming_edge_list_type::const_iterator incoming_graph_edges_iter = incoming_graph_edges.begin();
-		ReconstructionGraph::plate_incoming_edge_list_type::const_iterator incoming_graph_edges_end = incoming_graph_edges.end();
-		for ( ; incoming_graph_edges_iter != incoming_graph_edges_end; ++incoming_graph_edges_iter)
+		// Iterate over the edges going *into* the plate that contain the reconstruction time.
+		const std::pair<
+				ReconstructionGraph::EdgeTimeIndex::edge_iterator,
+				ReconstructionGraph::EdgeTimeIndex::edge_iterator> incoming_graph_edges =
+						graph_plate.get_incoming_edge_time_index().get_edges(d_reconstruction_time_instant);
+		ReconstructionGraph::EdgeTimeIndex::edge_iterator incoming_graph_edges_iter = incoming_graph_edges.first;
+		for ( ; incoming_graph_edges_iter != incoming_graph_edges.second; ++incoming_graph_edges_iter)
 		{
-			const ReconstructionGraph::Edge &incoming_graph_edge = *incoming_graph_edges_iter;
+			const ReconstructionGraph::Edge &incoming_graph_edge = **incoming_graph_edges_iter;
 
 			// Create a sub-tree by following the current incoming graph edge
 			// in the reverse direction from its moving plate (which is 'graph_plate') to its fixed plate.
 			//
-			// But only if it contains the reconstruction time.
+			// But only if it doesn't create a cycle in the tree.
 			if (create_sub_tree_from_graph_edge(
 					incoming_graph_edge,
 					parent_tree_edge,
@@ -339,20 +315,22 @@ GPlatesAppLogic::ReconstructionTree::create_sub_trees_from_graph_plate(
 		}
 	}
 
-	// Iterate over the edges going *out* the plate.
+	// Iterate over the edges going *out* the plate that contain the reconstruction time.
 	//
 	// Note that we can traverse all outgoing edges.
-	const ReconstructionGraph::plate_outgoing_edge_list_type &outgoing_graph_edges = graph_plate.get_outgoing_edges();
-	ReconstructionGraph::plate_outgoing_edge_list_type::const_iterator outgoing_graph_edges_iter = outgoing_graph_edges.begin();
-	ReconstructionGraph::plate_outgoing_edge_list_type::const_iterator outgoing_graph_edges_end = outgoing_graph_edges.end();
-	for ( ; outgoing_graph_edges_iter != outgoing_graph_edges_end; ++outgoing_graph_edges_iter)
+	const std::pair<
+			ReconstructionGraph::EdgeTimeIndex::edge_iterator,
+			ReconstructionGraph::EdgeTimeIndex::edge_iterator> outgoing_graph_edges =
+					graph_plate.get_outgoing_edge_time_index().get_edges(d_reconstruction_time_instant);
+	ReconstructionGraph::EdgeTimeIndex::edge_iterator outgoing_graph_edges_iter = outgoing_graph_edges.first;
+	for ( ; outgoing_graph_edges_iter != outgoing_graph_edges.second; ++outgoing_graph_edges_iter)
 	{
-		const ReconstructionGraph::Edge &outgoing_graph_edge = *outgoing_graph_edges_iter;
+		const ReconstructionGraph::Edge &outgoing_graph_edge = **outgoing_graph_edges_iter;
 
 		// Create a sub-tree by following the current outgoing graph edge
 		// in the forward direction from its fixed plate (which is 'graph_plate') to its moving plate.
 		//
-		// But only if it contains the reconstruction time and doesn't create a cycle in the tree.
+		// But only if it doesn't create a cycle in the tree.
 		create_sub_tree_from_graph_edge(
 				outgoing_graph_edge,
 				parent_tree_edge,
@@ -369,13 +347,8 @@ GPlatesAppLogic::ReconstructionTree::create_sub_tree_from_graph_edge(
 		edge_list_type &tree_edges,
 		bool reverse_tree_edge)
 {
-	// If the reconstruction time is outside the graph edge [begin,end] time range then
-	// discontinue the current tree edge branch.
-	if (d_reconstruction_time_instant.is_strictly_earlier_than(graph_edge.get_begin_time()) ||
-		d_reconstruction_time_instant.is_strictly_later_than(graph_edge.get_end_time()))
-	{
-		return false;
-	}
+	// Note that the caller has already ensured (via the plate edge time indices) that the reconstruction time
+	// is inside the graph edge [begin,end] time range.
 
 	// If the tree edge is the reverse of the graph edge (ie, if we're following the graph edge backwards)
 	// then swap the fixed and moving plate associated with the tree edge.
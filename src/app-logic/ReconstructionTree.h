@@ -28,6 +28,7 @@
 #ifndef GPLATES_APP_LOGIC_RECONSTRUCTIONTREE_H
 #define GPLATES_APP_LOGIC_RECONSTRUCTIONTREE_H
 
+#include <atomic>
 #include <map>
 #include <boost/intrusive/slist.hpp>
 #include <boost/optional.hpp>
@@ -112,6 +113,15 @@ namespace GPlatesAppLogic
 				return d_moving_plate == d_graph_edge.get_fixed_plate().get_plate_id();
 			}
 
+			/**
+			 * Return the associated edge in the @a ReconstructionGraph (that this tree edge was created from).
+			 */
+			const ReconstructionGraph::Edge &
+			get_graph_edge() const
+			{
+				return d_graph_edge;
+			}
+
 			/**
 			 * Return the parent edge, or NULL if there is no parent edge (if this is a root edge).
 			 */
@@ -141,7 +151,7 @@ namespace GPlatesAppLogic
 			const GPlatesMaths::FiniteRotation &
 			get_relative_rotation() const
 			{
-				if (!d_relative_rotation)
+				if (d_relative_rotation_state.load(std::memory_order_acquire) != ROTATION_CACHED)
 				{
 					cache_relative_rotation();
 				}
@@ -156,7 +166,7 @@ namespace GPlatesAppLogic
 			const GPlatesMaths::FiniteRotation &
 			get_composed_absolute_rotation() const
 			{
-				if (!d_composed_absolute_rotation)
+				if (d_composed_absolute_rotation_state.load(std::memory_order_acquire) != ROTATION_CACHED)
 				{
 					cache_composed_absolute_rotation();
 				}
@@ -169,6 +179,21 @@ namespace GPlatesAppLogic
 			friend class ReconstructionTree;
 			friend class boost::object_pool<Edge>;  // Access to Edge constructor.
 
+			/**
+			 * The state of a rotation that is calculated on demand.
+			 *
+			 * A rotation can be requested concurrently by multiple threads (a reconstruction tree is
+			 * immutable once created and so can be shared across threads). The first thread to request
+			 * it calculates it (ROTATION_CACHING) and then publishes it (ROTATION_CACHED).
+			 * Subsequent requests only need to atomically read the state (no locking).
+			 */
+			enum RotationCacheState
+			{
+				ROTATION_NOT_CACHED,
+				ROTATION_CACHING,
+				ROTATION_CACHED
+			};
+
 			Edge(
 					GPlatesModel::integer_plate_id_type fixed_plate,
 					GPlatesModel::integer_plate_id_type moving_plate,
@@ -178,7 +203,9 @@ namespace GPlatesAppLogic
 				d_moving_plate(moving_plate),
 				d_reconstruction_time_instant(reconstruction_time_instant),
 				d_graph_edge(graph_edge),
-				d_parent_edge(NULL)
+				d_parent_edge(NULL),
+				d_relative_rotation_state(ROTATION_NOT_CACHED),
+				d_composed_absolute_rotation_state(ROTATION_NOT_CACHED)
 			{  }
 
 			/**
@@ -189,17 +216,22 @@ namespace GPlatesAppLogic
 			GPlatesMaths::FiniteRotation
 			calculate_graph_edge_relative_rotation() const;
 
+			/**
+			 * Calculates @a rotation using @a calculate_rotation, if it's not already cached, and
+			 * publishes it via @a rotation_state.
+			 *
+			 * If another thread is currently calculating it then waits for that thread to publish it.
+			 */
+			template <typename CalculateRotationFunctionType>
+			static
 			void
-			cache_relative_rotation() const
-			{
-				d_relative_rotation = calculate_graph_edge_relative_rotation();
+			cache_rotation(
+					std::atomic<int> &rotation_state,
+					boost::optional<GPlatesMaths::FiniteRotation> &rotation,
+					const CalculateRotationFunctionType &calculate_rotation);
 
-				// Reverse the relative rotation if we are reversed wrt the *graph* edge.
-				if (is_reversed())
-				{
-					d_relative_rotation = GPlatesMaths::get_reverse(d_relative_rotation.get());
-				}
-			}
+			void
+			cache_relative_rotation() const;
 
 			void
 			cache_composed_absolute_rotation() const;
@@ -235,6 +267,10 @@ namespace GPlatesAppLogic
 			// We only calculate these when needed...
 			mutable boost::optional<GPlatesMaths::FiniteRotation> d_relative_rotation;
 			mutable boost::optional<GPlatesMaths::FiniteRotation> d_composed_absolute_rotation;
+
+			//! Whether the above rotations have been calculated (see @a RotationCacheState).
+			mutable std::atomic<int> d_relative_rotation_state;
+			mutable std::atomic<int> d_composed_absolute_rotation_state;
 		};
 
 
@@ -457,8 +493,8 @@ namespace GPlatesAppLogic
 		 * Create a sub-tree by following the specified graph edge in the forward direction
 		 * (or reverse direction if @a reverse_tree_edge is true).
 		 *
-		 * But only create a tree edge if the graph edge contains the reconstruction time and
-		 * if a new tree edge does not create a cycle in the reconstruction tree.
+		 * The graph edge must contain the reconstruction time (see ReconstructionGraph::EdgeTimeIndex).
+		 * But only create a tree edge if a new tree edge does not create a cycle in the reconstruction tree.
 		 *
 		 * Returns true if an edge was created.
 		 */
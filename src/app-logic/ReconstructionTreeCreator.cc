@@ -23,6 +23,8 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <exception>
+#include <future>
 #include <list>
 #include <map>
 #include <utility>
@@ -258,7 +260,7 @@ GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::CachedReconstructionTreeCr
 							reconstruction_feature_collections,
 							extend_total_reconstruction_poles_to_distant_past))),
 	d_get_default_anchor_plate_id_function([=]() { return default_anchor_plate_id; }),
-	d_cache(d_create_reconstruction_tree_function, reconstruction_tree_cache_size)
+	d_cache(reconstruction_tree_cache_size)
 {
 }
 
@@ -279,7 +281,7 @@ GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::CachedReconstructionTreeCr
 			// Note we copied in [=] 'reconstruction_tree_creator' but it just contains a non-null pointer (so it's a cheap copy).
 			return default_anchor_plate_id ? default_anchor_plate_id.get() : reconstruction_tree_creator.get_default_anchor_plate_id();
 		}),
-	d_cache(d_create_reconstruction_tree_function, reconstruction_tree_cache_size)
+	d_cache(reconstruction_tree_cache_size)
 {
 }
 
@@ -289,7 +291,7 @@ GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::get_reconstruction_tree(
 		const double &reconstruction_time,
 		GPlatesModel::integer_plate_id_type anchor_plate_id)
 {
-	return d_cache.get_value(cache_key_type(reconstruction_time, anchor_plate_id));
+	return get_cached_reconstruction_tree(cache_key_type(reconstruction_time, anchor_plate_id));
 }
 
 
@@ -299,7 +301,7 @@ GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::get_reconstruction_tree_de
 {
 	const GPlatesModel::integer_plate_id_type default_anchor_plate_id = d_get_default_anchor_plate_id_function();
 
-	return d_cache.get_value(cache_key_type(reconstruction_time, default_anchor_plate_id));
+	return get_cached_reconstruction_tree(cache_key_type(reconstruction_time, default_anchor_plate_id));
 }
 
 
@@ -314,6 +316,7 @@ void
 GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::set_maximum_cache_size(
 		unsigned int maximum_num_cache_size)
 {
+	boost::mutex::scoped_lock cache_lock(d_cache_mutex);
 	d_cache.set_maximum_num_values_in_cache(maximum_num_cache_size);
 }
 
@@ -321,10 +324,64 @@ GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::set_maximum_cache_size(
 void
 GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::clear_cache()
 {
+	boost::mutex::scoped_lock cache_lock(d_cache_mutex);
 	d_cache.clear();
 }
 
 
+GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::cache_value_type
+GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::get_cached_reconstruction_tree(
+		const cache_key_type &key)
+{
+	std::promise<cache_value_type> reconstruction_tree_promise;
+	cache_future_value_type reconstruction_tree_future;
+
+	{
+		boost::mutex::scoped_lock cache_lock(d_cache_mutex);
+
+		cache_future_value_type &cached_reconstruction_tree_future = d_cache.get_value(key);
+		if (cached_reconstruction_tree_future.valid())
+		{
+			// Copy the future (the cache entry can be evicted by another thread once we release the lock).
+			reconstruction_tree_future = cached_reconstruction_tree_future;
+		}
+		else
+		{
+			// Not created yet (or a previous creation failed), so we'll create it - any other
+			// threads requesting the same reconstruction tree in the meantime will wait on our future.
+			reconstruction_tree_future = reconstruction_tree_promise.get_future().share();
+			cached_reconstruction_tree_future = reconstruction_tree_future;
+
+			// Release the lock before creating the reconstruction tree.
+			cache_lock.unlock();
+
+			try
+			{
+				reconstruction_tree_promise.set_value(d_create_reconstruction_tree_function(key));
+			}
+			catch (...)
+			{
+				// Reset the cache entry so the next request tries again, and pass the exception on to
+				// any threads waiting on our future.
+				//
+				// Note: If our entry was evicted (and re-inserted by another thread) in the meantime then
+				// this resets the other thread's entry instead. That's harmless - the other thread's
+				// waiters still get its reconstruction tree, it's just not cached.
+				cache_lock.lock();
+				d_cache.get_value(key) = cache_future_value_type();
+				cache_lock.unlock();
+
+				reconstruction_tree_promise.set_exception(std::current_exception());
+				throw;
+			}
+		}
+	}
+
+	// Wait for the reconstruction tree (if another thread is still creating it).
+	return reconstruction_tree_future.get();
+}
+
+
 GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::cache_value_type
 GPlatesAppLogic::CachedReconstructionTreeCreatorImpl::create_reconstruction_tree_from_reconstruction_graph(
 		const cache_key_type &key,
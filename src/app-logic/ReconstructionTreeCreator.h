@@ -26,11 +26,14 @@
 #ifndef GPLATES_APP_LOGIC_RECONSTRUCTIONTREECREATOR_H
 #define GPLATES_APP_LOGIC_RECONSTRUCTIONTREECREATOR_H
 
+#include <future>
 #include <utility>
 #include <vector>
 #include <boost/bind/bind.hpp>
 #include <boost/function.hpp>
 #include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "ReconstructionGraph.h"
 #include "ReconstructionTree.h"
@@ -282,6 +285,12 @@ namespace GPlatesAppLogic
 
 	/**
 	 * A reconstruction tree creator implementation that caches the most-recently requested reconstruction trees.
+	 *
+	 * This is thread-safe (reconstruction trees can be requested concurrently from multiple threads).
+	 * The least-recently used cache is only locked to look up (or insert) a reconstruction tree, and
+	 * not while creating it. So threads requesting different reconstruction times do not wait for
+	 * each other's reconstruction trees to be created, and threads requesting the same reconstruction
+	 * time wait for only one of them to create the reconstruction tree.
 	 */
 	class CachedReconstructionTreeCreatorImpl :
 			public ReconstructionTreeCreatorImpl
@@ -395,8 +404,16 @@ namespace GPlatesAppLogic
 		//! Typedef for the value in the reconstruction tree cache.
 		typedef ReconstructionTree::non_null_ptr_to_const_type cache_value_type;
 
+		/**
+		 * Typedef for a (possibly still being created) reconstruction tree in the cache.
+		 *
+		 * An invalid (default-constructed) future means the reconstruction tree has not been created
+		 * (or its creation failed).
+		 */
+		typedef std::shared_future<cache_value_type> cache_future_value_type;
+
 		//! Typedef for the reconstruction tree cache.
-		typedef GPlatesUtils::KeyValueCache<cache_key_type, cache_value_type> cache_type;
+		typedef GPlatesUtils::KeyValueCache<cache_key_type, cache_future_value_type> cache_type;
 
 		//! Typedef for a function accepting a cache key and returning a reconstruction tree.
 		typedef boost::function< cache_value_type (const cache_key_type &) >
@@ -409,6 +426,14 @@ namespace GPlatesAppLogic
 
 		create_reconstruction_tree_function_type d_create_reconstruction_tree_function;
 		get_default_anchor_plate_id_function_type d_get_default_anchor_plate_id_function;
+
+		/**
+		 * Protects @a d_cache.
+		 *
+		 * Note that it's only locked to look up (or insert) a cache entry, and not while creating
+		 * the reconstruction tree, so threads requesting different trees don't wait on each other.
+		 */
+		boost::mutex d_cache_mutex;
 		cache_type d_cache;
 
 
@@ -424,6 +449,13 @@ namespace GPlatesAppLogic
 				unsigned int reconstruction_tree_cache_size);
 
 
+		/**
+		 * Returns the reconstruction tree associated with @a key (creating it if not in the cache).
+		 */
+		cache_value_type
+		get_cached_reconstruction_tree(
+				const cache_key_type &key);
+
 		/**
 		 * Creates a reconstruction tree given the cache key (reconstruction time and anchor plate id).
 		 */
@@ -31,6 +31,7 @@
 #include <exception>
 #include <limits>
 #include <boost/bind/bind.hpp>
+#include <boost/foreach.hpp>
 #include <boost/utility/in_place_factory.hpp>
 // Seems we need this to avoid compile problems on some CGAL versions
 // (eg, 4.0.2 on Mac 10.6) for subsequent <CGAL/number_utils.h> include...
@@ -60,6 +61,7 @@
 #include "maths/MathsUtils.h"
 #include "maths/Real.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
 #ifdef _MSC_VER
@@ -214,6 +216,8 @@ namespace GPlatesAppLogic
 GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type
 GPlatesAppLogic::ResolvedTriangulation::Network::get_boundary_polygon_with_rigid_block_holes() const
 {
+	boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+
 	// Create polygon if not already done so.
 	if (!d_network_boundary_polygon_with_rigid_block_holes)
 	{
@@ -506,13 +510,19 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_deformation_in_deform
 	delaunay_natural_neighbor_coordinates_2_type natural_neighbor_coordinates;
 	calc_delaunay_natural_neighbor_coordinates_in_deforming_region(natural_neighbor_coordinates, point_2, start_face_hint);
 
+	// The point-to-vertex map is created on demand (but not modified after that).
+	boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+	const delaunay_point_2_to_vertex_handle_map_type &delaunay_point_2_to_vertex_handle_map =
+			get_delaunay_point_2_to_vertex_handle_map();
+	cached_data_lock.unlock();
+
 	// Interpolate the deformation infos in the triangulation using the interpolation coordinates.
 	return linear_interpolation_2(
 			natural_neighbor_coordinates,
 			// We don't need to cache the vertex deformations since, unlike velocities,
 			// they are already cached inside the vertices...
 			UncachedDataAccess<DeformationInfo>(
-					get_delaunay_point_2_to_vertex_handle_map(),
+					delaunay_point_2_to_vertex_handle_map,
 					boost::bind(&calc_delaunay_vertex_deformation, boost::placeholders::_1)));
 }
 
@@ -551,6 +561,9 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_deformed_point(
 	const VelocityDeltaTime::Type velocity_delta_time_type =
 			reverse_deform ? VelocityDeltaTime::T_TO_T_MINUS_DELTA_T : VelocityDeltaTime::T_PLUS_DELTA_T_TO_T;
 
+	// Use the deformed positions and stage rotations calculated up front if prepared for this time increment.
+	const PreparedDeformation *prepared_deformation = get_prepared_deformation(time_increment);
+
 	// See if the point is inside any interior rigid blocks.
 	boost::optional<const RigidBlock &> rigid_block;
 	if (point_location)
@@ -563,11 +576,30 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_deformed_point(
 	}
 	if (rigid_block)
 	{
-		GPlatesMaths::FiniteRotation rigid_block_stage_rotation =
-				calculate_rigid_block_stage_rotation(
-						rigid_block.get(),
-						time_increment,
-						velocity_delta_time_type);
+		GPlatesMaths::FiniteRotation rigid_block_stage_rotation = GPlatesMaths::FiniteRotation::create_identity_rotation();
+		if (prepared_deformation)
+		{
+			// All rigid block stage rotations were calculated up front.
+			const RigidBlockToStageRotationMapType &rigid_block_stage_rotations = reverse_deform
+					? prepared_deformation->forward_rigid_block_stage_rotations
+					: prepared_deformation->backward_rigid_block_stage_rotations;
+			RigidBlockToStageRotationMapType::const_iterator stage_rotation_iter =
+					rigid_block_stage_rotations.find(&rigid_block.get());
+			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+					stage_rotation_iter != rigid_block_stage_rotations.end(),
+					GPLATES_ASSERTION_SOURCE);
+
+			rigid_block_stage_rotation = stage_rotation_iter->second;
+		}
+		else
+		{
+			boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+			rigid_block_stage_rotation =
+					get_rigid_block_stage_rotation(
+							rigid_block.get(),
+							time_increment,
+							velocity_delta_time_type);
+		}
 
 		// The stage rotation goes forward in time but if we are reconstructing backward
 		// in time then we need to reverse the stage rotation.
@@ -610,12 +642,32 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_deformed_point(
 				point_2,
 				delaunay_face);
 
+		if (prepared_deformation)
+		{
+			// The prepared vertex deformed positions (and point-to-vertex map) are not modified by queries,
+			// so they're read without locking.
+			const QPointF prepared_deformed_point_2 = linear_interpolation_2(
+					natural_neighbor_coordinates,
+					PreparedDataAccess<DelaunayVertexHandleToDeformedPointMapType>(
+							reverse_deform
+									? prepared_deformation->forward_vertex_deformed_points
+									: prepared_deformation->backward_vertex_deformed_points,
+							d_delaunay_point_2_to_vertex_handle_map.get()));
+
+			return std::make_pair(
+					d_projection.unproject_to_point_on_sphere(prepared_deformed_point_2),
+					PointLocation(delaunay_face));
+		}
+
+		// The deformed vertex positions are cached.
+		boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+
 		// Look for an existing map associated with the deformed point parameters.
 		DelaunayVertexHandleToDeformedPointMapType &delaunay_vertex_handle_to_deformed_point_map =
-				d_velocity_delta_time_to_deformed_point_map.get_value(
-						std::make_pair(
-								reverse_deform,
-								std::make_pair(GPlatesMaths::Real(time_increment), velocity_delta_time_type)));
+				get_delaunay_vertex_handle_to_deformed_point_map(
+						time_increment,
+						reverse_deform,
+						velocity_delta_time_type);
 
 		// Interpolate the vertex deformed positions in the triangulation using the interpolation coordinates.
 		const QPointF deformed_point_2 = linear_interpolation_2(
@@ -654,12 +706,51 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_deformed_point(
 					point_2,
 					start_face_hint);
 
+	if (prepared_deformation)
+	{
+		// The prepared vertex deformed positions are not modified by queries, so they're read without locking.
+		const DelaunayVertexHandleToDeformedPointMapType &prepared_vertex_deformed_points = reverse_deform
+				? prepared_deformation->forward_vertex_deformed_points
+				: prepared_deformation->backward_vertex_deformed_points;
+
+		QPointF prepared_deformed_points[3];
+		for (unsigned int face_vertex_index = 0; face_vertex_index < 3; ++face_vertex_index)
+		{
+			// All vertices were calculated up front.
+			DelaunayVertexHandleToDeformedPointMapType::const_iterator deformed_point_iter =
+					prepared_vertex_deformed_points.find(delaunay_face->vertex(face_vertex_index));
+			GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+					deformed_point_iter != prepared_vertex_deformed_points.end(),
+					GPLATES_ASSERTION_SOURCE);
+
+			prepared_deformed_points[face_vertex_index] = deformed_point_iter->second;
+		}
+
+		// Interpolate the vertex deformed positions.
+		const QPointF prepared_interpolated_deformed_point(
+				CGAL::to_double(
+						barycentric_coord_vertex_1 * prepared_deformed_points[0].x() +
+						barycentric_coord_vertex_2 * prepared_deformed_points[1].x() +
+						barycentric_coord_vertex_3 * prepared_deformed_points[2].x()),
+				CGAL::to_double(
+						barycentric_coord_vertex_1 * prepared_deformed_points[0].y() +
+						barycentric_coord_vertex_2 * prepared_deformed_points[1].y() +
+						barycentric_coord_vertex_3 * prepared_deformed_points[2].y()));
+
+		return std::make_pair(
+				d_projection.unproject_to_point_on_sphere(prepared_interpolated_deformed_point),
+				PointLocation(delaunay_face));
+	}
+
+	// The deformed vertex positions are cached.
+	boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+
 	// Look for an existing map associated with the velocity delta time parameters.
 	DelaunayVertexHandleToDeformedPointMapType &delaunay_vertex_handle_to_deformed_point_map =
-			d_velocity_delta_time_to_deformed_point_map.get_value(
-					std::make_pair(
-							reverse_deform,
-							std::make_pair(GPlatesMaths::Real(time_increment), velocity_delta_time_type)));
+			get_delaunay_vertex_handle_to_deformed_point_map(
+					time_increment,
+					reverse_deform,
+					velocity_delta_time_type);
 
 	static const QPointF ZERO_POINT(0, 0);
 
@@ -733,6 +824,194 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_deformed_point(
 }
 
 
+void
+GPlatesAppLogic::ResolvedTriangulation::Network::create_delaunay_triangulations(
+		const std::vector<const Network *> &networks,
+		unsigned int num_worker_threads)
+{
+	PROFILE_FUNC();
+
+	std::vector<const Network *> concurrent_networks;
+	BOOST_FOREACH(const Network *network, networks)
+	{
+		if (network->can_create_delaunay_2_concurrently())
+		{
+			concurrent_networks.push_back(network);
+		}
+	}
+
+	// Capture each network's exception (rather than letting 'parallel_for' stop at the first one)
+	// so that one failed triangulation doesn't prevent the others from being created.
+	std::vector<std::exception_ptr> network_exceptions(concurrent_networks.size());
+
+	GPlatesUtils::ParallelUtils::parallel_for(
+			concurrent_networks.size(),
+			[&concurrent_networks, &network_exceptions](unsigned int network_index)
+			{
+				try
+				{
+					concurrent_networks[network_index]->get_delaunay_2();
+				}
+				catch (...)
+				{
+					network_exceptions[network_index] = std::current_exception();
+				}
+			},
+			num_worker_threads
+					? num_worker_threads
+					: GPlatesUtils::ParallelUtils::get_num_worker_threads());
+
+	// Re-throw the first exception (if any) in the calling thread.
+	BOOST_FOREACH(const std::exception_ptr &network_exception, network_exceptions)
+	{
+		if (network_exception)
+		{
+			std::rethrow_exception(network_exception);
+		}
+	}
+}
+
+
+void
+GPlatesAppLogic::ResolvedTriangulation::Network::prepare_for_concurrent_deformation(
+		const double &time_increment) const
+{
+	// Nothing to do if already prepared.
+	if (d_prepared_deformation_created.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	// Create the triangulation.
+	const Delaunay_2 &delaunay_2 = get_delaunay_2();
+
+	prepare_point_in_polygon_tests();
+
+	boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+
+	// Another thread might have prepared it while we were waiting for the lock.
+	if (d_prepared_deformation_created.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	get_delaunay_point_2_to_vertex_handle_map();
+
+	PreparedDeformation prepared_deformation(time_increment);
+
+	// Calculate the deformed positions of all vertices (see 'calculate_deformed_point()' for the
+	// velocity delta time type used for each deform direction).
+	Delaunay_2::Finite_vertices_iterator finite_vertices_iter = delaunay_2.finite_vertices_begin();
+	Delaunay_2::Finite_vertices_iterator finite_vertices_end = delaunay_2.finite_vertices_end();
+	for ( ; finite_vertices_iter != finite_vertices_end; ++finite_vertices_iter)
+	{
+		const Delaunay_2::Vertex_handle vertex_handle = finite_vertices_iter;
+
+		prepared_deformation.backward_vertex_deformed_points.insert(
+				std::make_pair(
+						vertex_handle,
+						calc_delaunay_vertex_deformed_point(
+								vertex_handle,
+								time_increment,
+								false/*reverse_deform*/,
+								VelocityDeltaTime::T_PLUS_DELTA_T_TO_T,
+								d_projection)));
+		prepared_deformation.forward_vertex_deformed_points.insert(
+				std::make_pair(
+						vertex_handle,
+						calc_delaunay_vertex_deformed_point(
+								vertex_handle,
+								time_increment,
+								true/*reverse_deform*/,
+								VelocityDeltaTime::T_TO_T_MINUS_DELTA_T,
+								d_projection)));
+	}
+
+	// Calculate the stage rotations of all rigid blocks.
+	rigid_block_seq_type::const_iterator rigid_blocks_iter = d_rigid_blocks.begin();
+	rigid_block_seq_type::const_iterator rigid_blocks_end = d_rigid_blocks.end();
+	for ( ; rigid_blocks_iter != rigid_blocks_end; ++rigid_blocks_iter)
+	{
+		prepared_deformation.backward_rigid_block_stage_rotations.insert(
+				RigidBlockToStageRotationMapType::value_type(
+						&*rigid_blocks_iter,
+						calculate_rigid_block_stage_rotation(
+								*rigid_blocks_iter,
+								time_increment,
+								VelocityDeltaTime::T_PLUS_DELTA_T_TO_T)));
+		prepared_deformation.forward_rigid_block_stage_rotations.insert(
+				RigidBlockToStageRotationMapType::value_type(
+						&*rigid_blocks_iter,
+						calculate_rigid_block_stage_rotation(
+								*rigid_blocks_iter,
+								time_increment,
+								VelocityDeltaTime::T_TO_T_MINUS_DELTA_T)));
+	}
+
+	d_prepared_deformation = prepared_deformation;
+
+	// Readers can now access the prepared deformation without locking.
+	d_prepared_deformation_created.store(true, std::memory_order_release);
+}
+
+
+void
+GPlatesAppLogic::ResolvedTriangulation::Network::prepare_for_concurrent_velocities(
+		const double &velocity_delta_time,
+		VelocityDeltaTime::Type velocity_delta_time_type) const
+{
+	// Create the triangulation.
+	const Delaunay_2 &delaunay_2 = get_delaunay_2();
+
+	prepare_point_in_polygon_tests();
+
+	boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+
+	get_delaunay_point_2_to_vertex_handle_map();
+
+	// Nothing to do if already prepared for the same velocity delta time parameters.
+	if (get_prepared_velocities(velocity_delta_time, velocity_delta_time_type))
+	{
+		return;
+	}
+
+	PreparedVelocities prepared_velocities(
+			std::make_pair(GPlatesMaths::Real(velocity_delta_time), velocity_delta_time_type));
+
+	// Calculate the velocities of all vertices.
+	Delaunay_2::Finite_vertices_iterator finite_vertices_iter = delaunay_2.finite_vertices_begin();
+	Delaunay_2::Finite_vertices_iterator finite_vertices_end = delaunay_2.finite_vertices_end();
+	for ( ; finite_vertices_iter != finite_vertices_end; ++finite_vertices_iter)
+	{
+		const Delaunay_2::Vertex_handle vertex_handle = finite_vertices_iter;
+
+		prepared_velocities.vertex_velocities.insert(
+				std::make_pair(
+						vertex_handle,
+						calc_delaunay_vertex_velocity(
+								vertex_handle,
+								velocity_delta_time,
+								velocity_delta_time_type)));
+	}
+
+	// Calculate the stage rotations of all rigid blocks.
+	rigid_block_seq_type::const_iterator rigid_blocks_iter = d_rigid_blocks.begin();
+	rigid_block_seq_type::const_iterator rigid_blocks_end = d_rigid_blocks.end();
+	for ( ; rigid_blocks_iter != rigid_blocks_end; ++rigid_blocks_iter)
+	{
+		prepared_velocities.rigid_block_stage_rotations.insert(
+				RigidBlockToStageRotationMapType::value_type(
+						&*rigid_blocks_iter,
+						calculate_rigid_block_stage_rotation(
+								*rigid_blocks_iter,
+								velocity_delta_time,
+								velocity_delta_time_type)));
+	}
+
+	d_prepared_velocities = prepared_velocities;
+}
+
+
 boost::optional<
 		std::pair<
 				GPlatesMaths::FiniteRotation,
@@ -796,6 +1075,9 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_stage_rotation(
 					point_2,
 					start_face_hint);
 
+	// The vertex stage rotations are cached.
+	boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+
 	// Look for an existing map associated with the velocity delta time parameters.
 	DelaunayVertexHandleToStageRotationMapType &delaunay_vertex_handle_to_stage_rotation_map =
 			d_velocity_delta_time_to_stage_rotation_map.get_value(
@@ -865,6 +1147,10 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_velocity(
 		return boost::none;
 	}
 
+	// Use the velocities calculated up front if prepared for these velocity delta time parameters.
+	const PreparedVelocities *prepared_velocities =
+			get_prepared_velocities(velocity_delta_time, velocity_delta_time_type);
+
 	// See if the point is inside any interior rigid blocks.
 	boost::optional<const RigidBlock &> rigid_block;
 	if (point_location)
@@ -882,7 +1168,8 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_velocity(
 						point,
 						rigid_block.get(),
 						velocity_delta_time,
-						velocity_delta_time_type);
+						velocity_delta_time_type,
+						prepared_velocities);
 
 		return std::make_pair(rigid_block_velocity, PointLocation(rigid_block.get()));
 	}
@@ -910,6 +1197,23 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_velocity(
 	delaunay_natural_neighbor_coordinates_2_type natural_neighbor_coordinates;
 	calc_delaunay_natural_neighbor_coordinates_in_deforming_region(natural_neighbor_coordinates, point_2, delaunay_face);
 
+	if (prepared_velocities)
+	{
+		// The prepared vertex velocities (and point-to-vertex map) are not modified by queries,
+		// so they're read without locking.
+		const GPlatesMaths::Vector3D interpolated_velocity =
+				linear_interpolation_2(
+						natural_neighbor_coordinates,
+						PreparedDataAccess<DelaunayVertexHandleToVelocityMapType>(
+								prepared_velocities->vertex_velocities,
+								d_delaunay_point_2_to_vertex_handle_map.get()));
+
+		return std::make_pair(interpolated_velocity, PointLocation(delaunay_face));
+	}
+
+	// The vertex velocities are cached.
+	boost::mutex::scoped_lock cached_data_lock(d_cached_data_mutex);
+
 	// Look for an existing map associated with the velocity delta time parameters.
 	DelaunayVertexHandleToVelocityMapType &delaunay_vertex_handle_to_velocity_map =
 			d_velocity_delta_time_to_velocity_map.get_value(
@@ -935,7 +1239,16 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_velocity(
 const GPlatesAppLogic::ResolvedTriangulation::Delaunay_2 &
 GPlatesAppLogic::ResolvedTriangulation::Network::get_delaunay_2() const
 {
-	if (!d_delaunay_2)
+	// Fast path - the triangulation has already been created.
+	if (d_delaunay_2_created.load(std::memory_order_acquire))
+	{
+		return d_delaunay_2.get();
+	}
+
+	boost::mutex::scoped_lock delaunay_2_lock(d_delaunay_2_mutex);
+
+	// Another thread might have created it while we were waiting for the lock.
+	if (!d_delaunay_2_created.load(std::memory_order_relaxed))
 	{
 		create_delaunay_2();
 
@@ -947,6 +1260,8 @@ GPlatesAppLogic::ResolvedTriangulation::Network::get_delaunay_2() const
 		// Release some build data memory since we don't need it anymore.
 		std::vector<DelaunayPoint> empty_delaunay_points;
 		d_build_info.delaunay_points.swap(empty_delaunay_points);
+
+		d_delaunay_2_created.store(true, std::memory_order_release);
 	}
 
 	return d_delaunay_2.get();
@@ -2375,32 +2690,122 @@ GPlatesAppLogic::ResolvedTriangulation::Network::calculate_rigid_block_stage_rot
 }
 
 
+void
+GPlatesAppLogic::ResolvedTriangulation::Network::prepare_point_in_polygon_tests() const
+{
+	// Test an arbitrary point against the network boundary and rigid blocks.
+	// After this the (non-adaptive) point-in-polygon tests no longer modify the polygons.
+	const GPlatesMaths::PointOnSphere test_point(d_network_boundary_polygon->get_boundary_centroid());
+
+	is_point_in_network(test_point);
+	d_network_boundary_polygon->get_bounding_small_circle();
+
+	rigid_block_seq_type::const_iterator rigid_blocks_iter = d_rigid_blocks.begin();
+	rigid_block_seq_type::const_iterator rigid_blocks_end = d_rigid_blocks.end();
+	for ( ; rigid_blocks_iter != rigid_blocks_end; ++rigid_blocks_iter)
+	{
+		is_point_in_rigid_block(test_point, *rigid_blocks_iter);
+	}
+}
+
+
+const GPlatesMaths::FiniteRotation &
+GPlatesAppLogic::ResolvedTriangulation::Network::get_rigid_block_stage_rotation(
+		const RigidBlock &rigid_block,
+		const double &time_increment,
+		VelocityDeltaTime::Type velocity_delta_time_type) const
+{
+	// Look for an existing map associated with the velocity delta time parameters.
+	RigidBlockToStageRotationMapType &rigid_block_to_stage_rotation_map =
+			d_velocity_delta_time_to_rigid_block_stage_rotation_map.get_value(
+					std::make_pair(GPlatesMaths::Real(time_increment), velocity_delta_time_type));
+
+	RigidBlockToStageRotationMapType::iterator stage_rotation_iter =
+			rigid_block_to_stage_rotation_map.find(&rigid_block);
+	if (stage_rotation_iter == rigid_block_to_stage_rotation_map.end())
+	{
+		stage_rotation_iter = rigid_block_to_stage_rotation_map.insert(
+				RigidBlockToStageRotationMapType::value_type(
+						&rigid_block,
+						calculate_rigid_block_stage_rotation(
+								rigid_block,
+								time_increment,
+								velocity_delta_time_type))).first;
+	}
+
+	return stage_rotation_iter->second;
+}
+
+
+GPlatesAppLogic::ResolvedTriangulation::Network::DelaunayVertexHandleToDeformedPointMapType &
+GPlatesAppLogic::ResolvedTriangulation::Network::get_delaunay_vertex_handle_to_deformed_point_map(
+		const double &time_increment,
+		bool reverse_deform,
+		VelocityDeltaTime::Type velocity_delta_time_type) const
+{
+	return d_velocity_delta_time_to_deformed_point_map.get_value(
+			std::make_pair(
+					reverse_deform,
+					std::make_pair(GPlatesMaths::Real(time_increment), velocity_delta_time_type)));
+}
+
+
+const GPlatesAppLogic::ResolvedTriangulation::Network::PreparedVelocities *
+GPlatesAppLogic::ResolvedTriangulation::Network::get_prepared_velocities(
+		const double &velocity_delta_time,
+		VelocityDeltaTime::Type velocity_delta_time_type) const
+{
+	if (!d_prepared_velocities ||
+		d_prepared_velocities->velocity_delta_time_params !=
+			std::make_pair(GPlatesMaths::Real(velocity_delta_time), velocity_delta_time_type))
+	{
+		return NULL;
+	}
+
+	return &d_prepared_velocities.get();
+}
+
+
+const GPlatesAppLogic::ResolvedTriangulation::Network::PreparedDeformation *
+GPlatesAppLogic::ResolvedTriangulation::Network::get_prepared_deformation(
+		const double &time_increment) const
+{
+	if (!d_prepared_deformation_created.load(std::memory_order_acquire) ||
+		d_prepared_deformation->time_increment != GPlatesMaths::Real(time_increment))
+	{
+		return NULL;
+	}
+
+	return &d_prepared_deformation.get();
+}
+
+
 GPlatesMaths::Vector3D
 GPlatesAppLogic::ResolvedTriangulation::Network::calculate_rigid_block_velocity(
 		const GPlatesMaths::PointOnSphere &point,
 		const RigidBlock &rigid_block,
 		const double &velocity_delta_time,
-		VelocityDeltaTime::Type velocity_delta_time_type) const
+		VelocityDeltaTime::Type velocity_delta_time_type,
+		const PreparedVelocities *prepared_velocities) const
 {
-	ReconstructedFeatureGeometry::non_null_ptr_type rigid_block_rfg =
-			rigid_block.get_reconstructed_feature_geometry();
-
-	// Get the rigid block plate id.
-	// If we can't get a reconstruction plate ID then we'll just use plate id zero (spin axis)
-	// which can still give a non-identity rotation if the anchor plate id is non-zero.
-	boost::optional<GPlatesModel::integer_plate_id_type> rigid_block_plate_id =
-			rigid_block_rfg->reconstruction_plate_id();
-	if (!rigid_block_plate_id)
+	if (prepared_velocities)
 	{
-		rigid_block_plate_id = 0;
+		// All rigid block stage rotations were calculated up front.
+		RigidBlockToStageRotationMapType::const_iterator stage_rotation_iter =
+				prepared_velocities->rigid_block_stage_rotations.find(&rigid_block);
+		GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+				stage_rotation_iter != prepared_velocities->rigid_block_stage_rotations.end(),
+				GPLATES_ASSERTION_SOURCE);
+
+		// Calculate the velocity from the stage rotation (the same as for non-network rigid plates).
+		return GPlatesMaths::calculate_velocity_vector(point, stage_rotation_iter->second, velocity_delta_time);
 	}
 
-	// Calculate the velocity for this plate id.
-	return PlateVelocityUtils::calculate_velocity_vector(
+	return GPlatesMaths::calculate_velocity_vector(
 			point,
-			rigid_block_plate_id.get(),
-			rigid_block_rfg->get_reconstruction_tree_creator(),
-			rigid_block_rfg->get_reconstruction_time(),
-			velocity_delta_time,
-			velocity_delta_time_type);
+			calculate_rigid_block_stage_rotation(
+					rigid_block,
+					velocity_delta_time,
+					velocity_delta_time_type),
+			velocity_delta_time);
 }
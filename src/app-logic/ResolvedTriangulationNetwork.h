@@ -27,6 +27,7 @@
 #ifndef GPLATES_APP_LOGIC_RESOLVEDTRIANGULATIONNETWORK_H
 #define GPLATES_APP_LOGIC_RESOLVEDTRIANGULATIONNETWORK_H
 
+#include <atomic>
 #include <cmath>
 #include <functional>
 #include <map>
@@ -35,6 +36,7 @@
 #include <boost/function.hpp>
 #include <boost/optional.hpp>
 #include <boost/ref.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/variant.hpp>
 #include <QPointF>
 
@@ -46,6 +48,9 @@
 #include "TopologyNetworkParams.h"
 #include "VelocityDeltaTime.h"
 
+#include "global/AssertionFailureException.h"
+#include "global/GPlatesAssert.h"
+
 #include "maths/AngularExtent.h"
 #include "maths/AzimuthalEqualAreaProjection.h"
 #include "maths/FiniteRotation.h"
@@ -352,6 +357,52 @@ namespace GPlatesAppLogic
 			}
 
 
+			/**
+			 * Returns the number of points used to build the 2D delaunay triangulation.
+			 *
+			 * This is available without building the triangulation and hence is useful for estimating
+			 * the memory used by the network once its triangulation is built.
+			 */
+			unsigned int
+			get_num_delaunay_points() const
+			{
+				return d_num_delaunay_points;
+			}
+
+
+			/**
+			 * Returns true if the 2D delaunay triangulation can be created (by @a get_delaunay_2) on a
+			 * thread other than the one that resolved this network.
+			 *
+			 * This is not the case for networks representing a rift because the adaptive rift refinement
+			 * queries reconstruction trees using the reconstruction tree creator of the topological sections,
+			 * and that can delegate to a (non-thread-safe) layer proxy.
+			 */
+			bool
+			can_create_delaunay_2_concurrently() const
+			{
+				return !d_build_info.rift_params;
+			}
+
+
+			/**
+			 * Creates the 2D delaunay triangulations (see @a get_delaunay_2) of those @a networks that
+			 * can be created concurrently (see @a can_create_delaunay_2_concurrently) using up to
+			 * @a num_worker_threads threads (zero means GPlatesUtils::ParallelUtils::get_num_worker_threads).
+			 *
+			 * The remaining networks create their triangulation when first accessed.
+			 *
+			 * If creating any triangulation throws an exception then the remaining triangulations are
+			 * still created and then the first such exception (in network order) is re-thrown in the
+			 * calling thread.
+			 */
+			static
+			void
+			create_delaunay_triangulations(
+					const std::vector<const Network *> &networks,
+					unsigned int num_worker_threads = 1);
+
+
 			/**
 			 * Returns true if the specified 3D point is inside the network boundary (PolygonOnSphere).
 			 *
@@ -655,6 +706,61 @@ namespace GPlatesAppLogic
 			}
 
 
+			/**
+			 * Calculates everything that @a calculate_deformed_point and @a get_point_location would
+			 * otherwise calculate on demand for @a time_increment (deforming in both directions).
+			 *
+			 * This includes the triangulation, the point-in-polygon structures of the network boundary
+			 * and rigid blocks, the deformed positions of all triangulation vertices and the stage
+			 * rotations of all rigid blocks.
+			 *
+			 * After this, @a calculate_deformed_point (with the same @a time_increment) and
+			 * @a get_point_location can be called concurrently by multiple threads. They no longer access
+			 * any reconstruction trees (via vertex sources or rigid blocks) and read the prepared
+			 * deformed positions and stage rotations without locking.
+			 *
+			 * Only the first call prepares anything (later calls, even with a different @a time_increment,
+			 * do nothing). So it can be called while other threads are calling @a calculate_deformed_point.
+			 */
+			void
+			prepare_for_concurrent_deformation(
+					const double &time_increment) const;
+
+
+			/**
+			 * Calculates everything that @a calculate_velocity would otherwise calculate on demand for
+			 * the specified velocity delta time parameters.
+			 *
+			 * This includes the triangulation, the point-in-polygon structures of the network boundary
+			 * and rigid blocks, the velocities of all triangulation vertices and the stage rotations
+			 * of all rigid blocks.
+			 *
+			 * After this, @a calculate_velocity (with the same velocity delta time parameters) can be
+			 * called concurrently by multiple threads. It no longer accesses any reconstruction trees
+			 * (via vertex sources or rigid blocks) and reads the prepared velocities without locking.
+			 *
+			 * Only the most recently prepared parameters are kept. So this must not be called while
+			 * other threads are calling @a calculate_velocity.
+			 */
+			void
+			prepare_for_concurrent_velocities(
+					const double &velocity_delta_time = 1.0,
+					VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_DELTA_T_TO_T) const;
+
+
+			/**
+			 * Returns true if @a prepare_for_concurrent_velocities was (most recently) called with
+			 * the specified velocity delta time parameters.
+			 */
+			bool
+			is_prepared_for_concurrent_velocities(
+					const double &velocity_delta_time = 1.0,
+					VelocityDeltaTime::Type velocity_delta_time_type = VelocityDeltaTime::T_PLUS_DELTA_T_TO_T) const
+			{
+				return get_prepared_velocities(velocity_delta_time, velocity_delta_time_type) != NULL;
+			}
+
+
 			/**
 			 * Calculates the stage rotation at @a point in the network interpolated using barycentric coordinates.
 			 *
@@ -756,6 +862,9 @@ namespace GPlatesAppLogic
 			 * NOTE: Creates delaunay triangulation if it hasn't yet been created.
 			 * This enables the optimisation whereby the triangulation is not generated
 			 * if it is never needed (accessed).
+			 *
+			 * The creation is thread-safe (if another thread is creating the triangulation then this
+			 * waits for it), but see @a can_create_delaunay_2_concurrently.
 			 */
 			const Delaunay_2 &
 			get_delaunay_2() const;
@@ -939,6 +1048,52 @@ namespace GPlatesAppLogic
 			};
 
 
+			/**
+			 * Functor class for accessing function values at delaunay vertices that have all been
+			 * calculated up front (so the map is only read, and can be read by multiple threads).
+			 */
+			template <class VertexHandleToDataMapType>
+			class PreparedDataAccess
+			{
+			public:
+
+				typedef typename VertexHandleToDataMapType::mapped_type data_type;
+
+				PreparedDataAccess(
+						const VertexHandleToDataMapType &vertex_handle_to_data_map,
+						const delaunay_point_2_to_vertex_handle_map_type &point_2_to_vertex_handle_map) :
+					d_vertex_handle_to_data_map(vertex_handle_to_data_map),
+					d_point_2_to_vertex_handle_map(point_2_to_vertex_handle_map)
+				{  }
+
+				std::pair<data_type, bool>
+				operator()(
+						const delaunay_point_2_type &point_2) const
+				{
+					// Lookup the vertex handle using the point - we should always be able to find one.
+					delaunay_point_2_to_vertex_handle_map_type::const_iterator vertex_handle_iter =
+							d_point_2_to_vertex_handle_map.find(point_2);
+					if (vertex_handle_iter == d_point_2_to_vertex_handle_map.end())
+					{
+						return std::make_pair(data_type(), false);
+					}
+
+					// All vertices were calculated up front.
+					typename VertexHandleToDataMapType::const_iterator data_iter =
+							d_vertex_handle_to_data_map.find(vertex_handle_iter->second);
+					GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+							data_iter != d_vertex_handle_to_data_map.end(),
+							GPLATES_ASSERTION_SOURCE);
+
+					return std::make_pair(data_iter->second, true);
+				}
+
+			private:
+				const VertexHandleToDataMapType &d_vertex_handle_to_data_map;
+				const delaunay_point_2_to_vertex_handle_map_type &d_point_2_to_vertex_handle_map;
+			};
+
+
 			//! Typedef for velocity delta-time parameters.
 			typedef std::pair<GPlatesMaths::Real, VelocityDeltaTime::Type> velocity_delta_time_params_type;
 
@@ -991,6 +1146,67 @@ namespace GPlatesAppLogic
 					public std::map<Delaunay_2::Vertex_handle, QPointF>
 			{  };
 
+			/**
+			 * Typedef for a mapping of rigid blocks to stage rotations.
+			 *
+			 * NOTE: Avoid compiler warning 4503 'decorated name length exceeded' in Visual Studio 2008
+			 * (see above) - which we do by inheritance instead of using a typedef.
+			 */
+			struct RigidBlockToStageRotationMapType :
+					public std::map<const RigidBlock *, GPlatesMaths::FiniteRotation>
+			{  };
+
+			//! Typedef for a mapping of velocity delta-time parameter to rigid-blocks-to-stage-rotations maps.
+			typedef GPlatesUtils::KeyValueCache<velocity_delta_time_params_type, RigidBlockToStageRotationMapType>
+					velocity_delta_time_to_rigid_block_stage_rotation_map_type;
+
+			/**
+			 * The vertex velocities and rigid block stage rotations calculated up front by
+			 * @a prepare_for_concurrent_velocities (for one set of velocity delta time parameters).
+			 *
+			 * Unlike the least-recently-used caches these are never evicted (or modified by queries),
+			 * so they're read without locking.
+			 */
+			struct PreparedVelocities
+			{
+				explicit
+				PreparedVelocities(
+						const velocity_delta_time_params_type &velocity_delta_time_params_) :
+					velocity_delta_time_params(velocity_delta_time_params_)
+				{  }
+
+				velocity_delta_time_params_type velocity_delta_time_params;
+				DelaunayVertexHandleToVelocityMapType vertex_velocities;
+				RigidBlockToStageRotationMapType rigid_block_stage_rotations;
+			};
+
+
+			/**
+			 * The vertex deformed positions and rigid block stage rotations calculated up front by
+			 * @a prepare_for_concurrent_deformation (for one time increment, deforming in both directions).
+			 *
+			 * Like @a PreparedVelocities these are never modified by queries, so they're read without locking.
+			 */
+			struct PreparedDeformation
+			{
+				explicit
+				PreparedDeformation(
+						const GPlatesMaths::Real &time_increment_) :
+					time_increment(time_increment_)
+				{  }
+
+				GPlatesMaths::Real time_increment;
+
+				// Deforming backward in time ('reverse_deform' is false)...
+				DelaunayVertexHandleToDeformedPointMapType backward_vertex_deformed_points;
+				RigidBlockToStageRotationMapType backward_rigid_block_stage_rotations;
+
+				// Deforming forward in time ('reverse_deform' is true)...
+				DelaunayVertexHandleToDeformedPointMapType forward_vertex_deformed_points;
+				RigidBlockToStageRotationMapType forward_rigid_block_stage_rotations;
+			};
+
+
 			//! Typedef for deformed position parameters.
 			typedef std::pair<bool/*reverse_deform*/, velocity_delta_time_params_type> deformed_point_params_type;
 
@@ -1029,11 +1245,26 @@ namespace GPlatesAppLogic
 			 */
 			mutable BuildInfo d_build_info;
 
+			/**
+			 * The number of points used to build the 2D delaunay triangulation.
+			 */
+			unsigned int d_num_delaunay_points;
+
 			/**
 			 * 2D delaunay triangulation is only built if it's needed.
 			 */
 			mutable boost::optional<Delaunay_2> d_delaunay_2;
 
+			/**
+			 * Whether @a d_delaunay_2 has been fully created (read without locking).
+			 */
+			mutable std::atomic<bool> d_delaunay_2_created;
+
+			/**
+			 * Serialises creation of @a d_delaunay_2 (in case it's built concurrently by multiple threads).
+			 */
+			mutable boost::mutex d_delaunay_2_mutex;
+
 			/**
 			 * Maps delaunay vertex points to vertex handles.
 			 */
@@ -1063,6 +1294,39 @@ namespace GPlatesAppLogic
 			 */
 			mutable velocity_delta_time_to_deformed_point_map_type d_velocity_delta_time_to_deformed_point_map;
 
+			/**
+			 * Maps velocity delta-time parameters to the stage rotations of rigid blocks (when deforming points).
+			 */
+			mutable velocity_delta_time_to_rigid_block_stage_rotation_map_type d_velocity_delta_time_to_rigid_block_stage_rotation_map;
+
+			/**
+			 * The vertex velocities and rigid block stage rotations prepared for concurrent velocity queries.
+			 *
+			 * Only written by @a prepare_for_concurrent_velocities (which is not called concurrently with queries).
+			 */
+			mutable boost::optional<PreparedVelocities> d_prepared_velocities;
+
+			/**
+			 * The vertex deformed positions and rigid block stage rotations prepared for concurrent deformation.
+			 *
+			 * Only written (once) by @a prepare_for_concurrent_deformation, before setting
+			 * @a d_prepared_deformation_created.
+			 */
+			mutable boost::optional<PreparedDeformation> d_prepared_deformation;
+
+			/**
+			 * Whether @a d_prepared_deformation has been fully created (read without locking).
+			 */
+			mutable std::atomic<bool> d_prepared_deformation_created;
+
+			/**
+			 * Guards the caches that get modified when they're accessed (@a d_network_boundary_polygon_with_rigid_block_holes,
+			 * @a d_delaunay_point_2_to_vertex_handle_map and the velocity/stage-rotation/deformed-point maps).
+			 *
+			 * Note that it's not held while locating points in the triangulation (the expensive part).
+			 */
+			mutable boost::mutex d_cached_data_mutex;
+
 
 			template <typename DelaunayPointIter, typename RigidBlockIter>
 			Network(
@@ -1081,6 +1345,8 @@ namespace GPlatesAppLogic
 						GPlatesMaths::PointOnSphere(network_boundary_polygon->get_boundary_centroid()),
 						1e3 * GPlatesUtils::Earth::MEAN_RADIUS_KMS/*Earth radius in metres*/),
 				d_build_info(delaunay_points_begin, delaunay_points_end, topology_network_params, rift),
+				d_num_delaunay_points(d_build_info.delaunay_points.size()),
+				d_delaunay_2_created(false),
 				// Set the number of cached velocity maps (eg, for different velocity delta time parameters).
 				//
 				// A value of 2 is suitable since a network layer will typically be asked to use one
@@ -1088,12 +1354,45 @@ namespace GPlatesAppLogic
 				// animation might override it and use another...
 				d_velocity_delta_time_to_velocity_map(2/*maximum_num_values_in_cache*/),
 				d_velocity_delta_time_to_stage_rotation_map(2/*maximum_num_values_in_cache*/),
-				d_velocity_delta_time_to_deformed_point_map(2/*maximum_num_values_in_cache*/)
+				d_velocity_delta_time_to_deformed_point_map(2/*maximum_num_values_in_cache*/),
+				// Only used when deforming points, and deforming backward and forward in time use
+				// different velocity delta time types (velocities use @a d_prepared_velocities instead)...
+				d_velocity_delta_time_to_rigid_block_stage_rotation_map(2/*maximum_num_values_in_cache*/),
+				d_prepared_deformation_created(false)
 			{  }
 
 			void
 			create_delaunay_2() const;
 
+			/**
+			 * Sets up the point-in-polygon structures of the network boundary and rigid blocks
+			 * so that they're no longer modified by point-in-polygon tests.
+			 */
+			void
+			prepare_point_in_polygon_tests() const;
+
+			/**
+			 * Returns the (cached) stage rotation of @a rigid_block (used when deforming points).
+			 *
+			 * NOTE: @a d_cached_data_mutex must be locked by the caller.
+			 */
+			const GPlatesMaths::FiniteRotation &
+			get_rigid_block_stage_rotation(
+					const RigidBlock &rigid_block,
+					const double &time_increment,
+					VelocityDeltaTime::Type velocity_delta_time_type) const;
+
+			/**
+			 * Returns the (cached) deformed-positions map for the specified parameters.
+			 *
+			 * NOTE: @a d_cached_data_mutex must be locked by the caller.
+			 */
+			DelaunayVertexHandleToDeformedPointMapType &
+			get_delaunay_vertex_handle_to_deformed_point_map(
+					const double &time_increment,
+					bool reverse_deform,
+					VelocityDeltaTime::Type velocity_delta_time_type) const;
+
 			void
 			refine_rift_delaunay_2(
 					const BuildInfo::RiftParams &rift_params,
@@ -1127,6 +1426,9 @@ namespace GPlatesAppLogic
 					const ReconstructionTreeCreator &reconstruction_tree_creator) const;
 
 
+			/**
+			 * NOTE: @a d_cached_data_mutex must be locked by the caller.
+			 */
 			const delaunay_point_2_to_vertex_handle_map_type &
 			get_delaunay_point_2_to_vertex_handle_map() const;
 
@@ -1207,12 +1509,36 @@ namespace GPlatesAppLogic
 					const double &velocity_delta_time,
 					VelocityDeltaTime::Type velocity_delta_time_type) const;
 
+			/**
+			 * Returns the prepared velocities if @a prepare_for_concurrent_velocities was called with
+			 * the specified velocity delta time parameters.
+			 */
+			const PreparedVelocities *
+			get_prepared_velocities(
+					const double &velocity_delta_time,
+					VelocityDeltaTime::Type velocity_delta_time_type) const;
+
+			/**
+			 * Returns the prepared deformation if @a prepare_for_concurrent_deformation was called with
+			 * the specified time increment.
+			 */
+			const PreparedDeformation *
+			get_prepared_deformation(
+					const double &time_increment) const;
+
+			/**
+			 * Returns the velocity of @a point in @a rigid_block.
+			 *
+			 * Uses the prepared stage rotation of @a rigid_block if @a prepared_velocities is specified,
+			 * otherwise calculates it (which queries reconstruction trees).
+			 */
 			GPlatesMaths::Vector3D
 			calculate_rigid_block_velocity(
 					const GPlatesMaths::PointOnSphere &point,
 					const RigidBlock &rigid_block,
 					const double &velocity_delta_time,
-					VelocityDeltaTime::Type velocity_delta_time_type) const;
+					VelocityDeltaTime::Type velocity_delta_time_type,
+					const PreparedVelocities *prepared_velocities) const;
 		};
 	}
 }
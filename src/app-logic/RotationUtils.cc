@@ -26,6 +26,7 @@
 #include "RotationUtils.h"
 
 #include "ReconstructionFeatureProperties.h"
+#include "ReconstructionRotationTable.h"
 #include "ReconstructionTree.h"
 #include "ReconstructionTreeCreator.h"
 
@@ -493,6 +494,38 @@ GPlatesAppLogic::RotationUtils::get_stage_pole(
 }
 
 
+GPlatesMaths::FiniteRotation
+GPlatesAppLogic::RotationUtils::get_stage_pole(
+		const ReconstructionRotationTable &rotation_table,
+		unsigned int reconstruction_time_index_1,
+		unsigned int reconstruction_time_index_2,
+		const GPlatesModel::integer_plate_id_type &moving_plate_id,
+		const GPlatesModel::integer_plate_id_type &fixed_plate_id)
+{
+	// See the other overload of 'get_stage_pole()' for an explanation of these rotation compositions.
+	//
+	// R(t1->t2,F->M) = inverse[R(0->t2,A->F)] * R(0->t2,A->M) * inverse[R(0->t1,A->M)] * R(0->t1,A->F)
+
+	const GPlatesMaths::FiniteRotation finite_rot_0_to_t1_M =
+			rotation_table.get_composed_absolute_rotation(reconstruction_time_index_1, moving_plate_id);
+	const GPlatesMaths::FiniteRotation finite_rot_0_to_t1_F =
+			rotation_table.get_composed_absolute_rotation(reconstruction_time_index_1, fixed_plate_id);
+
+	const GPlatesMaths::FiniteRotation finite_rot_0_to_t2_M =
+			rotation_table.get_composed_absolute_rotation(reconstruction_time_index_2, moving_plate_id);
+	const GPlatesMaths::FiniteRotation finite_rot_0_to_t2_F =
+			rotation_table.get_composed_absolute_rotation(reconstruction_time_index_2, fixed_plate_id);
+
+	const GPlatesMaths::FiniteRotation finite_rot_t1 =
+			GPlatesMaths::compose(GPlatesMaths::get_reverse(finite_rot_0_to_t1_F), finite_rot_0_to_t1_M);
+
+	const GPlatesMaths::FiniteRotation finite_rot_t2 =
+			GPlatesMaths::compose(GPlatesMaths::get_reverse(finite_rot_0_to_t2_F), finite_rot_0_to_t2_M);
+
+	return GPlatesMaths::compose(finite_rot_t2, GPlatesMaths::get_reverse(finite_rot_t1));
+}
+
+
 boost::optional<GPlatesMaths::FiniteRotation>
 GPlatesAppLogic::RotationUtils::calculate_short_path_final_rotation(
 		const GPlatesMaths::FiniteRotation &final_rotation,
@@ -36,6 +36,7 @@
 namespace GPlatesAppLogic
 {
 	class ReconstructionFeatureProperties;
+	class ReconstructionRotationTable;
 	class ReconstructionTree;
 	class ReconstructionTreeCreator;
 
@@ -121,6 +122,21 @@ namespace GPlatesAppLogic
 				const GPlatesModel::integer_plate_id_type &fixed_plate_id);	
 
 
+		/**
+		 * Same as the other overload of @a get_stage_pole but gets the rotations from @a rotation_table
+		 * at the reconstruction times with indices @a reconstruction_time_index_1 and @a reconstruction_time_index_2.
+		 *
+		 * This avoids creating a reconstruction tree per time when calculating stage poles over many times.
+		 */
+		GPlatesMaths::FiniteRotation
+		get_stage_pole(
+				const ReconstructionRotationTable &rotation_table,
+				unsigned int reconstruction_time_index_1,
+				unsigned int reconstruction_time_index_2,
+				const GPlatesModel::integer_plate_id_type &moving_plate_id,
+				const GPlatesModel::integer_plate_id_type &fixed_plate_id);
+
+
 		/**
 		 * Returns an adjusted version of @a final_rotation such that the relative rotation
 		 * from @a initial_rotation to @a final_rotation takes the short path around the globe
@@ -54,6 +54,7 @@
 #include "property-values/GpmlTopologicalPoint.h"
 
 #include "utils/GeometryCreationUtils.h"
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 #include "utils/UnicodeStringUtils.h"
 
@@ -63,12 +64,14 @@ GPlatesAppLogic::TopologyGeometryResolver::TopologyGeometryResolver(
 		ReconstructHandle::type reconstruct_handle,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles) :
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		unsigned int num_worker_threads) :
 	d_resolved_topological_lines(resolved_topological_lines),
 	d_reconstruct_handle(reconstruct_handle),
 	d_reconstruction_tree_creator(reconstruction_tree_creator),
 	d_reconstruction_tree(reconstruction_tree_creator.get_reconstruction_tree(reconstruction_time)),
-	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles)
+	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles),
+	d_num_worker_threads(num_worker_threads)
 {  
 }
 
@@ -78,12 +81,14 @@ GPlatesAppLogic::TopologyGeometryResolver::TopologyGeometryResolver(
 		ReconstructHandle::type reconstruct_handle,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles) :
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		unsigned int num_worker_threads) :
 	d_resolved_topological_boundaries(resolved_topological_boundaries),
 	d_reconstruct_handle(reconstruct_handle),
 	d_reconstruction_tree_creator(reconstruction_tree_creator),
 	d_reconstruction_tree(reconstruction_tree_creator.get_reconstruction_tree(reconstruction_time)),
-	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles)
+	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles),
+	d_num_worker_threads(num_worker_threads)
 {  
 }
 
@@ -94,17 +99,54 @@ GPlatesAppLogic::TopologyGeometryResolver::TopologyGeometryResolver(
 		ReconstructHandle::type reconstruct_handle,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles) :
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		unsigned int num_worker_threads) :
 	d_resolved_topological_lines(resolved_topological_lines),
 	d_resolved_topological_boundaries(resolved_topological_boundaries),
 	d_reconstruct_handle(reconstruct_handle),
 	d_reconstruction_tree_creator(reconstruction_tree_creator),
 	d_reconstruction_tree(reconstruction_tree_creator.get_reconstruction_tree(reconstruction_time)),
-	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles)
+	d_topological_sections_reconstruct_handles(topological_sections_reconstruct_handles),
+	d_num_worker_threads(num_worker_threads)
 {  
 }
 
 
+void
+GPlatesAppLogic::TopologyGeometryResolver::resolve_deferred_topologies()
+{
+	if (d_deferred_resolved_geometries.empty())
+	{
+		return;
+	}
+
+	PROFILE_FUNC();
+
+	// Intersect the sections, and build the resolved geometry, of each topology concurrently.
+	//
+	// This only accesses the (recorded) section geometries and the shared intersection cache.
+	const unsigned int num_deferred_resolved_geometries = d_deferred_resolved_geometries.size();
+	GPlatesUtils::ParallelUtils::parallel_for(
+			num_deferred_resolved_geometries,
+			[this](unsigned int resolved_geometry_index)
+			{
+				resolve_geometry(d_deferred_resolved_geometries[resolved_geometry_index]);
+			},
+			d_num_worker_threads
+					? d_num_worker_threads
+					: GPlatesUtils::ParallelUtils::get_num_worker_threads());
+
+	// Create the resolved topological geometries (in the order visited) on this thread
+	// since they reference the model.
+	BOOST_FOREACH(const ResolvedGeometry &resolved_geometry, d_deferred_resolved_geometries)
+	{
+		create_resolved_topological_geometry(resolved_geometry);
+	}
+
+	d_deferred_resolved_geometries.clear();
+}
+
+
 bool
 GPlatesAppLogic::TopologyGeometryResolver::initialise_pre_feature_properties(
 		GPlatesModel::FeatureHandle &feature_handle)
@@ -226,16 +268,10 @@ GPlatesAppLogic::TopologyGeometryResolver::visit_gpml_topological_polygon(
 			gpml_topological_polygon.exterior_sections_end());
 
 	//
-	// Now iterate over our internal structure 'd_resolved_geometry' and
-	// intersect neighbouring sections that require it and
-	// generate the resolved boundary subsegments.
+	// Now intersect neighbouring sections that require it, generate the resolved boundary
+	// subsegments and create the resolved topological boundary (either now or deferred).
 	//
-	process_resolved_boundary_topological_section_intersections();
-
-	//
-	// Now create the resolved topological boundary.
-	//
-	create_resolved_topological_boundary();
+	record_resolved_geometry(RESOLVE_BOUNDARY);
 
 	// Finished visiting topological polygon property.
 	d_current_resolved_geometry_type = boost::none;
@@ -269,16 +305,10 @@ GPlatesAppLogic::TopologyGeometryResolver::visit_gpml_topological_line(
 			gpml_topological_line.sections_end());
 
 	//
-	// Now iterate over our internal structure 'd_resolved_geometry' and
-	// intersect neighbouring sections that require it and
-	// generate the resolved line subsegments.
+	// Now intersect neighbouring sections that require it, generate the resolved line
+	// subsegments and create the resolved topological line (either now or deferred).
 	//
-	process_resolved_line_topological_section_intersections();
-
-	//
-	// Now create the resolved topological line.
-	//
-	create_resolved_topological_line();
+	record_resolved_geometry(RESOLVE_LINE);
 
 	// Finished visiting topological line property.
 	d_current_resolved_geometry_type = boost::none;
@@ -441,11 +471,12 @@ GPlatesAppLogic::TopologyGeometryResolver::record_topological_section_reconstruc
 
 
 void
-GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological_section_intersections()
+GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological_section_intersections(
+		ResolvedGeometry::section_seq_type &sections)
 {
 	// Iterate over our internal sequence of sections that we built up by
 	// visiting the topological sections of a topological geometry property.
-	const std::size_t num_sections = d_resolved_geometry.d_sections.size();
+	const std::size_t num_sections = sections.size();
 
 	// If there's only one section then don't try to intersect it with itself.
 	if (num_sections < 2)
@@ -464,7 +495,7 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological
 		// This makes a difference if the user builds a topology with two sections that only
 		// intersect once (not something the user should be building) and means that the
 		// same topology will be creating here as in the builder.
-		process_resolved_boundary_topological_section_intersection(1/*section_index*/, true/*two_sections*/);
+		process_resolved_boundary_topological_section_intersection(sections, 1/*section_index*/, true/*two_sections*/);
 		return;
 	}
 
@@ -472,13 +503,14 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological
 	// and its previous neighbour.
 	for (std::size_t section_index = 0; section_index < num_sections; ++section_index)
 	{
-		process_resolved_boundary_topological_section_intersection(section_index);
+		process_resolved_boundary_topological_section_intersection(sections, section_index);
 	}
 }
 
 
 void
 GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological_section_intersection(
+		ResolvedGeometry::section_seq_type &sections,
 		const std::size_t current_section_index,
 		const bool two_sections)
 {
@@ -486,9 +518,9 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological
 	// Intersect the current section with the previous section.
 	//
 
-	const std::size_t num_sections = d_resolved_geometry.d_sections.size();
+	const std::size_t num_sections = sections.size();
 
-	ResolvedGeometry::Section &current_section = d_resolved_geometry.d_sections[current_section_index];
+	ResolvedGeometry::Section &current_section = sections[current_section_index];
 
 	//
 	// We get the start intersection geometry the previous section in the topological geometry's
@@ -500,7 +532,7 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological
 			? num_sections - 1
 			: current_section_index - 1;
 
-	ResolvedGeometry::Section &prev_section = d_resolved_geometry.d_sections[prev_section_index];
+	ResolvedGeometry::Section &prev_section = sections[prev_section_index];
 
 	// If both sections refer to the same geometry then don't intersect.
 	// This can happen when the same geometry is added more than once to the topology
@@ -524,12 +556,14 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological
 	{
 		current_section.d_intersection_results->
 				intersect_with_previous_section_allowing_two_intersections(
-						prev_section.d_intersection_results);
+						prev_section.d_intersection_results,
+						d_intersection_cache);
 	}
 	else
 	{
 		current_section.d_intersection_results->intersect_with_previous_section(
-				prev_section.d_intersection_results);
+				prev_section.d_intersection_results,
+				d_intersection_cache);
 	}
 
 	// NOTE: We don't need to look at the end intersection because the next topological
@@ -540,11 +574,12 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_boundary_topological
 
 
 void
-GPlatesAppLogic::TopologyGeometryResolver::process_resolved_line_topological_section_intersections()
+GPlatesAppLogic::TopologyGeometryResolver::process_resolved_line_topological_section_intersections(
+		ResolvedGeometry::section_seq_type &sections)
 {
 	// Iterate over our internal sequence of sections that we built up by
 	// visiting the topological sections of a topological geometry property.
-	const std::size_t num_sections = d_resolved_geometry.d_sections.size();
+	const std::size_t num_sections = sections.size();
 
 	// If there's only one section then don't try to intersect it with itself.
 	if (num_sections < 2)
@@ -561,20 +596,21 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_line_topological_sec
 	// and its previous neighbour.
 	for (std::size_t section_index = 0; section_index < num_sections; ++section_index)
 	{
-		process_resolved_line_topological_section_intersection(section_index);
+		process_resolved_line_topological_section_intersection(sections, section_index);
 	}
 }
 
 
 void
 GPlatesAppLogic::TopologyGeometryResolver::process_resolved_line_topological_section_intersection(
+		ResolvedGeometry::section_seq_type &sections,
 		const std::size_t current_section_index)
 {
 	//
 	// Intersect the current section with the previous section.
 	//
 
-	ResolvedGeometry::Section &current_section = d_resolved_geometry.d_sections[current_section_index];
+	ResolvedGeometry::Section &current_section = sections[current_section_index];
 
 	//
 	// We get the start intersection geometry from the previous section in the topological geometry's
@@ -590,7 +626,7 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_line_topological_sec
 
 	const std::size_t prev_section_index = current_section_index - 1;
 
-	ResolvedGeometry::Section &prev_section = d_resolved_geometry.d_sections[prev_section_index];
+	ResolvedGeometry::Section &prev_section = sections[prev_section_index];
 
 	// If both sections refer to the same geometry then don't intersect.
 	// This can happen when the same geometry is added more than once to the topology
@@ -611,7 +647,8 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_line_topological_sec
 	// Process the actual intersection.
 	//
 	current_section.d_intersection_results->intersect_with_previous_section(
-			prev_section.d_intersection_results);
+			prev_section.d_intersection_results,
+			d_intersection_cache);
 
 	// NOTE: We don't need to look at the end intersection because the next topological
 	// section that we visit will have this current section as its start intersection and
@@ -621,57 +658,149 @@ GPlatesAppLogic::TopologyGeometryResolver::process_resolved_line_topological_sec
 
 
 void
-GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_boundary()
+GPlatesAppLogic::TopologyGeometryResolver::record_resolved_geometry(
+		ResolveGeometryType resolve_geometry_type)
 {
-	PROFILE_FUNC();
-
-	// The points to create the plate polygon with.
-	std::vector<GPlatesMaths::PointOnSphere> polygon_points;
-
-	// Sequence of subsegments of resolved topology used when creating ResolvedTopologicalBoundary.
-	std::vector<ResolvedTopologicalGeometrySubSegment::non_null_ptr_type> output_subsegments;
+	d_resolved_geometry.d_resolve_geometry_type = resolve_geometry_type;
 
-	// Iterate over the sections of the resolved boundary and construct
-	// the resolved polygon boundary and its subsegments.
+	// Record the section feature references.
+	// If a section's feature reference is invalid then the section will not contribute to the resolved geometry.
 	const std::size_t num_sections = d_resolved_geometry.d_sections.size();
 	for (std::size_t section_index = 0; section_index < num_sections; ++section_index)
 	{
 		const ResolvedGeometry::Section &section = d_resolved_geometry.d_sections[section_index];
 
-		// Get the subsegment feature reference.
-		boost::optional<GPlatesModel::FeatureHandle::weak_ref> subsegment_feature_ref =
-				GPlatesAppLogic::ReconstructionGeometryUtils::get_feature_ref(section.d_source_rg);
+		d_resolved_geometry.d_section_feature_refs.push_back(
+				ReconstructionGeometryUtils::get_feature_ref(section.d_source_rg));
+	}
+
+	// Record the topological geometry property and some reconstruction properties of its feature.
+	d_resolved_geometry.d_property_iterator = current_top_level_propiter();
+	d_resolved_geometry.d_recon_plate_id = d_reconstruction_params.get_recon_plate_id();
+	d_resolved_geometry.d_time_of_appearance = d_reconstruction_params.get_time_of_appearance();
+
+	if (d_num_worker_threads == 1)
+	{
+		// Resolve the topology now.
+		resolve_geometry(d_resolved_geometry);
+		create_resolved_topological_geometry(d_resolved_geometry);
+		return;
+	}
+
+	// Section geometries can be shared with other topologies, so build their lazily-created
+	// intersection data now (on this thread) rather than when resolving concurrently.
+	for (std::size_t section_index = 0; section_index < num_sections; ++section_index)
+	{
+		d_resolved_geometry.d_sections[section_index].d_intersection_results->prepare_for_concurrent_intersection();
+	}
+
+	// Defer resolving the topology until 'resolve_deferred_topologies()'.
+	d_deferred_resolved_geometries.push_back(d_resolved_geometry);
+}
+
+
+void
+GPlatesAppLogic::TopologyGeometryResolver::resolve_geometry(
+		ResolvedGeometry &resolved_geometry)
+{
+	bool include_rubber_band_points;
+
+	//
+	// Iterate over our internal sequence of sections and intersect neighbouring sections
+	// that require it (this generates the resolved subsegments).
+	//
+	if (resolved_geometry.d_resolve_geometry_type == RESOLVE_BOUNDARY)
+	{
+		process_resolved_boundary_topological_section_intersections(resolved_geometry.d_sections);
+
+		include_rubber_band_points = ResolvedTopologicalBoundary::INCLUDE_SUB_SEGMENT_RUBBER_BAND_POINTS_IN_RESOLVED_BOUNDARY;
+	}
+	else // RESOLVE_LINE ...
+	{
+		process_resolved_line_topological_section_intersections(resolved_geometry.d_sections);
+
+		include_rubber_band_points = ResolvedTopologicalLine::INCLUDE_SUB_SEGMENT_RUBBER_BAND_POINTS_IN_RESOLVED_LINE;
+	}
+
+	// The points to create the resolved polygon or polyline with.
+	std::vector<GPlatesMaths::PointOnSphere> resolved_geometry_points;
+
+	// Iterate over the sections and append their subsegment points.
+	const std::size_t num_sections = resolved_geometry.d_sections.size();
+	for (std::size_t section_index = 0; section_index < num_sections; ++section_index)
+	{
 		// If the feature reference is invalid then skip the current section.
-		if (!subsegment_feature_ref)
+		if (!resolved_geometry.d_section_feature_refs[section_index])
 		{
 			continue;
 		}
 
-		// Create a subsegment structure that'll get used when creating the resolved topological boundary.
-		const ResolvedTopologicalGeometrySubSegment::non_null_ptr_type output_subsegment =
-				ResolvedTopologicalGeometrySubSegment::create(
-						section.d_intersection_results->get_sub_segment_range_in_section(),
-						section.d_intersection_results->get_reverse_flag(),
-						subsegment_feature_ref.get(),
-						section.d_source_rg);
-		output_subsegments.push_back(output_subsegment);
+		const ResolvedGeometry::Section &section = resolved_geometry.d_sections[section_index];
 
-		// Append the subsegment geometry to the plate polygon points.
+		// Append the subsegment geometry to the resolved geometry points.
 		// Subsegment should be reversed if that's how it contributed to the resolved topology.
-		output_subsegment->get_reversed_sub_segment_points(
-				polygon_points,
-				ResolvedTopologicalBoundary::INCLUDE_SUB_SEGMENT_RUBBER_BAND_POINTS_IN_RESOLVED_BOUNDARY/*include_rubber_band_points*/);
+		section.d_intersection_results->get_reversed_sub_segment_points(
+				resolved_geometry_points,
+				include_rubber_band_points);
+	}
+
+	if (resolved_geometry.d_resolve_geometry_type == RESOLVE_BOUNDARY)
+	{
+		// Create a polygon on sphere for the resolved boundary using 'resolved_geometry_points'.
+		GPlatesUtils::GeometryConstruction::GeometryConstructionValidity polygon_validity;
+		boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> plate_polygon =
+				GPlatesUtils::create_polygon_on_sphere(
+						resolved_geometry_points.begin(), resolved_geometry_points.end(), polygon_validity);
+
+		// If we are unable to create a polygon (such as insufficient points) then
+		// a resolved topological geometry will not be created.
+		if (polygon_validity == GPlatesUtils::GeometryConstruction::VALID)
+		{
+			resolved_geometry.d_boundary_polygon = plate_polygon;
+		}
 	}
+	else // RESOLVE_LINE ...
+	{
+		// Create a polyline on sphere for the resolved line using 'resolved_geometry_points'.
+		GPlatesUtils::GeometryConstruction::GeometryConstructionValidity polyline_validity;
+		boost::optional<GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type> resolved_line_geometry =
+				GPlatesUtils::create_polyline_on_sphere(
+						resolved_geometry_points.begin(), resolved_geometry_points.end(), polyline_validity);
+
+		// If we are unable to create a polyline (such as insufficient points) then
+		// a resolved topological geometry will not be created.
+		if (polyline_validity == GPlatesUtils::GeometryConstruction::VALID)
+		{
+			resolved_geometry.d_line_polyline = resolved_line_geometry;
+		}
+	}
+}
 
-	// Create a polygon on sphere for the resolved boundary using 'polygon_points'.
-	GPlatesUtils::GeometryConstruction::GeometryConstructionValidity polygon_validity;
-	boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> plate_polygon =
-			GPlatesUtils::create_polygon_on_sphere(
-					polygon_points.begin(), polygon_points.end(), polygon_validity);
 
-	// If we are unable to create a polygon (such as insufficient points) then
+void
+GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_geometry(
+		const ResolvedGeometry &resolved_geometry)
+{
+	if (resolved_geometry.d_resolve_geometry_type == RESOLVE_BOUNDARY)
+	{
+		create_resolved_topological_boundary(resolved_geometry);
+	}
+	else // RESOLVE_LINE ...
+	{
+		create_resolved_topological_line(resolved_geometry);
+	}
+}
+
+
+void
+GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_boundary(
+		const ResolvedGeometry &resolved_geometry)
+{
+	PROFILE_FUNC();
+
+	// If we were unable to create a polygon (such as insufficient points) then
 	// just return without creating a resolved topological geometry.
-	if (polygon_validity != GPlatesUtils::GeometryConstruction::VALID)
+	if (!resolved_geometry.d_boundary_polygon)
 	{
 // These errors never really get fixed in the topology datasets so might as well stop spamming the log.
 // Better to write a pyGPlates script to detect these types of errors as a post-process.
@@ -680,12 +809,40 @@ GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_boundary(
 				"insufficient points for a polygon.";
 		qDebug() << "Skipping creation for topological polygon feature_id=";
 		qDebug() << GPlatesUtils::make_qstring_from_icu_string(
-				d_currently_visited_feature->feature_id().get());
+				resolved_geometry.d_property_iterator->handle_weak_ref()->feature_id().get());
 #endif
 
 		return;
 	}
 
+	// Sequence of subsegments of resolved topology used when creating ResolvedTopologicalBoundary.
+	std::vector<ResolvedTopologicalGeometrySubSegment::non_null_ptr_type> output_subsegments;
+
+	// Iterate over the sections of the resolved boundary and construct its subsegments.
+	const std::size_t num_sections = resolved_geometry.d_sections.size();
+	for (std::size_t section_index = 0; section_index < num_sections; ++section_index)
+	{
+		const ResolvedGeometry::Section &section = resolved_geometry.d_sections[section_index];
+
+		// Get the subsegment feature reference.
+		const boost::optional<GPlatesModel::FeatureHandle::weak_ref> &subsegment_feature_ref =
+				resolved_geometry.d_section_feature_refs[section_index];
+		// If the feature reference is invalid then skip the current section.
+		if (!subsegment_feature_ref)
+		{
+			continue;
+		}
+
+		// Create a subsegment structure that'll get used when creating the resolved topological boundary.
+		const ResolvedTopologicalGeometrySubSegment::non_null_ptr_type output_subsegment =
+				ResolvedTopologicalGeometrySubSegment::create(
+						section.d_intersection_results->get_sub_segment_range_in_section(),
+						section.d_intersection_results->get_reverse_flag(),
+						subsegment_feature_ref.get(),
+						section.d_source_rg);
+		output_subsegments.push_back(output_subsegment);
+	}
+
 	//
 	// Create the RTB for the plate polygon.
 	//
@@ -693,13 +850,13 @@ GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_boundary(
 		ResolvedTopologicalBoundary::create(
 			d_reconstruction_tree,
 			d_reconstruction_tree_creator,
-			*plate_polygon,
-			*(current_top_level_propiter()->handle_weak_ref()),
-			*(current_top_level_propiter()),
+			resolved_geometry.d_boundary_polygon.get(),
+			*(resolved_geometry.d_property_iterator->handle_weak_ref()),
+			resolved_geometry.d_property_iterator.get(),
 			output_subsegments.begin(),
 			output_subsegments.end(),
-			d_reconstruction_params.get_recon_plate_id(),
-			d_reconstruction_params.get_time_of_appearance(),
+			resolved_geometry.d_recon_plate_id,
+			resolved_geometry.d_time_of_appearance,
 			d_reconstruct_handle/*identify where/when this RTG was resolved*/);
 
 	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
@@ -710,26 +867,40 @@ GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_boundary(
 
 
 void
-GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_line()
+GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_line(
+		const ResolvedGeometry &resolved_geometry)
 {
 	PROFILE_FUNC();
 
-	// The points to create the resolved line with.
-	std::vector<GPlatesMaths::PointOnSphere> resolved_line_points;
+	// If we were unable to create a polyline (such as insufficient points) then
+	// just return without creating a resolved topological geometry.
+	if (!resolved_geometry.d_line_polyline)
+	{
+// These errors never really get fixed in the topology datasets so might as well stop spamming the log.
+// Better to write a pyGPlates script to detect these types of errors as a post-process.
+#if 0
+		qDebug() << "ERROR: Failed to create a ResolvedTopologicalLine - probably has "
+				"insufficient points for a polyline.";
+		qDebug() << "Skipping creation for topological line feature_id=";
+		qDebug() << GPlatesUtils::make_qstring_from_icu_string(
+				resolved_geometry.d_property_iterator->handle_weak_ref()->feature_id().get());
+#endif
+
+		return;
+	}
 
 	// Sequence of subsegments of resolved topology used when creating ResolvedTopologicalLine.
 	std::vector<ResolvedTopologicalGeometrySubSegment::non_null_ptr_type> output_subsegments;
 
-	// Iterate over the sections of the resolved line and construct
-	// the resolved polyline and its subsegments.
-	const std::size_t num_sections = d_resolved_geometry.d_sections.size();
+	// Iterate over the sections of the resolved line and construct its subsegments.
+	const std::size_t num_sections = resolved_geometry.d_sections.size();
 	for (std::size_t section_index = 0; section_index < num_sections; ++section_index)
 	{
-		const ResolvedGeometry::Section &section = d_resolved_geometry.d_sections[section_index];
+		const ResolvedGeometry::Section &section = resolved_geometry.d_sections[section_index];
 
 		// Get the subsegment feature reference.
-		boost::optional<GPlatesModel::FeatureHandle::weak_ref> subsegment_feature_ref =
-				GPlatesAppLogic::ReconstructionGeometryUtils::get_feature_ref(section.d_source_rg);
+		const boost::optional<GPlatesModel::FeatureHandle::weak_ref> &subsegment_feature_ref =
+				resolved_geometry.d_section_feature_refs[section_index];
 		// If the feature reference is invalid then skip the current section.
 		if (!subsegment_feature_ref)
 		{
@@ -744,35 +915,6 @@ GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_line()
 						subsegment_feature_ref.get(),
 						section.d_source_rg);
 		output_subsegments.push_back(output_subsegment);
-
-		// Append the subsegment geometry to the resolved line points.
-		// Subsegment should be reversed if that's how it contributed to the resolved topology.
-		output_subsegment->get_reversed_sub_segment_points(
-				resolved_line_points,
-				ResolvedTopologicalLine::INCLUDE_SUB_SEGMENT_RUBBER_BAND_POINTS_IN_RESOLVED_LINE/*include_rubber_band_points*/);
-	}
-
-	// Create a polyline on sphere for the resolved line using 'resolved_line_points'.
-	GPlatesUtils::GeometryConstruction::GeometryConstructionValidity polyline_validity;
-	boost::optional<GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type> resolved_line_geometry =
-			GPlatesUtils::create_polyline_on_sphere(
-					resolved_line_points.begin(), resolved_line_points.end(), polyline_validity);
-
-	// If we are unable to create a polyline (such as insufficient points) then
-	// just return without creating a resolved topological geometry.
-	if (polyline_validity != GPlatesUtils::GeometryConstruction::VALID)
-	{
-// These errors never really get fixed in the topology datasets so might as well stop spamming the log.
-// Better to write a pyGPlates script to detect these types of errors as a post-process.
-#if 0
-		qDebug() << "ERROR: Failed to create a ResolvedTopologicalLine - probably has "
-				"insufficient points for a polyline.";
-		qDebug() << "Skipping creation for topological line feature_id=";
-		qDebug() << GPlatesUtils::make_qstring_from_icu_string(
-				d_currently_visited_feature->feature_id().get());
-#endif
-
-		return;
 	}
 
 	//
@@ -782,13 +924,13 @@ GPlatesAppLogic::TopologyGeometryResolver::create_resolved_topological_line()
 		ResolvedTopologicalLine::create(
 			d_reconstruction_tree,
 			d_reconstruction_tree_creator,
-			*resolved_line_geometry,
-			*(current_top_level_propiter()->handle_weak_ref()),
-			*(current_top_level_propiter()),
+			resolved_geometry.d_line_polyline.get(),
+			*(resolved_geometry.d_property_iterator->handle_weak_ref()),
+			resolved_geometry.d_property_iterator.get(),
 			output_subsegments.begin(),
 			output_subsegments.end(),
-			d_reconstruction_params.get_recon_plate_id(),
-			d_reconstruction_params.get_time_of_appearance(),
+			resolved_geometry.d_recon_plate_id,
+			resolved_geometry.d_time_of_appearance,
 			d_reconstruct_handle/*identify where/when this RTG was resolved*/);
 
 	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
@@ -39,9 +39,12 @@
 #include "ReconstructionTree.h"
 #include "ResolvedTopologicalBoundary.h"
 #include "ResolvedTopologicalLine.h"
+#include "TopologyIntersectionCache.h"
 #include "TopologyIntersections.h"
 
 #include "maths/GeometryOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/PolylineOnSphere.h"
 
 #include "model/types.h"
 #include "model/FeatureId.h"
@@ -50,6 +53,7 @@
 #include "model/FeatureCollectionHandle.h"
 #include "model/Model.h"
 
+#include "property-values/GeoTimeInstant.h"
 #include "property-values/GpmlTopologicalSection.h"
 
 
@@ -80,13 +84,17 @@ namespace GPlatesAppLogic
 		 *        the subset, of all reconstruction geometries observing the topological section features,
 		 *        that should be searched when resolving the topological geometries.
 		 *        This is useful to avoid outdated reconstruction geometries still in existence (and other scenarios).
+		 * @param num_worker_threads is the number of threads used to resolve the visited topologies -
+		 *        see @a resolve_deferred_topologies (one resolves each topology as it is visited, and
+		 *        zero means use GPlatesUtils::ParallelUtils::get_num_worker_threads).
 		 */
 		TopologyGeometryResolver(
 				std::vector<ResolvedTopologicalLine::non_null_ptr_type> &resolved_topological_lines,
 				ReconstructHandle::type reconstruct_handle,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+				unsigned int num_worker_threads = 1);
 
 		/**
 		 * The resolved topological *boundaries* are appended to @a resolved_topological_boundaries.
@@ -96,13 +104,17 @@ namespace GPlatesAppLogic
 		 *        the subset, of all reconstruction geometries observing the topological section features,
 		 *        that should be searched when resolving the topological geometries.
 		 *        This is useful to avoid outdated reconstruction geometries still in existence (and other scenarios).
+		 * @param num_worker_threads is the number of threads used to resolve the visited topologies -
+		 *        see @a resolve_deferred_topologies (one resolves each topology as it is visited, and
+		 *        zero means use GPlatesUtils::ParallelUtils::get_num_worker_threads).
 		 */
 		TopologyGeometryResolver(
 				std::vector<ResolvedTopologicalBoundary::non_null_ptr_type> &resolved_topological_boundaries,
 				ReconstructHandle::type reconstruct_handle,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+				unsigned int num_worker_threads = 1);
 
 		/**
 		 * The resolved topological *lines* are appended to @a resolved_topological_lines and
@@ -113,6 +125,9 @@ namespace GPlatesAppLogic
 		 *        the subset, of all reconstruction geometries observing the topological section features,
 		 *        that should be searched when resolving the topological geometries.
 		 *        This is useful to avoid outdated reconstruction geometries still in existence (and other scenarios).
+		 * @param num_worker_threads is the number of threads used to resolve the visited topologies -
+		 *        see @a resolve_deferred_topologies (one resolves each topology as it is visited, and
+		 *        zero means use GPlatesUtils::ParallelUtils::get_num_worker_threads).
 		 */
 		TopologyGeometryResolver(
 				std::vector<ResolvedTopologicalLine::non_null_ptr_type> &resolved_topological_lines,
@@ -120,12 +135,29 @@ namespace GPlatesAppLogic
 				ReconstructHandle::type reconstruct_handle,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+				unsigned int num_worker_threads = 1);
 
 		virtual
 		~TopologyGeometryResolver() 
 		{  }
 
+
+		/**
+		 * Creates the resolved topological geometries of the topologies visited since the last call.
+		 *
+		 * This only applies when resolving with more than one worker thread (see constructor).
+		 * In that case visiting a topological geometry only records its topological sections, and
+		 * this method then intersects the sections (and builds the resolved geometries) of all
+		 * recorded topologies concurrently. The resolved topological geometries are appended to
+		 * the caller's sequences in the same order they were visited.
+		 *
+		 * This does nothing when resolving with a single worker thread (since each topology
+		 * is then resolved as it is visited).
+		 */
+		void
+		resolve_deferred_topologies();
+
 		virtual
 		bool
 		initialise_pre_feature_properties(
@@ -165,6 +197,17 @@ namespace GPlatesAppLogic
 				GPlatesPropertyValues::GpmlTopologicalPoint &gpml_topological_point);
 
 	private:
+
+		//! The type of topological geometry to resolve.
+		enum ResolveGeometryType
+		{
+			RESOLVE_BOUNDARY,
+			RESOLVE_LINE,
+
+			NUM_RESOLVE_GEOMETRY_TYPES // This must be last.
+		};
+
+
 		/**
 		 * Stores/builds information from iterating over @a GpmlTopologicalSection objects.
 		 */
@@ -176,6 +219,12 @@ namespace GPlatesAppLogic
 			reset()
 			{
 				d_sections.clear();
+				d_section_feature_refs.clear();
+				d_property_iterator = boost::none;
+				d_recon_plate_id = boost::none;
+				d_time_of_appearance = boost::none;
+				d_boundary_polygon = boost::none;
+				d_line_polyline = boost::none;
 			}
 
 			//! Keeps track of topological section information when visiting topological sections.
@@ -209,16 +258,36 @@ namespace GPlatesAppLogic
 
 			//! Sequence of sections of the currently visited topological geometry.
 			section_seq_type d_sections;
-		};
 
+			//
+			// The following are recorded (on the visiting thread) once all sections have been recorded,
+			// since the model cannot be accessed when resolving topologies concurrently.
+			//
 
-		//! The type of topological geometry to resolve.
-		enum ResolveGeometryType
-		{
-			RESOLVE_BOUNDARY,
-			RESOLVE_LINE,
+			//! The type of topological geometry being resolved.
+			ResolveGeometryType d_resolve_geometry_type;
 
-			NUM_RESOLVE_GEOMETRY_TYPES // This must be last.
+			//! The feature reference of each section (none if section's feature reference is invalid).
+			std::vector<boost::optional<GPlatesModel::FeatureHandle::weak_ref> > d_section_feature_refs;
+
+			//! The topological geometry property.
+			boost::optional<GPlatesModel::FeatureHandle::iterator> d_property_iterator;
+
+			//! The reconstruction plate ID of the topological geometry feature.
+			boost::optional<GPlatesModel::integer_plate_id_type> d_recon_plate_id;
+
+			//! The time of appearance of the topological geometry feature.
+			boost::optional<GPlatesPropertyValues::GeoTimeInstant> d_time_of_appearance;
+
+			//
+			// The resolved geometry (if it could be created) after the sections have been intersected.
+			//
+
+			//! Resolved boundary polygon (if resolving a boundary).
+			boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> d_boundary_polygon;
+
+			//! Resolved line polyline (if resolving a line).
+			boost::optional<GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type> d_line_polyline;
 		};
 
 
@@ -267,20 +336,61 @@ namespace GPlatesAppLogic
 		//! Used to help build the resolved geometry of the current topological geometry.
 		ResolvedGeometry d_resolved_geometry;
 
+		/**
+		 * The number of threads used to resolve topologies (zero means use the global default).
+		 *
+		 * If not one then topologies are deferred until @a resolve_deferred_topologies is called.
+		 */
+		unsigned int d_num_worker_threads;
+
+		/**
+		 * Topologies recorded while visiting but not yet resolved (only when resolving concurrently).
+		 */
+		std::vector<ResolvedGeometry> d_deferred_resolved_geometries;
 
 		/**
-		 * Create a *polygon* @a ResolvedTopologicalBoundary from information gathered from the most
-		 * recently visited topological polygon (stored in @a d_resolved_geometry).
+		 * Intersections of adjacent section pairs shared by all topologies resolved by us.
+		 *
+		 * All topologies are resolved at the same reconstruction time, and adjacent topologies
+		 * typically share section pairs (at their common junctions).
+		 */
+		TopologyIntersectionCache d_intersection_cache;
+
+
+		/**
+		 * Records the remaining information needed to resolve the most recently visited topological
+		 * geometry (stored in @a d_resolved_geometry) and either resolves it now or defers it
+		 * until @a resolve_deferred_topologies.
+		 */
+		void
+		record_resolved_geometry(
+				ResolveGeometryType resolve_geometry_type);
+
+		/**
+		 * Intersects the sections of @a resolved_geometry and creates its resolved polygon (boundary)
+		 * or polyline (line).
+		 *
+		 * This does not access the model and so can be called concurrently for different topologies.
 		 */
 		void
-		create_resolved_topological_boundary();
+		resolve_geometry(
+				ResolvedGeometry &resolved_geometry);
 
 		/**
-		 * Create a *polyline* @a ResolvedTopologicalLine from information gathered from the most
-		 * recently visited topological line (stored in @a d_resolved_geometry).
+		 * Create a *polygon* @a ResolvedTopologicalBoundary, or a *polyline* @a ResolvedTopologicalLine,
+		 * from the previously resolved @a resolved_geometry.
 		 */
 		void
-		create_resolved_topological_line();
+		create_resolved_topological_geometry(
+				const ResolvedGeometry &resolved_geometry);
+
+		void
+		create_resolved_topological_boundary(
+				const ResolvedGeometry &resolved_geometry);
+
+		void
+		create_resolved_topological_line(
+				const ResolvedGeometry &resolved_geometry);
 
 		template <typename TopologicalSectionsIterator>
 		void
@@ -295,18 +405,22 @@ namespace GPlatesAppLogic
 				bool reverse_hint);
 
 		void
-		process_resolved_boundary_topological_section_intersections();
+		process_resolved_boundary_topological_section_intersections(
+				ResolvedGeometry::section_seq_type &sections);
 
 		void
 		process_resolved_boundary_topological_section_intersection(
+				ResolvedGeometry::section_seq_type &sections,
 				const std::size_t current_section_index,
 				const bool two_sections = false);
 
 		void
-		process_resolved_line_topological_section_intersections();
+		process_resolved_line_topological_section_intersections(
+				ResolvedGeometry::section_seq_type &sections);
 
 		void
 		process_resolved_line_topological_section_intersection(
+				ResolvedGeometry::section_seq_type &sections,
 				const std::size_t current_section_index);
 
 		void
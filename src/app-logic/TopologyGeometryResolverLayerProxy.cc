@@ -1214,7 +1214,8 @@ GPlatesAppLogic::TopologyGeometryResolverLayerProxy::create_resolved_topological
 			d_current_topological_boundary_features,
 			d_current_reconstruction_layer_proxy.get_input_layer_proxy()->get_reconstruction_tree_creator(),
 			reconstruction_time,
-			topological_geometry_reconstruct_handles);
+			topological_geometry_reconstruct_handles,
+			TopologyUtils::get_layer_num_worker_threads());
 }
 
 
@@ -1291,7 +1292,9 @@ GPlatesAppLogic::TopologyGeometryResolverLayerProxy::create_resolved_topological
 			topological_line_features,
 			d_current_reconstruction_layer_proxy.get_input_layer_proxy()->get_reconstruction_tree_creator(),
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			boost::none/*topological_lines_referenced*/,
+			TopologyUtils::get_layer_num_worker_threads());
 }
 
 
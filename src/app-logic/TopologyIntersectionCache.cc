@@ -0,0 +1,138 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+
+#include "TopologyIntersectionCache.h"
+
+
+namespace GPlatesAppLogic
+{
+	namespace
+	{
+		/**
+		 * Copies @a intersection_graph into @a swapped_intersection_graph with the roles of the
+		 * first and second geometries swapped.
+		 *
+		 * The intersection positions are unchanged.
+		 */
+		void
+		swap_intersection_graph_geometries(
+				GPlatesMaths::GeometryIntersect::Graph &swapped_intersection_graph,
+				const GPlatesMaths::GeometryIntersect::Graph &intersection_graph)
+		{
+			typedef GPlatesMaths::GeometryIntersect::Intersection intersection_type;
+
+			swapped_intersection_graph.unordered_intersections = intersection_graph.unordered_intersections;
+
+			GPlatesMaths::GeometryIntersect::intersection_seq_type::iterator intersections_iter =
+					swapped_intersection_graph.unordered_intersections.begin();
+			GPlatesMaths::GeometryIntersect::intersection_seq_type::iterator intersections_end =
+					swapped_intersection_graph.unordered_intersections.end();
+			for ( ; intersections_iter != intersections_end; ++intersections_iter)
+			{
+				intersection_type &intersection = *intersections_iter;
+
+				std::swap(intersection.segment_index1, intersection.segment_index2);
+				std::swap(intersection.angle_in_segment1, intersection.angle_in_segment2);
+
+				if (intersection.type == intersection_type::SEGMENT1_START_ON_SEGMENT2)
+				{
+					intersection.type = intersection_type::SEGMENT2_START_ON_SEGMENT1;
+				}
+				else if (intersection.type == intersection_type::SEGMENT2_START_ON_SEGMENT1)
+				{
+					intersection.type = intersection_type::SEGMENT1_START_ON_SEGMENT2;
+				}
+			}
+
+			// The ordered sequences index into the unordered intersections (whose order is unchanged).
+			swapped_intersection_graph.geometry1_ordered_intersections = intersection_graph.geometry2_ordered_intersections;
+			swapped_intersection_graph.geometry2_ordered_intersections = intersection_graph.geometry1_ordered_intersections;
+		}
+	}
+}
+
+
+const GPlatesMaths::GeometryIntersect::Graph &
+GPlatesAppLogic::TopologyIntersectionCache::get_intersection_graph(
+		const ReconstructionGeometry::non_null_ptr_to_const_type &section_reconstruction_geometry1,
+		const GPlatesMaths::PolylineOnSphere &section_polyline1,
+		const ReconstructionGeometry::non_null_ptr_to_const_type &section_reconstruction_geometry2,
+		const GPlatesMaths::PolylineOnSphere &section_polyline2)
+{
+	const section_pair_key_type section_pair_key(
+			section_reconstruction_geometry1.get(),
+			section_reconstruction_geometry2.get());
+
+	{
+		boost::mutex::scoped_lock lock(d_intersections_mutex);
+
+		// See if we've already intersected the section pair in the requested order.
+		intersection_map_type::iterator intersection_iter = d_intersections.find(section_pair_key);
+		if (intersection_iter != d_intersections.end())
+		{
+			return intersection_iter->second.intersection_graph;
+		}
+
+		// See if we've already intersected the section pair in the opposite order.
+		if (section_pair_key.first != section_pair_key.second)
+		{
+			intersection_map_type::const_iterator reversed_intersection_iter = d_intersections.find(
+					section_pair_key_type(section_pair_key.second, section_pair_key.first));
+			if (reversed_intersection_iter != d_intersections.end())
+			{
+				SectionPairIntersection &section_pair_intersection = d_intersections.insert(
+						intersection_map_type::value_type(
+								section_pair_key,
+								SectionPairIntersection(section_reconstruction_geometry1, section_reconstruction_geometry2)))
+									.first->second;
+
+				swap_intersection_graph_geometries(
+						section_pair_intersection.intersection_graph,
+						reversed_intersection_iter->second.intersection_graph);
+
+				return section_pair_intersection.intersection_graph;
+			}
+		}
+	}
+
+	// Intersect the two section polylines (this clears the graph if there are no intersections).
+	//
+	// This is done without locking so that other section pairs can be intersected concurrently.
+	SectionPairIntersection section_pair_intersection(section_reconstruction_geometry1, section_reconstruction_geometry2);
+	GPlatesMaths::GeometryIntersect::intersect(
+			section_pair_intersection.intersection_graph,
+			section_polyline1,
+			section_polyline2);
+
+	boost::mutex::scoped_lock lock(d_intersections_mutex);
+
+	// Note that if another thread inserted the same section pair in the meantime then its
+	// (identical) graph is returned instead.
+	return d_intersections.insert(
+			intersection_map_type::value_type(section_pair_key, section_pair_intersection))
+				.first->second.intersection_graph;
+}
@@ -0,0 +1,135 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_APP_LOGIC_TOPOLOGYINTERSECTIONCACHE_H
+#define GPLATES_APP_LOGIC_TOPOLOGYINTERSECTIONCACHE_H
+
+#include <map>
+#include <utility>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "ReconstructionGeometry.h"
+
+#include "maths/GeometryIntersect.h"
+#include "maths/PolylineOnSphere.h"
+
+
+namespace GPlatesAppLogic
+{
+	/**
+	 * Caches the intersection of pairs of adjacent topological sections.
+	 *
+	 * Two adjacent topological geometries (eg, plate boundaries) typically share a junction where
+	 * the same two section geometries are intersected - once by each topology. Since the section
+	 * geometries are identified by their (reconstruction-time specific) reconstruction geometries,
+	 * the result of intersecting a section pair can be reused by all topologies resolved
+	 * at the same reconstruction time.
+	 *
+	 * Adjacent topologies usually traverse a shared junction in opposite directions, in which case
+	 * the section pair is (previous, current) for one topology and (current, previous) for the other.
+	 * The cached intersection graph is then returned with the roles of its two geometries swapped.
+	 *
+	 * The cache can be accessed concurrently by topologies being resolved in parallel.
+	 * However the section polylines must have their bounding trees built before concurrent access
+	 * (see @a TopologicalIntersections::prepare_for_concurrent_intersection).
+	 */
+	class TopologyIntersectionCache :
+			private boost::noncopyable
+	{
+	public:
+
+		/**
+		 * Returns the intersection graph of @a section_polyline1 and @a section_polyline2
+		 * (in that order), where the section polylines are the intersectable geometries of
+		 * @a section_reconstruction_geometry1 and @a section_reconstruction_geometry2 respectively.
+		 *
+		 * The returned graph is empty if the two section polylines do not intersect.
+		 *
+		 * Only the first request for a section pair (in either order) performs the intersection,
+		 * subsequent requests return the cached graph (swapped if requested in the opposite order).
+		 *
+		 * The returned reference remains valid for the lifetime of this cache.
+		 */
+		const GPlatesMaths::GeometryIntersect::Graph &
+		get_intersection_graph(
+				const ReconstructionGeometry::non_null_ptr_to_const_type &section_reconstruction_geometry1,
+				const GPlatesMaths::PolylineOnSphere &section_polyline1,
+				const ReconstructionGeometry::non_null_ptr_to_const_type &section_reconstruction_geometry2,
+				const GPlatesMaths::PolylineOnSphere &section_polyline2);
+
+		/**
+		 * Removes all cached intersections.
+		 */
+		void
+		clear()
+		{
+			boost::mutex::scoped_lock lock(d_intersections_mutex);
+			d_intersections.clear();
+		}
+
+	private:
+
+		//! Section pair (ordered) identified by their reconstruction geometries.
+		typedef std::pair<const ReconstructionGeometry *, const ReconstructionGeometry *> section_pair_key_type;
+
+		/**
+		 * The intersection graph of a section pair.
+		 *
+		 * Also keeps the section reconstruction geometries alive so that their addresses
+		 * (used in the key) cannot be re-used by other reconstruction geometries.
+		 */
+		struct SectionPairIntersection
+		{
+			SectionPairIntersection(
+					const ReconstructionGeometry::non_null_ptr_to_const_type &section_reconstruction_geometry1_,
+					const ReconstructionGeometry::non_null_ptr_to_const_type &section_reconstruction_geometry2_) :
+				section_reconstruction_geometry1(section_reconstruction_geometry1_),
+				section_reconstruction_geometry2(section_reconstruction_geometry2_)
+			{  }
+
+			ReconstructionGeometry::non_null_ptr_to_const_type section_reconstruction_geometry1;
+			ReconstructionGeometry::non_null_ptr_to_const_type section_reconstruction_geometry2;
+			GPlatesMaths::GeometryIntersect::Graph intersection_graph;
+		};
+
+		typedef std::map<section_pair_key_type, SectionPairIntersection> intersection_map_type;
+
+
+		/**
+		 * Map of ordered section pairs to their intersection graphs.
+		 *
+		 * Note that std::map does not invalidate references to its elements on insertion.
+		 */
+		intersection_map_type d_intersections;
+
+		/**
+		 * Protects @a d_intersections (but not the intersecting of section polylines).
+		 */
+		boost::mutex d_intersections_mutex;
+	};
+}
+
+#endif // GPLATES_APP_LOGIC_TOPOLOGYINTERSECTIONCACHE_H
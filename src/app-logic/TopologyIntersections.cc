@@ -28,6 +28,7 @@
 #include "TopologyIntersections.h"
 
 #include "GeometryUtils.h"
+#include "TopologyIntersectionCache.h"
 
 #include "global/AssertionFailureException.h"
 #include "global/GPlatesAssert.h"
@@ -96,9 +97,21 @@ GPlatesAppLogic::TopologicalIntersections::TopologicalIntersections(
 }
 
 
+void
+GPlatesAppLogic::TopologicalIntersections::prepare_for_concurrent_intersection() const
+{
+	if (d_intersectable_section_polyline)
+	{
+		// The bounding tree is created (and cached) on first access.
+		d_intersectable_section_polyline.get()->get_bounding_tree();
+	}
+}
+
+
 boost::optional<GPlatesMaths::PointOnSphere>
 GPlatesAppLogic::TopologicalIntersections::intersect_with_previous_section(
-		const shared_ptr_type &previous_section)
+		const shared_ptr_type &previous_section,
+		boost::optional<TopologyIntersectionCache &> intersection_cache)
 {
 	// Must not have already been tested for intersection with a previous section
 	// (which also means previous section not been tested with a next section).
@@ -120,11 +133,10 @@ GPlatesAppLogic::TopologicalIntersections::intersect_with_previous_section(
 
 	// Intersect the two section polylines.
 	// If there were no intersections then return false.
-	GPlatesMaths::GeometryIntersect::Graph intersection_graph;
-	if (!GPlatesMaths::GeometryIntersect::intersect(
-			intersection_graph,
-			*previous_section->d_intersectable_section_polyline.get(),
-			*d_intersectable_section_polyline.get()))
+	GPlatesMaths::GeometryIntersect::Graph uncached_intersection_graph;
+	const GPlatesMaths::GeometryIntersect::Graph &intersection_graph =
+			intersect_section_polylines(previous_section, uncached_intersection_graph, intersection_cache);
+	if (intersection_graph.empty())
 	{
 		return boost::none;
 	}
@@ -542,7 +554,8 @@ boost::optional<
 				// Optional second intersection
 				boost::optional<GPlatesMaths::PointOnSphere> > >
 GPlatesAppLogic::TopologicalIntersections::intersect_with_previous_section_allowing_two_intersections(
-		const shared_ptr_type &previous_section)
+		const shared_ptr_type &previous_section,
+		boost::optional<TopologyIntersectionCache &> intersection_cache)
 {
 	// We're expecting two sections that have not yet been tested for intersection with previous or next.
 	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
@@ -564,11 +577,10 @@ GPlatesAppLogic::TopologicalIntersections::intersect_with_previous_section_allow
 
 	// Intersect the two section polylines.
 	// If there were no intersections then return false.
-	GPlatesMaths::GeometryIntersect::Graph intersection_graph;
-	if (!GPlatesMaths::GeometryIntersect::intersect(
-			intersection_graph,
-			*previous_section->d_intersectable_section_polyline.get(),
-			*d_intersectable_section_polyline.get()))
+	GPlatesMaths::GeometryIntersect::Graph uncached_intersection_graph;
+	const GPlatesMaths::GeometryIntersect::Graph &intersection_graph =
+			intersect_section_polylines(previous_section, uncached_intersection_graph, intersection_cache);
+	if (intersection_graph.empty())
 	{
 		return boost::none;
 	}
@@ -673,6 +685,32 @@ GPlatesAppLogic::TopologicalIntersections::intersect_with_previous_section_allow
 }
 
 
+const GPlatesMaths::GeometryIntersect::Graph &
+GPlatesAppLogic::TopologicalIntersections::intersect_section_polylines(
+		const shared_ptr_type &previous_section,
+		GPlatesMaths::GeometryIntersect::Graph &uncached_intersection_graph,
+		boost::optional<TopologyIntersectionCache &> intersection_cache) const
+{
+	if (intersection_cache)
+	{
+		// Adjacent topologies typically share section pairs, so only intersect each pair once.
+		return intersection_cache->get_intersection_graph(
+				previous_section->d_section_reconstruction_geometry,
+				*previous_section->d_intersectable_section_polyline.get(),
+				d_section_reconstruction_geometry,
+				*d_intersectable_section_polyline.get());
+	}
+
+	// Note that the graph is cleared if there are no intersections.
+	GPlatesMaths::GeometryIntersect::intersect(
+			uncached_intersection_graph,
+			*previous_section->d_intersectable_section_polyline.get(),
+			*d_intersectable_section_polyline.get());
+
+	return uncached_intersection_graph;
+}
+
+
 bool
 GPlatesAppLogic::TopologicalIntersections::get_reverse_flag() const
 {
@@ -44,6 +44,9 @@
 
 namespace GPlatesAppLogic
 {
+	class TopologyIntersectionCache;
+
+
 	/**
 	 * Keeps track of a topological section's intersection results with its
 	 * neighbouring sections to assist with determining the partitioned segment.
@@ -131,6 +134,17 @@ namespace GPlatesAppLogic
 		}
 
 
+		/**
+		 * Builds the lazily-created data of the section geometry used when intersecting sections.
+		 *
+		 * Section geometries can be shared by topologies and building that data is not thread-safe.
+		 * So this should be called (from a single thread) before sections belonging to different
+		 * topologies are intersected concurrently.
+		 */
+		void
+		prepare_for_concurrent_intersection() const;
+
+
 		/**
 		 * Intersects this section with the previous neighbouring topological section and
 		 * returns intersection point if there was one.
@@ -141,10 +155,14 @@ namespace GPlatesAppLogic
 		 * that each section gets intersected with both its neighbouring sections.
 		 *
 		 * If there were two or more intersections then only one is chosen.
+		 *
+		 * If @a intersection_cache is specified then it is used to avoid re-intersecting the
+		 * same two sections when they are adjacent in more than one topology.
 		 */
 		boost::optional<GPlatesMaths::PointOnSphere>
 		intersect_with_previous_section(
-				const shared_ptr_type &previous_section);
+				const shared_ptr_type &previous_section,
+				boost::optional<TopologyIntersectionCache &> intersection_cache = boost::none);
 
 
 		/**
@@ -162,6 +180,9 @@ namespace GPlatesAppLogic
 		 * returned - and this is reported as a user error.
 		 * See TopologyInternalUtils::intersect_topological_sections_allowing_two_intersections()
 		 * for more details regarding how the two intersection points are chosen/handled.
+		 *
+		 * If @a intersection_cache is specified then it is used to avoid re-intersecting the
+		 * same two sections when they are adjacent in more than one topology.
 		 */
 		boost::optional<
 				boost::tuple<
@@ -170,7 +191,8 @@ namespace GPlatesAppLogic
 						// Optional second intersection
 						boost::optional<GPlatesMaths::PointOnSphere> > >
 		intersect_with_previous_section_allowing_two_intersections(
-				const shared_ptr_type &previous_section);
+				const shared_ptr_type &previous_section,
+				boost::optional<TopologyIntersectionCache &> intersection_cache = boost::none);
 
 
 		/**
@@ -344,6 +366,18 @@ namespace GPlatesAppLogic
 				const GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type &section_geometry,
 				bool reverse_hint);
 
+		/**
+		 * Intersects the previous section polyline with our section polyline (in that order).
+		 *
+		 * Returns the graph in @a intersection_cache if specified, otherwise intersects into
+		 * (and returns) @a uncached_intersection_graph.
+		 */
+		const GPlatesMaths::GeometryIntersect::Graph &
+		intersect_section_polylines(
+				const shared_ptr_type &previous_section,
+				GPlatesMaths::GeometryIntersect::Graph &uncached_intersection_graph,
+				boost::optional<TopologyIntersectionCache &> intersection_cache) const;
+
 		boost::optional<GPlatesMaths::PointOnSphere>
 		backward_compatible_multiple_intersections_with_previous_section(
 				const shared_ptr_type &previous_section,
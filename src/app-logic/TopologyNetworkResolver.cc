@@ -70,6 +70,7 @@
 #include "property-values/XsString.h"
 
 #include "utils/GeometryCreationUtils.h"
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 #include "utils/UnicodeStringUtils.h"
 
@@ -79,15 +80,52 @@ GPlatesAppLogic::TopologyNetworkResolver::TopologyNetworkResolver(
 		const double &reconstruction_time,
 		ReconstructHandle::type reconstruct_handle,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-		const TopologyNetworkParams &topology_network_params) :
+		const TopologyNetworkParams &topology_network_params,
+		unsigned int num_worker_threads) :
 	d_resolved_topological_networks(resolved_topological_networks),
 	d_reconstruction_time(reconstruction_time),
 	d_reconstruct_handle(reconstruct_handle),
 	d_topological_geometry_reconstruct_handles(topological_geometry_reconstruct_handles),
-	d_topology_network_params(topology_network_params)
+	d_topology_network_params(topology_network_params),
+	d_num_worker_threads(num_worker_threads)
 {  
 }
 
+
+void
+GPlatesAppLogic::TopologyNetworkResolver::resolve_deferred_topologies()
+{
+	if (d_deferred_resolved_networks.empty())
+	{
+		return;
+	}
+
+	PROFILE_FUNC();
+
+	// Intersect the boundary sections, and build the boundary polygon, of each network concurrently.
+	//
+	// This only accesses the (recorded) section geometries.
+	const unsigned int num_deferred_resolved_networks = d_deferred_resolved_networks.size();
+	GPlatesUtils::ParallelUtils::parallel_for(
+			num_deferred_resolved_networks,
+			[this](unsigned int resolved_network_index)
+			{
+				resolve_network(d_deferred_resolved_networks[resolved_network_index]);
+			},
+			d_num_worker_threads
+					? d_num_worker_threads
+					: GPlatesUtils::ParallelUtils::get_num_worker_threads());
+
+	// Create the resolved topological networks (in the order visited) on this thread
+	// since they reference the model.
+	BOOST_FOREACH(const ResolvedNetwork &resolved_network, d_deferred_resolved_networks)
+	{
+		create_resolved_topology_network(resolved_network);
+	}
+
+	d_deferred_resolved_networks.clear();
+}
+
 bool
 GPlatesAppLogic::TopologyNetworkResolver::initialise_pre_feature_properties(
 		GPlatesModel::FeatureHandle &feature_handle)
@@ -133,7 +171,7 @@ GPlatesAppLogic::TopologyNetworkResolver::finalise_post_feature_properties(
 	//
 	if (d_current_resolved_network.has_resolved_network())
 	{
-		create_resolved_topology_network();
+		record_resolved_network();
 	}
 }
 
@@ -217,12 +255,8 @@ GPlatesAppLogic::TopologyNetworkResolver::visit_gpml_topological_network(
 	record_topological_boundary_sections(gpml_topological_network);
 	record_topological_interior_geometries(gpml_topological_network);
 
-	//
-	// Now iterate over our internal structure 'd_resolved_network' and
-	// intersect neighbouring sections that require it and
-	// generate the resolved boundary subsegments.
-	//
-	process_topological_boundary_section_intersections();
+	// Note that neighbouring boundary sections are intersected (to generate the resolved boundary
+	// subsegments) after the feature has been visited (see 'record_resolved_network()').
 }
 
 
@@ -634,11 +668,12 @@ GPlatesAppLogic::TopologyNetworkResolver::record_topological_interior_reconstruc
 /////////
 
 void
-GPlatesAppLogic::TopologyNetworkResolver::process_topological_boundary_section_intersections()
+GPlatesAppLogic::TopologyNetworkResolver::process_topological_boundary_section_intersections(
+		ResolvedNetwork::boundary_section_seq_type &boundary_sections)
 {
 	// Iterate over our internal sequence of sections that we built up by
 	// visiting the topological sections of a topological polygon.
-	const std::size_t num_sections = d_current_resolved_network.boundary_sections.size();
+	const std::size_t num_sections = boundary_sections.size();
 
 	// If there's only one section then don't try to intersect it with itself.
 	if (num_sections < 2)
@@ -657,7 +692,7 @@ GPlatesAppLogic::TopologyNetworkResolver::process_topological_boundary_section_i
 		// This makes a difference if the user builds a topology with two sections that only
 		// intersect once (not something the user should be building) and means that the
 		// same topology will be creating here as in the builder.
-		process_topological_section_intersection_boundary(1/*section_index*/, true/*two_sections*/);
+		process_topological_section_intersection_boundary(boundary_sections, 1/*section_index*/, true/*two_sections*/);
 		return;
 	}
 
@@ -665,12 +700,13 @@ GPlatesAppLogic::TopologyNetworkResolver::process_topological_boundary_section_i
 	// and its previous neighbour.
 	for (std::size_t section_index = 0; section_index < num_sections; ++section_index)
 	{
-		process_topological_section_intersection_boundary(section_index);
+		process_topological_section_intersection_boundary(boundary_sections, section_index);
 	}
 }
 
 void
 GPlatesAppLogic::TopologyNetworkResolver::process_topological_section_intersection_boundary(
+		ResolvedNetwork::boundary_section_seq_type &boundary_sections,
 		const std::size_t current_section_index,
 		const bool two_sections)
 {
@@ -678,10 +714,9 @@ GPlatesAppLogic::TopologyNetworkResolver::process_topological_section_intersecti
 	// Intersect the current section with the previous section.
 	//
 
-	const std::size_t num_sections = d_current_resolved_network.boundary_sections.size();
+	const std::size_t num_sections = boundary_sections.size();
 
-	ResolvedNetwork::BoundarySection &current_section =
-			d_current_resolved_network.boundary_sections[current_section_index];
+	ResolvedNetwork::BoundarySection &current_section = boundary_sections[current_section_index];
 
 	//
 	// We get the start intersection geometry from previous section in the topological polygon's
@@ -692,8 +727,7 @@ GPlatesAppLogic::TopologyNetworkResolver::process_topological_section_intersecti
 			? num_sections - 1
 			: current_section_index - 1;
 
-	ResolvedNetwork::BoundarySection &prev_section =
-			d_current_resolved_network.boundary_sections[prev_section_index];
+	ResolvedNetwork::BoundarySection &prev_section = boundary_sections[prev_section_index];
 
 	// If both sections refer to the same geometry then don't intersect.
 	// This can happen when the same geometry is added more than once to the topology
@@ -732,17 +766,122 @@ GPlatesAppLogic::TopologyNetworkResolver::process_topological_section_intersecti
 }
 
 
+void
+GPlatesAppLogic::TopologyNetworkResolver::record_resolved_network()
+{
+	// Record the boundary section feature references.
+	// If a section's feature reference is invalid then the section will not contribute to the resolved network.
+	const std::size_t num_boundary_sections = d_current_resolved_network.boundary_sections.size();
+	for (std::size_t boundary_section_index = 0; boundary_section_index < num_boundary_sections; ++boundary_section_index)
+	{
+		const ResolvedNetwork::BoundarySection &boundary_section =
+				d_current_resolved_network.boundary_sections[boundary_section_index];
+
+		d_current_resolved_network.boundary_section_feature_refs.push_back(
+				ReconstructionGeometryUtils::get_feature_ref(boundary_section.d_source_rg));
+	}
+
+	// Record the network feature and some of its reconstruction (and rift) properties.
+	d_current_resolved_network.feature_ref = d_currently_visited_feature;
+	d_current_resolved_network.recon_plate_id = d_current_reconstruction_params.get_recon_plate_id();
+	d_current_resolved_network.time_of_appearance = d_current_reconstruction_params.get_time_of_appearance();
+	d_current_resolved_network.rift_params = d_current_rift_params;
+
+	if (d_num_worker_threads == 1)
+	{
+		// Resolve the network now.
+		resolve_network(d_current_resolved_network);
+		create_resolved_topology_network(d_current_resolved_network);
+		return;
+	}
+
+	// Section geometries can be shared with other networks (and topologies), so build their
+	// lazily-created intersection data now (on this thread) rather than when resolving concurrently.
+	for (std::size_t boundary_section_index = 0; boundary_section_index < num_boundary_sections; ++boundary_section_index)
+	{
+		d_current_resolved_network.boundary_sections[boundary_section_index]
+				.d_intersection_results->prepare_for_concurrent_intersection();
+	}
+
+	// Defer resolving the network until 'resolve_deferred_topologies()'.
+	d_deferred_resolved_networks.push_back(d_current_resolved_network);
+}
+
+
+void
+GPlatesAppLogic::TopologyNetworkResolver::resolve_network(
+		ResolvedNetwork &resolved_network)
+{
+	//
+	// Iterate over our internal sequence of boundary sections and intersect neighbouring
+	// sections that require it (this generates the resolved boundary subsegments).
+	//
+	process_topological_boundary_section_intersections(resolved_network.boundary_sections);
+
+	// All the points on the boundary of the network.
+	std::vector<GPlatesMaths::PointOnSphere> boundary_points;
+
+	// Iterate over the boundary sections and append their subsegment points.
+	const std::size_t num_boundary_sections = resolved_network.boundary_sections.size();
+	for (std::size_t boundary_section_index = 0; boundary_section_index < num_boundary_sections; ++boundary_section_index)
+	{
+		// If the feature reference is invalid then skip the current section.
+		if (!resolved_network.boundary_section_feature_refs[boundary_section_index])
+		{
+			continue;
+		}
+
+		const ResolvedNetwork::BoundarySection &boundary_section =
+				resolved_network.boundary_sections[boundary_section_index];
+
+		// Append the subsegment geometry to the boundary points.
+		// Subsegment should be reversed if that's how it contributed to the resolved topology.
+		boundary_section.d_intersection_results->get_reversed_sub_segment_points(
+				boundary_points,
+				ResolvedTopologicalNetwork::INCLUDE_SUB_SEGMENT_RUBBER_BAND_POINTS_IN_RESOLVED_NETWORK_BOUNDARY/*include_rubber_band_points*/);
+	}
+
+	// Create a polygon on sphere for the resolved boundary using 'boundary_points'.
+	GPlatesUtils::GeometryConstruction::GeometryConstructionValidity boundary_polygon_validity;
+	boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> boundary_polygon =
+			GPlatesUtils::create_polygon_on_sphere(
+					boundary_points.begin(), boundary_points.end(), boundary_polygon_validity);
+
+	// If we are unable to create a polygon (such as insufficient points) then
+	// a resolved topological network will not be created.
+	if (boundary_polygon_validity == GPlatesUtils::GeometryConstruction::VALID)
+	{
+		resolved_network.boundary_polygon = boundary_polygon;
+	}
+}
+
+
 // Final Creation Step
 void
-GPlatesAppLogic::TopologyNetworkResolver::create_resolved_topology_network()
+GPlatesAppLogic::TopologyNetworkResolver::create_resolved_topology_network(
+		const ResolvedNetwork &resolved_network)
 {
+	// If we were unable to create a polygon (such as insufficient points) then
+	// just return without creating a resolved topological network.
+	if (!resolved_network.boundary_polygon)
+	{
+// These errors never really get fixed in the topology datasets so might as well stop spamming the log.
+// Better to write a pyGPlates script to detect these types of errors as a post-process.
+#if 0
+		qDebug() << "ERROR: Failed to create a polygon boundary for a ResolvedTopologicalNetwork - "
+				"probably has insufficient points for a polygon.";
+		qDebug() << "Skipping creation for topological network feature_id=";
+		qDebug() << GPlatesUtils::make_qstring_from_icu_string(
+				resolved_network.feature_ref->feature_id().get());
+#endif
+
+		return;
+	}
+
 	// 2D + INFO 
 	// This vector holds extra info to pass to the delaunay triangulation.
 	std::vector<ResolvedTriangulation::Network::DelaunayPoint> delaunay_points;
 
-	// All the points on the boundary of the delaunay_triangulation_2_type
-	std::vector<GPlatesMaths::PointOnSphere> boundary_points;
-
 	// Sequence of boundary subsegments of resolved topology boundary.
 	std::vector<ResolvedTopologicalGeometrySubSegment::non_null_ptr_type> boundary_subsegments;
 
@@ -752,16 +891,15 @@ GPlatesAppLogic::TopologyNetworkResolver::create_resolved_topology_network()
 	std::vector<ResolvedTriangulation::Network::RigidBlock> rigid_blocks;
 
 
-	// Iterate over the sections of the resolved boundary and construct
-	// the resolved polygon boundary and its subsegments.
-	const std::size_t num_boundary_sections = d_current_resolved_network.boundary_sections.size();
+	// Iterate over the sections of the resolved boundary and construct its subsegments.
+	const std::size_t num_boundary_sections = resolved_network.boundary_sections.size();
 	for (std::size_t boundary_section_index = 0; boundary_section_index < num_boundary_sections; ++boundary_section_index)
 	{
-		const ResolvedNetwork::BoundarySection &boundary_section = d_current_resolved_network.boundary_sections[boundary_section_index];
+		const ResolvedNetwork::BoundarySection &boundary_section = resolved_network.boundary_sections[boundary_section_index];
 
 		// Get the subsegment feature reference.
-		boost::optional<GPlatesModel::FeatureHandle::weak_ref> boundary_subsegment_feature_ref =
-				ReconstructionGeometryUtils::get_feature_ref(boundary_section.d_source_rg);
+		const boost::optional<GPlatesModel::FeatureHandle::weak_ref> &boundary_subsegment_feature_ref =
+				resolved_network.boundary_section_feature_refs[boundary_section_index];
 		// If the feature reference is invalid then skip the current section.
 		if (!boundary_subsegment_feature_ref)
 		{
@@ -806,40 +944,14 @@ GPlatesAppLogic::TopologyNetworkResolver::create_resolved_topology_network()
 							boundary_segment_points[n],
 							boundary_segment_point_source_infos[n]));
 		}
-
-		// Add the points of this boundary section to the final list of boundary points (for boundary polygon).
-		boundary_points.insert(boundary_points.end(), boundary_segment_points.begin(), boundary_segment_points.end());
-	}
-
-	// Create a polygon on sphere for the resolved boundary using 'boundary_points'.
-	GPlatesUtils::GeometryConstruction::GeometryConstructionValidity boundary_polygon_validity;
-	boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> boundary_polygon =
-			GPlatesUtils::create_polygon_on_sphere(
-					boundary_points.begin(), boundary_points.end(), boundary_polygon_validity);
-
-	// If we are unable to create a polygon (such as insufficient points) then
-	// just return without creating a resolved topological geometry.
-	if (boundary_polygon_validity != GPlatesUtils::GeometryConstruction::VALID)
-	{
-// These errors never really get fixed in the topology datasets so might as well stop spamming the log.
-// Better to write a pyGPlates script to detect these types of errors as a post-process.
-#if 0
-		qDebug() << "ERROR: Failed to create a polygon boundary for a ResolvedTopologicalNetwork - "
-				"probably has insufficient points for a polygon.";
-		qDebug() << "Skipping creation for topological network feature_id=";
-		qDebug() << GPlatesUtils::make_qstring_from_icu_string(
-				d_currently_visited_feature->feature_id().get());
-#endif
-
-		return;
 	}
 
 
 	// Iterate over the interior geometries.
 	ResolvedNetwork::interior_geometry_seq_type::const_iterator interior_geometry_iter =
-			d_current_resolved_network.interior_geometries.begin();
+			resolved_network.interior_geometries.begin();
 	ResolvedNetwork::interior_geometry_seq_type::const_iterator interior_geometry_end =
-			d_current_resolved_network.interior_geometries.end();
+			resolved_network.interior_geometries.end();
 	for ( ; interior_geometry_iter != interior_geometry_end; ++interior_geometry_iter)
 	{
 		const ResolvedNetwork::InteriorGeometry &interior_geometry = *interior_geometry_iter;
@@ -933,22 +1045,23 @@ GPlatesAppLogic::TopologyNetworkResolver::create_resolved_topology_network()
 	// Initialise rift parameters if this network is a rift.
 	// We only need the left and right plate IDs to be a rift.
 	boost::optional<ResolvedTriangulation::Network::Rift> rift;
-	if (d_current_rift_params.left_plate_id &&
-		d_current_rift_params.right_plate_id)
+	const RiftProperties &rift_params = resolved_network.rift_params;
+	if (rift_params.left_plate_id &&
+		rift_params.right_plate_id)
 	{
 		rift = ResolvedTriangulation::Network::Rift(
-				d_current_rift_params.left_plate_id.get(),
-				d_current_rift_params.right_plate_id.get(),
-				d_current_rift_params.exponential_stretching_constant,
-				d_current_rift_params.strain_rate_resolution,
-				d_current_rift_params.edge_length_threshold);
+				rift_params.left_plate_id.get(),
+				rift_params.right_plate_id.get(),
+				rift_params.exponential_stretching_constant,
+				rift_params.strain_rate_resolution,
+				rift_params.edge_length_threshold);
 	}
 
 	// Now that we've gathered all the triangulation information we can create the triangulation network.
 	ResolvedTriangulation::Network::non_null_ptr_type triangulation_network =
 			ResolvedTriangulation::Network::create(
 					d_reconstruction_time,
-					boundary_polygon.get(),
+					resolved_network.boundary_polygon.get(),
 					delaunay_points.begin(),
 					delaunay_points.end(),
 					rigid_blocks.begin(),
@@ -961,12 +1074,12 @@ GPlatesAppLogic::TopologyNetworkResolver::create_resolved_topology_network()
 			ResolvedTopologicalNetwork::create(
 					d_reconstruction_time,
 					triangulation_network,
-					*d_currently_visited_feature,
-					d_current_resolved_network.topological_network_property.get(),
+					*resolved_network.feature_ref,
+					resolved_network.topological_network_property.get(),
 					boundary_subsegments.begin(),
 					boundary_subsegments.end(),
-					d_current_reconstruction_params.get_recon_plate_id(),
-					d_current_reconstruction_params.get_time_of_appearance(),
+					resolved_network.recon_plate_id,
+					resolved_network.time_of_appearance,
 					d_reconstruct_handle/*identify where/when this RTN was resolved*/);
 
 	d_resolved_topological_networks.push_back(network);
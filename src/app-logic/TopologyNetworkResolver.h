@@ -48,6 +48,7 @@
 
 #include "maths/AngularExtent.h"
 #include "maths/GeometryOnSphere.h"
+#include "maths/PolygonOnSphere.h"
 
 #include "model/types.h"
 #include "model/FeatureId.h"
@@ -56,6 +57,7 @@
 #include "model/FeatureCollectionHandle.h"
 #include "model/Model.h"
 
+#include "property-values/GeoTimeInstant.h"
 #include "property-values/GpmlTopologicalNetwork.h"
 #include "property-values/GpmlTopologicalSection.h"
 
@@ -91,18 +93,41 @@ namespace GPlatesAppLogic
 		 *        resolving the topological networks.
 		 *        This is useful to avoid outdated RFGs and RTGS still in existence (among other scenarios).
 		 * @param topology_network_params parameters used when creating the resolved networks.
+		 * @param num_worker_threads is the number of threads used to resolve the visited networks -
+		 *        see @a resolve_deferred_topologies (one resolves each network as it is visited, and
+		 *        zero means use GPlatesUtils::ParallelUtils::get_num_worker_threads).
 		 */
 		TopologyNetworkResolver(
 				std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &resolved_topological_networks,
 				const double &reconstruction_time,
 				ReconstructHandle::type reconstruct_handle,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams());
+				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams(),
+				unsigned int num_worker_threads = 1);
 
 		virtual
 		~TopologyNetworkResolver() 
 		{  }
 
+
+		/**
+		 * Creates the resolved topological networks of the networks visited since the last call.
+		 *
+		 * This only applies when resolving with more than one worker thread (see constructor).
+		 * In that case visiting a topological network only records its boundary sections and
+		 * interior geometries, and this method then intersects the boundary sections (and builds
+		 * the boundary polygon) of all recorded networks concurrently. The resolved topological
+		 * networks are appended to the caller's sequence in the same order they were visited.
+		 *
+		 * Note that this does not create the Delaunay triangulations of the networks
+		 * (see ResolvedTriangulation::Network::create_delaunay_triangulations).
+		 *
+		 * This does nothing when resolving with a single worker thread (since each network
+		 * is then resolved as it is visited).
+		 */
+		void
+		resolve_deferred_topologies();
+
 		virtual
 		bool
 		initialise_pre_feature_properties(
@@ -151,6 +176,34 @@ namespace GPlatesAppLogic
 				GPlatesPropertyValues::XsDouble &xs_double);
 
 	private:
+		/**
+		* Feature properties if this network is a rift.
+		*
+		* A network is a rift if the network feature has rift left/right plate IDs.
+		*/
+		struct RiftProperties
+		{
+		public:
+			void
+			reset()
+			{
+				left_plate_id = boost::none;
+				right_plate_id = boost::none;
+
+				exponential_stretching_constant = boost::none;
+				strain_rate_resolution = boost::none;
+				edge_length_threshold = boost::none;
+			}
+
+			boost::optional<GPlatesModel::integer_plate_id_type> left_plate_id;
+			boost::optional<GPlatesModel::integer_plate_id_type> right_plate_id;
+
+			boost::optional<double> exponential_stretching_constant;
+			boost::optional<double> strain_rate_resolution;
+			boost::optional<GPlatesMaths::AngularExtent> edge_length_threshold;
+		};
+
+
 		/**
 		 * Stores/builds information from iterating over @a GpmlTopologicalSection objects.
 		 */
@@ -164,6 +217,12 @@ namespace GPlatesAppLogic
 				boundary_sections.clear();
 				interior_geometries.clear();
 				topological_network_property = boost::none;
+				boundary_section_feature_refs.clear();
+				feature_ref = GPlatesModel::FeatureHandle::weak_ref();
+				recon_plate_id = boost::none;
+				time_of_appearance = boost::none;
+				rift_params.reset();
+				boundary_polygon = boost::none;
 			}
 
 			//! Record the topological network property of the feature being visited.
@@ -248,35 +307,34 @@ namespace GPlatesAppLogic
 
 			//! The topological network feature property containing the boundary and interior sections.
 			boost::optional<GPlatesModel::FeatureHandle::iterator> topological_network_property;
-		};
 
-		/**
-		* Feature properties if this network is a rift.
-		*
-		* A network is a rift if the network feature has rift left/right plate IDs.
-		*/
-		struct RiftProperties
-		{
-		public:
-			void
-			reset()
-			{
-				left_plate_id = boost::none;
-				right_plate_id = boost::none;
+			//
+			// The following are recorded (on the visiting thread) once the feature has been visited,
+			// since the model cannot be accessed when resolving networks concurrently.
+			//
 
-				exponential_stretching_constant = boost::none;
-				strain_rate_resolution = boost::none;
-				edge_length_threshold = boost::none;
-			}
+			//! The feature reference of each boundary section (none if section's feature reference is invalid).
+			std::vector<boost::optional<GPlatesModel::FeatureHandle::weak_ref> > boundary_section_feature_refs;
 
-			boost::optional<GPlatesModel::integer_plate_id_type> left_plate_id;
-			boost::optional<GPlatesModel::integer_plate_id_type> right_plate_id;
+			//! The topological network feature.
+			GPlatesModel::FeatureHandle::weak_ref feature_ref;
 
-			boost::optional<double> exponential_stretching_constant;
-			boost::optional<double> strain_rate_resolution;
-			boost::optional<GPlatesMaths::AngularExtent> edge_length_threshold;
-		};
+			//! The reconstruction plate ID of the topological network feature.
+			boost::optional<GPlatesModel::integer_plate_id_type> recon_plate_id;
 
+			//! The time of appearance of the topological network feature.
+			boost::optional<GPlatesPropertyValues::GeoTimeInstant> time_of_appearance;
+
+			//! Parameters if this network is a rift.
+			RiftProperties rift_params;
+
+			//
+			// The resolved boundary (if it could be created) after the boundary sections have been intersected.
+			//
+
+			//! Resolved boundary polygon.
+			boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> boundary_polygon;
+		};
 
 		/**
 		 * The resolved topological networks we're generating.
@@ -320,6 +378,18 @@ namespace GPlatesAppLogic
 		//! Used to help build the resolved network of the current topological polygon.
 		ResolvedNetwork d_current_resolved_network;
 
+		/**
+		 * The number of threads used to resolve networks (zero means use the global default).
+		 *
+		 * If not one then networks are deferred until @a resolve_deferred_topologies is called.
+		 */
+		unsigned int d_num_worker_threads;
+
+		/**
+		 * Networks recorded while visiting but not yet resolved (only when resolving concurrently).
+		 */
+		std::vector<ResolvedNetwork> d_deferred_resolved_networks;
+
 
 		boost::optional<ReconstructionGeometry::non_null_ptr_type>
 		find_topological_reconstruction_geometry(
@@ -354,21 +424,40 @@ namespace GPlatesAppLogic
 
 
 		void
-		process_topological_boundary_section_intersections();
+		process_topological_boundary_section_intersections(
+				ResolvedNetwork::boundary_section_seq_type &boundary_sections);
 
 		void
 		process_topological_section_intersection_boundary(
+				ResolvedNetwork::boundary_section_seq_type &boundary_sections,
 				const std::size_t current_section_index,
 				const bool two_sections = false);
 
 
 		/**
-		 * Create a @a ResolvedTopologicalNetwork from information gathered
-		 * from the most recently visited topological polygon
-		 * (stored in @a d_resolved_network) and add it to the @a Reconstruction.
+		 * Records the remaining information needed to resolve the most recently visited topological
+		 * network (stored in @a d_current_resolved_network) and either resolves it now or defers it
+		 * until @a resolve_deferred_topologies.
+		 */
+		void
+		record_resolved_network();
+
+		/**
+		 * Intersects the boundary sections of @a resolved_network and creates its boundary polygon.
+		 *
+		 * This does not access the model and so can be called concurrently for different networks.
+		 */
+		void
+		resolve_network(
+				ResolvedNetwork &resolved_network);
+
+		/**
+		 * Create a @a ResolvedTopologicalNetwork from the previously resolved @a resolved_network
+		 * and add it to the resolved topological networks.
 		 */
 		void
-		create_resolved_topology_network();
+		create_resolved_topology_network(
+				const ResolvedNetwork &resolved_network);
 	};
 }
 
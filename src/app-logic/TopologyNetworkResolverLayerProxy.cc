@@ -42,6 +42,7 @@
 #include "global/PreconditionViolationError.h"
 
 #include "maths/MathsUtils.h"
+#include "maths/PointOnSphere.h"
 
 
 namespace GPlatesAppLogic
@@ -90,14 +91,71 @@ namespace GPlatesAppLogic
 				}
 			}
 		}
+
+
+		/**
+		 * Rough estimate of the memory used (in bytes) per Delaunay triangulation vertex of a resolved network.
+		 *
+		 * This includes the vertex itself, its share of the triangulation faces, their cached deformation
+		 * data and the vertex source info.
+		 */
+		const std::size_t ESTIMATED_MEMORY_USAGE_PER_DELAUNAY_VERTEX = 1024;
+
+
+		/**
+		 * Returns the estimated memory usage (in bytes) of the specified resolved networks
+		 * (including their Delaunay triangulations, whether built yet or not).
+		 */
+		std::size_t
+		estimate_memory_usage(
+				const std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &resolved_topological_networks)
+		{
+			std::size_t memory_usage = 0;
+
+			BOOST_FOREACH(
+					const ResolvedTopologicalNetwork::non_null_ptr_type &resolved_topological_network,
+					resolved_topological_networks)
+			{
+				memory_usage += sizeof(ResolvedTopologicalNetwork) +
+						ESTIMATED_MEMORY_USAGE_PER_DELAUNAY_VERTEX *
+							resolved_topological_network->get_triangulation_network().get_num_delaunay_points();
+			}
+
+			return memory_usage;
+		}
+
+
+		/**
+		 * Returns the estimated memory usage (in bytes) of the specified resolved network velocities.
+		 */
+		std::size_t
+		estimate_memory_usage(
+				const std::vector<MultiPointVectorField::non_null_ptr_type> &resolved_topological_network_velocities)
+		{
+			std::size_t memory_usage = 0;
+
+			BOOST_FOREACH(
+					const MultiPointVectorField::non_null_ptr_type &resolved_topological_network_velocity,
+					resolved_topological_network_velocities)
+			{
+				// Each domain point and its (optional) velocity.
+				memory_usage += sizeof(MultiPointVectorField) +
+						resolved_topological_network_velocity->domain_size() *
+							(sizeof(GPlatesMaths::PointOnSphere) + sizeof(MultiPointVectorField::codomain_type::value_type));
+			}
+
+			return memory_usage;
+		}
 	}
 }
 
 
 GPlatesAppLogic::TopologyNetworkResolverLayerProxy::TopologyNetworkResolverLayerProxy(
-		const TopologyNetworkParams &topology_network_params) :
+		const TopologyNetworkParams &topology_network_params,
+		std::size_t max_memory_usage_in_resolved_networks_cache) :
 	d_current_reconstruction_time(0),
-	d_current_topology_network_params(topology_network_params)
+	d_current_topology_network_params(topology_network_params),
+	d_max_memory_usage_in_resolved_networks_cache(max_memory_usage_in_resolved_networks_cache)
 {
 	// Defined in ".cc" file because...
 	// non_null_ptr destructors require complete type of class they're referring to.
@@ -118,33 +176,31 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::get_resolved_topological_net
 		const TopologyNetworkParams &topology_network_params,
 		const double &reconstruction_time)
 {
-	// See if the reconstruction time has changed.
-	if (d_cached_resolved_networks.cached_reconstruction_time != GPlatesMaths::real_t(reconstruction_time) ||
-		d_cached_resolved_networks.cached_topology_network_params != topology_network_params)
-	{
-		// The resolved networks are now invalid.
-		d_cached_resolved_networks.invalidate();
-
-		// The new time and params that our cache will correspond to.
-		d_cached_resolved_networks.cached_reconstruction_time = GPlatesMaths::real_t(reconstruction_time);
-		d_cached_resolved_networks.cached_topology_network_params = topology_network_params;
-	}
-
 	// See if any input layer proxies have changed.
+	//
+	// NOTE: This is done before accessing the cache since it can clear the cache.
 	check_input_layer_proxies();
 
-	if (!d_cached_resolved_networks.cached_resolved_topological_networks)
+	// Get the cached networks for the reconstruction time (and params).
+	ResolvedNetworks &resolved_networks = get_cached_resolved_networks(topology_network_params, reconstruction_time);
+
+	if (!resolved_networks.cached_resolved_topological_networks)
 	{
-		cache_resolved_topological_networks(topology_network_params, reconstruction_time);
+		cache_resolved_topological_networks(resolved_networks);
 	}
 
 	// Append our cached resolved topological networks to the caller's sequence.
 	resolved_topological_networks.insert(
 			resolved_topological_networks.end(),
-			d_cached_resolved_networks.cached_resolved_topological_networks->begin(),
-			d_cached_resolved_networks.cached_resolved_topological_networks->end());
+			resolved_networks.cached_resolved_topological_networks->begin(),
+			resolved_networks.cached_resolved_topological_networks->end());
+
+	const ReconstructHandle::type reconstruct_handle = resolved_networks.cached_reconstruct_handle.get();
+
+	// NOTE: This never evicts the most-recently requested entry (which is 'resolved_networks').
+	evict_least_recently_used_resolved_networks();
 
-	return d_cached_resolved_networks.cached_reconstruct_handle.get();
+	return reconstruct_handle;
 }
 
 
@@ -211,57 +267,58 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::get_resolved_topological_net
 		VelocityDeltaTime::Type velocity_delta_time_type,
 		const double &velocity_delta_time)
 {
-	// See if the reconstruction time has changed.
-	if (d_cached_resolved_networks.cached_reconstruction_time != GPlatesMaths::real_t(reconstruction_time) ||
-		d_cached_resolved_networks.cached_topology_network_params != topology_network_params)
-	{
-		// The resolved networks are now invalid.
-		d_cached_resolved_networks.invalidate();
-
-		// The new time and params that our cache will correspond to.
-		d_cached_resolved_networks.cached_reconstruction_time = GPlatesMaths::real_t(reconstruction_time);
-		d_cached_resolved_networks.cached_topology_network_params = topology_network_params;
-	}
-
 	// See if any input layer proxies have changed.
+	//
+	// NOTE: This is done before accessing the cache since it can clear the cache.
 	check_input_layer_proxies();
 
+	// Get the cached networks (and velocities) for the reconstruction time (and params).
+	ResolvedNetworks &resolved_networks = get_cached_resolved_networks(topology_network_params, reconstruction_time);
+
 	// If the velocity delta time parameters have changed then remove the velocities from the cache.
-	if (d_cached_resolved_networks.cached_velocity_delta_time_params !=
+	if (resolved_networks.cached_velocity_delta_time_params !=
 		std::make_pair(velocity_delta_time_type, GPlatesMaths::real_t(velocity_delta_time)))
 	{
-		d_cached_resolved_networks.cached_resolved_topological_network_velocities = boost::none;
+		resolved_networks.cached_resolved_topological_network_velocities = boost::none;
+		resolved_networks.estimated_velocities_memory_usage = 0;
 
-		d_cached_resolved_networks.cached_velocity_delta_time_params =
+		resolved_networks.cached_velocity_delta_time_params =
 				std::make_pair(velocity_delta_time_type, GPlatesMaths::real_t(velocity_delta_time));
 	}
 
-	if (!d_cached_resolved_networks.cached_resolved_topological_network_velocities)
+	if (!resolved_networks.cached_resolved_topological_network_velocities)
 	{
 		// First get/create the resolved topological networks.
-		cache_resolved_topological_networks(topology_network_params, reconstruction_time);
+		cache_resolved_topological_networks(resolved_networks);
 
 		// Create empty vector of resolved topological network velocities.
-		d_cached_resolved_networks.cached_resolved_topological_network_velocities =
+		resolved_networks.cached_resolved_topological_network_velocities =
 				std::vector<MultiPointVectorField::non_null_ptr_type>();
 
 		// Create our topological network velocities.
-		d_cached_resolved_networks.cached_velocities_handle =
+		resolved_networks.cached_velocities_handle =
 				create_resolved_topological_network_velocities(
-						d_cached_resolved_networks.cached_resolved_topological_network_velocities.get(),
-						d_cached_resolved_networks.cached_resolved_topological_networks.get(),
+						resolved_networks.cached_resolved_topological_network_velocities.get(),
+						resolved_networks.cached_resolved_topological_networks.get(),
 						reconstruction_time,
 						velocity_delta_time_type,
 						velocity_delta_time);
+
+		resolved_networks.estimated_velocities_memory_usage =
+				estimate_memory_usage(resolved_networks.cached_resolved_topological_network_velocities.get());
 	}
 
 	// Append our cached resolved topological network velocities to the caller's sequence.
 	resolved_topological_network_velocities.insert(
 			resolved_topological_network_velocities.end(),
-			d_cached_resolved_networks.cached_resolved_topological_network_velocities->begin(),
-			d_cached_resolved_networks.cached_resolved_topological_network_velocities->end());
+			resolved_networks.cached_resolved_topological_network_velocities->begin(),
+			resolved_networks.cached_resolved_topological_network_velocities->end());
+
+	const ReconstructHandle::type velocities_handle = resolved_networks.cached_velocities_handle.get();
+
+	evict_least_recently_used_resolved_networks();
 
-	return d_cached_resolved_networks.cached_velocities_handle.get();
+	return velocities_handle;
 }
 
 
@@ -504,7 +561,7 @@ void
 GPlatesAppLogic::TopologyNetworkResolverLayerProxy::reset_cache()
 {
 	// Clear any cached resolved topological networks.
-	d_cached_resolved_networks.invalidate();
+	d_cached_resolved_networks.clear();
 	d_cached_time_span.invalidate();
 }
 
@@ -592,17 +649,19 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::check_input_layer_proxies()
 
 std::vector<GPlatesAppLogic::ResolvedTopologicalNetwork::non_null_ptr_type> &
 GPlatesAppLogic::TopologyNetworkResolverLayerProxy::cache_resolved_topological_networks(
-		const TopologyNetworkParams &topology_network_params,
-		const double &reconstruction_time)
+		ResolvedNetworks &resolved_networks)
 {
+	const TopologyNetworkParams &topology_network_params = resolved_networks.topology_network_params;
+	const double reconstruction_time = resolved_networks.reconstruction_time.dval();
+
 	// If they're already cached then nothing to do.
-	if (d_cached_resolved_networks.cached_resolved_topological_networks)
+	if (resolved_networks.cached_resolved_topological_networks)
 	{
-		return d_cached_resolved_networks.cached_resolved_topological_networks.get();
+		return resolved_networks.cached_resolved_topological_networks.get();
 	}
 
 	// Create empty vector of resolved topological networks.
-	d_cached_resolved_networks.cached_resolved_topological_networks =
+	resolved_networks.cached_resolved_topological_networks =
 			std::vector<ResolvedTopologicalNetwork::non_null_ptr_type>();
 
 	// First see if we've already cached the current reconstruction time (and topology network params)
@@ -621,45 +680,118 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::cache_resolved_topological_n
 					d_cached_time_span.cached_resolved_network_time_span.get()->get_sample_in_time_slot(time_slot.get());
 			if (resolved_topological_networks)
 			{
-				d_cached_resolved_networks.cached_resolved_topological_networks = resolved_topological_networks.get();
+				resolved_networks.cached_resolved_topological_networks = resolved_topological_networks.get();
 
 				// Get the reconstruct handle from one of the resolved networks (if any).
-				if (!d_cached_resolved_networks.cached_resolved_topological_networks->empty())
+				if (!resolved_networks.cached_resolved_topological_networks->empty())
 				{
 					boost::optional<ReconstructHandle::type> reconstruct_handle =
-							d_cached_resolved_networks.cached_resolved_topological_networks->front()
+							resolved_networks.cached_resolved_topological_networks->front()
 									->get_reconstruct_handle();
 					if (reconstruct_handle)
 					{
-						d_cached_resolved_networks.cached_reconstruct_handle = reconstruct_handle.get();
+						resolved_networks.cached_reconstruct_handle = reconstruct_handle.get();
 					}
 					else
 					{
 						// RTN doesn't have a reconstruct handle - this shouldn't happen.
-						d_cached_resolved_networks.cached_reconstruct_handle =
+						resolved_networks.cached_reconstruct_handle =
 								ReconstructHandle::get_next_reconstruct_handle();
 					}
 				}
 				else
 				{
 					// There will be no reconstructed/resolved networks for this handle.
-					d_cached_resolved_networks.cached_reconstruct_handle =
+					resolved_networks.cached_reconstruct_handle =
 							ReconstructHandle::get_next_reconstruct_handle();
 				}
 
-				return d_cached_resolved_networks.cached_resolved_topological_networks.get();
+				resolved_networks.estimated_networks_memory_usage =
+						estimate_memory_usage(resolved_networks.cached_resolved_topological_networks.get());
+
+				return resolved_networks.cached_resolved_topological_networks.get();
 			}
 		}
 	}
 
 	// Generate the resolved topological networks for the reconstruction time.
-	d_cached_resolved_networks.cached_reconstruct_handle =
+	resolved_networks.cached_reconstruct_handle =
 			create_resolved_topological_networks(
-					d_cached_resolved_networks.cached_resolved_topological_networks.get(),
+					resolved_networks.cached_resolved_topological_networks.get(),
 					topology_network_params,
 					reconstruction_time);
 
-	return d_cached_resolved_networks.cached_resolved_topological_networks.get();
+	resolved_networks.estimated_networks_memory_usage =
+			estimate_memory_usage(resolved_networks.cached_resolved_topological_networks.get());
+
+	return resolved_networks.cached_resolved_topological_networks.get();
+}
+
+
+GPlatesAppLogic::TopologyNetworkResolverLayerProxy::resolved_networks_cache_type::iterator
+GPlatesAppLogic::TopologyNetworkResolverLayerProxy::find_cached_resolved_networks(
+		const TopologyNetworkParams &topology_network_params,
+		const double &reconstruction_time)
+{
+	const GPlatesMaths::real_t time(reconstruction_time);
+
+	resolved_networks_cache_type::iterator cache_iter = d_cached_resolved_networks.begin();
+	resolved_networks_cache_type::iterator cache_end = d_cached_resolved_networks.end();
+	for ( ; cache_iter != cache_end; ++cache_iter)
+	{
+		if (cache_iter->reconstruction_time == time &&
+			cache_iter->topology_network_params == topology_network_params)
+		{
+			break;
+		}
+	}
+
+	return cache_iter;
+}
+
+
+GPlatesAppLogic::TopologyNetworkResolverLayerProxy::ResolvedNetworks &
+GPlatesAppLogic::TopologyNetworkResolverLayerProxy::get_cached_resolved_networks(
+		const TopologyNetworkParams &topology_network_params,
+		const double &reconstruction_time)
+{
+	resolved_networks_cache_type::iterator cache_iter =
+			find_cached_resolved_networks(topology_network_params, reconstruction_time);
+	if (cache_iter != d_cached_resolved_networks.end())
+	{
+		// Move to the front (most-recently requested).
+		// Note that splicing does not invalidate any references to the entry.
+		d_cached_resolved_networks.splice(
+				d_cached_resolved_networks.begin(),
+				d_cached_resolved_networks,
+				cache_iter);
+	}
+	else
+	{
+		d_cached_resolved_networks.push_front(
+				ResolvedNetworks(GPlatesMaths::real_t(reconstruction_time), topology_network_params));
+	}
+
+	return d_cached_resolved_networks.front();
+}
+
+
+void
+GPlatesAppLogic::TopologyNetworkResolverLayerProxy::evict_least_recently_used_resolved_networks()
+{
+	std::size_t memory_usage = 0;
+	BOOST_FOREACH(const ResolvedNetworks &resolved_networks, d_cached_resolved_networks)
+	{
+		memory_usage += resolved_networks.get_estimated_memory_usage();
+	}
+
+	// Always keep the most-recently requested entry.
+	while (memory_usage > d_max_memory_usage_in_resolved_networks_cache &&
+		d_cached_resolved_networks.size() > 1)
+	{
+		memory_usage -= d_cached_resolved_networks.back().get_estimated_memory_usage();
+		d_cached_resolved_networks.pop_back();
+	}
 }
 
 
@@ -842,7 +974,8 @@ GPlatesAppLogic::TopologyNetworkResolverLayerProxy::create_resolved_topological_
 			reconstruction_time,
 			d_current_topological_network_features,
 			topological_geometry_reconstruct_handles,
-			topology_network_params);
+			topology_network_params,
+			TopologyUtils::get_layer_num_worker_threads());
 }
 
 
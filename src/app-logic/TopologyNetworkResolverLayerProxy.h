@@ -27,6 +27,8 @@
 #ifndef GPLATES_APP_LOGIC_TOPOLOGYNETWORKRESOLVERLAYERPROXY_H
 #define GPLATES_APP_LOGIC_TOPOLOGYNETWORKRESOLVERLAYERPROXY_H
 
+#include <cstddef>
+#include <list>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -67,15 +69,31 @@ namespace GPlatesAppLogic
 		typedef GPlatesUtils::non_null_intrusive_ptr<const TopologyNetworkResolverLayerProxy> non_null_ptr_to_const_type;
 
 
+		/**
+		 * The default maximum (estimated) memory, in bytes, used by resolved topological networks
+		 * (and their velocities) cached for recently requested reconstruction times.
+		 *
+		 * Resolved networks (and their Delaunay triangulations) are expensive to create, so caching
+		 * several reconstruction times avoids re-resolving when the user scrubs back and forth.
+		 * The least-recently requested times are evicted first (but the most recent is always kept).
+		 */
+		static const std::size_t DEFAULT_MAX_MEMORY_USAGE_IN_RESOLVED_NETWORKS_CACHE = 256 * 1024 * 1024;
+
+
 		/**
 		 * Creates a @a TopologyNetworkResolverLayerProxy object.
 		 */
 		static
 		non_null_ptr_type
 		create(
-				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams())
+				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams(),
+				std::size_t max_memory_usage_in_resolved_networks_cache =
+						DEFAULT_MAX_MEMORY_USAGE_IN_RESOLVED_NETWORKS_CACHE)
 		{
-			return non_null_ptr_type(new TopologyNetworkResolverLayerProxy(topology_network_params));
+			return non_null_ptr_type(
+					new TopologyNetworkResolverLayerProxy(
+							topology_network_params,
+							max_memory_usage_in_resolved_networks_cache));
 		}
 
 
@@ -389,28 +407,37 @@ namespace GPlatesAppLogic
 	private:
 
 		/**
-		 * Contains resolved topological networks.
+		 * Contains resolved topological networks for a single reconstruction time (and topology network params).
 		 */
 		struct ResolvedNetworks
 		{
-			void
-			invalidate()
-			{
-				cached_reconstruction_time = boost::none;
-
-				cached_reconstruct_handle = boost::none;
-				cached_resolved_topological_networks = boost::none;
-				cached_topology_network_params = boost::none;
+			ResolvedNetworks(
+					const GPlatesMaths::real_t &reconstruction_time_,
+					const TopologyNetworkParams &topology_network_params_) :
+				reconstruction_time(reconstruction_time_),
+				topology_network_params(topology_network_params_),
+				estimated_networks_memory_usage(0),
+				estimated_velocities_memory_usage(0)
+			{  }
 
-				cached_velocities_handle = boost::none;
-				cached_velocity_delta_time_params = boost::none;
-				cached_resolved_topological_network_velocities = boost::none;
+			/**
+			 * Estimated memory usage (in bytes) of the cached networks and velocities.
+			 */
+			std::size_t
+			get_estimated_memory_usage() const
+			{
+				return estimated_networks_memory_usage + estimated_velocities_memory_usage;
 			}
 
 			/**
-			 * Cached reconstruction time associated with the cache resolved topological networks.
+			 * Reconstruction time associated with the cache resolved topological networks.
+			 */
+			GPlatesMaths::real_t reconstruction_time;
+
+			/**
+			 * The topology network parameters associated with the cache resolved topological networks.
 			 */
-			boost::optional<GPlatesMaths::real_t> cached_reconstruction_time;
+			TopologyNetworkParams topology_network_params;
 
 			/**
 			 * The reconstruct handle that identifies all cached resolved topological networks
@@ -425,9 +452,9 @@ namespace GPlatesAppLogic
 					cached_resolved_topological_networks;
 
 			/**
-			 * The cached topology network parameters associated with the cache resolved topological networks.
+			 * Estimated memory usage (in bytes) of @a cached_resolved_topological_networks.
 			 */
-			boost::optional<TopologyNetworkParams> cached_topology_network_params;
+			std::size_t estimated_networks_memory_usage;
 
 			//
 			// Velocities.
@@ -450,6 +477,11 @@ namespace GPlatesAppLogic
 			 */
 			boost::optional< std::vector<MultiPointVectorField::non_null_ptr_type> >
 					cached_resolved_topological_network_velocities;
+
+			/**
+			 * Estimated memory usage (in bytes) of @a cached_resolved_topological_network_velocities.
+			 */
+			std::size_t estimated_velocities_memory_usage;
 		};
 
 		/**
@@ -512,10 +544,20 @@ namespace GPlatesAppLogic
 		 */
 		TopologyNetworkParams d_current_topology_network_params;
 
+		//! Typedef for a sequence of resolved networks ordered from most to least recently requested.
+		typedef std::list<ResolvedNetworks> resolved_networks_cache_type;
+
 		/**
-		 * The cached resolved topologies for a single reconstruction time.
+		 * The cached resolved topologies for recently requested reconstruction times (and params).
+		 *
+		 * Ordered from most-recently to least-recently requested.
 		 */
-		ResolvedNetworks d_cached_resolved_networks;
+		resolved_networks_cache_type d_cached_resolved_networks;
+
+		/**
+		 * The maximum (estimated) memory used by @a d_cached_resolved_networks.
+		 */
+		std::size_t d_max_memory_usage_in_resolved_networks_cache;
 
 		/**
 		 * The cached resolved topologies over a range of reconstruction times.
@@ -535,9 +577,9 @@ namespace GPlatesAppLogic
 		mutable GPlatesUtils::SubjectToken d_subject_token;
 
 
-		explicit
 		TopologyNetworkResolverLayerProxy(
-				const TopologyNetworkParams &topology_network_params);
+				const TopologyNetworkParams &topology_network_params,
+				std::size_t max_memory_usage_in_resolved_networks_cache);
 
 
 		/**
@@ -557,15 +599,44 @@ namespace GPlatesAppLogic
 
 
 		/**
-		 * Generates resolved topological networks for the specified reconstruction time
-		 * if they're not already cached.
+		 * Returns the cache entry for the specified reconstruction time and topology network params,
+		 * or the end of the cache if there's no entry.
 		 */
-		std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &
-		cache_resolved_topological_networks(
+		resolved_networks_cache_type::iterator
+		find_cached_resolved_networks(
+				const TopologyNetworkParams &topology_network_params,
+				const double &reconstruction_time);
+
+
+		/**
+		 * Returns the cache entry for the specified reconstruction time and topology network params,
+		 * and marks it as the most-recently requested entry.
+		 *
+		 * An empty entry is created if there isn't one (its networks have not been resolved yet).
+		 */
+		ResolvedNetworks &
+		get_cached_resolved_networks(
 				const TopologyNetworkParams &topology_network_params,
 				const double &reconstruction_time);
 
 
+		/**
+		 * Generates resolved topological networks for the reconstruction time (and params) of
+		 * @a resolved_networks if they're not already cached.
+		 */
+		std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &
+		cache_resolved_topological_networks(
+				ResolvedNetworks &resolved_networks);
+
+
+		/**
+		 * Evicts least-recently requested resolved networks until the estimated memory usage of the
+		 * cache is within budget (the most-recently requested entry is never evicted).
+		 */
+		void
+		evict_least_recently_used_resolved_networks();
+
+
 		/**
 		 * Generates a resolved network time span for the specified time range if one is not already cached.
 		 */
@@ -58,6 +58,7 @@
 
 #include "maths/AngularExtent.h"
 #include "maths/CalculateVelocity.h"
+#include "maths/CubeQuadTreePartitionUtils.h"
 #include "maths/GeometryDistance.h"
 #include "maths/MathsUtils.h"
 #include "maths/Rotation.h"
@@ -84,35 +85,6 @@ namespace GPlatesAppLogic
 		// Inverse of Earth radius (Kms).
 		const double INVERSE_EARTH_EQUATORIAL_RADIUS_KMS = 1.0 / GPlatesUtils::Earth::EQUATORIAL_RADIUS_KMS;
 
-		/**
-		 * Predicate to test if the geometry *points* bounding small circle intersects the
-		 * resolved boundary bounding small circle.
-		 */
-		class IntersectGeometryPointsAndResolvedBoundarySmallCircleBounds
-		{
-		public:
-
-			explicit
-			IntersectGeometryPointsAndResolvedBoundarySmallCircleBounds(
-					const GPlatesMaths::BoundingSmallCircle *geometry_points_bounding_small_circle) :
-				d_geometry_points_bounding_small_circle(geometry_points_bounding_small_circle)
-			{  }
-
-			bool
-			operator()(
-					const ResolvedTopologicalBoundary::non_null_ptr_type &rtb) const
-			{
-				const GPlatesMaths::BoundingSmallCircle &rtb_bounding_small_circle =
-						rtb->resolved_topology_boundary()->get_bounding_small_circle();
-
-				return intersect(rtb_bounding_small_circle, *d_geometry_points_bounding_small_circle);
-			}
-
-		private:
-
-			const GPlatesMaths::BoundingSmallCircle *d_geometry_points_bounding_small_circle;
-		};
-
 		/**
 		 * Predicate to test if the geometry *points* bounding small circle intersects the
 		 * resolved network bounding small circle.
@@ -146,13 +118,18 @@ namespace GPlatesAppLogic
 
 		/**
 		 * Get the rigid rotation from @a initial_time to @a final_time.
+		 *
+		 * The rotations are obtained from @a rotations which is either a ReconstructionTreeCreator or
+		 * a ReconstructionRotationTable followed by a ReconstructionTreeCreator
+		 * (see the overloads of 'PlateVelocityUtils::calculate_stage_rotation()').
 		 */
+		template <typename... RotationsType>
 		GPlatesMaths::FiniteRotation
 		get_stage_rotation(
 				GPlatesModel::integer_plate_id_type reconstruction_plate_id,
-				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &initial_time,
-				const double &final_time)
+				const double &final_time,
+				const RotationsType &... rotations)
 		{
 			//
 			// Delegate to 'PlateVelocityUtils::calculate_stage_rotation()' since it adjusts the
@@ -165,7 +142,7 @@ namespace GPlatesAppLogic
 				// Forward stage rotation from 'initial_time' to 'final_time'.
 				return PlateVelocityUtils::calculate_stage_rotation(
 						reconstruction_plate_id,
-						reconstruction_tree_creator,
+						rotations...,
 						initial_time/*reconstruction_time*/,
 						// Must be positive...
 						initial_time - final_time/*velocity_delta_time*/,
@@ -178,13 +155,80 @@ namespace GPlatesAppLogic
 				return GPlatesMaths::get_reverse(
 						PlateVelocityUtils::calculate_stage_rotation(
 								reconstruction_plate_id,
-								reconstruction_tree_creator,
+								rotations...,
 								initial_time/*reconstruction_time*/,
 								// Must be positive...
 								final_time - initial_time/*velocity_delta_time*/,
 								VelocityDeltaTime::T_PLUS_DELTA_T_TO_T/*velocity_delta_time_type*/));
 			}
 		}
+
+
+		/**
+		 * Appends to @a stage_rotation_times the times needed by @a get_stage_rotation to get the
+		 * rigid rotation from @a initial_time to @a final_time.
+		 */
+		void
+		get_stage_rotation_times(
+				std::vector<double> &stage_rotation_times,
+				const double &initial_time,
+				const double &final_time)
+		{
+			if (initial_time > final_time) // forward in time ...
+			{
+				PlateVelocityUtils::get_stage_rotation_times(
+						stage_rotation_times,
+						initial_time/*reconstruction_time*/,
+						initial_time - final_time/*velocity_delta_time*/,
+						VelocityDeltaTime::T_TO_T_MINUS_DELTA_T/*velocity_delta_time_type*/);
+			}
+			else // backward in time ...
+			{
+				PlateVelocityUtils::get_stage_rotation_times(
+						stage_rotation_times,
+						initial_time/*reconstruction_time*/,
+						final_time - initial_time/*velocity_delta_time*/,
+						VelocityDeltaTime::T_PLUS_DELTA_T_TO_T/*velocity_delta_time_type*/);
+			}
+		}
+
+
+		/**
+		 * Returns true if @a rotation_table contains all times needed by @a get_stage_rotation to get
+		 * the rigid rotation from @a initial_time to @a final_time.
+		 */
+		bool
+		contains_stage_rotation_times(
+				const ReconstructionRotationTable &rotation_table,
+				const double &initial_time,
+				const double &final_time)
+		{
+			std::vector<double> stage_rotation_times;
+			get_stage_rotation_times(stage_rotation_times, initial_time, final_time);
+
+			for (unsigned int n = 0; n < stage_rotation_times.size(); ++n)
+			{
+				if (!rotation_table.get_reconstruction_time_index(stage_rotation_times[n]))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+
+		/**
+		 * Predicate to test if two times are equal (within epsilon).
+		 */
+		bool
+		are_times_coincident(
+				const double &time1,
+				const double &time2)
+		{
+			return GPlatesPropertyValues::GeoTimeInstant(time1).is_coincident_with(
+					GPlatesPropertyValues::GeoTimeInstant(time2));
+		}
 	}
 }
 
@@ -212,6 +256,224 @@ GPlatesAppLogic::TopologyReconstruct::create_geometry_time_span(
 }
 
 
+void
+GPlatesAppLogic::TopologyReconstruct::prepare_for_concurrent_geometry_time_spans() const
+{
+	if (d_prepared_for_concurrent_geometry_time_spans)
+	{
+		return;
+	}
+
+	PROFILE_FUNC();
+
+	// Create everything that geometry time spans share (and would otherwise create on demand)
+	// so that they only read it, without locking, when created concurrently.
+	const unsigned int num_time_slots = d_time_range.get_num_time_slots();
+	for (unsigned int time_slot = 0; time_slot < num_time_slots; ++time_slot)
+	{
+		get_resolved_boundary_spatial_partition(time_slot);
+
+		// Deform the vertices of each resolved network triangulation by one time increment
+		// (forward and backward in time) so that geometry time spans can deform points in the
+		// network without locking and without accessing reconstruction trees.
+		boost::optional<const rtn_seq_type &> resolved_networks =
+				d_resolved_network_time_span->get_sample_in_time_slot(time_slot);
+		if (resolved_networks)
+		{
+			BOOST_FOREACH(const ResolvedTopologicalNetwork::non_null_ptr_type &resolved_network, resolved_networks.get())
+			{
+				resolved_network->get_triangulation_network().prepare_for_concurrent_deformation(
+						d_time_range.get_time_increment());
+			}
+		}
+	}
+
+	get_time_slot_rotation_table();
+
+	d_prepared_for_concurrent_geometry_time_spans = true;
+}
+
+
+const GPlatesAppLogic::ReconstructionRotationTable &
+GPlatesAppLogic::TopologyReconstruct::get_time_slot_rotation_table() const
+{
+	if (!d_time_slot_rotation_table)
+	{
+		PROFILE_FUNC();
+
+		// The times needed for stage rotations from each time slot to its adjacent time slots.
+		// This includes times one time increment outside the time range (and possibly present day).
+		std::vector<double> rotation_times;
+		const unsigned int num_time_slots = d_time_range.get_num_time_slots();
+		for (unsigned int time_slot = 0; time_slot < num_time_slots; ++time_slot)
+		{
+			const double time = d_time_range.get_time(time_slot);
+
+			get_stage_rotation_times(rotation_times, time, time - d_time_range.get_time_increment());
+			get_stage_rotation_times(rotation_times, time, time + d_time_range.get_time_increment());
+		}
+
+		// Remove duplicate times (most times are needed by more than one time slot).
+		std::sort(rotation_times.begin(), rotation_times.end());
+		rotation_times.erase(
+				std::unique(rotation_times.begin(), rotation_times.end(), &are_times_coincident),
+				rotation_times.end());
+
+		d_time_slot_rotation_table = ReconstructionRotationTable::non_null_ptr_to_const_type(
+				ReconstructionRotationTable::create(d_reconstruction_tree_creator, rotation_times));
+	}
+
+	return *d_time_slot_rotation_table.get();
+}
+
+
+boost::optional<const GPlatesAppLogic::TopologyReconstruct::ResolvedBoundarySpatialPartition &>
+GPlatesAppLogic::TopologyReconstruct::get_resolved_boundary_spatial_partition(
+		unsigned int time_slot) const
+{
+	GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+			time_slot < d_resolved_boundary_spatial_partitions.size(),
+			GPLATES_ASSERTION_SOURCE);
+
+	boost::optional<ResolvedBoundarySpatialPartition::non_null_ptr_to_const_type> &resolved_boundary_spatial_partition =
+			d_resolved_boundary_spatial_partitions[time_slot];
+	if (!resolved_boundary_spatial_partition)
+	{
+		// Get the resolved boundaries for the time slot.
+		boost::optional<const rtb_seq_type &> resolved_boundaries =
+				d_resolved_boundary_time_span->get_sample_in_time_slot(time_slot);
+		if (!resolved_boundaries ||
+			resolved_boundaries->empty())
+		{
+			return boost::none;
+		}
+
+		// Note that the resolved boundaries are owned by the resolved boundary time span (which we keep alive).
+		resolved_boundary_spatial_partition = ResolvedBoundarySpatialPartition::non_null_ptr_to_const_type(
+				ResolvedBoundarySpatialPartition::create(resolved_boundaries.get()));
+	}
+
+	return *resolved_boundary_spatial_partition.get();
+}
+
+
+GPlatesAppLogic::TopologyReconstruct::ResolvedBoundarySpatialPartition::ResolvedBoundarySpatialPartition(
+		const rtb_seq_type &resolved_boundaries) :
+	d_resolved_boundaries(resolved_boundaries),
+	d_spatial_partition(spatial_partition_type::create(SPATIAL_PARTITION_DEPTH))
+{
+	PROFILE_FUNC();
+
+	const unsigned int num_resolved_boundaries = d_resolved_boundaries.size();
+	for (unsigned int resolved_boundary_index = 0;
+		resolved_boundary_index < num_resolved_boundaries;
+		++resolved_boundary_index)
+	{
+		const ResolvedTopologicalBoundary::non_null_ptr_type &resolved_boundary =
+				d_resolved_boundaries[resolved_boundary_index];
+
+		// Resolved boundaries without a plate ID cannot be used to reconstruct points so don't add them.
+		// Shouldn't happen - resolved boundary should have a plate ID.
+		if (!resolved_boundary->plate_id())
+		{
+			continue;
+		}
+
+		const ResolvedTopologicalBoundary::resolved_topology_boundary_ptr_type boundary_polygon =
+				resolved_boundary->resolved_topology_boundary();
+
+		// Add the resolved boundary index using the bounding small circle of its boundary polygon.
+		d_spatial_partition->add(resolved_boundary_index, *boundary_polygon);
+
+		// Set up the high-speed point-in-polygon structure now (by testing an arbitrary point) rather
+		// than on the first point test. Subsequent tests then only read the polygon's cached structure
+		// and hence can be performed concurrently (see 'find_resolved_boundary_containing_point()').
+		boundary_polygon->is_point_in_polygon(
+				GPlatesMaths::PointOnSphere(boundary_polygon->get_boundary_centroid()),
+				GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE);
+	}
+}
+
+
+bool
+GPlatesAppLogic::TopologyReconstruct::ResolvedBoundarySpatialPartition::intersects(
+		const GPlatesMaths::BoundingSmallCircle &bounding_small_circle) const
+{
+	bool intersects_any_resolved_boundary = false;
+
+	GPlatesMaths::CubeQuadTreePartitionUtils::visit_potentially_intersecting_elements(
+			*d_spatial_partition,
+			bounding_small_circle.get_centre(),
+			bounding_small_circle.get_angular_extent(),
+			[&](unsigned int resolved_boundary_index)
+			{
+				if (!intersects_any_resolved_boundary &&
+					intersect(
+							d_resolved_boundaries[resolved_boundary_index]
+									->resolved_topology_boundary()->get_bounding_small_circle(),
+							bounding_small_circle))
+				{
+					intersects_any_resolved_boundary = true;
+				}
+			});
+
+	return intersects_any_resolved_boundary;
+}
+
+
+boost::optional<unsigned int>
+GPlatesAppLogic::TopologyReconstruct::ResolvedBoundarySpatialPartition::find_resolved_boundary_containing_point(
+		const GPlatesMaths::PointOnSphere &point,
+		boost::optional<unsigned int> hint_resolved_boundary_index,
+		std::vector<unsigned int> &candidate_indices) const
+{
+	// The point is probably in the same resolved boundary as the previous point so test that first.
+	//
+	// Note that the medium and high speed point-in-polygon tests include a quick small circle
+	// bounds test so we don't need to perform that test before the point-in-polygon test.
+	if (hint_resolved_boundary_index &&
+		d_resolved_boundaries[hint_resolved_boundary_index.get()]->resolved_topology_boundary()->is_point_in_polygon(
+				point,
+				GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE))
+	{
+		return hint_resolved_boundary_index;
+	}
+
+	// Find those resolved boundaries whose bounds might contain the point.
+	candidate_indices.clear();
+	GPlatesMaths::CubeQuadTreePartitionUtils::visit_elements_potentially_containing_point(
+			*d_spatial_partition,
+			point.position_vector(),
+			[&](unsigned int resolved_boundary_index)
+			{
+				candidate_indices.push_back(resolved_boundary_index);
+			});
+
+	// Test the candidates in the order the resolved boundaries are stored (rather than the order of
+	// spatial partition traversal) so that overlapping resolved boundaries give a consistent result.
+	std::sort(candidate_indices.begin(), candidate_indices.end());
+
+	for (unsigned int candidate_index : candidate_indices)
+	{
+		// Skip the hint since we've already tested it.
+		if (hint_resolved_boundary_index &&
+			candidate_index == hint_resolved_boundary_index.get())
+		{
+			continue;
+		}
+
+		if (d_resolved_boundaries[candidate_index]->resolved_topology_boundary()->is_point_in_polygon(
+				point,
+				GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE))
+		{
+			return candidate_index;
+		}
+	}
+
+	return boost::none;
+}
+
+
 GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::GeometryTimeSpan(
 		TopologyReconstruct::non_null_ptr_to_const_type topology_reconstruct,
 		const GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type &geometry,
@@ -527,7 +789,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_first_time_s
 	// Get the resolved boundaries/networks for the current time slot.
 	//
 	// As an optimisation, remove those boundaries/networks that the current geometry points do not intersect.
-	rtb_seq_type resolved_boundaries;
+	boost::optional<const ResolvedBoundarySpatialPartition &> resolved_boundaries;
 	rtn_seq_type resolved_networks;
 	if (!get_resolved_topologies(resolved_boundaries, resolved_networks, current_time_slot, current_geometry_sample))
 	{
@@ -576,6 +838,11 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_first_time_s
 	// since many points will be inside the same resolved boundary.
 	plate_id_to_stage_rotation_map_type resolved_boundary_reconstruct_stage_rotation_map;
 
+	// The next point is probably in the same resolved boundary as the previous point so test it first.
+	boost::optional<unsigned int> resolved_boundary_hint_index;
+	// Scratch space to avoid re-allocating for each point.
+	std::vector<unsigned int> resolved_boundary_candidate_indices;
+
 	// Keep track of number of topology reconstructed geometry points for the current time.
 	unsigned int num_topology_reconstructed_geometry_points = 0;
 
@@ -609,13 +876,16 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_first_time_s
 				resolved_networks,
 				time_increment,
 				reverse_reconstruct);
-		if (!topology_reconstructed_point)
+		if (!topology_reconstructed_point &&
+			resolved_boundaries)
 		{
 			// Second attempt uses resolved boundaries.
 			topology_reconstructed_point = reconstruct_point_using_resolved_boundaries(
 					current_point,
 					current_geometry_point->location,
-					resolved_boundaries,
+					resolved_boundaries.get(),
+					resolved_boundary_hint_index,
+					resolved_boundary_candidate_indices,
 					resolved_boundary_reconstruct_stage_rotation_map,
 					current_time,
 					next_time);
@@ -648,9 +918,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_first_time_s
 	{
 		// Get the rigid finite rotation used for those geometry points that did not
 		// intersect any resolved boundaries/networks and hence must be rigidly rotated.
-		const GPlatesMaths::FiniteRotation rigid_stage_rotation = get_stage_rotation(
-				d_reconstruction_plate_id,
-				d_topology_reconstruct->get_reconstruction_tree_creator(),
+		const GPlatesMaths::FiniteRotation rigid_stage_rotation = get_rigid_stage_rotation(
 				current_time/*initial_time*/,
 				next_time/*final_time*/);
 
@@ -694,7 +962,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_intermediate
 	// Get the resolved boundaries/networks for the current time slot.
 	//
 	// As an optimisation, remove those boundaries/networks that the current geometry points do not intersect.
-	rtb_seq_type resolved_boundaries;
+	boost::optional<const ResolvedBoundarySpatialPartition &> resolved_boundaries;
 	rtn_seq_type resolved_networks;
 	if (!get_resolved_topologies(resolved_boundaries, resolved_networks, current_time_slot, current_geometry_sample))
 	{
@@ -750,6 +1018,11 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_intermediate
 	// since many points will be inside the same resolved boundary.
 	plate_id_to_stage_rotation_map_type resolved_boundary_reconstruct_stage_rotation_map;
 
+	// The next point is probably in the same resolved boundary as the previous point so test it first.
+	boost::optional<unsigned int> resolved_boundary_hint_index;
+	// Scratch space to avoid re-allocating for each point.
+	std::vector<unsigned int> resolved_boundary_candidate_indices;
+
 	// Keep track of number of topology reconstructed geometry points for the current time.
 	unsigned int num_topology_reconstructed_geometry_points = 0;
 	// Keep track of number of active geometry points for the current time.
@@ -784,13 +1057,16 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_intermediate
 				resolved_networks,
 				time_increment,
 				reverse_reconstruct);
-		if (!topology_reconstructed_point)
+		if (!topology_reconstructed_point &&
+			resolved_boundaries)
 		{
 			// Second attempt uses resolved boundaries.
 			topology_reconstructed_point = reconstruct_point_using_resolved_boundaries(
 					current_point,
 					current_geometry_point->location,
-					resolved_boundaries,
+					resolved_boundaries.get(),
+					resolved_boundary_hint_index,
+					resolved_boundary_candidate_indices,
 					resolved_boundary_reconstruct_stage_rotation_map,
 					current_time,
 					next_time);
@@ -807,7 +1083,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_intermediate
 			GeometryPoint *prev_geometry_point = prev_geometry_points[geometry_point_index];
 			const double prev_time = d_time_range.get_time(prev_time_slot);
 			if (prev_geometry_point &&
-				d_deactivate_points.get()->deactivate(
+				deactivate_point(
 						GPlatesMaths::PointOnSphere(prev_geometry_point->position)/*prev_point*/,
 						prev_geometry_point->location/*prev_location*/,
 						prev_time,
@@ -860,9 +1136,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_intermediate
 	{
 		// Get the rigid finite rotation used for those geometry points that did not
 		// intersect any resolved boundaries/networks and hence must be rigidly rotated.
-		const GPlatesMaths::FiniteRotation rigid_stage_rotation = get_stage_rotation(
-				d_reconstruction_plate_id,
-				d_topology_reconstruct->get_reconstruction_tree_creator(),
+		const GPlatesMaths::FiniteRotation rigid_stage_rotation = get_rigid_stage_rotation(
 				current_time/*initial_time*/,
 				next_time/*final_time*/);
 
@@ -902,7 +1176,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_last_time_st
 	// Get the resolved boundaries/networks for the current time slot.
 	//
 	// As an optimisation, remove those boundaries/networks that the current geometry points do not intersect.
-	rtb_seq_type resolved_boundaries;
+	boost::optional<const ResolvedBoundarySpatialPartition &> resolved_boundaries;
 	rtn_seq_type resolved_networks;
 	if (!get_resolved_topologies(resolved_boundaries, resolved_networks, current_time_slot, current_geometry_sample))
 	{
@@ -932,6 +1206,11 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_last_time_st
 	// Keep track of number of active geometry points for the current time.
 	unsigned int num_active_geometry_points = 0;
 
+	// The next point is probably in the same resolved boundary as the previous point so test it first.
+	boost::optional<unsigned int> resolved_boundary_hint_index;
+	// Scratch space to avoid re-allocating for each point.
+	std::vector<unsigned int> resolved_boundary_candidate_indices;
+
 	// Iterate over the current geometry points and attempt to reconstruct them using resolved boundaries/networks.
 	for (unsigned int geometry_point_index = 0; geometry_point_index < num_geometry_points; ++geometry_point_index)
 	{
@@ -956,13 +1235,16 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_last_time_st
 		if (!reconstruct_last_point_using_resolved_networks(
 				current_point,
 				current_geometry_point->location,
-				resolved_networks))
+				resolved_networks) &&
+			resolved_boundaries)
 		{
 			// Second search the resolved boundaries.
 			reconstruct_last_point_using_resolved_boundaries(
 					current_point,
 					current_geometry_point->location,
-					resolved_boundaries);
+					resolved_boundaries.get(),
+					resolved_boundary_hint_index,
+					resolved_boundary_candidate_indices);
 		}
 
 		// If can deactivate points...
@@ -979,7 +1261,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_last_time_st
 				const double prev_time = d_time_range.get_time(prev_time_slot);
 
 				if (prev_geometry_point &&
-					d_deactivate_points.get()->deactivate(
+					deactivate_point(
 							GPlatesMaths::PointOnSphere(prev_geometry_point->position)/*prev_point*/,
 							prev_geometry_point->location/*prev_location*/,
 							prev_time,
@@ -1026,12 +1308,15 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_point_using_
 		boost::optional<
 				std::pair<
 						GPlatesMaths::PointOnSphere,
-						ResolvedTriangulation::Network::PointLocation> > deformed_point_result =
-				resolved_network->get_triangulation_network().calculate_deformed_point(
-						point,
-						time_increment,
-						reverse_reconstruct,
-						d_deformation_uses_natural_neighbour_interpolation);
+						ResolvedTriangulation::Network::PointLocation> > deformed_point_result;
+		// Note that the network triangulation guards its own cached data, and its deformed vertex
+		// positions were calculated when the time slot was first accessed (if creating geometry time
+		// spans concurrently) so that they're read without locking and reconstruction trees are not accessed here.
+		deformed_point_result = resolved_network->get_triangulation_network().calculate_deformed_point(
+				point,
+				time_increment,
+				reverse_reconstruct,
+				d_deformation_uses_natural_neighbour_interpolation);
 		if (!deformed_point_result)
 		{
 			// The point is outside the network so continue searching the resolved networks.
@@ -1070,7 +1355,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_last_point_u
 	{
 		const ResolvedTopologicalNetwork::non_null_ptr_type resolved_network = *resolved_networks_iter;
 
-		boost::optional<ResolvedTriangulation::Network::PointLocation> point_location_result =
+		const boost::optional<ResolvedTriangulation::Network::PointLocation> point_location_result =
 				resolved_network->get_triangulation_network().get_point_location(point);
 		if (!point_location_result)
 		{
@@ -1098,56 +1383,45 @@ boost::optional<GPlatesMaths::PointOnSphere>
 GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_point_using_resolved_boundaries(
 		const GPlatesMaths::PointOnSphere &point,
 		TopologyPointLocation &location,
-		rtb_seq_type &resolved_boundaries,
+		const ResolvedBoundarySpatialPartition &resolved_boundaries,
+		boost::optional<unsigned int> &resolved_boundary_hint_index,
+		std::vector<unsigned int> &resolved_boundary_candidate_indices,
 		plate_id_to_stage_rotation_map_type &resolved_boundary_stage_rotation_map,
 		const double &current_time,
 		const double &next_time)
 {
-	rtb_seq_type::iterator resolved_boundaries_iter = resolved_boundaries.begin();
-	rtb_seq_type::iterator resolved_boundaries_end = resolved_boundaries.end();
-	for ( ; resolved_boundaries_iter != resolved_boundaries_end; ++resolved_boundaries_iter)
-	{
-		const ResolvedTopologicalBoundary::non_null_ptr_type resolved_boundary = *resolved_boundaries_iter;
-
-		// Note that the medium and high speed point-in-polygon tests include a quick small circle
-		// bounds test so we don't need to perform that test before the point-in-polygon test.
-		if (!resolved_boundary->resolved_topology_boundary()->is_point_in_polygon(
-				point,
-				GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE))
-		{
-			// The point is outside the resolved boundary so continue searching resolved boundaries.
-			continue;
-		}
-
-		const boost::optional<GPlatesModel::integer_plate_id_type> resolved_boundary_plate_id = resolved_boundary->plate_id();
-		if (!resolved_boundary_plate_id)
-		{
-			// Shouldn't happen - resolved boundary should have a plate ID - ignore if doesn't.
-			continue;
-		}
+	// Only those resolved boundaries near the point are tested.
+	const boost::optional<unsigned int> resolved_boundary_index =
+			resolved_boundaries.find_resolved_boundary_containing_point(
+					point,
+					resolved_boundary_hint_index,
+					resolved_boundary_candidate_indices);
+	if (!resolved_boundary_index)
+	{
+		// The point is outside all resolved boundaries.
+		return boost::none;
+	}
 
-		// Store the resolved boundary containing the point.
-		location = TopologyPointLocation(resolved_boundary);
+	const ResolvedTopologicalBoundary::non_null_ptr_type &resolved_boundary =
+			resolved_boundaries.get_resolved_boundaries()[resolved_boundary_index.get()];
 
-		const GPlatesMaths::FiniteRotation &resolved_boundary_stage_rotation =
-				get_or_create_stage_rotation(
-						resolved_boundary_plate_id.get(),
-						resolved_boundary->get_reconstruction_tree_creator(),
-						current_time/*initial_time*/,
-						next_time/*final_time*/,
-						resolved_boundary_stage_rotation_map);
+	// Store the resolved boundary containing the point.
+	location = TopologyPointLocation(resolved_boundary);
 
-		// The next point is probably in the same resolved boundary so make it the first one to be tested next time.
-		if (resolved_boundaries_iter != resolved_boundaries.begin())
-		{
-			std::swap(resolved_boundaries.front(), *resolved_boundaries_iter);
-		}
+	// Note that the spatial partition only contains resolved boundaries that have a plate ID.
+	const GPlatesMaths::FiniteRotation &resolved_boundary_stage_rotation =
+			get_or_create_stage_rotation(
+					resolved_boundary->plate_id().get(),
+					resolved_boundary->get_reconstruction_tree_creator(),
+					current_time/*initial_time*/,
+					next_time/*final_time*/,
+					resolved_boundary_stage_rotation_map);
 
-		// Return reconstructed point.
-		return resolved_boundary_stage_rotation * point;
-	}
+	// The next point is probably in the same resolved boundary so make it the first one to be tested next time.
+	resolved_boundary_hint_index = resolved_boundary_index;
 
-	return boost::none;
+	// Return reconstructed point.
+	return resolved_boundary_stage_rotation * point;
 }
 
 
@@ -1155,57 +1429,43 @@ bool
 GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::reconstruct_last_point_using_resolved_boundaries(
 		const GPlatesMaths::PointOnSphere &point,
 		TopologyPointLocation &location,
-		rtb_seq_type &resolved_boundaries)
+		const ResolvedBoundarySpatialPartition &resolved_boundaries,
+		boost::optional<unsigned int> &resolved_boundary_hint_index,
+		std::vector<unsigned int> &resolved_boundary_candidate_indices)
 {
-	rtb_seq_type::iterator resolved_boundaries_iter = resolved_boundaries.begin();
-	rtb_seq_type::iterator resolved_boundaries_end = resolved_boundaries.end();
-	for ( ; resolved_boundaries_iter != resolved_boundaries_end; ++resolved_boundaries_iter)
-	{
-		const ResolvedTopologicalBoundary::non_null_ptr_type resolved_boundary = *resolved_boundaries_iter;
-
-		// Note that the medium and high speed point-in-polygon tests include a quick small circle
-		// bounds test so we don't need to perform that test before the point-in-polygon test.
-		if (!resolved_boundary->resolved_topology_boundary()->is_point_in_polygon(
-				point,
-				GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE))
-		{
-			// The point is outside the resolved boundary so continue searching resolved boundaries.
-			continue;
-		}
-
-		const boost::optional<GPlatesModel::integer_plate_id_type> resolved_boundary_plate_id = resolved_boundary->plate_id();
-		if (!resolved_boundary_plate_id)
-		{
-			// Shouldn't happen - resolved boundary should have a plate ID - ignore if doesn't.
-			continue;
-		}
+	// Only those resolved boundaries near the point are tested.
+	const boost::optional<unsigned int> resolved_boundary_index =
+			resolved_boundaries.find_resolved_boundary_containing_point(
+					point,
+					resolved_boundary_hint_index,
+					resolved_boundary_candidate_indices);
+	if (!resolved_boundary_index)
+	{
+		// The point is outside all resolved boundaries.
+		return false;
+	}
 
-		// Store the resolved boundary containing the point.
-		location = TopologyPointLocation(resolved_boundary);
+	// Store the resolved boundary containing the point.
+	location = TopologyPointLocation(
+			resolved_boundaries.get_resolved_boundaries()[resolved_boundary_index.get()]);
 
-		// The next point is probably in the same resolved boundary so make it the first one to be tested next time.
-		if (resolved_boundaries_iter != resolved_boundaries.begin())
-		{
-			std::swap(resolved_boundaries.front(), *resolved_boundaries_iter);
-		}
+	// The next point is probably in the same resolved boundary so make it the first one to be tested next time.
+	resolved_boundary_hint_index = resolved_boundary_index;
 
-		return true;
-	}
-
-	return false;
+	return true;
 }
 
 
 bool
 GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::get_resolved_topologies(
-		rtb_seq_type &resolved_boundaries,
+		boost::optional<const ResolvedBoundarySpatialPartition &> &resolved_boundaries,
 		rtn_seq_type &resolved_networks,
 		unsigned int time_slot,
 		const GeometrySample::non_null_ptr_type &geometry_sample) const
 {
-	// Get the resolved boundaries for the time slot.
-	boost::optional<const rtb_seq_type &> resolved_boundaries_opt =
-			d_topology_reconstruct->get_resolved_boundary_time_span()->get_sample_in_time_slot(time_slot);
+	// Get the spatial partition of resolved boundaries for the time slot.
+	// This is shared by all geometry time spans (it's only created once per time slot).
+	resolved_boundaries = d_topology_reconstruct->get_resolved_boundary_spatial_partition(time_slot);
 
 	// Get the resolved networks for the time slot.
 	boost::optional<const rtn_seq_type &> resolved_networks_opt =
@@ -1213,19 +1473,15 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::get_resolved_topologies(
 
 	// If there are no boundaries and no networks for the time slot then return early.
 	const bool have_topology_surfaces =
-			(resolved_boundaries_opt && !resolved_boundaries_opt->empty()) ||
+			resolved_boundaries ||
 			(resolved_networks_opt && !resolved_networks_opt->empty());
 	if (!have_topology_surfaces)
 	{
 		return false;
 	}
 
-	// Make a copy of the list of boundaries/networks.
+	// Make a copy of the list of networks.
 	// We will then can cull those that can't possibly intersect the geometry sample.
-	if (resolved_boundaries_opt)
-	{
-		resolved_boundaries = resolved_boundaries_opt.get();
-	}
 	if (resolved_networks_opt)
 	{
 		resolved_networks = resolved_networks_opt.get();
@@ -1271,15 +1527,13 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::get_resolved_topologies(
 		const GPlatesMaths::BoundingSmallCircle geometry_points_small_circle_bounds =
 				geometry_points_small_circle_bounds_builder.get_bounding_small_circle();
 
-		if (!resolved_boundaries.empty())
+		// Rather than copying and culling the resolved boundaries we just query the spatial partition
+		// to see if any resolved boundaries can possibly intersect the geometry points.
+		// Each point is later located using the spatial partition anyway.
+		if (resolved_boundaries &&
+			!resolved_boundaries->intersects(geometry_points_small_circle_bounds))
 		{
-			IntersectGeometryPointsAndResolvedBoundarySmallCircleBounds intersects(&geometry_points_small_circle_bounds);
-			resolved_boundaries.erase(
-					std::remove_if(
-							resolved_boundaries.begin(),
-							resolved_boundaries.end(),
-							[&](const ResolvedTopologicalBoundary::non_null_ptr_type &rtb) { return !intersects(rtb); }),
-					resolved_boundaries.end());
+			resolved_boundaries = boost::none;
 		}
 
 		if (!resolved_networks.empty())
@@ -1295,7 +1549,62 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::get_resolved_topologies(
 	}
 
 	// Return true if there are any remaining topology surfaces.
-	return !resolved_boundaries.empty() || !resolved_networks.empty();
+	return resolved_boundaries || !resolved_networks.empty();
+}
+
+
+GPlatesMaths::FiniteRotation
+GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::get_rigid_stage_rotation(
+		const double &initial_time,
+		const double &final_time) const
+{
+	// Stage rotations between adjacent time slots use the rotations calculated (for all time slots)
+	// in one pass. When geometry time spans are created concurrently these were created up front
+	// (see 'prepare_for_concurrent_geometry_time_spans()') so they're read without locking.
+	const ReconstructionRotationTable &time_slot_rotation_table =
+			d_topology_reconstruct->get_time_slot_rotation_table();
+	if (contains_stage_rotation_times(time_slot_rotation_table, initial_time, final_time))
+	{
+		// All times are in the table so the reconstruction tree creator is not used (it needs locking).
+		return get_stage_rotation(
+				d_reconstruction_plate_id,
+				initial_time,
+				final_time,
+				time_slot_rotation_table,
+				d_topology_reconstruct->get_reconstruction_tree_creator());
+	}
+
+	// Reconstruction trees are cached (and their rotations are calculated on demand).
+	boost::mutex::scoped_lock reconstruction_tree_lock(d_topology_reconstruct->d_reconstruction_tree_mutex);
+
+	return get_stage_rotation(
+			d_reconstruction_plate_id,
+			initial_time,
+			final_time,
+			d_topology_reconstruct->get_reconstruction_tree_creator());
+}
+
+
+bool
+GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::deactivate_point(
+		const GPlatesMaths::PointOnSphere &prev_point,
+		const TopologyPointLocation &prev_location,
+		const double &prev_time,
+		const GPlatesMaths::PointOnSphere &current_point,
+		const TopologyPointLocation &current_location,
+		const double &current_time) const
+{
+	// Deactivating points typically calculates velocities in resolved networks (which accesses
+	// reconstruction trees). And the DeactivatePoint itself might cache data.
+	boost::mutex::scoped_lock reconstruction_tree_lock(d_topology_reconstruct->d_reconstruction_tree_mutex);
+
+	return d_deactivate_points.get()->deactivate(
+			prev_point,
+			prev_location,
+			prev_time,
+			current_point,
+			current_location,
+			current_time);
 }
 
 
@@ -1315,6 +1624,9 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::get_or_create_stage_rota
 		return stage_rotation_iter->second;
 	}
 
+	// Reconstruction trees are cached (and their rotations are calculated on demand).
+	boost::mutex::scoped_lock reconstruction_tree_lock(d_topology_reconstruct->d_reconstruction_tree_mutex);
+
 	// Calculate stage rotation and insert into the map.
 	const std::pair<plate_id_to_stage_rotation_map_type::iterator, bool> insert_result =
 			stage_rotation_map.insert(
@@ -1322,9 +1634,9 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::get_or_create_stage_rota
 							reconstruction_plate_id,
 							get_stage_rotation(
 									reconstruction_plate_id,
-									reconstruction_tree_creator,
 									initial_time,
-									final_time)));
+									final_time,
+									reconstruction_tree_creator)));
 
 	return insert_result.first->second;
 }
@@ -1370,11 +1682,16 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::rigid_reconstruct(
 		bool reverse_reconstruct,
 		boost::optional<PoolAllocator::non_null_ptr_type> pool_allocator) const
 {
+	// Reconstruction trees are cached (and their rotations are calculated on demand).
+	boost::mutex::scoped_lock reconstruction_tree_lock(d_topology_reconstruct->d_reconstruction_tree_mutex);
+
 	GPlatesMaths::FiniteRotation rotation =
 			d_topology_reconstruct->get_reconstruction_tree_creator()
 					.get_reconstruction_tree(reconstruction_time)
 							->get_composed_absolute_rotation(d_reconstruction_plate_id);
 
+	reconstruction_tree_lock.unlock();
+
 	if (reverse_reconstruct)
 	{
 		rotation = get_reverse(rotation);
@@ -1393,11 +1710,7 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::rigid_stage_reconstruct(
 		boost::optional<PoolAllocator::non_null_ptr_type> pool_allocator) const
 {
 	const GPlatesMaths::FiniteRotation initial_to_final_rotation =
-			get_stage_rotation(
-					d_reconstruction_plate_id,
-					d_topology_reconstruct->get_reconstruction_tree_creator(),
-					initial_time,
-					final_time);
+			get_rigid_stage_rotation(initial_time, final_time);
 
 	// Create a new rotated geometry sample.
 	return rotate_geometry_sample(geometry_sample, initial_to_final_rotation, pool_allocator);
@@ -2514,9 +2827,9 @@ GPlatesAppLogic::TopologyReconstruct::GeometryTimeSpan::interpolate_geometry_sam
 			{
 				interpolate_rigid_stage_rotation = get_stage_rotation(
 						d_reconstruction_plate_id,
-						d_topology_reconstruct->get_reconstruction_tree_creator(),
 						initial_time,      // initial_time
-						reconstruction_time); // final_time
+						reconstruction_time, // final_time
+						d_topology_reconstruct->get_reconstruction_tree_creator());
 			}
 
 			const GPlatesMaths::PointOnSphere interpolated_point =
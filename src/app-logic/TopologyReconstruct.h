@@ -31,9 +31,11 @@
 #include <vector>
 #include <boost/optional.hpp>
 #include <boost/pool/object_pool.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "DeformationStrain.h"
 #include "DeformationStrainRate.h"
+#include "ReconstructionRotationTable.h"
 #include "ReconstructionTreeCreator.h"
 #include "ResolvedTopologicalBoundary.h"
 #include "ResolvedTopologicalNetwork.h"
@@ -46,11 +48,13 @@
 #include "global/PreconditionViolationError.h"
 
 #include "maths/AngularExtent.h"
+#include "maths/CubeQuadTreePartition.h"
 #include "maths/FiniteRotation.h"
 #include "maths/GeometryOnSphere.h"
 #include "maths/GeometryType.h"
 #include "maths/MultiPointOnSphere.h"
 #include "maths/PointOnSphere.h"
+#include "maths/SmallCircleBounds.h"
 #include "maths/types.h"
 #include "maths/UnitVector3D.h"
 #include "maths/Vector3D.h"
@@ -72,6 +76,9 @@ namespace GPlatesAppLogic
 	class TopologyReconstruct :
 			public GPlatesUtils::ReferenceCount<TopologyReconstruct>
 	{
+	private:
+		class ResolvedBoundarySpatialPartition;
+
 	public:
 		class GeometryTimeSpan;
 
@@ -288,6 +295,23 @@ namespace GPlatesAppLogic
 		}
 
 
+		/**
+		 * Enables geometry time spans to be created concurrently (see @a create_geometry_time_span).
+		 *
+		 * This creates, for all time slots, the data that geometry time spans share (and that is otherwise
+		 * created on demand) - the spatial partitions of resolved boundaries, the rotations used for rigid
+		 * stage rotations and the resolved network triangulations (triangulated and their vertices deformed
+		 * by one time increment). Geometry time spans then read these without locking, and deform points
+		 * in networks without accessing reconstruction trees.
+		 *
+		 * Only the first call does any work.
+		 *
+		 * This must be called before (not during) creating geometry time spans concurrently.
+		 */
+		void
+		prepare_for_concurrent_geometry_time_spans() const;
+
+
 		/**
 		 * Creates a time span for the specified present day geometry.
 		 *
@@ -322,6 +346,11 @@ namespace GPlatesAppLogic
 		 * of the feature's topology-reconstructed geometry prior to the feature's end (disappearance) time.
 		 * Changing the feature's begin/end time then only changes the time window within which
 		 * the feature is visible (and generates ReconstructedFeatureGeometry's).
+		 *
+		 * Note that this can be called concurrently from multiple threads to create multiple geometry
+		 * time spans (eg, using GPlatesUtils::ParallelUtils::parallel_for) provided
+		 * @a prepare_for_concurrent_geometry_time_spans is called first and no other thread
+		 * is accessing the resolved boundaries/networks or reconstruction trees at the same time.
 		 */
 		/*GeometryTimeSpan::non_null_ptr_type*/GPlatesUtils::non_null_intrusive_ptr<GeometryTimeSpan>
 		create_geometry_time_span(
@@ -956,12 +985,13 @@ namespace GPlatesAppLogic
 			/**
 			 * Reconstructs the specified point in the specified resolved boundaries.
 			 *
-			 * Also stores location of point (if successful) and reorders sequence of resolved boundaries
-			 * such that the boundary containing the point is at the front of the sequence.
+			 * Also stores location of point (if successful) and records the index of the boundary
+			 * containing the point in @a resolved_boundary_hint_index (so it's the first one tested next time).
 			 *
 			 * @a resolved_boundary_stage_rotation_map is used as an optimisation to avoid repeating the
 			 * calculation of stage rotation when many points are in the same resolved boundary.
 			 * 
+			 * @a resolved_boundary_candidate_indices is just scratch space (to avoid re-allocating for each point).
 			 *
 			 * Returns none if point is not in any resolved boundaries.
 			 */
@@ -969,7 +999,9 @@ namespace GPlatesAppLogic
 			reconstruct_point_using_resolved_boundaries(
 					const GPlatesMaths::PointOnSphere &point,
 					TopologyPointLocation &location,
-					rtb_seq_type &resolved_boundaries,
+					const ResolvedBoundarySpatialPartition &resolved_boundaries,
+					boost::optional<unsigned int> &resolved_boundary_hint_index,
+					std::vector<unsigned int> &resolved_boundary_candidate_indices,
 					plate_id_to_stage_rotation_map_type &resolved_boundary_stage_rotation_map,
 					const double &current_time,
 					const double &next_time);
@@ -982,24 +1014,53 @@ namespace GPlatesAppLogic
 			reconstruct_last_point_using_resolved_boundaries(
 					const GPlatesMaths::PointOnSphere &point,
 					TopologyPointLocation &location,
-					rtb_seq_type &resolved_boundaries);
+					const ResolvedBoundarySpatialPartition &resolved_boundaries,
+					boost::optional<unsigned int> &resolved_boundary_hint_index,
+					std::vector<unsigned int> &resolved_boundary_candidate_indices);
 
 			/**
 			 * Return the resolved boundaries/networks in the specified time slot.
 			 *
-			 * Also removes/culls those resolved boundaries/networks that the specified geometry sample does not intersect.
-			 * This is an optimisation that just removes those resolved boundaries/networks that can't possibly intersect.
-			 * It doesn't mean the remaining resolved boundaries/networks will definitely intersect though.
+			 * Also removes/culls those resolved networks that the specified geometry sample does not intersect.
+			 * This is an optimisation that just removes those resolved networks that can't possibly intersect.
+			 * It doesn't mean the remaining resolved networks will definitely intersect though.
+			 *
+			 * The resolved boundaries are not culled since each point is located using the spatial partition
+			 * of resolved boundaries in the time slot (which is shared by all geometry time spans).
+			 * However @a resolved_boundaries is only set if at least one resolved boundary potentially
+			 * intersects the geometry sample.
 			 *
 			 * Returns false if there are no resolved boundaries/networks (or all have been culled).
 			 */
 			bool
 			get_resolved_topologies(
-					rtb_seq_type &resolved_boundaries,
+					boost::optional<const ResolvedBoundarySpatialPartition &> &resolved_boundaries,
 					rtn_seq_type &resolved_networks,
 					unsigned int time_slot,
 					const GeometrySample::non_null_ptr_type &geometry_sample) const;
 
+			/**
+			 * Calculate the rigid stage rotation, of our reconstruction plate ID, from @a initial_time to @a final_time.
+			 *
+			 * The stage rotation can go forward or backward in time.
+			 */
+			GPlatesMaths::FiniteRotation
+			get_rigid_stage_rotation(
+					const double &initial_time,
+					const double &final_time) const;
+
+			/**
+			 * Returns true if the current point should be deactivated (see DeactivatePoint::deactivate).
+			 */
+			bool
+			deactivate_point(
+					const GPlatesMaths::PointOnSphere &prev_point,
+					const TopologyPointLocation &prev_location,
+					const double &prev_time,
+					const GPlatesMaths::PointOnSphere &current_point,
+					const TopologyPointLocation &current_location,
+					const double &current_time) const;
+
 			/**
 			 * Calculate the stage rotation from @a initial_time to @a final_time, or
 			 * re-use an existing calculation in plate ID map.
@@ -1122,11 +1183,126 @@ namespace GPlatesAppLogic
 
 	private:
 
+		/**
+		 * A spatial partition of the resolved boundaries in a single time slot.
+		 *
+		 * This is shared by all geometry time spans (and all points in them) so that locating a point
+		 * in the resolved boundaries of a time slot only tests those boundaries near the point
+		 * (instead of searching through all resolved boundaries).
+		 */
+		class ResolvedBoundarySpatialPartition :
+				public GPlatesUtils::ReferenceCount<ResolvedBoundarySpatialPartition>
+		{
+		public:
+			typedef GPlatesUtils::non_null_intrusive_ptr<ResolvedBoundarySpatialPartition> non_null_ptr_type;
+			typedef GPlatesUtils::non_null_intrusive_ptr<const ResolvedBoundarySpatialPartition> non_null_ptr_to_const_type;
+
+			/**
+			 * Creates a spatial partition of @a resolved_boundaries.
+			 *
+			 * NOTE: @a resolved_boundaries is referenced (not copied) so it must outlive us.
+			 */
+			static
+			non_null_ptr_type
+			create(
+					const rtb_seq_type &resolved_boundaries)
+			{
+				return non_null_ptr_type(new ResolvedBoundarySpatialPartition(resolved_boundaries));
+			}
+
+			/**
+			 * Returns the resolved boundaries (in the time slot).
+			 */
+			const rtb_seq_type &
+			get_resolved_boundaries() const
+			{
+				return d_resolved_boundaries;
+			}
+
+			/**
+			 * Returns true if the bounding small circle of any resolved boundary intersects @a bounding_small_circle.
+			 */
+			bool
+			intersects(
+					const GPlatesMaths::BoundingSmallCircle &bounding_small_circle) const;
+
+			/**
+			 * Returns the index (into @a get_resolved_boundaries) of the resolved boundary containing @a point.
+			 *
+			 * If @a hint_resolved_boundary_index is specified then it is tested first.
+			 * Otherwise, if more than one resolved boundary contains @a point, the one earliest
+			 * in the sequence of resolved boundaries is returned.
+			 *
+			 * @a candidate_indices is just scratch space (to avoid re-allocating for each point).
+			 *
+			 * Only resolved boundaries with a plate ID are considered.
+			 */
+			boost::optional<unsigned int>
+			find_resolved_boundary_containing_point(
+					const GPlatesMaths::PointOnSphere &point,
+					boost::optional<unsigned int> hint_resolved_boundary_index,
+					std::vector<unsigned int> &candidate_indices) const;
+
+		private:
+			//! Typedef for a spatial partition of indices into the sequence of resolved boundaries.
+			typedef GPlatesMaths::CubeQuadTreePartition<unsigned int> spatial_partition_type;
+
+			/**
+			 * Depth of the spatial partition.
+			 *
+			 * Resolved boundaries are typically large so there's no need to go as deep as for
+			 * reconstructed geometries (eg, see ReconstructLayerProxy).
+			 */
+			static const unsigned int SPATIAL_PARTITION_DEPTH = 6;
+
+			const rtb_seq_type &d_resolved_boundaries;
+			spatial_partition_type::non_null_ptr_type d_spatial_partition;
+
+			explicit
+			ResolvedBoundarySpatialPartition(
+					const rtb_seq_type &resolved_boundaries);
+		};
+
+
 		TimeSpanUtils::TimeRange d_time_range;
 		resolved_boundary_time_span_type::non_null_ptr_to_const_type d_resolved_boundary_time_span;
 		resolved_network_time_span_type::non_null_ptr_to_const_type d_resolved_network_time_span;
 		ReconstructionTreeCreator d_reconstruction_tree_creator;
 
+		/**
+		 * Spatial partitions of the resolved boundaries (indexed by time slot).
+		 *
+		 * These are created on demand (see @a get_resolved_boundary_spatial_partition), or all up front
+		 * by @a prepare_for_concurrent_geometry_time_spans.
+		 */
+		mutable std::vector< boost::optional<ResolvedBoundarySpatialPartition::non_null_ptr_to_const_type> >
+				d_resolved_boundary_spatial_partitions;
+
+		/**
+		 * Guards access to reconstruction trees (and the caches inside any DeactivatePoint) since
+		 * the reconstruction tree creators are not thread-safe.
+		 *
+		 * This enables geometry time spans to be created concurrently by multiple threads.
+		 * Only lookups not covered by the data created in @a prepare_for_concurrent_geometry_time_spans
+		 * are done with the lock (deactivating points, rotations of resolved boundaries using their own
+		 * reconstruction tree creators, rigidly reconstructing to the geometry import time and stage
+		 * rotations missing from @a d_time_slot_rotation_table).
+		 */
+		mutable boost::mutex d_reconstruction_tree_mutex;
+
+		/**
+		 * Whether @a prepare_for_concurrent_geometry_time_spans has been called.
+		 */
+		mutable bool d_prepared_for_concurrent_geometry_time_spans;
+
+		/**
+		 * The rotations (of all plates) needed for rigid stage rotations between adjacent time slots.
+		 *
+		 * This is created on demand (see @a get_time_slot_rotation_table), or up front
+		 * by @a prepare_for_concurrent_geometry_time_spans.
+		 */
+		mutable boost::optional<ReconstructionRotationTable::non_null_ptr_to_const_type> d_time_slot_rotation_table;
+
 
 		TopologyReconstruct(
 				const TimeSpanUtils::TimeRange &time_range,
@@ -1136,8 +1312,37 @@ namespace GPlatesAppLogic
 			d_time_range(time_range),
 			d_resolved_boundary_time_span(resolved_boundary_time_span),
 			d_resolved_network_time_span(resolved_network_time_span),
-			d_reconstruction_tree_creator(reconstruction_tree_creator)
+			d_reconstruction_tree_creator(reconstruction_tree_creator),
+			d_resolved_boundary_spatial_partitions(time_range.get_num_time_slots()),
+			d_prepared_for_concurrent_geometry_time_spans(false)
 		{  }
+
+		/**
+		 * Returns the spatial partition of resolved boundaries in the specified time slot, or
+		 * none if there are no resolved boundaries in the time slot.
+		 *
+		 * The spatial partition is created the first time it is requested for a time slot.
+		 *
+		 * This can only be called concurrently by multiple threads after
+		 * @a prepare_for_concurrent_geometry_time_spans (which creates all of them).
+		 */
+		boost::optional<const ResolvedBoundarySpatialPartition &>
+		get_resolved_boundary_spatial_partition(
+				unsigned int time_slot) const;
+
+		/**
+		 * Returns the rotations of all plates (using @a d_reconstruction_tree_creator) at the times needed to
+		 * calculate rigid stage rotations between adjacent time slots (forward and backward in time).
+		 *
+		 * This avoids creating a reconstruction tree per time slot when rigidly reconstructing geometries.
+		 *
+		 * The table is created the first time it is requested.
+		 *
+		 * This can only be called concurrently by multiple threads after
+		 * @a prepare_for_concurrent_geometry_time_spans (which creates it).
+		 */
+		const ReconstructionRotationTable &
+		get_time_slot_rotation_table() const;
 	};
 }
 
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <cstddef> // For std::size_t
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <map>
@@ -45,6 +46,7 @@
 #include "ResolvedTopologicalGeometrySubSegment.h"
 #include "ResolvedTopologicalLine.h"
 #include "ResolvedTopologicalNetwork.h"
+#include "ResolvedTriangulationNetwork.h"
 #include "TopologyGeometryResolver.h"
 #include "TopologyInternalUtils.h"
 #include "TopologyNetworkResolver.h"
@@ -62,6 +64,7 @@
 #include "property-values/GpmlPiecewiseAggregation.h"
 #include "property-values/GpmlTopologicalLine.h"
 
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 #include "utils/UnicodeStringUtils.h"
 
@@ -1364,6 +1367,38 @@ namespace GPlatesAppLogic
 				add_or_remove_marker_topology(sharing_resolved_topologies, sub_segment_marker);
 			}
 		}
+
+
+		//
+		// The following function is used in 'resolve_topological_networks()'.
+		//
+
+
+		/**
+		 * Builds the Delaunay triangulations of the resolved networks (starting at @a networks_begin_index)
+		 * using @a num_worker_threads threads (see ResolvedTriangulation::Network::create_delaunay_triangulations).
+		 */
+		void
+		create_delaunay_triangulations(
+				const std::vector<ResolvedTopologicalNetwork::non_null_ptr_type> &resolved_topological_networks,
+				std::size_t networks_begin_index,
+				unsigned int num_worker_threads)
+		{
+			// Only reference the triangulation networks (not the resolved networks) in the worker threads
+			// since releasing a resolved network is not thread-safe (it references the model).
+			std::vector<const ResolvedTriangulation::Network *> triangulation_networks;
+			for (std::size_t network_index = networks_begin_index;
+				network_index < resolved_topological_networks.size();
+				++network_index)
+			{
+				triangulation_networks.push_back(
+						&resolved_topological_networks[network_index]->get_triangulation_network());
+			}
+
+			ResolvedTriangulation::Network::create_delaunay_triangulations(
+					triangulation_networks,
+					num_worker_threads);
+		}
 	}
 }
 
@@ -1490,6 +1525,13 @@ GPlatesAppLogic::TopologyUtils::has_topological_line_features(
 }
 
 
+unsigned int
+GPlatesAppLogic::TopologyUtils::get_layer_num_worker_threads()
+{
+	return GPlatesUtils::ParallelUtils::get_num_worker_threads();
+}
+
+
 GPlatesAppLogic::ReconstructHandle::type
 GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 		std::vector<ResolvedTopologicalLine::non_null_ptr_type> &resolved_topological_lines,
@@ -1497,7 +1539,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
-		boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced)
+		boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced,
+		unsigned int num_worker_threads)
 {
 	PROFILE_FUNC();
 
@@ -1510,7 +1553,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 			reconstruct_handle,
 			reconstruction_tree_creator,
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			num_worker_threads);
 
 	for (auto feature_collection : topological_line_features_collection)
 	{
@@ -1537,6 +1581,9 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 		}
 	}
 
+	// Resolve any topological lines deferred for concurrent resolving.
+	topology_line_resolver.resolve_deferred_topologies();
+
 	return reconstruct_handle;
 }
 
@@ -1548,7 +1595,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
-		boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced)
+		boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced,
+		unsigned int num_worker_threads)
 {
 	PROFILE_FUNC();
 
@@ -1561,7 +1609,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 			reconstruct_handle,
 			reconstruction_tree_creator,
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			num_worker_threads);
 
 	for (auto feature_ref : topological_line_features)
 	{
@@ -1583,6 +1632,9 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
 		}
 	}
 
+	// Resolve any topological lines deferred for concurrent resolving.
+	topology_line_resolver.resolve_deferred_topologies();
+
 	return reconstruct_handle;
 }
 
@@ -1635,7 +1687,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
 		const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &topological_closed_plate_polygon_features_collection,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles)
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		unsigned int num_worker_threads)
 {
 	PROFILE_FUNC();
 
@@ -1648,13 +1701,17 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
 			reconstruct_handle,
 			reconstruction_tree_creator,
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			num_worker_threads);
 
 	AppLogicUtils::visit_feature_collections(
 			topological_closed_plate_polygon_features_collection.begin(),
 			topological_closed_plate_polygon_features_collection.end(),
 			topology_boundary_resolver);
 
+	// Resolve any topological boundaries deferred for concurrent resolving.
+	topology_boundary_resolver.resolve_deferred_topologies();
+
 	return reconstruct_handle;
 }
 
@@ -1665,7 +1722,8 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
 		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_closed_plate_polygon_features,
 		const ReconstructionTreeCreator &reconstruction_tree_creator,
 		const double &reconstruction_time,
-		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles)
+		boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles,
+		unsigned int num_worker_threads)
 {
 	PROFILE_FUNC();
 
@@ -1678,13 +1736,17 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
 			reconstruct_handle,
 			reconstruction_tree_creator,
 			reconstruction_time,
-			topological_sections_reconstruct_handles);
+			topological_sections_reconstruct_handles,
+			num_worker_threads);
 
 	AppLogicUtils::visit_features(
 			topological_closed_plate_polygon_features.begin(),
 			topological_closed_plate_polygon_features.end(),
 			topology_boundary_resolver);
 
+	// Resolve any topological boundaries deferred for concurrent resolving.
+	topology_boundary_resolver.resolve_deferred_topologies();
+
 	return reconstruct_handle;
 }
 
@@ -1739,26 +1801,42 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_networks(
 		const double &reconstruction_time,
 		const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &topological_network_features_collection,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-		const TopologyNetworkParams &topology_network_params)
+		const TopologyNetworkParams &topology_network_params,
+		unsigned int num_worker_threads)
 {
 	PROFILE_FUNC();
 
 	// Get the next global reconstruct handle - it'll be stored in each RTN.
 	const ReconstructHandle::type reconstruct_handle = ReconstructHandle::get_next_reconstruct_handle();
 
+	// Any networks already in the caller's sequence are not ours.
+	const std::size_t resolved_topological_networks_begin_index = resolved_topological_networks.size();
+
 	// Visit topological network features.
 	TopologyNetworkResolver topology_network_resolver(
 			resolved_topological_networks,
 			reconstruction_time,
 			reconstruct_handle,
 			topological_geometry_reconstruct_handles,
-			topology_network_params);
+			topology_network_params,
+			num_worker_threads);
 
 	AppLogicUtils::visit_feature_collections(
 			topological_network_features_collection.begin(),
 			topological_network_features_collection.end(),
 			topology_network_resolver);
 
+	// Resolve any topological networks deferred for concurrent resolving.
+	topology_network_resolver.resolve_deferred_topologies();
+
+	if (num_worker_threads != 1)
+	{
+		create_delaunay_triangulations(
+				resolved_topological_networks,
+				resolved_topological_networks_begin_index,
+				num_worker_threads);
+	}
+
 	return reconstruct_handle;
 }
 
@@ -1769,26 +1847,42 @@ GPlatesAppLogic::TopologyUtils::resolve_topological_networks(
 		const double &reconstruction_time,
 		const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_network_features,
 		boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-		const TopologyNetworkParams &topology_network_params)
+		const TopologyNetworkParams &topology_network_params,
+		unsigned int num_worker_threads)
 {
 	PROFILE_FUNC();
 
 	// Get the next global reconstruct handle - it'll be stored in each RTN.
 	const ReconstructHandle::type reconstruct_handle = ReconstructHandle::get_next_reconstruct_handle();
 
+	// Any networks already in the caller's sequence are not ours.
+	const std::size_t resolved_topological_networks_begin_index = resolved_topological_networks.size();
+
 	// Visit topological network features.
 	TopologyNetworkResolver topology_network_resolver(
 			resolved_topological_networks,
 			reconstruction_time,
 			reconstruct_handle,
 			topological_geometry_reconstruct_handles,
-			topology_network_params);
+			topology_network_params,
+			num_worker_threads);
 
 	AppLogicUtils::visit_features(
 			topological_network_features.begin(),
 			topological_network_features.end(),
 			topology_network_resolver);
 
+	// Resolve any topological networks deferred for concurrent resolving.
+	topology_network_resolver.resolve_deferred_topologies();
+
+	if (num_worker_threads != 1)
+	{
+		create_delaunay_triangulations(
+				resolved_topological_networks,
+				resolved_topological_networks_begin_index,
+				num_worker_threads);
+	}
+
 	return reconstruct_handle;
 }
 
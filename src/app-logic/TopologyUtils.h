@@ -110,6 +110,19 @@ namespace GPlatesAppLogic
 				const GPlatesModel::FeatureCollectionHandle::const_weak_ref &feature_collection);
 
 
+		/**
+		 * Returns the number of threads that layers resolve topologies with (the @a num_worker_threads
+		 * argument of the resolve functions below).
+		 *
+		 * This is the global 'num_worker_threads' setting (the GUI preference, or the Python
+		 * 'set_num_worker_threads'). Only the section intersections and network triangulations run
+		 * concurrently (on prepared data) while the calling thread waits, and the model is only
+		 * accessed on the calling thread.
+		 */
+		unsigned int
+		get_layer_num_worker_threads();
+
+
 		/**
 		 * Create and return a sequence of @a ResolvedTopologicalLine objects by resolving
 		 * topological lines in @a topological_line_features_collection.
@@ -124,6 +137,10 @@ namespace GPlatesAppLogic
 		 * @param topological_lines_referenced Only resolved those topological line features matching
 		 *        the specified feature IDs. This is useful when subsequently resolving boundaries/networks
 		 *        that reference a subset of the topological line features specified.
+		 * @param num_worker_threads is the number of threads used to intersect the topological sections
+		 *        (one resolves serially on the calling thread, and zero means use
+		 *        GPlatesUtils::ParallelUtils::get_num_worker_threads). The resolved topological lines
+		 *        are in the same order regardless.
 		 *
 		 * The returned reconstruct handle can be used to identify the resolved topological lines
 		 * when resolving topological *boundaries* (since they can reference resolved *lines*).
@@ -135,7 +152,8 @@ namespace GPlatesAppLogic
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none,
-				boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced = boost::none);
+				boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced = boost::none,
+				unsigned int num_worker_threads = 1);
 
 		/**
 		 * An overload of @a resolve_topological_lines accepting a vector of features instead of a feature collection.
@@ -147,7 +165,8 @@ namespace GPlatesAppLogic
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none,
-				boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced = boost::none);
+				boost::optional<const std::set<GPlatesModel::FeatureId> &> topological_lines_referenced = boost::none,
+				unsigned int num_worker_threads = 1);
 
 
 		/**
@@ -179,6 +198,10 @@ namespace GPlatesAppLogic
 		 *        observing the topological section features,
 		 *        that should be searched when resolving the topological boundaries.
 		 *        This is useful to avoid outdated RFGs and RTGS still in existence (among other scenarios).
+		 * @param num_worker_threads is the number of threads used to intersect the topological sections
+		 *        (one resolves serially on the calling thread, and zero means use
+		 *        GPlatesUtils::ParallelUtils::get_num_worker_threads). The resolved topological boundaries
+		 *        are in the same order regardless.
 		 *
 		 * The returned reconstruct handle can be used to identify the resolved topological boundaries.
 		 * This is not currently used though.
@@ -189,7 +212,8 @@ namespace GPlatesAppLogic
 				const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &topological_closed_plate_polygon_features_collection,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none,
+				unsigned int num_worker_threads = 1);
 
 		/**
 		 * An overload of @a resolve_topological_boundaries accepting a vector of features instead of a feature collection.
@@ -200,7 +224,8 @@ namespace GPlatesAppLogic
 				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_closed_plate_polygon_features,
 				const ReconstructionTreeCreator &reconstruction_tree_creator,
 				const double &reconstruction_time,
-				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none);
+				boost::optional<const std::vector<ReconstructHandle::type> &> topological_sections_reconstruct_handles = boost::none,
+				unsigned int num_worker_threads = 1);
 
 
 		//! Typedef for a sequence of resolved topological boundaries.
@@ -238,6 +263,11 @@ namespace GPlatesAppLogic
 		 *        that should be searched when resolving the topological networks.
 		 *        This is useful to avoid outdated RFGs and RTGS still in existence (among other scenarios).
 		 * @param topology_network_params parameters used when creating the resolved networks.
+		 * @param num_worker_threads is the number of threads used to intersect the boundary sections of,
+		 *        and build the Delaunay triangulations of, the resolved networks (one resolves serially
+		 *        on the calling thread and leaves each triangulation to be built when first accessed,
+		 *        and zero means use GPlatesUtils::ParallelUtils::get_num_worker_threads).
+		 *        The resolved topological networks are in the same order regardless.
 		 *
 		 * The returned reconstruct handle can be used to identify the resolved topological networks.
 		 * This is not currently used though.
@@ -248,7 +278,8 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time,
 				const std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> &topological_network_features_collection,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams());
+				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams(),
+				unsigned int num_worker_threads = 1);
 
 		/**
 		 * An overload of @a resolve_topological_networks accepting a vector of features instead of a feature collection.
@@ -259,7 +290,8 @@ namespace GPlatesAppLogic
 				const double &reconstruction_time,
 				const std::vector<GPlatesModel::FeatureHandle::weak_ref> &topological_network_features,
 				boost::optional<const std::vector<ReconstructHandle::type> &> topological_geometry_reconstruct_handles,
-				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams());
+				const TopologyNetworkParams &topology_network_params = TopologyNetworkParams(),
+				unsigned int num_worker_threads = 1);
 
 
 		/**
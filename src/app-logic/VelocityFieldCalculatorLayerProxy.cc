@@ -521,7 +521,10 @@ GPlatesAppLogic::VelocityFieldCalculatorLayerProxy::cache_velocities(
 				surface_resolved_topological_networks,
 				velocity_params.get_delta_time(),
 				velocity_params.get_delta_time_type(),
-				velocity_smoothing_options);
+				velocity_smoothing_options,
+				// Use the 'app_logic/num_worker_threads' preference (the rigid plates and networks
+				// are prepared up front so domain points can be solved concurrently)...
+				0/*num_worker_threads*/);
 	}
 	else
 	{
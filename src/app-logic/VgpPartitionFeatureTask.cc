@@ -23,6 +23,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <boost/optional.hpp>
 #include <QDebug>
 
 #include "VgpPartitionFeatureTask.h"
@@ -41,6 +42,46 @@
 #include "utils/UnicodeStringUtils.h"
 
 
+namespace GPlatesAppLogic
+{
+	namespace
+	{
+		/**
+		 * The sample site of a VirtualGeomagneticPole feature extracted by @a VgpPartitionFeatureTask.
+		 */
+		class VgpExtractedFeature :
+				public PartitionFeatureTask::ExtractedFeature
+		{
+		public:
+
+			VgpExtractedFeature(
+					const GPlatesMaths::PointOnSphere &sample_site_point_,
+					const GeometryCookieCutter &geometry_cookie_cutter) :
+				sample_site_point(sample_site_point_),
+				d_geometry_cookie_cutter(geometry_cookie_cutter)
+			{  }
+
+			virtual
+			void
+			partition()
+			{
+				// Find a partitioning polygon boundary that contains the sample site.
+				partitioning_polygon = d_geometry_cookie_cutter.partition_point(sample_site_point);
+			}
+
+
+			GPlatesMaths::PointOnSphere sample_site_point;
+
+			//! The partitioning polygon containing the sample site (if any).
+			boost::optional<const ReconstructionGeometry *> partitioning_polygon;
+
+		private:
+			const GeometryCookieCutter &d_geometry_cookie_cutter;
+		};
+	}
+}
+
+
 GPlatesAppLogic::VgpPartitionFeatureTask::VgpPartitionFeatureTask(
 		bool verify_information_model) :
 	d_verify_information_model(verify_information_model)
@@ -60,13 +101,10 @@ GPlatesAppLogic::VgpPartitionFeatureTask::can_partition_feature(
 }
 
 
-void
-GPlatesAppLogic::VgpPartitionFeatureTask::partition_feature(
+GPlatesAppLogic::PartitionFeatureTask::extracted_feature_ptr_type
+GPlatesAppLogic::VgpPartitionFeatureTask::extract_feature(
 		const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
-		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
 		const GPlatesAppLogic::GeometryCookieCutter &geometry_cookie_cutter,
-		const ReconstructMethodInterface::Context &reconstruct_method_context,
-		const double &reconstruction_time,
 		// 'respect_feature_time_period' is ignored for VGP features...
 		bool /*respect_feature_time_period*/)
 {
@@ -83,13 +121,26 @@ GPlatesAppLogic::VgpPartitionFeatureTask::partition_feature(
 				"in 'VirtualGeomagneticPole' with feature id = ";
 		qDebug() << GPlatesUtils::make_qstring_from_icu_string(
 				feature_ref->feature_id().get());
-		return;
+		return extracted_feature_ptr_type();
 	}
-	const GPlatesMaths::PointOnSphere &sample_site_point = sample_site_gml_point.get()->point();
 
-	// Find a partitioning polygon boundary that contains the sample site.
-	const boost::optional<const ReconstructionGeometry *> partitioning_polygon =
-						geometry_cookie_cutter.partition_point(sample_site_point);
+	return extracted_feature_ptr_type(
+			new VgpExtractedFeature(
+					sample_site_gml_point.get()->point(),
+					geometry_cookie_cutter));
+}
+
+
+void
+GPlatesAppLogic::VgpPartitionFeatureTask::assign_extracted_feature(
+		ExtractedFeature &extracted_feature,
+		const GPlatesModel::FeatureHandle::weak_ref &feature_ref,
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref,
+		const ReconstructMethodInterface::Context &reconstruct_method_context,
+		const double &reconstruction_time)
+{
+	const boost::optional<const ReconstructionGeometry *> &partitioning_polygon =
+			dynamic_cast<VgpExtractedFeature &>(extracted_feature).partitioning_polygon;
 
 	if (!partitioning_polygon)
 	{
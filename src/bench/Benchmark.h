@@ -0,0 +1,141 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef GPLATES_BENCH_BENCHMARK_H
+#define GPLATES_BENCH_BENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+
+
+namespace GPlatesBench
+{
+	class BenchmarkContext;
+
+
+	/**
+	 * Base class of the benchmarks run by the 'gplates-bench' program.
+	 *
+	 * A benchmark prepares its inputs in @a set_up (which is not timed) and then @a run is timed
+	 * over a number of iterations. Each iteration should do the same work so that the timings are
+	 * repeatable (for example, any random inputs should be generated in @a set_up using a fixed seed).
+	 */
+	class Benchmark :
+			private boost::noncopyable
+	{
+	public:
+
+		typedef boost::shared_ptr<Benchmark> shared_ptr_type;
+
+
+		/**
+		 * Micro benchmarks time a single (fast) operation, whereas macro benchmarks time
+		 * a larger workflow (such as a sequence of reconstruction times).
+		 */
+		enum Scope
+		{
+			MICRO,
+			MACRO
+		};
+
+
+		virtual
+		~Benchmark()
+		{  }
+
+
+		/**
+		 * The unique name of this benchmark (such as "reconstruction/tree_build").
+		 *
+		 * It identifies the benchmark in the results file (and hence when comparing against a baseline).
+		 */
+		const std::string &
+		get_name() const
+		{
+			return d_name;
+		}
+
+		Scope
+		get_scope() const
+		{
+			return d_scope;
+		}
+
+
+		/**
+		 * Prepares the inputs of this benchmark (not timed).
+		 *
+		 * Returns the reason this benchmark cannot be run (such as missing sample data), otherwise boost::none.
+		 */
+		virtual
+		boost::optional<std::string>
+		set_up(
+				BenchmarkContext &context) = 0;
+
+
+		/**
+		 * Runs one (timed) iteration of this benchmark.
+		 *
+		 * Returns the number of items processed (such as the number of geometries reconstructed)
+		 * which is used to report the throughput.
+		 */
+		virtual
+		unsigned int
+		run() = 0;
+
+
+		/**
+		 * Releases the inputs created in @a set_up.
+		 */
+		virtual
+		void
+		tear_down()
+		{  }
+
+	protected:
+
+		Benchmark(
+				const std::string &name,
+				Scope scope) :
+			d_name(name),
+			d_scope(scope)
+		{  }
+
+	private:
+
+		std::string d_name;
+		Scope d_scope;
+	};
+
+
+	//! Typedef for a sequence of benchmarks.
+	typedef std::vector<Benchmark::shared_ptr_type> benchmark_seq_type;
+}
+
+#endif // GPLATES_BENCH_BENCHMARK_H
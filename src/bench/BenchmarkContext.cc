@@ -0,0 +1,110 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <QDir>
+#include <QFileInfo>
+
+#include "BenchmarkContext.h"
+
+#include "file-io/FileInfo.h"
+#include "file-io/ReadErrorAccumulation.h"
+
+
+GPlatesBench::BenchmarkContext::BenchmarkContext(
+		const QString &sample_data_dir,
+		const QString &temporary_dir,
+		boost::optional<QString> raster_filename,
+		unsigned int num_worker_threads) :
+	d_sample_data_dir(sample_data_dir),
+	d_temporary_dir(temporary_dir),
+	d_raster_filename(raster_filename),
+	d_num_worker_threads(num_worker_threads)
+{
+}
+
+
+QString
+GPlatesBench::BenchmarkContext::get_sample_data_filename(
+		const QString &relative_filename) const
+{
+	return QDir(d_sample_data_dir).absoluteFilePath(relative_filename);
+}
+
+
+QStringList
+GPlatesBench::BenchmarkContext::get_sample_data_filenames(
+		const QString &relative_dir,
+		const QStringList &name_filters) const
+{
+	const QDir dir(get_sample_data_filename(relative_dir));
+
+	QStringList relative_filenames;
+	const QStringList entries = dir.entryList(name_filters, QDir::Files, QDir::Name);
+	for (const QString &entry : entries)
+	{
+		relative_filenames.append(QDir(relative_dir).filePath(entry));
+	}
+
+	return relative_filenames;
+}
+
+
+boost::optional<GPlatesBench::BenchmarkContext::feature_collection_seq_type>
+GPlatesBench::BenchmarkContext::load_sample_data(
+		const QStringList &relative_filenames)
+{
+	feature_collection_seq_type feature_collections;
+
+	for (const QString &relative_filename : relative_filenames)
+	{
+		const QString filename = get_sample_data_filename(relative_filename);
+
+		loaded_file_map_type::iterator loaded_file_iter = d_loaded_files.find(filename);
+		if (loaded_file_iter == d_loaded_files.end())
+		{
+			if (!QFileInfo(filename).isFile())
+			{
+				return boost::none;
+			}
+
+			// Read the feature collection from the file.
+			GPlatesFileIO::File::non_null_ptr_type file =
+					GPlatesFileIO::File::create_file(GPlatesFileIO::FileInfo(filename));
+			GPlatesFileIO::ReadErrorAccumulation read_errors;
+			d_file_format_registry.read_feature_collection(file->get_reference(), read_errors);
+
+			// Add the feature collection to be managed by the model (keeps it alive while loaded).
+			loaded_file_iter = d_loaded_files.insert(
+					loaded_file_map_type::value_type(
+							filename,
+							file->add_feature_collection_to_model(d_model))).first;
+		}
+
+		feature_collections.push_back(loaded_file_iter->second->get_feature_collection());
+	}
+
+	return feature_collections;
+}
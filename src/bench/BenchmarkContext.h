@@ -0,0 +1,156 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef GPLATES_BENCH_BENCHMARKCONTEXT_H
+#define GPLATES_BENCH_BENCHMARKCONTEXT_H
+
+#include <map>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
+#include <QString>
+#include <QStringList>
+
+#include "file-io/FeatureCollectionFileFormatRegistry.h"
+#include "file-io/File.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/ModelInterface.h"
+
+
+namespace GPlatesBench
+{
+	/**
+	 * The state shared by the benchmarks (such as the model and the loaded sample data).
+	 */
+	class BenchmarkContext :
+			private boost::noncopyable
+	{
+	public:
+
+		//! Typedef for a sequence of feature collections.
+		typedef std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> feature_collection_seq_type;
+
+
+		/**
+		 * @a sample_data_dir is the directory containing the GPlates sample data
+		 * (the 'sample-data/' directory in the source tree).
+		 *
+		 * @a temporary_dir is a writable directory for files generated by benchmarks.
+		 *
+		 * @a raster_filename is an optional raster used by the raster benchmarks
+		 * (otherwise they generate their own raster in @a temporary_dir).
+		 */
+		BenchmarkContext(
+				const QString &sample_data_dir,
+				const QString &temporary_dir,
+				boost::optional<QString> raster_filename,
+				unsigned int num_worker_threads);
+
+
+		/**
+		 * Returns the absolute path of @a relative_filename in the sample data directory.
+		 */
+		QString
+		get_sample_data_filename(
+				const QString &relative_filename) const;
+
+
+		/**
+		 * Returns the files in the sample data sub-directory @a relative_dir matching @a name_filters
+		 * (such as "*.gpml.gz"), sorted by name and relative to the sample data directory.
+		 */
+		QStringList
+		get_sample_data_filenames(
+				const QString &relative_dir,
+				const QStringList &name_filters) const;
+
+
+		/**
+		 * Returns the feature collections of the sample data files @a relative_filenames.
+		 *
+		 * Each file is only loaded once (the first time it is requested) and remains loaded for the
+		 * lifetime of this context, so benchmarks sharing sample data do not time (or repeat) its loading.
+		 *
+		 * Returns boost::none if any of the files do not exist.
+		 */
+		boost::optional<feature_collection_seq_type>
+		load_sample_data(
+				const QStringList &relative_filenames);
+
+
+		GPlatesModel::ModelInterface &
+		get_model()
+		{
+			return d_model;
+		}
+
+		GPlatesFileIO::FeatureCollectionFileFormat::Registry &
+		get_file_format_registry()
+		{
+			return d_file_format_registry;
+		}
+
+		const QString &
+		get_temporary_dir() const
+		{
+			return d_temporary_dir;
+		}
+
+		const boost::optional<QString> &
+		get_raster_filename() const
+		{
+			return d_raster_filename;
+		}
+
+		/**
+		 * The number of threads used by benchmarks of operations that can run on multiple threads.
+		 */
+		unsigned int
+		get_num_worker_threads() const
+		{
+			return d_num_worker_threads;
+		}
+
+	private:
+
+		typedef std::map<QString, GPlatesFileIO::File::Reference::non_null_ptr_type> loaded_file_map_type;
+
+
+		QString d_sample_data_dir;
+		QString d_temporary_dir;
+		boost::optional<QString> d_raster_filename;
+		unsigned int d_num_worker_threads;
+
+		GPlatesModel::ModelInterface d_model;
+		GPlatesFileIO::FeatureCollectionFileFormat::Registry d_file_format_registry;
+
+		//! The loaded sample data files (keyed by absolute filename).
+		loaded_file_map_type d_loaded_files;
+	};
+}
+
+#endif // GPLATES_BENCH_BENCHMARKCONTEXT_H
@@ -0,0 +1,253 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <map>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+
+#include "BenchmarkResult.h"
+
+#include "file-io/ErrorOpeningFileForReadingException.h"
+#include "file-io/ErrorOpeningFileForWritingException.h"
+
+#include "global/Version.h"
+
+
+namespace GPlatesBench
+{
+	namespace
+	{
+		/**
+		 * Identifies the format of the results file.
+		 *
+		 * Increment the version if the format changes incompatibly.
+		 */
+		const char *RESULTS_FORMAT = "gplates-bench";
+		const int RESULTS_FORMAT_VERSION = 1;
+
+
+		const char *
+		get_scope_name(
+				Benchmark::Scope scope)
+		{
+			return scope == Benchmark::MICRO ? "micro" : "macro";
+		}
+
+		const char *
+		get_status_name(
+				BenchmarkResult::Status status)
+		{
+			switch (status)
+			{
+			case BenchmarkResult::SKIPPED:
+				return "skipped";
+			case BenchmarkResult::FAILED:
+				return "failed";
+			case BenchmarkResult::COMPLETED:
+			default:
+				break;
+			}
+
+			return "completed";
+		}
+
+
+		QJsonObject
+		to_json(
+				const BenchmarkResult &result)
+		{
+			QJsonObject json_result;
+
+			json_result["name"] = QString::fromStdString(result.name);
+			json_result["scope"] = get_scope_name(result.scope);
+			json_result["status"] = get_status_name(result.status);
+			if (!result.message.empty())
+			{
+				json_result["message"] = QString::fromStdString(result.message);
+			}
+
+			if (result.status == BenchmarkResult::COMPLETED)
+			{
+				json_result["iterations"] = static_cast<int>(result.iterations);
+				json_result["items_per_iteration"] = static_cast<double>(result.items_per_iteration);
+				json_result["min_seconds"] = result.min_seconds;
+				json_result["median_seconds"] = result.median_seconds;
+				json_result["mean_seconds"] = result.mean_seconds;
+				json_result["max_seconds"] = result.max_seconds;
+				if (result.median_seconds > 0)
+				{
+					json_result["items_per_second"] = result.items_per_iteration / result.median_seconds;
+				}
+			}
+
+			return json_result;
+		}
+
+
+		BenchmarkResult
+		from_json(
+				const QJsonObject &json_result)
+		{
+			BenchmarkResult result(
+					json_result["name"].toString().toStdString(),
+					json_result["scope"].toString() == "micro" ? Benchmark::MICRO : Benchmark::MACRO);
+
+			const QString status = json_result["status"].toString();
+			if (status == "skipped")
+			{
+				result.status = BenchmarkResult::SKIPPED;
+			}
+			else if (status == "failed")
+			{
+				result.status = BenchmarkResult::FAILED;
+			}
+			result.message = json_result["message"].toString().toStdString();
+
+			result.iterations = json_result["iterations"].toInt();
+			result.items_per_iteration = static_cast<unsigned int>(json_result["items_per_iteration"].toDouble());
+			result.min_seconds = json_result["min_seconds"].toDouble();
+			result.median_seconds = json_result["median_seconds"].toDouble();
+			result.mean_seconds = json_result["mean_seconds"].toDouble();
+			result.max_seconds = json_result["max_seconds"].toDouble();
+
+			return result;
+		}
+	}
+}
+
+
+void
+GPlatesBench::write_benchmark_results(
+		const QString &filename,
+		const benchmark_result_seq_type &results,
+		unsigned int num_worker_threads)
+{
+	QJsonArray json_results;
+	for (const BenchmarkResult &result : results)
+	{
+		json_results.append(to_json(result));
+	}
+
+	QJsonObject json_root;
+	json_root["format"] = RESULTS_FORMAT;
+	json_root["format_version"] = RESULTS_FORMAT_VERSION;
+	json_root["gplates_version"] = GPlatesGlobal::Version::get_GPlates_version();
+	json_root["num_worker_threads"] = static_cast<int>(num_worker_threads);
+	json_root["benchmarks"] = json_results;
+
+	QFile file(filename);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		throw GPlatesFileIO::ErrorOpeningFileForWritingException(GPLATES_EXCEPTION_SOURCE, filename);
+	}
+
+	file.write(QJsonDocument(json_root).toJson());
+}
+
+
+boost::optional<GPlatesBench::benchmark_result_seq_type>
+GPlatesBench::read_benchmark_results(
+		const QString &filename)
+{
+	QFile file(filename);
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		throw GPlatesFileIO::ErrorOpeningFileForReadingException(GPLATES_EXCEPTION_SOURCE, filename);
+	}
+
+	const QJsonDocument json_document = QJsonDocument::fromJson(file.readAll());
+	if (!json_document.isObject())
+	{
+		return boost::none;
+	}
+
+	const QJsonObject json_root = json_document.object();
+	if (json_root["format"].toString() != RESULTS_FORMAT ||
+		json_root["format_version"].toInt() > RESULTS_FORMAT_VERSION)
+	{
+		return boost::none;
+	}
+
+	benchmark_result_seq_type results;
+
+	const QJsonArray json_results = json_root["benchmarks"].toArray();
+	for (const QJsonValue &json_result : json_results)
+	{
+		results.push_back(from_json(json_result.toObject()));
+	}
+
+	return results;
+}
+
+
+GPlatesBench::benchmark_comparison_seq_type
+GPlatesBench::compare_benchmark_results(
+		const benchmark_result_seq_type &results,
+		const benchmark_result_seq_type &baseline_results,
+		double regression_threshold)
+{
+	std::map<std::string, const BenchmarkResult *> baseline_result_map;
+	for (const BenchmarkResult &baseline_result : baseline_results)
+	{
+		if (baseline_result.status == BenchmarkResult::COMPLETED)
+		{
+			baseline_result_map[baseline_result.name] = &baseline_result;
+		}
+	}
+
+	benchmark_comparison_seq_type comparisons;
+
+	for (const BenchmarkResult &result : results)
+	{
+		if (result.status != BenchmarkResult::COMPLETED)
+		{
+			continue;
+		}
+
+		std::map<std::string, const BenchmarkResult *>::const_iterator baseline_result_iter =
+				baseline_result_map.find(result.name);
+		if (baseline_result_iter == baseline_result_map.end() ||
+			baseline_result_iter->second->median_seconds <= 0)
+		{
+			continue;
+		}
+		const BenchmarkResult &baseline_result = *baseline_result_iter->second;
+
+		BenchmarkComparison comparison;
+		comparison.name = result.name;
+		comparison.baseline_median_seconds = baseline_result.median_seconds;
+		comparison.median_seconds = result.median_seconds;
+		comparison.ratio = result.median_seconds / baseline_result.median_seconds;
+		comparison.is_regression = comparison.ratio > 1 + regression_threshold;
+
+		comparisons.push_back(comparison);
+	}
+
+	return comparisons;
+}
@@ -0,0 +1,147 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef GPLATES_BENCH_BENCHMARKRESULT_H
+#define GPLATES_BENCH_BENCHMARKRESULT_H
+
+#include <string>
+#include <vector>
+#include <boost/optional.hpp>
+#include <QString>
+
+#include "Benchmark.h"
+
+
+namespace GPlatesBench
+{
+	/**
+	 * The timings of one benchmark.
+	 */
+	struct BenchmarkResult
+	{
+		enum Status
+		{
+			COMPLETED,
+			SKIPPED, //!< The benchmark could not be set up (eg, missing sample data).
+			FAILED   //!< The benchmark threw an exception.
+		};
+
+
+		BenchmarkResult(
+				const std::string &name_,
+				Benchmark::Scope scope_) :
+			name(name_),
+			scope(scope_),
+			status(COMPLETED),
+			iterations(0),
+			items_per_iteration(0),
+			min_seconds(0),
+			median_seconds(0),
+			mean_seconds(0),
+			max_seconds(0)
+		{  }
+
+
+		std::string name;
+		Benchmark::Scope scope;
+		Status status;
+		std::string message; //!< Reason for being skipped, or exception message if failed.
+
+		unsigned int iterations;
+		unsigned int items_per_iteration;
+
+		double min_seconds;
+		double median_seconds;
+		double mean_seconds;
+		double max_seconds;
+	};
+
+	//! Typedef for a sequence of benchmark results.
+	typedef std::vector<BenchmarkResult> benchmark_result_seq_type;
+
+
+	/**
+	 * Compares a completed benchmark with the same benchmark in the baseline results.
+	 */
+	struct BenchmarkComparison
+	{
+		std::string name;
+		double baseline_median_seconds;
+		double median_seconds;
+
+		//! Ratio of the current median time to the baseline median time (greater than 1 is slower).
+		double ratio;
+
+		//! Whether the ratio exceeds the regression threshold.
+		bool is_regression;
+	};
+
+	//! Typedef for a sequence of benchmark comparisons.
+	typedef std::vector<BenchmarkComparison> benchmark_comparison_seq_type;
+
+
+	/**
+	 * Writes @a results to the JSON file @a filename.
+	 *
+	 * The file also records the number of worker threads and the GPlates version
+	 * (so that a baseline can be matched to the build it came from).
+	 *
+	 * Throws ErrorOpeningFileForWritingException if the file could not be opened.
+	 */
+	void
+	write_benchmark_results(
+			const QString &filename,
+			const benchmark_result_seq_type &results,
+			unsigned int num_worker_threads);
+
+
+	/**
+	 * Reads the results previously written by @a write_benchmark_results.
+	 *
+	 * Returns boost::none if the file does not contain benchmark results.
+	 *
+	 * Throws ErrorOpeningFileForReadingException if the file could not be opened.
+	 */
+	boost::optional<benchmark_result_seq_type>
+	read_benchmark_results(
+			const QString &filename);
+
+
+	/**
+	 * Compares the completed benchmarks in @a results with those of the same name in @a baseline_results.
+	 *
+	 * A benchmark is a regression if its median time exceeds the baseline median time by more than
+	 * @a regression_threshold (a fraction, such as 0.1 for 10%). Benchmarks missing from the baseline
+	 * (or not completed in either) are not compared.
+	 */
+	benchmark_comparison_seq_type
+	compare_benchmark_results(
+			const benchmark_result_seq_type &results,
+			const benchmark_result_seq_type &baseline_results,
+			double regression_threshold);
+}
+
+#endif // GPLATES_BENCH_BENCHMARKRESULT_H
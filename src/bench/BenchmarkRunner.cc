@@ -0,0 +1,111 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include "BenchmarkRunner.h"
+
+#include "global/GPlatesException.h"
+
+
+GPlatesBench::BenchmarkRunner::BenchmarkRunner(
+		unsigned int num_warmup_iterations,
+		unsigned int num_iterations) :
+	d_num_warmup_iterations(num_warmup_iterations),
+	d_num_iterations((std::max)(num_iterations, 1U))
+{
+}
+
+
+GPlatesBench::BenchmarkResult
+GPlatesBench::BenchmarkRunner::run(
+		Benchmark &benchmark,
+		BenchmarkContext &context) const
+{
+	BenchmarkResult result(benchmark.get_name(), benchmark.get_scope());
+
+	try
+	{
+		const boost::optional<std::string> skip_reason = benchmark.set_up(context);
+		if (skip_reason)
+		{
+			result.status = BenchmarkResult::SKIPPED;
+			result.message = skip_reason.get();
+			benchmark.tear_down();
+			return result;
+		}
+
+		for (unsigned int n = 0; n < d_num_warmup_iterations; ++n)
+		{
+			benchmark.run();
+		}
+
+		std::vector<double> iteration_seconds;
+		iteration_seconds.reserve(d_num_iterations);
+		for (unsigned int n = 0; n < d_num_iterations; ++n)
+		{
+			const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+			result.items_per_iteration = benchmark.run();
+			const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+
+			iteration_seconds.push_back(std::chrono::duration<double>(end_time - start_time).count());
+		}
+
+		benchmark.tear_down();
+
+		std::sort(iteration_seconds.begin(), iteration_seconds.end());
+
+		const unsigned int num_iterations = iteration_seconds.size();
+		result.iterations = num_iterations;
+		result.min_seconds = iteration_seconds.front();
+		result.max_seconds = iteration_seconds.back();
+		result.mean_seconds =
+				std::accumulate(iteration_seconds.begin(), iteration_seconds.end(), 0.0) / num_iterations;
+		result.median_seconds = (num_iterations % 2)
+				? iteration_seconds[num_iterations / 2]
+				: 0.5 * (iteration_seconds[num_iterations / 2 - 1] + iteration_seconds[num_iterations / 2]);
+	}
+	catch (const GPlatesGlobal::Exception &exc)
+	{
+		std::ostringstream message;
+		exc.write(message);
+
+		result.status = BenchmarkResult::FAILED;
+		result.message = message.str();
+	}
+	catch (const std::exception &exc)
+	{
+		result.status = BenchmarkResult::FAILED;
+		result.message = exc.what();
+	}
+
+	return result;
+}
@@ -0,0 +1,75 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef GPLATES_BENCH_BENCHMARKRUNNER_H
+#define GPLATES_BENCH_BENCHMARKRUNNER_H
+
+#include "Benchmark.h"
+#include "BenchmarkResult.h"
+
+
+namespace GPlatesBench
+{
+	class BenchmarkContext;
+
+
+	/**
+	 * Times benchmarks over a fixed number of iterations.
+	 *
+	 * A fixed number of iterations (rather than running for a fixed duration) means each run of
+	 * 'gplates-bench' does the same work, so the results of different runs can be compared.
+	 */
+	class BenchmarkRunner
+	{
+	public:
+
+		/**
+		 * Each benchmark is run @a num_warmup_iterations times (untimed) before being timed
+		 * over @a num_iterations iterations.
+		 */
+		BenchmarkRunner(
+				unsigned int num_warmup_iterations,
+				unsigned int num_iterations);
+
+
+		/**
+		 * Sets up, times and tears down @a benchmark.
+		 *
+		 * Exceptions thrown by the benchmark are caught and reported as a failed result.
+		 */
+		BenchmarkResult
+		run(
+				Benchmark &benchmark,
+				BenchmarkContext &context) const;
+
+	private:
+
+		unsigned int d_num_warmup_iterations;
+		unsigned int d_num_iterations;
+	};
+}
+
+#endif // GPLATES_BENCH_BENCHMARKRUNNER_H
@@ -0,0 +1,184 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <vector>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <QStringList>
+
+#include "CoRegistrationBenchmarks.h"
+
+#include "BenchmarkContext.h"
+
+#include "app-logic/ReconstructContext.h"
+#include "app-logic/ReconstructionTreeCreator.h"
+#include "app-logic/ReconstructMethodRegistry.h"
+#include "app-logic/ReconstructUtils.h"
+
+#include "data-mining/CoRegTargetSpatialPartition.h"
+#include "data-mining/DataMiningUtils.h"
+
+
+namespace GPlatesBench
+{
+	namespace
+	{
+		/**
+		 * The region-of-interest ranges (in Kms) used to co-register each seed feature.
+		 *
+		 * As with co-registration, the smaller range only tests the targets found within the larger range.
+		 */
+		const double LARGE_REGION_OF_INTEREST_RANGE = 2000.0;
+		const double SMALL_REGION_OF_INTEREST_RANGE = 500.0;
+
+
+		/**
+		 * Finds the target geometries within the region-of-interest of each seed feature
+		 * (the most expensive part of co-registering geometries).
+		 *
+		 * This includes spatially partitioning the target geometries (which co-registration does each frame).
+		 * The seed and target features are reconstructed in @a set_up.
+		 */
+		class RegionOfInterestBenchmark :
+				public Benchmark
+		{
+		public:
+
+			RegionOfInterestBenchmark() :
+				Benchmark("coregistration/region_of_interest", MACRO)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> rotation_features =
+						context.load_sample_data(
+								QStringList() << "plates4-rotation-files/rotations_about_axes.rot");
+
+				const QStringList seed_files = QStringList()
+						<< "gpml/co_reg_seed.gpml"
+						<< context.get_sample_data_filenames("plates4-line-files", QStringList() << "*.dat");
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> seed_features =
+						context.load_sample_data(seed_files);
+
+				const QStringList target_files = QStringList()
+						<< "gpml/co_reg_target.gpml"
+						<< context.get_sample_data_filenames("unit-test-data", QStringList() << "33.mesh.*.gpml.gz");
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> target_features =
+						context.load_sample_data(target_files);
+
+				if (!rotation_features || !seed_features || !target_features)
+				{
+					return std::string("missing co-registration sample data");
+				}
+
+				const GPlatesAppLogic::ReconstructionTreeCreator reconstruction_tree_creator =
+						GPlatesAppLogic::create_cached_reconstruction_tree_creator(rotation_features.get());
+				const double reconstruction_time = 10.0;
+
+				d_reconstructed_seed_features.clear();
+				GPlatesAppLogic::ReconstructUtils::reconstruct(
+						d_reconstructed_seed_features,
+						reconstruction_time,
+						d_reconstruct_method_registry,
+						seed_features.get(),
+						reconstruction_tree_creator);
+
+				d_reconstructed_target_features.clear();
+				GPlatesAppLogic::ReconstructUtils::reconstruct(
+						d_reconstructed_target_features,
+						reconstruction_time,
+						d_reconstruct_method_registry,
+						target_features.get(),
+						reconstruction_tree_creator);
+
+				for (const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature :
+					d_reconstructed_seed_features)
+				{
+					GPlatesDataMining::DataMiningUtils::prepare_for_concurrent_distance_queries(reconstructed_seed_feature);
+				}
+
+				return boost::none;
+			}
+
+			unsigned int
+			run() override
+			{
+				const boost::shared_ptr<GPlatesDataMining::CoRegTargetSpatialPartition> target_spatial_partition =
+						GPlatesDataMining::CoRegTargetSpatialPartition::create(d_reconstructed_target_features);
+
+				unsigned int num_targets_in_region_of_interest = 0;
+				for (const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature :
+					d_reconstructed_seed_features)
+				{
+					if (reconstructed_seed_feature.get_reconstructions().empty())
+					{
+						continue;
+					}
+
+					GPlatesDataMining::CoRegTargetSpatialPartition::target_geometry_index_seq_type large_range_targets;
+					target_spatial_partition->find_target_geometries_in_region_of_interest(
+							large_range_targets,
+							reconstructed_seed_feature,
+							LARGE_REGION_OF_INTEREST_RANGE);
+
+					GPlatesDataMining::CoRegTargetSpatialPartition::target_geometry_index_seq_type small_range_targets;
+					target_spatial_partition->find_target_geometries_in_region_of_interest(
+							small_range_targets,
+							reconstructed_seed_feature,
+							SMALL_REGION_OF_INTEREST_RANGE,
+							large_range_targets);
+
+					num_targets_in_region_of_interest += large_range_targets.size() + small_range_targets.size();
+				}
+
+				return num_targets_in_region_of_interest;
+			}
+
+			void
+			tear_down() override
+			{
+				d_reconstructed_seed_features.clear();
+				d_reconstructed_target_features.clear();
+			}
+
+		private:
+
+			GPlatesAppLogic::ReconstructMethodRegistry d_reconstruct_method_registry;
+			std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> d_reconstructed_seed_features;
+			std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> d_reconstructed_target_features;
+		};
+	}
+}
+
+
+void
+GPlatesBench::add_co_registration_benchmarks(
+		benchmark_seq_type &benchmarks)
+{
+	benchmarks.push_back(boost::make_shared<RegionOfInterestBenchmark>());
+}
@@ -0,0 +1,164 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <boost/make_shared.hpp>
+#include <QDir>
+#include <QFileInfo>
+#include <QStringList>
+
+#include "FileIoBenchmarks.h"
+
+#include "BenchmarkContext.h"
+
+#include "file-io/File.h"
+#include "file-io/FileInfo.h"
+#include "file-io/ReadErrorAccumulation.h"
+
+
+namespace GPlatesBench
+{
+	namespace
+	{
+		/**
+		 * Loads feature collection files (into new feature collections each iteration).
+		 */
+		class FileLoadBenchmark :
+				public Benchmark
+		{
+		public:
+
+			/**
+			 * The files in the sample data sub-directory @a relative_dir matching @a name_filter are loaded.
+			 *
+			 * If @a save_as_gdat is true then the files are first saved (in @a set_up) in the binary
+			 * 'gdat' format and those files are loaded instead.
+			 */
+			FileLoadBenchmark(
+					const std::string &name,
+					const QString &relative_dir,
+					const QString &name_filter,
+					bool save_as_gdat = false) :
+				Benchmark(name, MICRO),
+				d_relative_dir(relative_dir),
+				d_name_filter(name_filter),
+				d_save_as_gdat(save_as_gdat),
+				d_file_format_registry(NULL)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				const QStringList relative_filenames =
+						context.get_sample_data_filenames(d_relative_dir, QStringList() << d_name_filter);
+				if (relative_filenames.isEmpty())
+				{
+					return std::string("missing sample data");
+				}
+
+				d_file_format_registry = &context.get_file_format_registry();
+
+				d_filenames.clear();
+				for (const QString &relative_filename : relative_filenames)
+				{
+					const QString filename = context.get_sample_data_filename(relative_filename);
+
+					if (!d_save_as_gdat)
+					{
+						d_filenames.append(filename);
+						continue;
+					}
+
+					const boost::optional<BenchmarkContext::feature_collection_seq_type> feature_collections =
+							context.load_sample_data(QStringList() << relative_filename);
+					if (!feature_collections)
+					{
+						return std::string("missing sample data");
+					}
+
+					const QString gdat_filename = QDir(context.get_temporary_dir()).absoluteFilePath(
+							QFileInfo(filename).completeBaseName() + ".gdat");
+					const GPlatesFileIO::File::Reference::non_null_ptr_type gdat_file_ref =
+							GPlatesFileIO::File::create_file_reference(
+									GPlatesFileIO::FileInfo(gdat_filename),
+									feature_collections->front());
+					d_file_format_registry->write_feature_collection(*gdat_file_ref);
+
+					d_filenames.append(gdat_filename);
+				}
+
+				return boost::none;
+			}
+
+			unsigned int
+			run() override
+			{
+				unsigned int num_features = 0;
+				for (const QString &filename : d_filenames)
+				{
+					GPlatesFileIO::File::non_null_ptr_type file =
+							GPlatesFileIO::File::create_file(GPlatesFileIO::FileInfo(filename));
+					GPlatesFileIO::ReadErrorAccumulation read_errors;
+					d_file_format_registry->read_feature_collection(file->get_reference(), read_errors);
+
+					num_features += file->get_reference().get_feature_collection()->size();
+				}
+
+				return num_features;
+			}
+
+			void
+			tear_down() override
+			{
+				d_filenames.clear();
+			}
+
+		private:
+
+			QString d_relative_dir;
+			QString d_name_filter;
+			bool d_save_as_gdat;
+
+			GPlatesFileIO::FeatureCollectionFileFormat::Registry *d_file_format_registry;
+			QStringList d_filenames;
+		};
+	}
+}
+
+
+void
+GPlatesBench::add_file_io_benchmarks(
+		benchmark_seq_type &benchmarks)
+{
+	benchmarks.push_back(
+			boost::make_shared<FileLoadBenchmark>("file_io/gpml_load", "gpml", "all_caps.gpml"));
+	benchmarks.push_back(
+			boost::make_shared<FileLoadBenchmark>("file_io/gpmlz_load", "unit-test-data", "129.mesh.*.gpml.gz"));
+	benchmarks.push_back(
+			boost::make_shared<FileLoadBenchmark>("file_io/gdat_load", "gpml", "all_caps.gpml", true/*save_as_gdat*/));
+	benchmarks.push_back(
+			boost::make_shared<FileLoadBenchmark>("file_io/shapefile_load", "shapefiles", "*.shp"));
+}
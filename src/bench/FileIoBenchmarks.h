@@ -0,0 +1,44 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef GPLATES_BENCH_FILEIOBENCHMARKS_H
+#define GPLATES_BENCH_FILEIOBENCHMARKS_H
+
+#include "Benchmark.h"
+
+
+namespace GPlatesBench
+{
+	/**
+	 * Adds the feature collection file loading (GPML, compressed GPML, binary 'gdat' and shapefile)
+	 * benchmarks to @a benchmarks.
+	 */
+	void
+	add_file_io_benchmarks(
+			benchmark_seq_type &benchmarks);
+}
+
+#endif // GPLATES_BENCH_FILEIOBENCHMARKS_H
@@ -0,0 +1,206 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <cmath>
+#include <vector>
+#include <boost/make_shared.hpp>
+#include <QStringList>
+
+#include "MathsBenchmarks.h"
+
+#include "BenchmarkContext.h"
+
+#include "app-logic/GeometryUtils.h"
+#include "app-logic/ReconstructedFeatureGeometry.h"
+#include "app-logic/ReconstructUtils.h"
+
+#include "maths/LatLonPoint.h"
+#include "maths/MathsUtils.h"
+#include "maths/PointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/UnitVector3D.h"
+
+
+namespace GPlatesBench
+{
+	namespace
+	{
+		/**
+		 * Number of vertices in the synthesized (densely sampled) polygon.
+		 */
+		const unsigned int NUM_STAR_POLYGON_VERTICES = 10000;
+
+
+		/**
+		 * Creates a star-shaped polygon centred on (lat,lon) = (0,0) whose vertices alternate
+		 * between radii of 30 and 40 degrees (so that it is not convex).
+		 */
+		GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type
+		create_star_polygon()
+		{
+			std::vector<GPlatesMaths::PointOnSphere> vertices;
+			vertices.reserve(NUM_STAR_POLYGON_VERTICES);
+
+			for (unsigned int n = 0; n < NUM_STAR_POLYGON_VERTICES; ++n)
+			{
+				const double azimuth = 2 * GPlatesMaths::PI * n / NUM_STAR_POLYGON_VERTICES;
+				const double radius = GPlatesMaths::convert_deg_to_rad((n % 2) ? 40.0 : 30.0);
+
+				vertices.push_back(
+						GPlatesMaths::PointOnSphere(
+								GPlatesMaths::UnitVector3D(
+										std::cos(radius),
+										std::sin(radius) * std::sin(azimuth),
+										std::sin(radius) * std::cos(azimuth),
+										false/*check_validity*/)));
+			}
+
+			return GPlatesMaths::PolygonOnSphere::create(vertices);
+		}
+
+
+		/**
+		 * Tests the points of a global 1 degree lat-lon grid against the polygons in the
+		 * sample data (and a densely sampled synthesized polygon).
+		 *
+		 * The polygons are created in @a set_up (and the first iteration is a warmup iteration)
+		 * so the once-off set up cost of the point-in-polygon speed is not timed.
+		 */
+		class PointInPolygonBenchmark :
+				public Benchmark
+		{
+		public:
+
+			PointInPolygonBenchmark(
+					const std::string &name,
+					GPlatesMaths::PolygonOnSphere::PointInPolygonSpeedAndMemory speed_and_memory) :
+				Benchmark(name, MICRO),
+				d_speed_and_memory(speed_and_memory)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				const QStringList polygon_files =
+						context.get_sample_data_filenames("plates4-line-files", QStringList() << "*polygon*.dat");
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> polygon_features =
+						context.load_sample_data(polygon_files);
+				if (!polygon_features || polygon_files.isEmpty())
+				{
+					return std::string("missing polygon sample data");
+				}
+
+				// The present day polygons (they have no rotations so reconstruct using an empty rotation model).
+				std::vector<GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type> reconstructed_feature_geometries;
+				GPlatesAppLogic::ReconstructUtils::reconstruct(
+						reconstructed_feature_geometries,
+						0.0/*reconstruction_time*/,
+						0/*anchor_plate_id*/,
+						polygon_features.get(),
+						BenchmarkContext::feature_collection_seq_type());
+
+				// Create new polygons since a polygon's point-in-polygon speed cannot be decreased
+				// (and other benchmarks might share the same polygons).
+				d_polygons.clear();
+				for (const GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type &rfg :
+					reconstructed_feature_geometries)
+				{
+					boost::optional<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> polygon =
+							GPlatesAppLogic::GeometryUtils::get_polygon_on_sphere(*rfg->reconstructed_geometry());
+					if (polygon)
+					{
+						d_polygons.push_back(
+								GPlatesMaths::PolygonOnSphere::create(
+										polygon.get()->exterior_ring_vertex_begin(),
+										polygon.get()->exterior_ring_vertex_end()));
+					}
+				}
+				d_polygons.push_back(create_star_polygon());
+
+				d_grid_points.clear();
+				for (int lat = -90; lat <= 90; ++lat)
+				{
+					for (int lon = -180; lon < 180; ++lon)
+					{
+						d_grid_points.push_back(
+								GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(lat, lon)));
+					}
+				}
+
+				return boost::none;
+			}
+
+			unsigned int
+			run() override
+			{
+				unsigned int num_tests = 0;
+				for (const GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type &polygon : d_polygons)
+				{
+					for (const GPlatesMaths::PointOnSphere &grid_point : d_grid_points)
+					{
+						polygon->is_point_in_polygon(grid_point, d_speed_and_memory);
+					}
+					num_tests += d_grid_points.size();
+				}
+
+				return num_tests;
+			}
+
+			void
+			tear_down() override
+			{
+				d_polygons.clear();
+				d_grid_points.clear();
+			}
+
+		private:
+
+			GPlatesMaths::PolygonOnSphere::PointInPolygonSpeedAndMemory d_speed_and_memory;
+			std::vector<GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type> d_polygons;
+			std::vector<GPlatesMaths::PointOnSphere> d_grid_points;
+		};
+	}
+}
+
+
+void
+GPlatesBench::add_maths_benchmarks(
+		benchmark_seq_type &benchmarks)
+{
+	benchmarks.push_back(
+			boost::make_shared<PointInPolygonBenchmark>(
+					"maths/point_in_polygon_low_speed",
+					GPlatesMaths::PolygonOnSphere::LOW_SPEED_NO_SETUP_NO_MEMORY_USAGE));
+	benchmarks.push_back(
+			boost::make_shared<PointInPolygonBenchmark>(
+					"maths/point_in_polygon_medium_speed",
+					GPlatesMaths::PolygonOnSphere::MEDIUM_SPEED_MEDIUM_SETUP_MEDIUM_MEMORY_USAGE));
+	benchmarks.push_back(
+			boost::make_shared<PointInPolygonBenchmark>(
+					"maths/point_in_polygon_high_speed",
+					GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE));
+}
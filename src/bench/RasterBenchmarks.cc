@@ -0,0 +1,207 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <algorithm>
+#include <utility>
+#include <boost/make_shared.hpp>
+#include <QDir>
+#include <QImage>
+#include <QString>
+
+#include "RasterBenchmarks.h"
+
+#include "BenchmarkContext.h"
+
+#include "file-io/RasterReader.h"
+#include "file-io/ReadErrorAccumulation.h"
+
+#include "property-values/ProxiedRasterResolver.h"
+#include "property-values/RawRaster.h"
+
+
+namespace GPlatesBench
+{
+	namespace
+	{
+		//! Dimensions of the raster generated when a raster file is not specified.
+		const int GENERATED_RASTER_WIDTH = 4096;
+		const int GENERATED_RASTER_HEIGHT = 2048;
+
+		//! The dimension of the (square) tiles read from each mipmap level.
+		const unsigned int TILE_DIMENSION = 256;
+
+
+		/**
+		 * Generates a global RGBA raster (with a repeatable pattern) and returns its filename.
+		 *
+		 * Returns boost::none if the raster could not be written.
+		 */
+		boost::optional<QString>
+		generate_raster(
+				const QString &dir)
+		{
+			QImage image(GENERATED_RASTER_WIDTH, GENERATED_RASTER_HEIGHT, QImage::Format_ARGB32);
+			for (int y = 0; y < GENERATED_RASTER_HEIGHT; ++y)
+			{
+				QRgb *const scanline = reinterpret_cast<QRgb *>(image.scanLine(y));
+				for (int x = 0; x < GENERATED_RASTER_WIDTH; ++x)
+				{
+					scanline[x] = qRgba(x & 0xff, y & 0xff, (x ^ y) & 0xff, 0xff);
+				}
+			}
+
+			const QString filename = QDir(dir).absoluteFilePath("bench_raster.png");
+			if (!image.save(filename, "PNG"))
+			{
+				return boost::none;
+			}
+
+			return filename;
+		}
+
+
+		/**
+		 * Reads every mipmap level of a raster (in tiles) from the raster file cache.
+		 *
+		 * The raster file cache (mipmap file) is generated in @a set_up (if it does not already exist)
+		 * so only reading the cache is timed.
+		 *
+		 * Uses the raster specified on the command-line, otherwise a raster generated in the temporary
+		 * directory (the sample data contains no rasters).
+		 */
+		class RasterCacheReadBenchmark :
+				public Benchmark
+		{
+		public:
+
+			RasterCacheReadBenchmark() :
+				Benchmark("raster/cache_read", MACRO),
+				d_raster_width(0),
+				d_raster_height(0)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				boost::optional<QString> raster_filename = context.get_raster_filename();
+				if (!raster_filename)
+				{
+					raster_filename = generate_raster(context.get_temporary_dir());
+					if (!raster_filename)
+					{
+						return std::string("unable to generate raster");
+					}
+				}
+
+				GPlatesFileIO::ReadErrorAccumulation read_errors;
+				GPlatesFileIO::RasterReader::non_null_ptr_type raster_reader =
+						GPlatesFileIO::RasterReader::create(raster_filename.get(), &read_errors);
+				if (!raster_reader->can_read() ||
+					raster_reader->get_number_of_bands(&read_errors) == 0)
+				{
+					return std::string("unable to read raster");
+				}
+
+				const std::pair<unsigned int, unsigned int> raster_size = raster_reader->get_size(&read_errors);
+				d_raster_width = raster_size.first;
+				d_raster_height = raster_size.second;
+
+				boost::optional<GPlatesPropertyValues::RawRaster::non_null_ptr_type> proxied_raw_raster =
+						raster_reader->get_proxied_raw_raster(1/*band_number*/, &read_errors);
+				if (!proxied_raw_raster)
+				{
+					return std::string("unable to read raster band");
+				}
+
+				d_proxied_raster_resolver =
+						GPlatesPropertyValues::ProxiedRasterResolver::create(proxied_raw_raster.get());
+				if (!d_proxied_raster_resolver ||
+					!d_proxied_raster_resolver.get()->ensure_mipmaps_available())
+				{
+					return std::string("unable to create raster file cache");
+				}
+
+				return boost::none;
+			}
+
+			unsigned int
+			run() override
+			{
+				unsigned int num_tiles = 0;
+
+				unsigned int level_width = d_raster_width;
+				unsigned int level_height = d_raster_height;
+
+				const unsigned int num_levels = d_proxied_raster_resolver.get()->get_number_of_levels();
+				for (unsigned int level = 0; level < num_levels; ++level)
+				{
+					for (unsigned int y = 0; y < level_height; y += TILE_DIMENSION)
+					{
+						for (unsigned int x = 0; x < level_width; x += TILE_DIMENSION)
+						{
+							if (d_proxied_raster_resolver.get()->get_region_from_level(
+									level,
+									x,
+									y,
+									(std::min)(TILE_DIMENSION, level_width - x),
+									(std::min)(TILE_DIMENSION, level_height - y)))
+							{
+								++num_tiles;
+							}
+						}
+					}
+
+					// Same as the mipmapper (each level is half the size, rounded up, of the previous level).
+					level_width = (level_width >> 1) + (level_width & 1);
+					level_height = (level_height >> 1) + (level_height & 1);
+				}
+
+				return num_tiles;
+			}
+
+			void
+			tear_down() override
+			{
+				d_proxied_raster_resolver = boost::none;
+			}
+
+		private:
+
+			boost::optional<GPlatesPropertyValues::ProxiedRasterResolver::non_null_ptr_type> d_proxied_raster_resolver;
+			unsigned int d_raster_width;
+			unsigned int d_raster_height;
+		};
+	}
+}
+
+
+void
+GPlatesBench::add_raster_benchmarks(
+		benchmark_seq_type &benchmarks)
+{
+	benchmarks.push_back(boost::make_shared<RasterCacheReadBenchmark>());
+}
@@ -1,11 +1,11 @@
 /* $Id$ */
 
 /**
- * \file 
+ * \file
  * $Revision$
  * $Date$
- * 
- * Copyright (C) 2012 The University of Sydney, Australia
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
  *
  * This file is part of GPlates.
  *
@@ -23,17 +23,21 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <ostream>
 
-#include "GpgimInitialisationException.h"
+#ifndef GPLATES_BENCH_RASTERBENCHMARKS_H
+#define GPLATES_BENCH_RASTERBENCHMARKS_H
+
+#include "Benchmark.h"
 
 
-void
-GPlatesModel::GpgimInitialisationException::write_message(
-		std::ostream &os) const
+namespace GPlatesBench
 {
-	os
-		<< "Error initialising GPGIM from file '" << d_gpgim_filename.toStdString()
-		<< "' at line '" << d_line_number
-		<< "': " << d_msg.toStdString();
+	/**
+	 * Adds the raster file cache (mipmap) read benchmark to @a benchmarks.
+	 */
+	void
+	add_raster_benchmarks(
+			benchmark_seq_type &benchmarks);
 }
+
+#endif // GPLATES_BENCH_RASTERBENCHMARKS_H
@@ -0,0 +1,342 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <vector>
+#include <boost/make_shared.hpp>
+#include <QStringList>
+
+#include "ReconstructionBenchmarks.h"
+
+#include "BenchmarkContext.h"
+
+#include "app-logic/ReconstructContext.h"
+#include "app-logic/ReconstructedFeatureGeometry.h"
+#include "app-logic/ReconstructionGraph.h"
+#include "app-logic/ReconstructionTree.h"
+#include "app-logic/ReconstructionTreeCreator.h"
+#include "app-logic/ReconstructMethodInterface.h"
+#include "app-logic/ReconstructMethodRegistry.h"
+#include "app-logic/ReconstructParams.h"
+#include "app-logic/ReconstructUtils.h"
+
+
+namespace GPlatesBench
+{
+	namespace
+	{
+		//! The rotation files used by the reconstruction benchmarks.
+		const QStringList ROTATION_FILES = QStringList()
+				<< "plates4-rotation-files/rotations_about_axes.rot"
+				<< "plates4-rotation-files/grot_example.grot";
+
+		//! Reconstruction times are from zero to this time (inclusive).
+		const double MAX_RECONSTRUCTION_TIME = 100.0;
+
+
+		/**
+		 * Loads the rotation features and reconstructable features used by the rigid reconstruct benchmarks.
+		 *
+		 * Returns the reason for skipping the benchmark if the sample data is missing.
+		 */
+		boost::optional<std::string>
+		load_rigid_reconstruct_sample_data(
+				BenchmarkContext &context,
+				BenchmarkContext::feature_collection_seq_type &rotation_features,
+				BenchmarkContext::feature_collection_seq_type &reconstructable_features)
+		{
+			const boost::optional<BenchmarkContext::feature_collection_seq_type> loaded_rotation_features =
+					context.load_sample_data(ROTATION_FILES);
+			if (!loaded_rotation_features)
+			{
+				return std::string("missing rotation sample data");
+			}
+			rotation_features = loaded_rotation_features.get();
+
+			// The plates4 line files, the shapefiles and the (large) velocity mesh point files.
+			const QStringList reconstructable_files = QStringList()
+					<< context.get_sample_data_filenames("plates4-line-files", QStringList() << "*.dat")
+					<< context.get_sample_data_filenames("shapefiles", QStringList() << "*.shp")
+					<< context.get_sample_data_filenames("unit-test-data", QStringList() << "129.mesh.*.gpml.gz");
+			const boost::optional<BenchmarkContext::feature_collection_seq_type> loaded_reconstructable_features =
+					context.load_sample_data(reconstructable_files);
+			if (!loaded_reconstructable_features || reconstructable_files.isEmpty())
+			{
+				return std::string("missing reconstructable sample data");
+			}
+			reconstructable_features = loaded_reconstructable_features.get();
+
+			return boost::none;
+		}
+
+
+		/**
+		 * Creates a reconstruction graph from the rotation files.
+		 */
+		class GraphBuildBenchmark :
+				public Benchmark
+		{
+		public:
+
+			GraphBuildBenchmark() :
+				Benchmark("reconstruction/graph_build", MICRO),
+				d_num_rotation_features(0)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> rotation_features =
+						context.load_sample_data(ROTATION_FILES);
+				if (!rotation_features)
+				{
+					return std::string("missing rotation sample data");
+				}
+				d_rotation_features = rotation_features.get();
+
+				d_num_rotation_features = 0;
+				for (const GPlatesModel::FeatureCollectionHandle::weak_ref &rotation_feature_collection : d_rotation_features)
+				{
+					d_num_rotation_features += rotation_feature_collection->size();
+				}
+
+				return boost::none;
+			}
+
+			unsigned int
+			run() override
+			{
+				GPlatesAppLogic::create_reconstruction_graph(d_rotation_features);
+
+				return d_num_rotation_features;
+			}
+
+			void
+			tear_down() override
+			{
+				d_rotation_features.clear();
+			}
+
+		private:
+
+			BenchmarkContext::feature_collection_seq_type d_rotation_features;
+			unsigned int d_num_rotation_features;
+		};
+
+
+		/**
+		 * Creates reconstruction trees (from an existing reconstruction graph) at 1My intervals.
+		 */
+		class TreeBuildBenchmark :
+				public Benchmark
+		{
+		public:
+
+			TreeBuildBenchmark() :
+				Benchmark("reconstruction/tree_build", MICRO)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> rotation_features =
+						context.load_sample_data(ROTATION_FILES);
+				if (!rotation_features)
+				{
+					return std::string("missing rotation sample data");
+				}
+				d_reconstruction_graph = GPlatesAppLogic::create_reconstruction_graph(rotation_features.get());
+
+				return boost::none;
+			}
+
+			unsigned int
+			run() override
+			{
+				unsigned int num_trees = 0;
+				for (double reconstruction_time = 0; reconstruction_time <= MAX_RECONSTRUCTION_TIME; reconstruction_time += 1.0)
+				{
+					GPlatesAppLogic::ReconstructionTree::create(
+							d_reconstruction_graph.get(),
+							reconstruction_time,
+							0/*anchor_plate_id*/);
+					++num_trees;
+				}
+
+				return num_trees;
+			}
+
+			void
+			tear_down() override
+			{
+				d_reconstruction_graph = boost::none;
+			}
+
+		private:
+
+			boost::optional<GPlatesAppLogic::ReconstructionGraph::non_null_ptr_to_const_type> d_reconstruction_graph;
+		};
+
+
+		/**
+		 * Rigidly reconstructs the sample data geometries at 10My intervals.
+		 *
+		 * This includes the reconstruction tree creation (as would happen when animating).
+		 */
+		class RigidReconstructBenchmark :
+				public Benchmark
+		{
+		public:
+
+			RigidReconstructBenchmark() :
+				Benchmark("reconstruction/rigid_reconstruct", MACRO)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				return load_rigid_reconstruct_sample_data(context, d_rotation_features, d_reconstructable_features);
+			}
+
+			unsigned int
+			run() override
+			{
+				// Create a new reconstruction tree creator each iteration so that its cached trees are not reused.
+				const GPlatesAppLogic::ReconstructionTreeCreator reconstruction_tree_creator =
+						GPlatesAppLogic::create_cached_reconstruction_tree_creator(d_rotation_features);
+
+				unsigned int num_reconstructed_feature_geometries = 0;
+				for (double reconstruction_time = 0; reconstruction_time <= MAX_RECONSTRUCTION_TIME; reconstruction_time += 10.0)
+				{
+					std::vector<GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type> reconstructed_feature_geometries;
+					GPlatesAppLogic::ReconstructUtils::reconstruct(
+							reconstructed_feature_geometries,
+							reconstruction_time,
+							d_reconstruct_method_registry,
+							d_reconstructable_features,
+							reconstruction_tree_creator);
+
+					num_reconstructed_feature_geometries += reconstructed_feature_geometries.size();
+				}
+
+				return num_reconstructed_feature_geometries;
+			}
+
+			void
+			tear_down() override
+			{
+				d_rotation_features.clear();
+				d_reconstructable_features.clear();
+			}
+
+		private:
+
+			GPlatesAppLogic::ReconstructMethodRegistry d_reconstruct_method_registry;
+			BenchmarkContext::feature_collection_seq_type d_rotation_features;
+			BenchmarkContext::feature_collection_seq_type d_reconstructable_features;
+		};
+
+
+		/**
+		 * Same as @a RigidReconstructBenchmark but uses the bulk reconstruction (flat arrays of
+		 * reconstructed points) instead of creating a @a ReconstructedFeatureGeometry per geometry.
+		 */
+		class BulkReconstructBenchmark :
+				public Benchmark
+		{
+		public:
+
+			BulkReconstructBenchmark() :
+				Benchmark("reconstruction/bulk_reconstruct", MACRO)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				return load_rigid_reconstruct_sample_data(context, d_rotation_features, d_reconstructable_features);
+			}
+
+			unsigned int
+			run() override
+			{
+				// Create a new reconstruction tree creator each iteration so that its cached trees are not reused.
+				const GPlatesAppLogic::ReconstructionTreeCreator reconstruction_tree_creator =
+						GPlatesAppLogic::create_cached_reconstruction_tree_creator(d_rotation_features);
+
+				// Like 'ReconstructUtils::reconstruct()' this includes mapping features to reconstruct methods.
+				GPlatesAppLogic::ReconstructContext reconstruct_context(d_reconstruct_method_registry);
+				reconstruct_context.set_features(d_reconstructable_features);
+				const GPlatesAppLogic::ReconstructContext::context_state_reference_type context_state =
+						reconstruct_context.create_context_state(
+								GPlatesAppLogic::ReconstructMethodInterface::Context(
+										GPlatesAppLogic::ReconstructParams(),
+										reconstruction_tree_creator));
+
+				unsigned int num_reconstructed_geometries = 0;
+				GPlatesAppLogic::ReconstructContext::BulkReconstruction bulk_reconstruction;
+				for (double reconstruction_time = 0; reconstruction_time <= MAX_RECONSTRUCTION_TIME; reconstruction_time += 10.0)
+				{
+					bulk_reconstruction.clear();
+					reconstruct_context.get_bulk_reconstruction(
+							bulk_reconstruction,
+							context_state,
+							reconstruction_time);
+
+					num_reconstructed_geometries += bulk_reconstruction.geometries.size();
+				}
+
+				return num_reconstructed_geometries;
+			}
+
+			void
+			tear_down() override
+			{
+				d_rotation_features.clear();
+				d_reconstructable_features.clear();
+			}
+
+		private:
+
+			GPlatesAppLogic::ReconstructMethodRegistry d_reconstruct_method_registry;
+			BenchmarkContext::feature_collection_seq_type d_rotation_features;
+			BenchmarkContext::feature_collection_seq_type d_reconstructable_features;
+		};
+	}
+}
+
+
+void
+GPlatesBench::add_reconstruction_benchmarks(
+		benchmark_seq_type &benchmarks)
+{
+	benchmarks.push_back(boost::make_shared<GraphBuildBenchmark>());
+	benchmarks.push_back(boost::make_shared<TreeBuildBenchmark>());
+	benchmarks.push_back(boost::make_shared<RigidReconstructBenchmark>());
+	benchmarks.push_back(boost::make_shared<BulkReconstructBenchmark>());
+}
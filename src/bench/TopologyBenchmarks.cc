@@ -0,0 +1,311 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <vector>
+#include <boost/make_shared.hpp>
+#include <QStringList>
+
+#include "TopologyBenchmarks.h"
+
+#include "BenchmarkContext.h"
+
+#include "app-logic/ReconstructedFeatureGeometry.h"
+#include "app-logic/ReconstructHandle.h"
+#include "app-logic/ReconstructionTreeCreator.h"
+#include "app-logic/ReconstructMethodRegistry.h"
+#include "app-logic/ReconstructUtils.h"
+#include "app-logic/ResolvedTopologicalBoundary.h"
+#include "app-logic/ResolvedTopologicalLine.h"
+#include "app-logic/ResolvedTopologicalNetwork.h"
+#include "app-logic/ResolvedTriangulationNetwork.h"
+#include "app-logic/TopologyNetworkParams.h"
+#include "app-logic/TopologyUtils.h"
+
+#include "maths/LatLonPoint.h"
+#include "maths/PointOnSphere.h"
+
+
+namespace GPlatesBench
+{
+	namespace
+	{
+		/**
+		 * The resolved topologies at a reconstruction time.
+		 *
+		 * The reconstructed topological sections are kept since the resolved topologies reference them.
+		 */
+		struct ResolvedTopologies
+		{
+			std::vector<GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type> reconstructed_sections;
+			std::vector<GPlatesAppLogic::ResolvedTopologicalLine::non_null_ptr_type> resolved_lines;
+			std::vector<GPlatesAppLogic::ResolvedTopologicalBoundary::non_null_ptr_type> resolved_boundaries;
+			std::vector<GPlatesAppLogic::ResolvedTopologicalNetwork::non_null_ptr_type> resolved_networks;
+		};
+
+
+		/**
+		 * Reconstructs the topological sections and then resolves the topological lines, boundaries and networks.
+		 *
+		 * Like a topology layer, the resolved lines are also used as topological sections
+		 * (of the boundaries and networks).
+		 */
+		void
+		resolve_topologies(
+				ResolvedTopologies &resolved_topologies,
+				const double &reconstruction_time,
+				const BenchmarkContext::feature_collection_seq_type &topology_features,
+				const GPlatesAppLogic::ReconstructMethodRegistry &reconstruct_method_registry,
+				const GPlatesAppLogic::ReconstructionTreeCreator &reconstruction_tree_creator,
+				unsigned int num_worker_threads)
+		{
+			std::vector<GPlatesAppLogic::ReconstructHandle::type> topological_sections_reconstruct_handles;
+
+			topological_sections_reconstruct_handles.push_back(
+					GPlatesAppLogic::ReconstructUtils::reconstruct(
+							resolved_topologies.reconstructed_sections,
+							reconstruction_time,
+							reconstruct_method_registry,
+							topology_features,
+							reconstruction_tree_creator));
+
+			topological_sections_reconstruct_handles.push_back(
+					GPlatesAppLogic::TopologyUtils::resolve_topological_lines(
+							resolved_topologies.resolved_lines,
+							topology_features,
+							reconstruction_tree_creator,
+							reconstruction_time,
+							topological_sections_reconstruct_handles,
+							boost::none/*topological_lines_referenced*/,
+							num_worker_threads));
+
+			GPlatesAppLogic::TopologyUtils::resolve_topological_boundaries(
+					resolved_topologies.resolved_boundaries,
+					topology_features,
+					reconstruction_tree_creator,
+					reconstruction_time,
+					topological_sections_reconstruct_handles,
+					num_worker_threads);
+
+			GPlatesAppLogic::TopologyUtils::resolve_topological_networks(
+					resolved_topologies.resolved_networks,
+					reconstruction_time,
+					topology_features,
+					topological_sections_reconstruct_handles,
+					GPlatesAppLogic::TopologyNetworkParams(),
+					num_worker_threads);
+		}
+
+
+		/**
+		 * Resolves the topology sample data at 10My intervals.
+		 *
+		 * Network triangulations are created on demand and so are not included here
+		 * (see @a NetworkDeformationBenchmark).
+		 */
+		class TopologyResolveBenchmark :
+				public Benchmark
+		{
+		public:
+
+			TopologyResolveBenchmark() :
+				Benchmark("topology/resolve", MACRO),
+				d_num_worker_threads(1)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> rotation_features =
+						context.load_sample_data(
+								QStringList() << "plates4-rotation-files/rotations_about_axes.rot");
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> topology_features =
+						context.load_sample_data(
+								QStringList()
+										<< "gpml/topology_test_mix.gpml"
+										<< "gpml/topology_test_intersections.gpml"
+										<< "gpml/topology_test_slab.gpml"
+										<< "gpml/topology_test_2nets.gpml");
+				if (!rotation_features || !topology_features)
+				{
+					return std::string("missing topology sample data");
+				}
+				d_rotation_features = rotation_features.get();
+				d_topology_features = topology_features.get();
+				d_num_worker_threads = context.get_num_worker_threads();
+
+				return boost::none;
+			}
+
+			unsigned int
+			run() override
+			{
+				const GPlatesAppLogic::ReconstructionTreeCreator reconstruction_tree_creator =
+						GPlatesAppLogic::create_cached_reconstruction_tree_creator(d_rotation_features);
+
+				unsigned int num_resolved_topologies = 0;
+				for (double reconstruction_time = 0; reconstruction_time <= 100.0; reconstruction_time += 10.0)
+				{
+					ResolvedTopologies resolved_topologies;
+					resolve_topologies(
+							resolved_topologies,
+							reconstruction_time,
+							d_topology_features,
+							d_reconstruct_method_registry,
+							reconstruction_tree_creator,
+							d_num_worker_threads);
+
+					num_resolved_topologies +=
+							resolved_topologies.resolved_lines.size() +
+							resolved_topologies.resolved_boundaries.size() +
+							resolved_topologies.resolved_networks.size();
+				}
+
+				return num_resolved_topologies;
+			}
+
+			void
+			tear_down() override
+			{
+				d_rotation_features.clear();
+				d_topology_features.clear();
+			}
+
+		private:
+
+			GPlatesAppLogic::ReconstructMethodRegistry d_reconstruct_method_registry;
+			BenchmarkContext::feature_collection_seq_type d_rotation_features;
+			BenchmarkContext::feature_collection_seq_type d_topology_features;
+			unsigned int d_num_worker_threads;
+		};
+
+
+		/**
+		 * Resolves the deforming networks in the deformation sample data and calculates the
+		 * deformation (strain rates) at the points of a global 1 degree lat-lon grid.
+		 *
+		 * This includes creating each network triangulation (on the first deformation query).
+		 */
+		class NetworkDeformationBenchmark :
+				public Benchmark
+		{
+		public:
+
+			NetworkDeformationBenchmark() :
+				Benchmark("topology/network_deformation", MACRO)
+			{  }
+
+			boost::optional<std::string>
+			set_up(
+					BenchmarkContext &context) override
+			{
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> rotation_features =
+						context.load_sample_data(
+								QStringList() << "deformation_tests/rotations_about_axes.rot");
+				const QStringList network_files =
+						context.get_sample_data_filenames("deformation_tests", QStringList() << "def_*.gpml");
+				const boost::optional<BenchmarkContext::feature_collection_seq_type> network_features =
+						context.load_sample_data(network_files);
+				if (!rotation_features || !network_features || network_files.isEmpty())
+				{
+					return std::string("missing deformation sample data");
+				}
+				d_rotation_features = rotation_features.get();
+				d_network_features = network_features.get();
+
+				d_grid_points.clear();
+				for (int lat = -90; lat <= 90; ++lat)
+				{
+					for (int lon = -180; lon < 180; ++lon)
+					{
+						d_grid_points.push_back(
+								GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(lat, lon)));
+					}
+				}
+
+				return boost::none;
+			}
+
+			unsigned int
+			run() override
+			{
+				const GPlatesAppLogic::ReconstructionTreeCreator reconstruction_tree_creator =
+						GPlatesAppLogic::create_cached_reconstruction_tree_creator(d_rotation_features);
+
+				ResolvedTopologies resolved_topologies;
+				resolve_topologies(
+						resolved_topologies,
+						10.0/*reconstruction_time*/,
+						d_network_features,
+						d_reconstruct_method_registry,
+						reconstruction_tree_creator,
+						1/*num_worker_threads*/);
+
+				unsigned int num_points_deformed = 0;
+				for (const GPlatesAppLogic::ResolvedTopologicalNetwork::non_null_ptr_type &resolved_network :
+					resolved_topologies.resolved_networks)
+				{
+					const GPlatesAppLogic::ResolvedTriangulation::Network &triangulation_network =
+							resolved_network->get_triangulation_network();
+
+					for (const GPlatesMaths::PointOnSphere &grid_point : d_grid_points)
+					{
+						if (triangulation_network.calculate_deformation(grid_point))
+						{
+							++num_points_deformed;
+						}
+					}
+				}
+
+				return num_points_deformed;
+			}
+
+			void
+			tear_down() override
+			{
+				d_rotation_features.clear();
+				d_network_features.clear();
+				d_grid_points.clear();
+			}
+
+		private:
+
+			GPlatesAppLogic::ReconstructMethodRegistry d_reconstruct_method_registry;
+			BenchmarkContext::feature_collection_seq_type d_rotation_features;
+			BenchmarkContext::feature_collection_seq_type d_network_features;
+			std::vector<GPlatesMaths::PointOnSphere> d_grid_points;
+		};
+	}
+}
+
+
+void
+GPlatesBench::add_topology_benchmarks(
+		benchmark_seq_type &benchmarks)
+{
+	benchmarks.push_back(boost::make_shared<TopologyResolveBenchmark>());
+	benchmarks.push_back(boost::make_shared<NetworkDeformationBenchmark>());
+}
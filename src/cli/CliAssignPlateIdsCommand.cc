@@ -47,6 +47,8 @@
 
 #include "model/Model.h"
 
+#include "utils/ParallelUtils.h"
+
 
 namespace
 {
@@ -99,6 +101,9 @@ namespace
 	//! Option name for anchor plate id with short version.
 	const char *ANCHOR_PLATE_ID_OPTION_NAME_WITH_SHORT_OPTION = "anchor-plate-id,a";
 
+	//! Option name for number of threads.
+	const char *NUM_THREADS_OPTION_NAME = "threads";
+
 	//
 	// Values specified by user on command-line for method used to assign plate ids.
 	//
@@ -164,7 +169,8 @@ GPlatesCli::AssignPlateIdsCommand::AssignPlateIdsCommand() :
 	d_assign_plate_id(true),
 	d_assign_time_period(false),
 	d_respect_time_period(false),
-	d_anchor_plate_id(0)
+	d_anchor_plate_id(0),
+	d_num_threads(0)
 {
 }
 
@@ -276,6 +282,13 @@ GPlatesCli::AssignPlateIdsCommand::add_options(
 					&d_anchor_plate_id)->default_value(0),
 			"set anchor plate id (defaults to zero)"
 		)
+		(
+			NUM_THREADS_OPTION_NAME,
+			boost::program_options::value<unsigned int>(&d_num_threads)->default_value(0),
+			"number of threads used to resolve topologies and partition features (defaults to zero which "
+			"means the number of processor cores) - features are still modified one at a time so the "
+			"results are the same for any number of threads"
+		)
 		;
 
 	// The (re)assigned plate id feature collection files can also be specified directly
@@ -365,6 +378,13 @@ GPlatesCli::AssignPlateIdsCommand::run(
 					d_anchor_plate_id,
 					10/*max_num_reconstruction_trees_in_cache*/);
 
+	// Resolving the partitioning topologies (when the plate id assigner is created) uses the
+	// global number of worker threads.
+	if (d_num_threads != 0)
+	{
+		GPlatesUtils::ParallelUtils::set_num_worker_threads(d_num_threads);
+	}
+
 	// Create the object used to assign plate ids.
 	const GPlatesAppLogic::AssignPlateIds::non_null_ptr_type plate_id_assigner =
 			GPlatesAppLogic::AssignPlateIds::create(
@@ -375,6 +395,7 @@ GPlatesCli::AssignPlateIdsCommand::run(
 					assign_feature_property_flags,
 					true/*verify_information_model*/,
 					d_respect_time_period);
+	plate_id_assigner->set_num_worker_threads(d_num_threads);
 
 	// Assign plate ids to the features.
 	// Do this after checking all command-line parameters since assigning plate ids
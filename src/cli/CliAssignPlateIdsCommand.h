@@ -113,6 +113,11 @@ namespace GPlatesCli
 
 		GPlatesModel::integer_plate_id_type d_anchor_plate_id;
 
+		/**
+		 * The number of threads used to partition features (zero means the number of processor cores).
+		 */
+		unsigned int d_num_threads;
+
 		std::string d_save_file_prefix;
 		std::string d_save_file_suffix;
 	};
@@ -93,6 +93,8 @@ GPlatesCli::ConvertFileFormatCommand::add_options(
 					+ " - GPlates native GPML format\n"
 					+ FeatureCollectionFileIO::SAVE_FILE_TYPE_GPMLZ
 					+ " - GPlates native GPML format compressed with gzip\n"
+					+ FeatureCollectionFileIO::SAVE_FILE_TYPE_GDAT
+					+ " - GPlates native binary format (fast to load)\n"
 					+ FeatureCollectionFileIO::SAVE_FILE_TYPE_SHAPEFILE
 					+ " - ArcGIS Shapefile format\n"
 					+ FeatureCollectionFileIO::SAVE_FILE_TYPE_GMT
@@ -103,11 +103,13 @@ namespace
 
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GPML = "gpml";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GPMLZ = "compressed-gpml";
+const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GDAT = "gdat";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_PLATES_LINE = "plates4-line";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_PLATES_ROTATION = "plates4-rotation";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_SHAPEFILE = "shapefile";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GMT = "gmt";
 const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GMAP = "vgp";
+const std::string GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GEOPACKAGE = "geopackage";
 
 GPlatesCli::FeatureCollectionFileIO::FeatureCollectionFileIO(
 		GPlatesModel::ModelInterface &model,
@@ -326,6 +328,10 @@ GPlatesCli::FeatureCollectionFileIO::get_save_file_format(
 	{
 		return GPlatesFileIO::FeatureCollectionFileFormat::GPMLZ;
 	}
+	else if (save_file_type == SAVE_FILE_TYPE_GDAT)
+	{
+		return GPlatesFileIO::FeatureCollectionFileFormat::GDAT;
+	}
 	else if (save_file_type == SAVE_FILE_TYPE_PLATES_LINE)
 	{
 		return GPlatesFileIO::FeatureCollectionFileFormat::PLATES4_LINE;
@@ -346,6 +352,10 @@ GPlatesCli::FeatureCollectionFileIO::get_save_file_format(
 	{
 		return GPlatesFileIO::FeatureCollectionFileFormat::GMAP;
 	}
+	else if (save_file_type == SAVE_FILE_TYPE_GEOPACKAGE)
+	{
+		return GPlatesFileIO::FeatureCollectionFileFormat::GEOPACKAGE;
+	}
 
 	throw GPlatesCli::InvalidOptionValue(
 			GPLATES_EXCEPTION_SOURCE,
@@ -118,11 +118,13 @@ namespace GPlatesCli
 		//
 		static const std::string SAVE_FILE_TYPE_GPML;
 		static const std::string SAVE_FILE_TYPE_GPMLZ;
+		static const std::string SAVE_FILE_TYPE_GDAT;
 		static const std::string SAVE_FILE_TYPE_PLATES_LINE;
 		static const std::string SAVE_FILE_TYPE_PLATES_ROTATION;
 		static const std::string SAVE_FILE_TYPE_SHAPEFILE;
 		static const std::string SAVE_FILE_TYPE_GMT;
 		static const std::string SAVE_FILE_TYPE_GMAP;
+		static const std::string SAVE_FILE_TYPE_GEOPACKAGE;
 
 		/**
 		 * Returns the save filename by changing the extension of @a file_info using
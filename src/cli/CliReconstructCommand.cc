@@ -22,25 +22,36 @@
  * with this program; if not, write to Free Software Foundation, Inc.,
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
+#include <vector>
+
 #include <boost/foreach.hpp>
+#include <boost/optional.hpp>
+
+#include <QString>
 
 #include "CliReconstructCommand.h"
 #include "CliFeatureCollectionFileIO.h"
 #include "CliInvalidOptionValue.h"
 #include "CliRequiredOptionNotPresent.h"
 
+#include "app-logic/ReconstructMethodRegistry.h"
 #include "app-logic/ReconstructParams.h"
 #include "app-logic/ReconstructUtils.h"
 #include "app-logic/Reconstruction.h"
 #include "app-logic/ReconstructionGeometryUtils.h"
+#include "app-logic/ReconstructionTreeCreator.h"
 
 #include "file-io/ReconstructedFeatureGeometryExport.h"
 #include "file-io/FeatureCollectionFileFormat.h"
 #include "file-io/FileInfo.h"
+#include "file-io/OgrMultiFrameExport.h"
+#include "file-io/OgrWriter.h"
 #include "file-io/ReadErrorAccumulation.h"
 
 #include "model/Model.h"
 
+#include "utils/AnimationSequenceUtils.h"
+
 namespace
 {
 	//! Option name for loading reconstructable feature collection file(s).
@@ -64,6 +75,13 @@ namespace
 	//! Option name for reconstruction time with short version.
 	const char *RECONSTRUCTION_TIME_OPTION_NAME_WITH_SHORT_OPTION = "recon-time,t";
 
+	//! Option name for the begin time of a range of reconstruction times.
+	const char *RECONSTRUCTION_BEGIN_TIME_OPTION_NAME = "recon-begin-time";
+	//! Option name for the end time of a range of reconstruction times.
+	const char *RECONSTRUCTION_END_TIME_OPTION_NAME = "recon-end-time";
+	//! Option name for the time increment of a range of reconstruction times.
+	const char *RECONSTRUCTION_TIME_INCREMENT_OPTION_NAME = "recon-time-increment";
+
 	//! Option name for anchor plate id with short version.
 	const char *ANCHOR_PLATE_ID_OPTION_NAME_WITH_SHORT_OPTION = "anchor-plate-id,a";
 
@@ -77,6 +95,12 @@ namespace
 	//! Option name for wrapping-to-dateline with short version.
 	const char *WRAP_TO_DATELINE_OPTION_NAME_WITH_SHORT_OPTION = "wrap-to-dateline,w";
 
+	//! Option name for exporting each reconstruction time of a range to its own GeoPackage layers.
+	const char *GEOPACKAGE_LAYER_PER_FRAME_OPTION_NAME = "geopackage-layer-per-frame";
+
+	//! Option name for the number of features written per GeoPackage transaction.
+	const char *GEOPACKAGE_TRANSACTION_BATCH_SIZE_OPTION_NAME = "geopackage-transaction-batch-size";
+
 
 	/**
 	 * Parses command-line option to get the export file type.
@@ -90,7 +114,8 @@ namespace
 
 		// We're only allowing a subset of the save file types that make sense for us.
 		if (export_file_type == GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GMT ||
-			export_file_type == GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_SHAPEFILE)
+			export_file_type == GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_SHAPEFILE ||
+			export_file_type == GPlatesCli::FeatureCollectionFileIO::SAVE_FILE_TYPE_GEOPACKAGE)
 		{
 			return export_file_type;
 		}
@@ -99,15 +124,36 @@ namespace
 				GPLATES_EXCEPTION_SOURCE,
 				export_file_type.c_str());
 	}
+
+
+	/**
+	 * Returns the export filename (without extension) for the specified reconstruction time
+	 * when exporting a range of reconstruction times.
+	 *
+	 * This follows the default filename template of the animation export in the GUI.
+	 */
+	std::string
+	get_frame_export_filename(
+			const std::string &export_filename,
+			const double &reconstruction_time)
+	{
+		return export_filename + "_" +
+				QString::number(reconstruction_time, 'f', 2).toStdString() + "Ma";
+	}
 }
 
 
 GPlatesCli::ReconstructCommand::ReconstructCommand() :
 	d_recon_time(0),
+	d_recon_begin_time(0),
+	d_recon_end_time(0),
+	d_recon_time_increment(1),
 	d_anchor_plate_id(0),
 	d_export_single_output_file(true),
 	d_export_separate_output_directory_per_input_file(true),
-	d_wrap_to_dateline(false)
+	d_wrap_to_dateline(false),
+	d_geopackage_layer_per_frame(false),
+	d_geopackage_transaction_batch_size(GPlatesFileIO::OgrWriter::DEFAULT_TRANSACTION_BATCH_SIZE)
 {
 }
 
@@ -151,13 +197,34 @@ GPlatesCli::ReconstructCommand::add_options(
 					+ FeatureCollectionFileIO::SAVE_FILE_TYPE_GMT
 					+ " - Generic Mapping Tools (GMT) format\n"
 					+ FeatureCollectionFileIO::SAVE_FILE_TYPE_SHAPEFILE
-					+ " - ArcGIS Shapefile format\n").c_str()
+					+ " - ArcGIS Shapefile format\n"
+					+ FeatureCollectionFileIO::SAVE_FILE_TYPE_GEOPACKAGE
+					+ " - GeoPackage format (a range of reconstruction times is exported to a single file)\n").c_str()
 		)
 		(
 			RECONSTRUCTION_TIME_OPTION_NAME_WITH_SHORT_OPTION,
 			boost::program_options::value<double>(&d_recon_time)->default_value(0),
 			"set reconstruction time (defaults to zero)"
 		)
+		(
+			RECONSTRUCTION_BEGIN_TIME_OPTION_NAME,
+			boost::program_options::value<double>(&d_recon_begin_time),
+			"set begin time of a range of reconstruction times to export\n"
+			"  NOTE: If specified then '--recon-time' is ignored and each reconstruction time\n"
+			"  is exported to a filename suffixed with that time (eg, 'reconstructed_10.00Ma')."
+		)
+		(
+			RECONSTRUCTION_END_TIME_OPTION_NAME,
+			boost::program_options::value<double>(&d_recon_end_time),
+			"set end time of a range of reconstruction times to export\n"
+			"  NOTE: Required if '--recon-begin-time' is specified."
+		)
+		(
+			RECONSTRUCTION_TIME_INCREMENT_OPTION_NAME,
+			boost::program_options::value<double>(&d_recon_time_increment)->default_value(1),
+			"set time increment of a range of reconstruction times to export (defaults to one)\n"
+			"  NOTE: The end time is always exported even if the range is not a multiple of the increment."
+		)
 		(
 			ANCHOR_PLATE_ID_OPTION_NAME_WITH_SHORT_OPTION,
 			boost::program_options::value<GPlatesModel::integer_plate_id_type>(
@@ -183,6 +250,21 @@ GPlatesCli::ReconstructCommand::add_options(
 			"wrap geometries to the dateline (defaults to 'false')\n"
 			"  NOTE: Only applies if export file type is Shapefile."
 		)
+		(
+			GEOPACKAGE_LAYER_PER_FRAME_OPTION_NAME,
+			boost::program_options::value<bool>(&d_geopackage_layer_per_frame)->default_value(false),
+			"export each reconstruction time to its own layers (defaults to 'false')\n"
+			"  NOTE: Only applies if exporting a range of reconstruction times to GeoPackage, in which case\n"
+			"  'false' exports all times to the same layers with a 'TIME' attribute."
+		)
+		(
+			GEOPACKAGE_TRANSACTION_BATCH_SIZE_OPTION_NAME,
+			boost::program_options::value<unsigned int>(&d_geopackage_transaction_batch_size)->default_value(
+					GPlatesFileIO::OgrWriter::DEFAULT_TRANSACTION_BATCH_SIZE),
+			"number of features written per transaction (must be at least one)\n"
+			"  NOTE: Only applies if export file type is GeoPackage. Larger batches export faster.\n"
+			"  If writing a feature fails then the features written before it are kept (in a partial file)."
+		)
 		;
 
 	// The feature collection files can also be specified directly on command-line
@@ -225,27 +307,53 @@ GPlatesCli::ReconstructCommand::run(
 	// The export filename information.
 	const std::string export_file_type = get_export_file_type(vm);
 
-	//
-	// Reconstruct feature collections and export reconstructed geometries.
-	//
+	if (d_geopackage_transaction_batch_size == 0)
+	{
+		throw InvalidOptionValue(
+				GPLATES_EXCEPTION_SOURCE,
+				GEOPACKAGE_TRANSACTION_BATCH_SIZE_OPTION_NAME);
+	}
 
-	// Perform reconstruction.
-	std::vector<GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type> reconstructed_feature_geometries;
-	GPlatesAppLogic::ReconstructUtils::reconstruct(
-			reconstructed_feature_geometries,
-			d_recon_time,
-			d_anchor_plate_id,
-			reconstructable_feature_collections,
-			reconstruction_feature_collections);
-
-	// Converts to raw pointers.
-	std::vector<const GPlatesAppLogic::ReconstructedFeatureGeometry *> reconstruct_feature_geom_seq;
-	reconstruct_feature_geom_seq.reserve(reconstructed_feature_geometries.size());
-	BOOST_FOREACH(
-			const GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type &rfg,
-			reconstructed_feature_geometries)
+	// The reconstruction times to export.
+	std::vector<double> reconstruction_times;
+	if (vm.count(RECONSTRUCTION_BEGIN_TIME_OPTION_NAME))
 	{
-		reconstruct_feature_geom_seq.push_back(rfg.get());
+		if (!vm.count(RECONSTRUCTION_END_TIME_OPTION_NAME))
+		{
+			throw RequiredOptionNotPresent(
+					GPLATES_EXCEPTION_SOURCE,
+					RECONSTRUCTION_END_TIME_OPTION_NAME,
+					std::string("Required when '") + RECONSTRUCTION_BEGIN_TIME_OPTION_NAME + "' is specified.");
+		}
+
+		GPlatesUtils::AnimationSequence::SequenceInfo sequence_info;
+		try
+		{
+			sequence_info = GPlatesUtils::AnimationSequence::calculate_sequence(
+					d_recon_begin_time,
+					d_recon_end_time,
+					d_recon_time_increment,
+					true/*should_finish_exactly_on_end_time*/);
+		}
+		catch (const GPlatesUtils::AnimationSequence::TimeIncrementZero &)
+		{
+			throw InvalidOptionValue(
+					GPLATES_EXCEPTION_SOURCE,
+					RECONSTRUCTION_TIME_INCREMENT_OPTION_NAME);
+		}
+
+		reconstruction_times.reserve(sequence_info.duration_in_frames);
+		for (GPlatesUtils::AnimationSequence::size_type frame_index = 0;
+			frame_index < sequence_info.duration_in_frames;
+			++frame_index)
+		{
+			reconstruction_times.push_back(
+					GPlatesUtils::AnimationSequence::calculate_time_for_frame(sequence_info, frame_index));
+		}
+	}
+	else
+	{
+		reconstruction_times.push_back(d_recon_time);
 	}
 
 	// Get the sequence of reconstructable files as File pointers.
@@ -266,25 +374,91 @@ GPlatesCli::ReconstructCommand::run(
 		reconstruction_file_ptrs.push_back(file_iter->get());
 	}
 
-	// Export filename.
-	const GPlatesFileIO::FileInfo export_filename =
-			file_io.get_save_file_info(
-					d_export_filename.c_str(),
-					export_file_type);
-
-	// Export the reconstructed feature geometries.
-	GPlatesFileIO::ReconstructedFeatureGeometryExport::export_reconstructed_feature_geometries(
-				export_filename.get_qfileinfo().filePath(),
-				GPlatesFileIO::ReconstructedFeatureGeometryExport::get_export_file_format(
-						export_filename.get_qfileinfo().filePath(),
-						file_io.get_file_format_registry()),
-				reconstruct_feature_geom_seq,
-				reconstructable_file_ptrs,
-				reconstruction_file_ptrs,
-				d_anchor_plate_id,
-				d_recon_time,
-				d_export_single_output_file/*export_single_output_file*/,
-				!d_export_single_output_file/*export_per_input_file*/,
-				d_export_separate_output_directory_per_input_file,
-				d_wrap_to_dateline);
+	//
+	// Reconstruct feature collections and export reconstructed geometries.
+	//
+
+	// The reconstruction graph is built once (from the loaded rotation features) and shared by all
+	// reconstruction times. A cache size of two allows features that also need the reconstruction
+	// tree of the previous frame (eg, flowlines and motion paths) to avoid rebuilding it.
+	const GPlatesAppLogic::ReconstructionTreeCreator reconstruction_tree_creator =
+			GPlatesAppLogic::create_cached_reconstruction_tree_creator(
+					reconstruction_feature_collections,
+					false/*extend_total_reconstruction_poles_to_distant_past*/,
+					d_anchor_plate_id,
+					2/*reconstruction_tree_cache_size*/);
+	const GPlatesAppLogic::ReconstructMethodRegistry reconstruct_method_registry;
+
+	// A range of reconstruction times exported to GeoPackage goes into a single file
+	// (each time is a frame of a multi-frame export) instead of one file per time.
+	const bool export_range_to_single_file =
+			vm.count(RECONSTRUCTION_BEGIN_TIME_OPTION_NAME) &&
+			export_file_type == FeatureCollectionFileIO::SAVE_FILE_TYPE_GEOPACKAGE;
+	const GPlatesFileIO::OgrMultiFrameExport::Layout multi_frame_layout = d_geopackage_layer_per_frame
+			? GPlatesFileIO::OgrMultiFrameExport::LAYER_PER_FRAME
+			: GPlatesFileIO::OgrMultiFrameExport::TIME_FIELD;
+
+	// Note that the frames are exported serially because exporting reads feature properties
+	// (such as plate ids and names) and the model is not thread-safe.
+	for (unsigned int frame_index = 0; frame_index < reconstruction_times.size(); ++frame_index)
+	{
+		const double &reconstruction_time = reconstruction_times[frame_index];
+
+		// Perform reconstruction.
+		std::vector<GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type> reconstructed_feature_geometries;
+		GPlatesAppLogic::ReconstructUtils::reconstruct(
+				reconstructed_feature_geometries,
+				reconstruction_time,
+				reconstruct_method_registry,
+				reconstructable_feature_collections,
+				reconstruction_tree_creator);
+
+		// Converts to raw pointers.
+		std::vector<const GPlatesAppLogic::ReconstructedFeatureGeometry *> reconstruct_feature_geom_seq;
+		reconstruct_feature_geom_seq.reserve(reconstructed_feature_geometries.size());
+		BOOST_FOREACH(
+				const GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type &rfg,
+				reconstructed_feature_geometries)
+		{
+			reconstruct_feature_geom_seq.push_back(rfg.get());
+		}
+
+		// Export filename (suffixed with the reconstruction time if exporting a range of times to separate files).
+		const std::string export_filename_no_extension =
+				(vm.count(RECONSTRUCTION_BEGIN_TIME_OPTION_NAME) && !export_range_to_single_file)
+				? get_frame_export_filename(d_export_filename, reconstruction_time)
+				: d_export_filename;
+
+		// The first frame replaces any existing file and subsequent frames are appended to it.
+		boost::optional<GPlatesFileIO::OgrMultiFrameExport::Frame> multi_frame;
+		if (export_range_to_single_file)
+		{
+			multi_frame = GPlatesFileIO::OgrMultiFrameExport::Frame(
+					multi_frame_layout,
+					reconstruction_time,
+					frame_index == 0/*is_first_frame*/);
+		}
+		const GPlatesFileIO::FileInfo export_filename =
+				file_io.get_save_file_info(
+						export_filename_no_extension.c_str(),
+						export_file_type);
+
+		// Export the reconstructed feature geometries.
+		GPlatesFileIO::ReconstructedFeatureGeometryExport::export_reconstructed_feature_geometries(
+					export_filename.get_qfileinfo().filePath(),
+					GPlatesFileIO::ReconstructedFeatureGeometryExport::get_export_file_format(
+							export_filename.get_qfileinfo().filePath(),
+							file_io.get_file_format_registry()),
+					reconstruct_feature_geom_seq,
+					reconstructable_file_ptrs,
+					reconstruction_file_ptrs,
+					d_anchor_plate_id,
+					reconstruction_time,
+					d_export_single_output_file/*export_single_output_file*/,
+					!d_export_single_output_file/*export_per_input_file*/,
+					d_export_separate_output_directory_per_input_file,
+					d_wrap_to_dateline,
+					multi_frame,
+					d_geopackage_transaction_batch_size);
+	}
 }
@@ -87,6 +87,17 @@ namespace GPlatesCli
 
 		GPlatesModel::ModelInterface d_model;
 		double d_recon_time;
+
+		/**
+		 * The time range [begin, end] exported in increments of @a d_recon_time_increment.
+		 *
+		 * These are only used if the begin time option is present (in which case @a d_recon_time is ignored).
+		 * All frames are reconstructed from the same loaded files (and cached reconstruction trees).
+		 */
+		double d_recon_begin_time;
+		double d_recon_end_time;
+		double d_recon_time_increment;
+
 		GPlatesModel::integer_plate_id_type d_anchor_plate_id;
 
 		std::string d_export_filename;
@@ -117,6 +128,18 @@ namespace GPlatesCli
 		 * This currently only applies to Shapefiles.
 		 */
 		bool d_wrap_to_dateline;
+
+		/**
+		 * When exporting a range of reconstruction times to GeoPackage, all times are exported to
+		 * the same file - if this is 'true' then each time gets its own layers, otherwise the times
+		 * share layers and are distinguished by a time attribute.
+		 */
+		bool d_geopackage_layer_per_frame;
+
+		/**
+		 * The number of features written per transaction when exporting to GeoPackage.
+		 */
+		unsigned int d_geopackage_transaction_batch_size;
 	};
 }
 
@@ -0,0 +1,197 @@
+/* $Id$ */
+
+/**
+ * \file 
+ * $Revision$
+ * $Date$
+ * 
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+
+#include "CoRegTargetSpatialPartition.h"
+#include "DataMiningUtils.h"
+#include "RegionOfInterestFilter.h"
+
+#include "app-logic/GeometryUtils.h"
+#include "app-logic/ReconstructedFeatureGeometry.h"
+
+#include "maths/AngularExtent.h"
+#include "maths/CubeQuadTreePartitionUtils.h"
+#include "maths/MathsUtils.h"
+
+#include "utils/Earth.h"
+#include "utils/Profile.h"
+
+
+GPlatesDataMining::CoRegTargetSpatialPartition::CoRegTargetSpatialPartition(
+		const reconstructed_feature_vector_type &reconstructed_target_features) :
+	d_reconstructed_target_features(reconstructed_target_features),
+	d_spatial_partition(spatial_partition_type::create(SPATIAL_PARTITION_DEPTH))
+{
+	PROFILE_FUNC();
+
+	const unsigned int num_target_features = d_reconstructed_target_features.size();
+	for (unsigned int target_feature_index = 0; target_feature_index < num_target_features; ++target_feature_index)
+	{
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_target_feature =
+				d_reconstructed_target_features[target_feature_index];
+
+		// Target geometries are shared by all seed features, which can be queried concurrently.
+		DataMiningUtils::prepare_for_concurrent_distance_queries(reconstructed_target_feature);
+
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature::reconstruction_seq_type &
+				reconstructed_target_geometries = reconstructed_target_feature.get_reconstructions();
+
+		const unsigned int num_target_geometries = reconstructed_target_geometries.size();
+		for (unsigned int target_geometry_index = 0; target_geometry_index < num_target_geometries; ++target_geometry_index)
+		{
+			// Add using the bounding small circle of the reconstructed target geometry.
+			d_spatial_partition->add(
+					target_geometry_index_type(target_feature_index, target_geometry_index),
+					*reconstructed_target_geometries[target_geometry_index]
+							.get_reconstructed_feature_geometry()->reconstructed_geometry());
+		}
+	}
+}
+
+
+void
+GPlatesDataMining::CoRegTargetSpatialPartition::find_target_geometries_in_region_of_interest(
+		target_geometry_index_seq_type &target_geometry_indices,
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+		const double &range,
+		boost::optional<const target_geometry_index_seq_type &> target_geometry_subset) const
+{
+	target_geometry_index_seq_type candidate_target_geometry_indices;
+	if (!target_geometry_subset)
+	{
+		find_candidate_target_geometries(candidate_target_geometry_indices, reconstructed_seed_feature, range);
+		target_geometry_subset = candidate_target_geometry_indices;
+	}
+
+	// Only keep those candidates actually within the region of interest.
+	for (const target_geometry_index_type &target_geometry_index : target_geometry_subset.get())
+	{
+		const GPlatesMaths::GeometryOnSphere &target_geometry =
+				*d_reconstructed_target_features[target_geometry_index.first]
+						.get_reconstructions()[target_geometry_index.second]
+								.get_reconstructed_feature_geometry()->reconstructed_geometry();
+
+		if (RegionOfInterestFilter::is_in_region_of_interest(target_geometry, reconstructed_seed_feature, range))
+		{
+			target_geometry_indices.push_back(target_geometry_index);
+		}
+	}
+}
+
+
+void
+GPlatesDataMining::CoRegTargetSpatialPartition::get_reconstructed_target_features(
+		reconstructed_feature_vector_type &reconstructed_target_features,
+		const target_geometry_index_seq_type &target_geometry_indices) const
+{
+	// Group the geometries of each target feature into a reconstructed target feature.
+	target_geometry_index_seq_type::const_iterator target_geometry_iter = target_geometry_indices.begin();
+	const target_geometry_index_seq_type::const_iterator target_geometry_end = target_geometry_indices.end();
+	while (target_geometry_iter != target_geometry_end)
+	{
+		const unsigned int target_feature_index = target_geometry_iter->first;
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_target_feature =
+				d_reconstructed_target_features[target_feature_index];
+
+		GPlatesAppLogic::ReconstructContext::ReconstructedFeature::reconstruction_seq_type target_geometries;
+		for ( ; target_geometry_iter != target_geometry_end && target_geometry_iter->first == target_feature_index; ++target_geometry_iter)
+		{
+			target_geometries.push_back(
+					reconstructed_target_feature.get_reconstructions()[target_geometry_iter->second]);
+		}
+
+		reconstructed_target_features.push_back(
+				GPlatesAppLogic::ReconstructContext::ReconstructedFeature(
+						reconstructed_target_feature.get_feature(),
+						target_geometries));
+	}
+}
+
+
+void
+GPlatesDataMining::CoRegTargetSpatialPartition::find_candidate_target_geometries(
+		target_geometry_index_seq_type &candidate_target_geometry_indices,
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+		const double &range) const
+{
+	// Convert range from kms to radians.
+	double range_in_radians = range / GPlatesUtils::Earth::EQUATORIAL_RADIUS_KMS;
+	if (range_in_radians > GPlatesMaths::PI)
+	{
+		range_in_radians = GPlatesMaths::PI;
+	}
+	const GPlatesMaths::AngularExtent range_angular_extent =
+			GPlatesMaths::AngularExtent::create_from_angle(range_in_radians);
+
+	// Find the target geometries near each seed geometry.
+	for (const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_seed_geom :
+		reconstructed_seed_feature.get_reconstructions())
+	{
+		const GPlatesMaths::GeometryOnSphere &seed_geometry =
+				*reconstructed_seed_geom.get_reconstructed_feature_geometry()->reconstructed_geometry();
+
+		// The region of interest is the seed geometry's bounding small circle expanded by the range.
+		// A point geometry has no bounding small circle (it's just the point itself).
+		boost::optional<const GPlatesMaths::BoundingSmallCircle &> seed_bounding_small_circle =
+				GPlatesAppLogic::GeometryUtils::get_geometry_bounding_small_circle(seed_geometry);
+		if (seed_bounding_small_circle)
+		{
+			GPlatesMaths::CubeQuadTreePartitionUtils::visit_potentially_intersecting_elements(
+					*d_spatial_partition,
+					seed_bounding_small_circle->get_centre(),
+					seed_bounding_small_circle->get_angular_extent() + range_angular_extent,
+					[&](const target_geometry_index_type &target_geometry_index)
+					{
+						candidate_target_geometry_indices.push_back(target_geometry_index);
+					});
+		}
+		else
+		{
+			boost::optional<const GPlatesMaths::PointOnSphere &> seed_point =
+					GPlatesAppLogic::GeometryUtils::get_point_on_sphere(seed_geometry);
+			if (!seed_point)
+			{
+				continue;
+			}
+
+			GPlatesMaths::CubeQuadTreePartitionUtils::visit_potentially_intersecting_elements(
+					*d_spatial_partition,
+					seed_point->position_vector(),
+					range_angular_extent,
+					[&](const target_geometry_index_type &target_geometry_index)
+					{
+						candidate_target_geometry_indices.push_back(target_geometry_index);
+					});
+		}
+	}
+
+	// Order candidates by target feature (and by geometry within each target feature) and
+	// remove duplicates (a target geometry can be near more than one seed geometry).
+	std::sort(candidate_target_geometry_indices.begin(), candidate_target_geometry_indices.end());
+	candidate_target_geometry_indices.erase(
+			std::unique(candidate_target_geometry_indices.begin(), candidate_target_geometry_indices.end()),
+			candidate_target_geometry_indices.end());
+}
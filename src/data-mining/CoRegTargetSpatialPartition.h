@@ -0,0 +1,156 @@
+/* $Id$ */
+
+/**
+ * \file 
+ * $Revision$
+ * $Date$
+ * 
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATESDATAMINING_COREGTARGETSPATIALPARTITION_H
+#define GPLATESDATAMINING_COREGTARGETSPATIALPARTITION_H
+
+#include <utility>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "app-logic/ReconstructContext.h"
+
+#include "maths/CubeQuadTreePartition.h"
+
+
+namespace GPlatesDataMining
+{
+	/**
+	 * A spatial partition of the reconstructed geometries of the target features of a co-registration
+	 * target layer (at a particular reconstruction time).
+	 *
+	 * This is built once per target layer and then queried for each seed feature, so that a
+	 * region-of-interest filter only needs to test those target geometries near each seed feature
+	 * (rather than all target geometries).
+	 *
+	 * The target geometries are prepared for concurrent distance queries on creation, so that
+	 * different seed features can be queried concurrently by multiple threads.
+	 */
+	class CoRegTargetSpatialPartition :
+			private boost::noncopyable
+	{
+	public:
+		typedef std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature>
+				reconstructed_feature_vector_type;
+
+		/**
+		 * Identifies a target geometry by its target feature index and its reconstruction index
+		 * (within the target feature).
+		 */
+		typedef std::pair<unsigned int, unsigned int> target_geometry_index_type;
+
+		//! Typedef for a sorted sequence of target geometry indices.
+		typedef std::vector<target_geometry_index_type> target_geometry_index_seq_type;
+
+
+		static
+		boost::shared_ptr<CoRegTargetSpatialPartition>
+		create(
+				const reconstructed_feature_vector_type &reconstructed_target_features)
+		{
+			return boost::shared_ptr<CoRegTargetSpatialPartition>(
+					new CoRegTargetSpatialPartition(reconstructed_target_features));
+		}
+
+
+		/**
+		 * Returns the reconstructed target features.
+		 */
+		const reconstructed_feature_vector_type &
+		get_reconstructed_target_features() const
+		{
+			return d_reconstructed_target_features;
+		}
+
+
+		/**
+		 * Appends to @a target_geometry_indices those target geometries that are within @a range (in Kms)
+		 * of any geometry of @a reconstructed_seed_feature (the region-of-interest filter).
+		 *
+		 * Only those target geometries near the seed geometries (according to the spatial partition)
+		 * are tested. And if @a target_geometry_subset is specified then only those target geometries
+		 * are tested (such as the result of a previous query with a larger range).
+		 *
+		 * The appended indices are sorted (by target feature and then by geometry within each target feature).
+		 *
+		 * This can be called concurrently (by multiple threads) provided the geometries of
+		 * @a reconstructed_seed_feature are not modified concurrently by another thread
+		 * (see 'DataMiningUtils::prepare_for_concurrent_distance_queries()').
+		 */
+		void
+		find_target_geometries_in_region_of_interest(
+				target_geometry_index_seq_type &target_geometry_indices,
+				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+				const double &range,
+				boost::optional<const target_geometry_index_seq_type &> target_geometry_subset = boost::none) const;
+
+
+		/**
+		 * Appends to @a reconstructed_target_features a reconstructed target feature for each target
+		 * feature referenced by @a target_geometry_indices (containing only the referenced geometries).
+		 *
+		 * @a target_geometry_indices must be sorted (as returned by @a find_target_geometries_in_region_of_interest).
+		 */
+		void
+		get_reconstructed_target_features(
+				reconstructed_feature_vector_type &reconstructed_target_features,
+				const target_geometry_index_seq_type &target_geometry_indices) const;
+
+	private:
+
+		typedef GPlatesMaths::CubeQuadTreePartition<target_geometry_index_type> spatial_partition_type;
+
+		/**
+		 * The maximum depth of the spatial partition.
+		 *
+		 * Target layers can contain many (eg, hundreds of thousands) of small geometries (such as points),
+		 * so this is deep enough to separate them but still limits the memory used by the quad tree nodes.
+		 */
+		static const unsigned int SPATIAL_PARTITION_DEPTH = 7;
+
+
+		reconstructed_feature_vector_type d_reconstructed_target_features;
+		spatial_partition_type::non_null_ptr_type d_spatial_partition;
+
+
+		explicit
+		CoRegTargetSpatialPartition(
+				const reconstructed_feature_vector_type &reconstructed_target_features);
+
+		/**
+		 * Appends the (sorted) target geometries whose bounds potentially intersect the bounds
+		 * of any seed geometry expanded by @a range (in Kms).
+		 */
+		void
+		find_candidate_target_geometries(
+				target_geometry_index_seq_type &candidate_target_geometry_indices,
+				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+				const double &range) const;
+	};
+}
+
+#endif // GPLATESDATAMINING_COREGTARGETSPATIALPARTITION_H
@@ -26,6 +26,7 @@
 #include <utility>
 #include <boost/foreach.hpp>
 
+#include "app-logic/GeometryUtils.h"
 #include "app-logic/ReconstructionLayerProxy.h"
 #include "app-logic/ReconstructedFeatureGeometry.h"
 #include "feature-visitors/ShapefileAttributeFinder.h"
@@ -141,6 +142,58 @@ GPlatesDataMining::DataMiningUtils::shortest_distance(
 }
 
 
+void
+GPlatesDataMining::DataMiningUtils::prepare_for_concurrent_distance_queries(
+		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_feature)
+{
+	BOOST_FOREACH(
+			const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstruction,
+			reconstructed_feature.get_reconstructions())
+	{
+		// The reconstructed geometry itself is calculated on demand.
+		const GPlatesMaths::GeometryOnSphere &geometry =
+				*reconstruction.get_reconstructed_feature_geometry()->reconstructed_geometry();
+
+		// Set up the data cached by the geometry that is used by distance queries.
+		switch (GPlatesAppLogic::GeometryUtils::get_geometry_type(geometry))
+		{
+		case GPlatesMaths::GeometryType::MULTIPOINT:
+			GPlatesAppLogic::GeometryUtils::get_multi_point_on_sphere(geometry).get()->get_bounding_small_circle();
+			break;
+
+		case GPlatesMaths::GeometryType::POLYLINE:
+			{
+				const GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type polyline =
+						GPlatesAppLogic::GeometryUtils::get_polyline_on_sphere(geometry).get();
+				polyline->get_bounding_small_circle();
+				polyline->get_bounding_tree();
+			}
+			break;
+
+		case GPlatesMaths::GeometryType::POLYGON:
+			{
+				const GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type polygon =
+						GPlatesAppLogic::GeometryUtils::get_polygon_on_sphere(geometry).get();
+				polygon->get_bounding_small_circle();
+				polygon->get_bounding_tree();
+
+				// Set up the high-speed point-in-polygon structure (by testing an arbitrary point) so that
+				// subsequent (adaptive) point-in-polygon tests no longer modify the polygon.
+				polygon->is_point_in_polygon(
+						GPlatesMaths::PointOnSphere(polygon->get_boundary_centroid()),
+						GPlatesMaths::PolygonOnSphere::HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE);
+			}
+			break;
+
+		case GPlatesMaths::GeometryType::POINT:
+		default:
+			// Nothing is cached by a point.
+			break;
+		}
+	}
+}
+
+
 GPlatesDataMining::OpaqueData
 GPlatesDataMining::DataMiningUtils::get_property_value_by_name(
 		const GPlatesModel::FeatureHandle* feature_ptr,
@@ -94,6 +94,15 @@ namespace GPlatesDataMining
 				const std::vector<const GPlatesAppLogic::ReconstructedFeatureGeometry*>& first,
 				const std::vector<const GPlatesAppLogic::ReconstructedFeatureGeometry*>& second);
 		/*
+		* Calculates (and caches) the reconstructed geometries of the specified reconstructed feature,
+		* and their bounds and point-in-polygon structures, so that subsequent distance queries on
+		* those geometries only read cached data (and hence can be performed concurrently).
+		*/
+		void
+		prepare_for_concurrent_distance_queries(
+				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_feature);
+
+		/*
 		* Given the feature handle, find a property by the name.
 		*/
 		OpaqueData
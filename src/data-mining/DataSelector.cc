@@ -34,6 +34,7 @@
 
 #include "CoRegFilterCache.h"
 #include "CoRegFilterMapReduceFactory.h"
+#include "CoRegTargetSpatialPartition.h"
 #include "DataSelector.h"
 #include "DataMiningUtils.h"
 #include "RegionOfInterestFilter.h"
@@ -50,6 +51,7 @@
 #include "opengl/GLRasterCoRegistration.h"
 
 #include "utils/Earth.h"
+#include "utils/ParallelUtils.h"
 #include "utils/Profile.h"
 
 GPlatesDataMining::DataTable GPlatesDataMining::DataSelector::d_data_table;
@@ -323,9 +325,145 @@ GPlatesDataMining::DataSelector::co_register_target_reconstructed_geometries(
 		const double &reconstruction_time,
 		GPlatesDataMining::DataTable &result_data_table)
 {
+	// Need to iterate over 'const' table.
+	const CoRegConfigurationTable &const_cfg_table = d_cfg_table;
+
+	// Reconstruct the target features of each target layer (and spatially partition them) once up front,
+	// rather than once per seed feature, so that region-of-interest filters only test nearby targets.
+	typedef std::map<GPlatesAppLogic::Layer, boost::shared_ptr<CoRegTargetSpatialPartition> >
+			target_spatial_partition_map_type;
+	target_spatial_partition_map_type target_spatial_partitions;
+	BOOST_FOREACH(const ConfigurationTableRow &config_row, const_cfg_table)
+	{
+		// If it's a raster co-registration then ignore it - it's handled in a separate code path.
+		if (config_row.attr_type == CO_REGISTRATION_RASTER_ATTRIBUTE)
+		{
+			continue;
+		}
+
+		// Skip target layers we've already visited.
+		const GPlatesAppLogic::Layer target_layer = config_row.target_layer;
+		if (target_spatial_partitions.find(target_layer) != target_spatial_partitions.end())
+		{
+			continue;
+		}
+
+		// Get the target reconstructed geometries layer proxy.
+		boost::optional<GPlatesAppLogic::ReconstructLayerProxy::non_null_ptr_type> target_layer_proxy =
+				target_layer.get_layer_output<GPlatesAppLogic::ReconstructLayerProxy>();
+		if (!target_layer_proxy)
+		{
+			qWarning() << "DataSelector: Unable to get reconstructed geometries layer output - skipping co-registration.";
+			continue;
+		}
+
+		// Get the reconstructed target features.
+		std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> reconstructed_target_features;
+		target_layer_proxy.get()->get_reconstructed_features(
+				reconstructed_target_features,
+				reconstruction_time);
+
+		target_spatial_partitions.insert(
+				target_spatial_partition_map_type::value_type(
+						target_layer,
+						CoRegTargetSpatialPartition::create(reconstructed_target_features)));
+	}
+
+	const unsigned int num_reconstructed_seed_features = reconstructed_seed_features.size();
+	const unsigned int num_config_rows = const_cfg_table.size();
+
+	// Calculating the distances from each seed feature to its nearby target geometries (the region-of-interest
+	// filter) is the most expensive part of co-registration, so that is done for all seed features
+	// concurrently (over multiple threads). The filtered results are then mapped and reduced (in the
+	// original seed/row order) on this thread, since that accesses the model (which is not thread-safe).
+	//
+	// Before distance queries can run concurrently the seed geometries need to cache their bounds
+	// (the target geometries were prepared when their spatial partitions were created).
+	BOOST_FOREACH(
+			const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+			reconstructed_seed_features)
+	{
+		DataMiningUtils::prepare_for_concurrent_distance_queries(reconstructed_seed_feature);
+	}
+
+	// The target geometries in the region-of-interest of each seed feature for each config row.
+	// Indexed by 'reconstructed_seed_feature_index * num_config_rows + config_row_index'.
+	// Is boost::none if the config row does not use a region-of-interest filter (or the seed is inactive).
+	std::vector< boost::optional<CoRegTargetSpatialPartition::target_geometry_index_seq_type> >
+			region_of_interest_results(num_reconstructed_seed_features * num_config_rows);
+
+	GPlatesUtils::ParallelUtils::parallel_for(
+			num_reconstructed_seed_features,
+			[&](unsigned int reconstructed_seed_feature_index)
+			{
+				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature =
+						reconstructed_seed_features[reconstructed_seed_feature_index];
+
+				// If the seed is inactive then it will not be co-registered.
+				if (reconstructed_seed_feature.get_reconstructions().empty())
+				{
+					return;
+				}
+
+				// Like 'CoRegFilterCache', a region-of-interest with a smaller range only needs to test
+				// the target geometries found within a larger range (of the same target layer).
+				std::vector<unsigned int> cached_config_row_indices;
+
+				for (unsigned int config_row_index = 0; config_row_index < num_config_rows; ++config_row_index)
+				{
+					const ConfigurationTableRow &config_row = const_cfg_table[config_row_index];
+
+					const RegionOfInterestFilter::Config *region_of_interest_filter_cfg =
+							dynamic_cast<const RegionOfInterestFilter::Config *>(config_row.filter_cfg.get());
+					if (config_row.attr_type == CO_REGISTRATION_RASTER_ATTRIBUTE ||
+						!region_of_interest_filter_cfg)
+					{
+						continue;
+					}
+
+					target_spatial_partition_map_type::const_iterator target_spatial_partition_iter =
+							target_spatial_partitions.find(config_row.target_layer);
+					if (target_spatial_partition_iter == target_spatial_partitions.end())
+					{
+						continue;
+					}
+					const CoRegTargetSpatialPartition &target_spatial_partition = *target_spatial_partition_iter->second;
+					const double range = region_of_interest_filter_cfg->range();
+
+					// Find the smallest previous result (of the same target layer) with a range at least as large.
+					boost::optional<const CoRegTargetSpatialPartition::target_geometry_index_seq_type &> target_geometry_subset;
+					BOOST_FOREACH(unsigned int cached_config_row_index, cached_config_row_indices)
+					{
+						const ConfigurationTableRow &cached_config_row = const_cfg_table[cached_config_row_index];
+						const CoRegTargetSpatialPartition::target_geometry_index_seq_type &cached_result =
+								region_of_interest_results[
+										reconstructed_seed_feature_index * num_config_rows + cached_config_row_index].get();
+
+						if (cached_config_row.target_layer == config_row.target_layer &&
+							dynamic_cast<const RegionOfInterestFilter::Config &>(*cached_config_row.filter_cfg).range() >= range &&
+							(!target_geometry_subset || cached_result.size() < target_geometry_subset->size()))
+						{
+							target_geometry_subset = cached_result;
+						}
+					}
+
+					boost::optional<CoRegTargetSpatialPartition::target_geometry_index_seq_type> &result =
+							region_of_interest_results[reconstructed_seed_feature_index * num_config_rows + config_row_index];
+					result = CoRegTargetSpatialPartition::target_geometry_index_seq_type();
+					target_spatial_partition.find_target_geometries_in_region_of_interest(
+							result.get(),
+							reconstructed_seed_feature,
+							range,
+							target_geometry_subset);
+
+					cached_config_row_indices.push_back(config_row_index);
+				}
+			},
+			d_num_worker_threads ? d_num_worker_threads : GPlatesUtils::ParallelUtils::get_num_worker_threads());
+
 	//for each seed feature
 	for (unsigned int reconstructed_seed_feature_index = 0;
-		reconstructed_seed_feature_index < reconstructed_seed_features.size();
+		reconstructed_seed_feature_index < num_reconstructed_seed_features;
 		++reconstructed_seed_feature_index)
 	{
 		const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature =
@@ -343,33 +481,28 @@ GPlatesDataMining::DataSelector::co_register_target_reconstructed_geometries(
 
 		CoRegFilterCache filter_cache;
 
-		// Need to iterate over 'const' table.
-		const CoRegConfigurationTable &const_cfg_table = d_cfg_table;
-
 		//for each row in cfg table
-		BOOST_FOREACH(const ConfigurationTableRow &config_row, const_cfg_table)
+		for (unsigned int config_row_index = 0; config_row_index < num_config_rows; ++config_row_index)
 		{
+			const ConfigurationTableRow &config_row = const_cfg_table[config_row_index];
+
 			// If it's a raster co-registration then ignore it - it's handled in a separate code path.
 			if (config_row.attr_type == CO_REGISTRATION_RASTER_ATTRIBUTE)
 			{
 				continue;
 			}
 
-			// Get the target reconstructed geometries layer proxy.
-			const GPlatesAppLogic::Layer target_layer = config_row.target_layer;
-			boost::optional<GPlatesAppLogic::ReconstructLayerProxy::non_null_ptr_type> target_layer_proxy =
-					target_layer.get_layer_output<GPlatesAppLogic::ReconstructLayerProxy>();
-			if (!target_layer_proxy)
+			// Get the reconstructed target features (and their spatial partition).
+			// If not found then the target layer was not a reconstructed geometries layer (already warned above).
+			target_spatial_partition_map_type::const_iterator target_spatial_partition_iter =
+					target_spatial_partitions.find(config_row.target_layer);
+			if (target_spatial_partition_iter == target_spatial_partitions.end())
 			{
-				qWarning() << "DataSelector: Unable to get reconstructed geometries layer output - skipping co-registration.";
 				continue;
 			}
-
-			// Get the reconstructed target features.
-			std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> reconstructed_target_features;
-			target_layer_proxy.get()->get_reconstructed_features(
-					reconstructed_target_features,
-					reconstruction_time);
+			const CoRegTargetSpatialPartition &target_spatial_partition = *target_spatial_partition_iter->second;
+			const std::vector<GPlatesAppLogic::ReconstructContext::ReconstructedFeature> &reconstructed_target_features =
+					target_spatial_partition.get_reconstructed_target_features();
 
 			boost::shared_ptr< CoRegFilter > filter;
 			boost::shared_ptr< CoRegMapper > mapper;
@@ -379,21 +512,33 @@ GPlatesDataMining::DataSelector::co_register_target_reconstructed_geometries(
 
 			//filter
 			CoRegFilter::reconstructed_feature_vector_type filter_result, cache_hit;
-			if(filter_cache.find(config_row, cache_hit))
+			const boost::optional<CoRegTargetSpatialPartition::target_geometry_index_seq_type> &region_of_interest_result =
+					region_of_interest_results[reconstructed_seed_feature_index * num_config_rows + config_row_index];
+			if (region_of_interest_result)
 			{
-				filter->process(
-						cache_hit.begin(),
-						cache_hit.end(),
-						filter_result);
+				// The region-of-interest filter was already applied (concurrently) above.
+				target_spatial_partition.get_reconstructed_target_features(
+						filter_result,
+						region_of_interest_result.get());
 			}
 			else
 			{
-				filter->process(
-						reconstructed_target_features.begin(),
-						reconstructed_target_features.end(),
-						filter_result);
+				if(filter_cache.find(config_row, cache_hit))
+				{
+					filter->process(
+							cache_hit.begin(),
+							cache_hit.end(),
+							filter_result);
+				}
+				else
+				{
+					filter->process(
+							reconstructed_target_features.begin(),
+							reconstructed_target_features.end(),
+							filter_result);
+				}
+				filter_cache.insert(config_row,filter_result);
 			}
-			filter_cache.insert(config_row,filter_result);
 
 			//map
 			CoRegMapper::MapperOutDataset map_result;
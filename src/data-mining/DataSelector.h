@@ -76,12 +76,18 @@ namespace GPlatesDataMining
 		};
 
 
+		/**
+		 * Seed features are co-registered with target geometries using up to @a num_worker_threads threads.
+		 *
+		 * A value of zero means use 'GPlatesUtils::ParallelUtils::get_num_worker_threads()'.
+		 */
 		static
 		boost::shared_ptr<DataSelector> 
 		create(
-				const CoRegConfigurationTable& table)
+				const CoRegConfigurationTable& table,
+				unsigned int num_worker_threads = 0)
 		{
-			return boost::shared_ptr<DataSelector>(new DataSelector(table));
+			return boost::shared_ptr<DataSelector>(new DataSelector(table, num_worker_threads));
 		}
 
 		
@@ -165,9 +171,12 @@ namespace GPlatesDataMining
 		const DataSelector&
 		operator=(const DataSelector&);
 
-		DataSelector(const CoRegConfigurationTable &table) : 
+		DataSelector(
+				const CoRegConfigurationTable &table,
+				unsigned int num_worker_threads) : 
 			d_cfg_table(table),
-			d_data_index(0)
+			d_data_index(0),
+			d_num_worker_threads(num_worker_threads)
 		{
 			populate_table_header();
 			if(!d_cfg_table.is_optimized())
@@ -178,6 +187,7 @@ namespace GPlatesDataMining
 
 		TableHeader d_table_header;
 		unsigned d_data_index;
+		unsigned int d_num_worker_threads;
 		/*
 		* TODO:
 		* Need to remove the "static" in the future.
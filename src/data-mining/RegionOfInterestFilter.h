@@ -172,6 +172,62 @@ namespace GPlatesDataMining
 
 		~RegionOfInterestFilter(){ }
 
+
+		/**
+		 * Returns true if @a reconstructed_target_geometry is within @a range (in Kms) of any of the
+		 * reconstructed geometries of @a reconstructed_seed_feature.
+		 *
+		 * This only reads the geometries so it can be called concurrently provided the geometries have
+		 * already cached their data (see 'DataMiningUtils::prepare_for_concurrent_distance_queries()').
+		 */
+		static
+		bool
+		is_in_region_of_interest(
+				const GPlatesMaths::GeometryOnSphere &reconstructed_target_geometry,
+				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature &reconstructed_seed_feature,
+				const double &range)
+		{
+			// Convert range from kms to radians.
+			double range_in_radians = range / GPlatesUtils::Earth::EQUATORIAL_RADIUS_KMS;
+			if (range_in_radians > GPlatesMaths::PI)
+			{
+				range_in_radians = GPlatesMaths::PI;
+			}
+			const GPlatesMaths::AngularExtent range_angular_extent =
+					GPlatesMaths::AngularExtent::create_from_angle(range_in_radians);
+
+			const GPlatesAppLogic::ReconstructContext::ReconstructedFeature::reconstruction_seq_type &
+					reconstructed_seed_geometries = reconstructed_seed_feature.get_reconstructions();
+
+			// Iterate over the reconstructed seed feature's geometries.
+			// If the target geometry is close enough to any of the seed geometries then it's in the region.
+			BOOST_FOREACH(
+					const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_seed_geom,
+					reconstructed_seed_geometries)
+			{
+				// Calculate minimum distance between the two geometries.
+				//
+				// The returned distance will either be less than 'range_in_radians' threshold or
+				// AngularDistance::PI (maximum possible distance) to signify threshold exceeded.
+				const GPlatesMaths::AngularDistance min_dist = minimum_distance(
+						*reconstructed_seed_geom.get_reconstructed_feature_geometry()->reconstructed_geometry(), 
+						reconstructed_target_geometry, 
+						// If either (or both) geometry is a polygon then the distance will be zero
+						// if the other geometry overlaps its interior...
+						true/*geometry1_interior_is_solid*/,
+						true/*geometry2_interior_is_solid*/,
+						range_angular_extent);
+
+				// If the minimum distance was less than the threshold 'range_in_radians'...
+				if (min_dist != GPlatesMaths::AngularDistance::PI)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
 	protected:
 
 		void
@@ -182,53 +238,21 @@ namespace GPlatesDataMining
 			const GPlatesAppLogic::ReconstructContext::ReconstructedFeature::reconstruction_seq_type &
 					reconstructed_target_geometries = reconstructed_target_feature.get_reconstructions();
 
-			// Iterate over the reconstructed target feature's geometries first.
+			// Iterate over the reconstructed target feature's geometries.
+			// If the current target geometry is close enough to any of the seed geometries then add it.
 			BOOST_FOREACH(
 					const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_target_geom,
 					reconstructed_target_geometries)
 			{
-				const GPlatesAppLogic::ReconstructContext::ReconstructedFeature::reconstruction_seq_type &
-						reconstructed_seed_geometries = d_reconstructed_seed_feature.get_reconstructions();
-
-				// Iterate over the reconstructed seed feature's geometries.
-				// If the current target geometry is close enough to any of the seed geometries then add it.
-				BOOST_FOREACH(
-						const GPlatesAppLogic::ReconstructContext::Reconstruction &reconstructed_seed_geom,
-						reconstructed_seed_geometries)
+				if (is_in_region_of_interest(
+						*reconstructed_target_geom.get_reconstructed_feature_geometry()->reconstructed_geometry(),
+						d_reconstructed_seed_feature,
+						d_range))
 				{
-					// Convert range from kms to radians.
-					double range_in_radians = d_range / GPlatesUtils::Earth::EQUATORIAL_RADIUS_KMS;
-					if (range_in_radians > GPlatesMaths::PI)
-					{
-						range_in_radians = GPlatesMaths::PI;
-					}
-
-					// Calculate minimum distance between the two geometries.
-					//
-					// The returned distance will either be less than 'range_in_radians' threshold or
-					// AngularDistance::PI (maximum possible distance) to signify threshold exceeded.
-					const GPlatesMaths::AngularExtent range_angular_extent =
-							GPlatesMaths::AngularExtent::create_from_angle(range_in_radians);
-					const GPlatesMaths::AngularDistance min_dist = minimum_distance(
-							*reconstructed_seed_geom.get_reconstructed_feature_geometry()->reconstructed_geometry(), 
-							*reconstructed_target_geom.get_reconstructed_feature_geometry()->reconstructed_geometry(), 
-							// If either (or both) geometry is a polygon then the distance will be zero
-							// if the other geometry overlaps its interior...
-							true/*geometry1_interior_is_solid*/,
-							true/*geometry2_interior_is_solid*/,
-							range_angular_extent);
-
-					// If the minimum distance was less than the threshold 'range_in_radians'...
-					if (min_dist != GPlatesMaths::AngularDistance::PI)
-					{
-						filtered_reconstructed_target_geometries.push_back(
-								GPlatesAppLogic::ReconstructContext::Reconstruction(
-										reconstructed_target_geom.get_geometry_property_handle(),
-										reconstructed_target_geom.get_reconstructed_feature_geometry()));
-
-						// Only add the current reconstructed target geometry once.
-						break;
-					}
+					filtered_reconstructed_target_geometries.push_back(
+							GPlatesAppLogic::ReconstructContext::Reconstruction(
+									reconstructed_target_geom.get_geometry_property_handle(),
+									reconstructed_target_geom.get_reconstructed_feature_geometry()));
 				}
 			}
 		}
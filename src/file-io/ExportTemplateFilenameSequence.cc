@@ -46,6 +46,25 @@ GPlatesFileIO::ExportTemplateFilename::validate_filename_template(
 }
 
 
+bool
+GPlatesFileIO::ExportTemplateFilename::does_filename_template_vary_with_time(
+		const QString &filename_template)
+{
+	try
+	{
+		ExportTemplateFilenameSequenceImpl::validate_filename_template(
+				filename_template,
+				true/*check_filename_variation*/);
+	}
+	catch (NoFilenameVariation &)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+
 GPlatesFileIO::ExportTemplateFilenameSequence::ExportTemplateFilenameSequence(
 		const QString &filename_template,
 		const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
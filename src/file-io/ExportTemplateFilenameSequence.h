@@ -81,6 +81,17 @@ namespace GPlatesFileIO
 				bool check_filename_variation = true);
 
 
+		/**
+		 * Returns true if the filename template has a format string that varies with
+		 * reconstruction time (or frame), so that each exported frame gets its own filename.
+		 *
+		 * @throws UnrecognisedFormatString if no format recognised at a '%' char.
+		 */
+		bool
+		does_filename_template_vary_with_time(
+				const QString &filename_template);
+
+
 		/**
 		 * Format string reserved for use by the client.
 		 *
@@ -38,6 +38,8 @@
 #include "FeatureCollectionFileFormatConfigurations.h"
 #include "FileFormatNotSupportedException.h"
 #include "FileInfo.h"
+#include "GdatOutputVisitor.h"
+#include "GdatReader.h"
 #include "GeoscimlProfile.h"
 #include "GmapReader.h"
 #include "GMTFormatWriter.h"
@@ -137,6 +139,7 @@ namespace GPlatesFileIO
 			const QString FILE_FORMAT_EXT_WRITE_ONLY_XY_GMT = "xy";
 			const QString FILE_FORMAT_EXT_GMAP = "vgp";
 			const QString FILE_FORMAT_EXT_GSML = "gsml";
+			const QString FILE_FORMAT_EXT_GDAT = "gdat";
 
 
 
@@ -284,6 +287,19 @@ namespace GPlatesFileIO
 								true/*use_gzip*/));
 			}
 
+			/**
+			 * Creates a GDAT feature visitor writer.
+			 */
+			boost::shared_ptr<GPlatesModel::ConstFeatureVisitor>
+			create_gdat_feature_collection_writer(
+					File::Reference &file_ref)
+			{
+				return boost::shared_ptr<GPlatesModel::ConstFeatureVisitor>(
+						new GdatOutputVisitor(
+								file_ref.get_file_info(),
+								file_ref.get_feature_collection()));
+			}
+
 			/**
 			 * Creates a PLATES4_LINE feature visitor writer.
 			 */
@@ -973,4 +989,20 @@ GPlatesFileIO::FeatureCollectionFileFormat::Registry::register_default_file_form
 			boost::none,
 			// No configuration options yet for this file format...
 			boost::none);
+
+	classifications_type gdat_classification;
+	gdat_classification.set(); // Set all flags - GDAT can handle everything (that GPML can).
+	register_file_format(
+			GDAT,
+			"GPlates binary feature collection",
+			std::vector<QString>(1, FILE_FORMAT_EXT_GDAT),
+			gdat_classification,
+			&file_name_ends_with,
+			Registry::read_feature_collection_function_type(
+					boost::bind(&GdatReader::read_file,
+							_1, gpml_property_structural_type_reader, _2, _3)),
+			Registry::create_feature_collection_writer_function_type(
+					boost::bind(&create_gdat_feature_collection_writer, _1)),
+			// No configuration options yet for this file format...
+			boost::none);
 }
@@ -43,6 +43,7 @@
 #include <boost/type_traits/is_floating_point.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <QDateTime>
+#include <QSysInfo>
 
 #include <ogr_spatialref.h>
 
@@ -1774,6 +1775,9 @@ GPlatesFileIO::GDALRasterReader::write_source_raster_file_cache(
 	// Write version number.
 	out << static_cast<quint32>(RasterFileCacheFormat::VERSION_NUMBER);
 
+	// Everything after the version number is written in the byte order of the current version.
+	out.setByteOrder(RasterFileCacheFormat::get_byte_order(RasterFileCacheFormat::VERSION_NUMBER));
+
 	// Write source raster type.
 	out << static_cast<quint32>(RasterFileCacheFormat::get_type_as_enum<typename RawRasterType::element_type>());
 
@@ -1932,8 +1936,10 @@ GPlatesFileIO::GDALRasterReader::write_source_raster_file_cache(
 
 	// Write the total size of the cache file so the reader can verify that the
 	// file was not partially written.
+	// NOTE: The file size is always big endian (regardless of the version's byte order).
 	cache_file.seek(file_size_file_offset);
 	total_cache_file_size = cache_file.size();
+	out.setByteOrder(QDataStream::BigEndian);
 	out << total_cache_file_size;
 }
 
@@ -2251,8 +2257,9 @@ GPlatesFileIO::GDALRasterReader::hilbert_curve_traversal(
 			block_info.height = RasterFileCacheFormat::BLOCK_SIZE;
 		}
 
-		// Record the file offset of the current block of data.
-		block_info.main_offset = out.device()->pos();
+		// Record the (aligned) file offset of the current block of data.
+		block_info.main_offset = RasterFileCacheFormat::write_block_data_alignment_padding(
+				out, out.device()->pos());
 
 		// TODO: Add coverage data.
 		block_info.coverage_offset = 0;
@@ -2272,6 +2279,12 @@ GPlatesFileIO::GDALRasterReader::hilbert_curve_traversal(
 
 		PROFILE_BLOCK("Write GDAL raster data to file cache");
 
+		// If the stream byte order matches the native byte order then each row can be written
+		// in one go (bypassing the much slower per-element output operator '<<').
+		const bool write_raw_rows =
+				(out.byteOrder() == QDataStream::LittleEndian) ==
+					(QSysInfo::ByteOrder == QSysInfo::LittleEndian);
+
 		// Write the current block from the source region to the output stream.
 		for (unsigned int y = 0; y < block_info.height; ++y)
 		{
@@ -2281,9 +2294,18 @@ GPlatesFileIO::GDALRasterReader::hilbert_curve_traversal(
 						std::size_t(block_info.y_offset - source_region.y() + y) * source_region.width() +
 						block_info.x_offset - source_region.x();
 
-			for (unsigned int x = 0; x < block_info.width; ++x)
+			if (write_raw_rows)
+			{
+				out.writeRawData(
+						reinterpret_cast<const char *>(source_region_row),
+						block_info.width * sizeof(typename RawRasterType::element_type));
+			}
+			else
 			{
-				out << source_region_row[x];
+				for (unsigned int x = 0; x < block_info.width; ++x)
+				{
+					out << source_region_row[x];
+				}
 			}
 		}
 
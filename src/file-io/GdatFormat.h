@@ -0,0 +1,138 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILEIO_GDATFORMAT_H
+#define GPLATES_FILEIO_GDATFORMAT_H
+
+#include <QDataStream>
+#include <QtGlobal>
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Constants shared by the writer (@a GdatOutputVisitor) and reader (@a GdatReader) of the
+	 * binary 'gdat' feature collection file format.
+	 *
+	 * A 'gdat' file is a versioned binary snapshot of a feature collection.
+	 * It stores the same features as GPML but avoids the cost of expanding them as XML.
+	 *
+	 * The file starts with a header:
+	 *  - the signature (@a SIGNATURE),
+	 *  - the byte order (@a BYTE_ORDER_BIG_ENDIAN or @a BYTE_ORDER_LITTLE_ENDIAN) used by the rest of the file,
+	 *  - the format version (@a VERSION),
+	 *  - the GPGIM version string of the GPlates that wrote the file.
+	 *
+	 * The header is followed by a sequence of records (each starting with a @a RecordTag).
+	 * The byte order is the native byte order of the writing machine so that arrays of vertices
+	 * can be written and read directly as raw memory (they are only byte-swapped when the file
+	 * is read on a machine of the opposite byte order).
+	 *
+	 * Qualified XML names (feature types, property names, structural types, etc) are written
+	 * only once - the first occurrence assigns the name an index and subsequent occurrences
+	 * only write the index.
+	 */
+	namespace GdatFormat
+	{
+		/**
+		 * The file signature (written as individual 8-bit characters).
+		 */
+		const char SIGNATURE[] = "GPlatesBinaryFeatureCollection";
+
+		/**
+		 * The current format version.
+		 *
+		 * Increment this when the format changes.
+		 * Files with a version greater than this cannot be read.
+		 */
+		const quint32 VERSION = 1;
+
+		/**
+		 * The Qt data stream version used to read/write strings.
+		 *
+		 * NOTE: This should not be changed (since it affects the format of existing files).
+		 */
+		const int QT_STREAM_VERSION = QDataStream::Qt_4_4;
+
+		//! Values for the byte order written in the file header.
+		const quint8 BYTE_ORDER_BIG_ENDIAN = 0;
+		const quint8 BYTE_ORDER_LITTLE_ENDIAN = 1;
+
+
+		/**
+		 * Tags identifying the records that follow the file header.
+		 */
+		enum RecordTag
+		{
+			END_OF_FILE_RECORD = 0,
+			FEATURE_RECORD,
+			PROPERTY_RECORD,
+			END_OF_FEATURE_RECORD
+		};
+
+
+		/**
+		 * How the property values of a top-level property are encoded.
+		 */
+		enum PropertyEncoding
+		{
+			//! The property values are encoded using the binary @a PropertyValueTag records.
+			BINARY_PROPERTY_ENCODING = 0,
+
+			//! The property is encoded as GPML (used for property values without a binary encoding).
+			GPML_PROPERTY_ENCODING
+		};
+
+
+		/**
+		 * Tags identifying the property value types that have a binary encoding.
+		 *
+		 * NOTE: Only append new tags (existing tag values must not change).
+		 */
+		enum PropertyValueTag
+		{
+			ENUMERATION_TAG = 0,
+			GML_LINE_STRING_TAG,
+			GML_MULTI_POINT_TAG,
+			GML_ORIENTABLE_CURVE_TAG,
+			GML_POINT_TAG,
+			GML_POLYGON_TAG,
+			GML_TIME_INSTANT_TAG,
+			GML_TIME_PERIOD_TAG,
+			GPML_CONSTANT_VALUE_TAG,
+			GPML_KEY_VALUE_DICTIONARY_TAG,
+			GPML_PLATE_ID_TAG,
+			XS_BOOLEAN_TAG,
+			XS_DOUBLE_TAG,
+			XS_INTEGER_TAG,
+			XS_STRING_TAG,
+			GPML_FINITE_ROTATION_TAG,
+			GPML_FINITE_ROTATION_SLERP_TAG,
+			GPML_IRREGULAR_SAMPLING_TAG
+		};
+	}
+}
+
+#endif // GPLATES_FILEIO_GDATFORMAT_H
@@ -0,0 +1,671 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <vector>
+#include <QBuffer>
+#include <QSysInfo>
+
+#include "GdatOutputVisitor.h"
+
+#include "ErrorOpeningFileForWritingException.h"
+#include "GdatFormat.h"
+#include "GpmlOutputVisitor.h"
+
+#include "global/GPlatesAssert.h"
+#include "global/AssertionFailureException.h"
+
+#include "maths/FiniteRotation.h"
+#include "maths/MultiPointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/PolylineOnSphere.h"
+
+#include "model/FeatureHandle.h"
+#include "model/Gpgim.h"
+#include "model/GpgimVersion.h"
+#include "model/Metadata.h"
+#include "model/TopLevelPropertyInline.h"
+
+#include "property-values/Enumeration.h"
+#include "property-values/GmlLineString.h"
+#include "property-values/GmlMultiPoint.h"
+#include "property-values/GmlOrientableCurve.h"
+#include "property-values/GmlPoint.h"
+#include "property-values/GmlPolygon.h"
+#include "property-values/GmlTimeInstant.h"
+#include "property-values/GmlTimePeriod.h"
+#include "property-values/GpmlConstantValue.h"
+#include "property-values/GpmlFiniteRotation.h"
+#include "property-values/GpmlFiniteRotationSlerp.h"
+#include "property-values/GpmlIrregularSampling.h"
+#include "property-values/GpmlKeyValueDictionary.h"
+#include "property-values/GpmlPlateId.h"
+#include "property-values/XsBoolean.h"
+#include "property-values/XsDouble.h"
+#include "property-values/XsInteger.h"
+#include "property-values/XsString.h"
+
+#include "utils/UnicodeStringUtils.h"
+
+
+namespace GPlatesFileIO
+{
+	namespace
+	{
+		/**
+		 * Writes the points in the sequence [@a points_begin, @a points_end) as a count followed
+		 * by the raw (native byte order) x, y and z components of each point.
+		 */
+		template <typename PointIter>
+		void
+		write_points(
+				QDataStream &output_stream,
+				PointIter points_begin,
+				PointIter points_end,
+				unsigned int num_points)
+		{
+			std::vector<double> components;
+			components.reserve(3 * num_points);
+			for (PointIter points_iter = points_begin; points_iter != points_end; ++points_iter)
+			{
+				const GPlatesMaths::UnitVector3D &position = points_iter->position_vector();
+				components.push_back(position.x().dval());
+				components.push_back(position.y().dval());
+				components.push_back(position.z().dval());
+			}
+
+			output_stream << static_cast<quint32>(num_points);
+			if (num_points > 0)
+			{
+				output_stream.writeRawData(
+						reinterpret_cast<const char *>(&components[0]),
+						components.size() * sizeof(double));
+			}
+		}
+	}
+}
+
+
+GPlatesFileIO::GdatOutputVisitor::GdatOutputVisitor(
+		const FileInfo &file_info,
+		const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref) :
+	d_output_file(file_info.get_qfileinfo().filePath()),
+	d_feature_collection_ref(feature_collection_ref),
+	d_property_value_stream(NULL),
+	d_wrote_property_value(false),
+	d_can_write_property_as_binary(true)
+{
+	if (!d_output_file.open(QIODevice::WriteOnly))
+	{
+		throw ErrorOpeningFileForWritingException(GPLATES_EXCEPTION_SOURCE,
+				file_info.get_qfileinfo().filePath());
+	}
+
+	d_output_stream.setDevice(&d_output_file);
+	d_output_stream.setVersion(GdatFormat::QT_STREAM_VERSION);
+
+	// Use the native byte order so that vertex arrays can be written as raw memory
+	// (and read back without byte swapping on machines with the same byte order).
+	const bool is_big_endian = (QSysInfo::ByteOrder == QSysInfo::BigEndian);
+	d_output_stream.setByteOrder(is_big_endian ? QDataStream::BigEndian : QDataStream::LittleEndian);
+
+	// Write the signature.
+	for (unsigned int n = 0; n < sizeof(GdatFormat::SIGNATURE) - 1; ++n)
+	{
+		d_output_stream << static_cast<qint8>(GdatFormat::SIGNATURE[n]);
+	}
+
+	d_output_stream << (is_big_endian ? GdatFormat::BYTE_ORDER_BIG_ENDIAN : GdatFormat::BYTE_ORDER_LITTLE_ENDIAN);
+	d_output_stream << GdatFormat::VERSION;
+
+	// The version of the GPGIM built into the current GPlates.
+	const GPlatesModel::GpgimVersion &gpgim_version = GPlatesModel::Gpgim::instance().get_version();
+	d_output_stream << gpgim_version.get_version_string();
+
+	// Also store the GPGIM version in the feature collection as a tag (like the GPML writer does).
+	if (d_feature_collection_ref.is_valid())
+	{
+		d_feature_collection_ref->tags()[GPlatesModel::GpgimVersion::FEATURE_COLLECTION_TAG] = gpgim_version;
+	}
+
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			d_output_stream.status() == QDataStream::Ok,
+			GPLATES_ASSERTION_SOURCE);
+}
+
+
+GPlatesFileIO::GdatOutputVisitor::~GdatOutputVisitor()
+{
+	// Wrap the entire body of the function in a 'try {  } catch(...)' block so that no
+	// exceptions can escape from the destructor.
+	try
+	{
+		d_output_stream << static_cast<quint8>(GdatFormat::END_OF_FILE_RECORD);
+	}
+	catch (...)
+	{
+	}
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_feature_handle(
+		const GPlatesModel::FeatureHandle &feature_handle)
+{
+	d_output_stream << static_cast<quint8>(GdatFormat::FEATURE_RECORD);
+
+	write_qualified_name(d_output_stream, feature_handle.feature_type());
+	write_string(d_output_stream, feature_handle.feature_id().get());
+	write_string(d_output_stream, feature_handle.revision_id().get());
+
+	// Now visit each of the properties in turn.
+	visit_feature_properties(feature_handle);
+
+	d_output_stream << static_cast<quint8>(GdatFormat::END_OF_FEATURE_RECORD);
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_top_level_property_inline(
+		const GPlatesModel::TopLevelPropertyInline &top_level_property_inline)
+{
+	// Write the property record header before buffering the property values.
+	// Qualified names are assigned indices in the order they are first written, and the reader
+	// expects each new name to be read in that order - so the property name (and any names in
+	// its XML attributes) must get their indices before any names used by the property values.
+	d_output_stream << static_cast<quint8>(GdatFormat::PROPERTY_RECORD);
+	write_qualified_name(d_output_stream, top_level_property_inline.property_name());
+	write_xml_attributes(d_output_stream, top_level_property_inline.xml_attributes());
+
+	// Qualified names first written by the property values are discarded if the property
+	// gets written as GPML instead (so we need to be able to remove them from the name table).
+	const std::size_t num_qualified_names = d_qualified_names.size();
+
+	// Write the property values to a separate buffer since they get discarded if any property
+	// value cannot be written as binary.
+	d_property_value_data.clear();
+	QDataStream property_value_stream(&d_property_value_data, QIODevice::WriteOnly);
+	property_value_stream.setVersion(d_output_stream.version());
+	property_value_stream.setByteOrder(d_output_stream.byteOrder());
+	d_property_value_stream = &property_value_stream;
+
+	d_can_write_property_as_binary = true;
+
+	property_value_stream << static_cast<quint32>(top_level_property_inline.size());
+
+	GPlatesModel::TopLevelPropertyInline::const_iterator property_values_iter = top_level_property_inline.begin();
+	GPlatesModel::TopLevelPropertyInline::const_iterator property_values_end = top_level_property_inline.end();
+	for ( ; d_can_write_property_as_binary && property_values_iter != property_values_end; ++property_values_iter)
+	{
+		write_property_value(**property_values_iter);
+	}
+
+	d_property_value_stream = NULL;
+
+	if (!d_can_write_property_as_binary)
+	{
+		// Remove the qualified names added while writing the discarded property values.
+		while (d_qualified_names.size() > num_qualified_names)
+		{
+			d_qualified_name_indices.erase(d_qualified_names.back());
+			d_qualified_names.pop_back();
+		}
+	}
+
+	if (d_can_write_property_as_binary)
+	{
+		d_output_stream << static_cast<quint8>(GdatFormat::BINARY_PROPERTY_ENCODING);
+		d_output_stream.writeRawData(d_property_value_data.constData(), d_property_value_data.size());
+	}
+	else
+	{
+		d_output_stream << static_cast<quint8>(GdatFormat::GPML_PROPERTY_ENCODING);
+		write_property_as_gpml(top_level_property_inline);
+	}
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_enumeration(
+		const GPlatesPropertyValues::Enumeration &enumeration)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::ENUMERATION_TAG);
+	write_qualified_name(*d_property_value_stream, enumeration.type());
+	write_string(*d_property_value_stream, enumeration.value().get());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gml_line_string(
+		const GPlatesPropertyValues::GmlLineString &gml_line_string)
+{
+	const GPlatesMaths::PolylineOnSphere &polyline = *gml_line_string.polyline();
+
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GML_LINE_STRING_TAG);
+	write_points(*d_property_value_stream,
+			polyline.vertex_begin(), polyline.vertex_end(), polyline.number_of_vertices());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gml_multi_point(
+		const GPlatesPropertyValues::GmlMultiPoint &gml_multi_point)
+{
+	const GPlatesMaths::MultiPointOnSphere &multi_point = *gml_multi_point.multipoint();
+
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GML_MULTI_POINT_TAG);
+	write_points(*d_property_value_stream,
+			multi_point.begin(), multi_point.end(), multi_point.number_of_points());
+
+	// One 'gml:pos' or 'gml:coordinates' flag per point.
+	const std::vector<GPlatesPropertyValues::GmlPoint::GmlProperty> &gml_properties = gml_multi_point.gml_properties();
+	*d_property_value_stream << static_cast<quint32>(gml_properties.size());
+	for (unsigned int n = 0; n < gml_properties.size(); ++n)
+	{
+		*d_property_value_stream << static_cast<quint8>(gml_properties[n]);
+	}
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gml_orientable_curve(
+		const GPlatesPropertyValues::GmlOrientableCurve &gml_orientable_curve)
+{
+	const GPlatesMaths::PolylineOnSphere &polyline = *gml_orientable_curve.base_curve()->polyline();
+
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GML_ORIENTABLE_CURVE_TAG);
+	write_xml_attributes(*d_property_value_stream, gml_orientable_curve.xml_attributes());
+	write_points(*d_property_value_stream,
+			polyline.vertex_begin(), polyline.vertex_end(), polyline.number_of_vertices());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gml_point(
+		const GPlatesPropertyValues::GmlPoint &gml_point)
+{
+	// Write the 2D position (rather than the point on sphere) since this is what GPML stores
+	// (and it preserves the longitude at the poles).
+	const std::pair<double, double> &point_2d = gml_point.point_2d();
+
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GML_POINT_TAG);
+	*d_property_value_stream << point_2d.first << point_2d.second;
+	*d_property_value_stream << static_cast<quint8>(gml_point.gml_property());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gml_polygon(
+		const GPlatesPropertyValues::GmlPolygon &gml_polygon)
+{
+	const GPlatesMaths::PolygonOnSphere &polygon = *gml_polygon.polygon();
+
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GML_POLYGON_TAG);
+	write_points(*d_property_value_stream,
+			polygon.exterior_ring_vertex_begin(),
+			polygon.exterior_ring_vertex_end(),
+			polygon.number_of_vertices_in_exterior_ring());
+
+	const unsigned int num_interior_rings = polygon.number_of_interior_rings();
+	*d_property_value_stream << static_cast<quint32>(num_interior_rings);
+	for (unsigned int interior_ring_index = 0; interior_ring_index < num_interior_rings; ++interior_ring_index)
+	{
+		write_points(*d_property_value_stream,
+				polygon.interior_ring_vertex_begin(interior_ring_index),
+				polygon.interior_ring_vertex_end(interior_ring_index),
+				polygon.number_of_vertices_in_interior_ring(interior_ring_index));
+	}
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gml_time_instant(
+		const GPlatesPropertyValues::GmlTimeInstant &gml_time_instant)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GML_TIME_INSTANT_TAG);
+
+	// Note that the distant past and distant future are positive and negative infinity.
+	*d_property_value_stream << gml_time_instant.time_position().value();
+	write_xml_attributes(*d_property_value_stream, gml_time_instant.time_position_xml_attributes());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gml_time_period(
+		const GPlatesPropertyValues::GmlTimePeriod &gml_time_period)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GML_TIME_PERIOD_TAG);
+
+	// The begin and end time instants follow.
+	write_property_value(*gml_time_period.begin());
+	write_property_value(*gml_time_period.end());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gpml_constant_value(
+		const GPlatesPropertyValues::GpmlConstantValue &gpml_constant_value)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GPML_CONSTANT_VALUE_TAG);
+	write_qualified_name(*d_property_value_stream, gpml_constant_value.value_type());
+	write_string(*d_property_value_stream, gpml_constant_value.description());
+
+	write_property_value(*gpml_constant_value.value());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gpml_finite_rotation(
+		const GPlatesPropertyValues::GpmlFiniteRotation &gpml_finite_rotation)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GPML_FINITE_ROTATION_TAG);
+
+	// The rotation metadata (written as a 'gpml:TotalReconstructionPole' in GPML).
+	const GPlatesModel::MetadataContainer &metadata = gpml_finite_rotation.metadata();
+	*d_property_value_stream << static_cast<quint32>(metadata.size());
+	for (unsigned int n = 0; n < metadata.size(); ++n)
+	{
+		*d_property_value_stream << metadata[n]->get_name() << metadata[n]->get_content();
+	}
+
+	// Like GPML, write the Euler pole and angle (a zero rotation has no determinate pole).
+	const bool is_zero_rotation = gpml_finite_rotation.is_zero_rotation();
+	*d_property_value_stream << static_cast<quint8>(is_zero_rotation ? 1 : 0);
+	if (!is_zero_rotation)
+	{
+		const GPlatesMaths::FiniteRotation &finite_rotation = gpml_finite_rotation.finite_rotation();
+		const GPlatesMaths::UnitQuaternion3D::RotationParams rotation_params =
+				finite_rotation.unit_quat().get_rotation_params(finite_rotation.axis_hint());
+
+		*d_property_value_stream
+				<< rotation_params.axis.x().dval()
+				<< rotation_params.axis.y().dval()
+				<< rotation_params.axis.z().dval()
+				<< rotation_params.angle.dval();
+	}
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gpml_finite_rotation_slerp(
+		const GPlatesPropertyValues::GpmlFiniteRotationSlerp &gpml_finite_rotation_slerp)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GPML_FINITE_ROTATION_SLERP_TAG);
+	write_qualified_name(*d_property_value_stream, gpml_finite_rotation_slerp.value_type());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gpml_irregular_sampling(
+		const GPlatesPropertyValues::GpmlIrregularSampling &gpml_irregular_sampling)
+{
+	const std::vector<GPlatesPropertyValues::GpmlTimeSample> &time_samples =
+			gpml_irregular_sampling.time_samples();
+
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GPML_IRREGULAR_SAMPLING_TAG);
+	write_qualified_name(*d_property_value_stream, gpml_irregular_sampling.value_type());
+
+	*d_property_value_stream << static_cast<quint32>(time_samples.size());
+	for (unsigned int n = 0; n < time_samples.size(); ++n)
+	{
+		write_gpml_time_sample(time_samples[n]);
+	}
+
+	// The interpolation function is optional.
+	if (gpml_irregular_sampling.interpolation_function())
+	{
+		*d_property_value_stream << static_cast<quint8>(1);
+		write_property_value(*gpml_irregular_sampling.interpolation_function());
+	}
+	else
+	{
+		*d_property_value_stream << static_cast<quint8>(0);
+	}
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gpml_key_value_dictionary(
+		const GPlatesPropertyValues::GpmlKeyValueDictionary &gpml_key_value_dictionary)
+{
+	const std::vector<GPlatesPropertyValues::GpmlKeyValueDictionaryElement> &elements =
+			gpml_key_value_dictionary.elements();
+
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GPML_KEY_VALUE_DICTIONARY_TAG);
+	*d_property_value_stream << static_cast<quint32>(elements.size());
+	for (unsigned int n = 0; n < elements.size(); ++n)
+	{
+		const GPlatesPropertyValues::GpmlKeyValueDictionaryElement &element = elements[n];
+
+		write_string(*d_property_value_stream, element.key()->value().get());
+		write_qualified_name(*d_property_value_stream, element.value_type());
+		write_property_value(*element.value());
+	}
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_gpml_plate_id(
+		const GPlatesPropertyValues::GpmlPlateId &gpml_plate_id)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::GPML_PLATE_ID_TAG);
+	*d_property_value_stream << static_cast<quint64>(gpml_plate_id.value());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_xs_boolean(
+		const GPlatesPropertyValues::XsBoolean &xs_boolean)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::XS_BOOLEAN_TAG);
+	*d_property_value_stream << static_cast<quint8>(xs_boolean.value() ? 1 : 0);
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_xs_double(
+		const GPlatesPropertyValues::XsDouble &xs_double)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::XS_DOUBLE_TAG);
+	*d_property_value_stream << static_cast<double>(xs_double.value());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_xs_integer(
+		const GPlatesPropertyValues::XsInteger &xs_integer)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::XS_INTEGER_TAG);
+	*d_property_value_stream << static_cast<qint32>(xs_integer.value());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::visit_xs_string(
+		const GPlatesPropertyValues::XsString &xs_string)
+{
+	*d_property_value_stream << static_cast<quint8>(GdatFormat::XS_STRING_TAG);
+	write_string(*d_property_value_stream, xs_string.value().get());
+
+	d_wrote_property_value = true;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::write_property_value(
+		const GPlatesModel::PropertyValue &property_value)
+{
+	// No need to write anything if a previous property value could not be written.
+	if (!d_can_write_property_as_binary)
+	{
+		return;
+	}
+
+	d_wrote_property_value = false;
+	property_value.accept_visitor(*this);
+
+	// Property value types without a binary encoding are not visited (by this class).
+	if (!d_wrote_property_value)
+	{
+		d_can_write_property_as_binary = false;
+	}
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::write_gpml_time_sample(
+		const GPlatesPropertyValues::GpmlTimeSample &gpml_time_sample)
+{
+	write_qualified_name(*d_property_value_stream, gpml_time_sample.value_type());
+	write_property_value(*gpml_time_sample.value());
+	write_property_value(*gpml_time_sample.valid_time());
+
+	// The description is optional.
+	if (gpml_time_sample.description())
+	{
+		*d_property_value_stream << static_cast<quint8>(1);
+		write_string(*d_property_value_stream, gpml_time_sample.description()->value().get());
+	}
+	else
+	{
+		*d_property_value_stream << static_cast<quint8>(0);
+	}
+
+	*d_property_value_stream << static_cast<quint8>(gpml_time_sample.is_disabled() ? 1 : 0);
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::write_property_as_gpml(
+		const GPlatesModel::TopLevelPropertyInline &top_level_property_inline)
+{
+	// The GPML property readers need to know the structural type of the property value.
+	// Top-level properties only contain a single property value in practice.
+	GPlatesGlobal::Assert<GPlatesGlobal::AssertionFailureException>(
+			top_level_property_inline.size() > 0,
+			GPLATES_ASSERTION_SOURCE);
+	write_qualified_name(d_output_stream, (*top_level_property_inline.begin())->get_structural_type());
+
+	// Write the property as a GPML document containing only the property element
+	// (the document's root element declares the namespace aliases used by the property).
+	QByteArray gpml_data;
+	{
+		QBuffer gpml_buffer(&gpml_data);
+		gpml_buffer.open(QIODevice::WriteOnly);
+
+		// The GPML document is finished when the GPML writer is destroyed.
+		GpmlOutputVisitor gpml_writer(&gpml_buffer, d_feature_collection_ref);
+		top_level_property_inline.accept_visitor(gpml_writer);
+	}
+
+	d_output_stream << gpml_data;
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::write_qualified_name(
+		QDataStream &output_stream,
+		const GPlatesUtils::UnicodeString &namespace_uri,
+		const GPlatesUtils::UnicodeString &namespace_alias,
+		const GPlatesUtils::UnicodeString &name)
+{
+	const qualified_name_key_type qualified_name_key(namespace_uri, namespace_alias, name);
+
+	const std::pair<qualified_name_index_map_type::iterator, bool> inserted =
+			d_qualified_name_indices.insert(
+					qualified_name_index_map_type::value_type(qualified_name_key, d_qualified_names.size()));
+
+	// Write the index of the qualified name.
+	output_stream << inserted.first->second;
+
+	// If it's the first occurrence then the index is a new index and the name follows it.
+	if (inserted.second)
+	{
+		d_qualified_names.push_back(qualified_name_key);
+
+		write_string(output_stream, namespace_uri);
+		write_string(output_stream, namespace_alias);
+		write_string(output_stream, name);
+	}
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::write_xml_attributes(
+		QDataStream &output_stream,
+		const xml_attributes_type &xml_attributes)
+{
+	output_stream << static_cast<quint32>(xml_attributes.size());
+
+	xml_attributes_type::const_iterator xml_attributes_iter = xml_attributes.begin();
+	xml_attributes_type::const_iterator xml_attributes_end = xml_attributes.end();
+	for ( ; xml_attributes_iter != xml_attributes_end; ++xml_attributes_iter)
+	{
+		write_qualified_name(output_stream, xml_attributes_iter->first);
+		write_string(output_stream, xml_attributes_iter->second.get());
+	}
+}
+
+
+void
+GPlatesFileIO::GdatOutputVisitor::write_string(
+		QDataStream &output_stream,
+		const GPlatesUtils::UnicodeString &string)
+{
+	output_stream << GPlatesUtils::make_qstring_from_icu_string(string);
+}
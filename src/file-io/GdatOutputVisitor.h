@@ -0,0 +1,292 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILEIO_GDATOUTPUTVISITOR_H
+#define GPLATES_FILEIO_GDATOUTPUTVISITOR_H
+
+#include <map>
+#include <vector>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+#include <QByteArray>
+#include <QDataStream>
+#include <QFile>
+
+#include "FileInfo.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/FeatureVisitor.h"
+#include "model/QualifiedXmlName.h"
+#include "model/XmlAttributeName.h"
+#include "model/XmlAttributeValue.h"
+
+#include "property-values/GpmlTimeSample.h"
+
+#include "utils/UnicodeString.h"
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Writes features to the binary 'gdat' file format (see @a GdatFormat).
+	 *
+	 * The common property value types (geometries, times, plate IDs, rotations, strings, etc) are written
+	 * in binary. Any top-level property containing a property value without a binary encoding
+	 * is instead written as GPML (and read back using the GPML property readers).
+	 */
+	class GdatOutputVisitor :
+			public GPlatesModel::ConstFeatureVisitor
+	{
+	public:
+
+		/**
+		 * Creates a 'gdat' writer for the given file.
+		 *
+		 * @a feature_collection_ref is used when writing properties as GPML.
+		 * The features in the feature collection are visited externally.
+		 *
+		 * This constructor can throw a ErrorOpeningFileForWritingException.
+		 */
+		GdatOutputVisitor(
+				const FileInfo &file_info,
+				const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection_ref);
+
+
+		virtual
+		~GdatOutputVisitor();
+
+	protected:
+
+		virtual
+		void
+		visit_feature_handle(
+				const GPlatesModel::FeatureHandle &feature_handle);
+
+		virtual
+		void
+		visit_top_level_property_inline(
+				const GPlatesModel::TopLevelPropertyInline &top_level_property_inline);
+
+		virtual
+		void
+		visit_enumeration(
+				const GPlatesPropertyValues::Enumeration &enumeration);
+
+		virtual
+		void
+		visit_gml_line_string(
+				const GPlatesPropertyValues::GmlLineString &gml_line_string);
+
+		virtual
+		void
+		visit_gml_multi_point(
+				const GPlatesPropertyValues::GmlMultiPoint &gml_multi_point);
+
+		virtual
+		void
+		visit_gml_orientable_curve(
+				const GPlatesPropertyValues::GmlOrientableCurve &gml_orientable_curve);
+
+		virtual
+		void
+		visit_gml_point(
+				const GPlatesPropertyValues::GmlPoint &gml_point);
+
+		virtual
+		void
+		visit_gml_polygon(
+				const GPlatesPropertyValues::GmlPolygon &gml_polygon);
+
+		virtual
+		void
+		visit_gml_time_instant(
+				const GPlatesPropertyValues::GmlTimeInstant &gml_time_instant);
+
+		virtual
+		void
+		visit_gml_time_period(
+				const GPlatesPropertyValues::GmlTimePeriod &gml_time_period);
+
+		virtual
+		void
+		visit_gpml_constant_value(
+				const GPlatesPropertyValues::GpmlConstantValue &gpml_constant_value);
+
+		virtual
+		void
+		visit_gpml_finite_rotation(
+				const GPlatesPropertyValues::GpmlFiniteRotation &gpml_finite_rotation);
+
+		virtual
+		void
+		visit_gpml_finite_rotation_slerp(
+				const GPlatesPropertyValues::GpmlFiniteRotationSlerp &gpml_finite_rotation_slerp);
+
+		virtual
+		void
+		visit_gpml_irregular_sampling(
+				const GPlatesPropertyValues::GpmlIrregularSampling &gpml_irregular_sampling);
+
+		virtual
+		void
+		visit_gpml_key_value_dictionary(
+				const GPlatesPropertyValues::GpmlKeyValueDictionary &gpml_key_value_dictionary);
+
+		virtual
+		void
+		visit_gpml_plate_id(
+				const GPlatesPropertyValues::GpmlPlateId &gpml_plate_id);
+
+		virtual
+		void
+		visit_xs_boolean(
+				const GPlatesPropertyValues::XsBoolean &xs_boolean);
+
+		virtual
+		void
+		visit_xs_double(
+				const GPlatesPropertyValues::XsDouble &xs_double);
+
+		virtual
+		void
+		visit_xs_integer(
+				const GPlatesPropertyValues::XsInteger &xs_integer);
+
+		virtual
+		void
+		visit_xs_string(
+				const GPlatesPropertyValues::XsString &xs_string);
+
+	private:
+
+		/**
+		 * Key identifying a qualified XML name (namespace, namespace alias and name).
+		 */
+		typedef boost::tuple<GPlatesUtils::UnicodeString, GPlatesUtils::UnicodeString, GPlatesUtils::UnicodeString>
+				qualified_name_key_type;
+
+		typedef std::map<qualified_name_key_type, quint32> qualified_name_index_map_type;
+
+		typedef std::map<GPlatesModel::XmlAttributeName, GPlatesModel::XmlAttributeValue> xml_attributes_type;
+
+
+		QFile d_output_file;
+		QDataStream d_output_stream;
+
+		/**
+		 * Used to write GPML for properties that have no binary encoding.
+		 */
+		GPlatesModel::FeatureCollectionHandle::weak_ref d_feature_collection_ref;
+
+		/**
+		 * The property values of the current top-level property are written to this buffer
+		 * (via @a d_property_value_stream) since they are discarded if any property value
+		 * has no binary encoding.
+		 */
+		QByteArray d_property_value_data;
+		QDataStream *d_property_value_stream;
+
+		/**
+		 * Whether the most recently visited property value was written to @a d_property_value_stream.
+		 *
+		 * This remains false after visiting a property value that has no binary encoding
+		 * (since the default visit function does nothing).
+		 */
+		bool d_wrote_property_value;
+
+		/**
+		 * False if any property value (including nested property values) in the current
+		 * top-level property has no binary encoding.
+		 */
+		bool d_can_write_property_as_binary;
+
+		/**
+		 * Index of each qualified name written so far.
+		 */
+		qualified_name_index_map_type d_qualified_name_indices;
+
+		/**
+		 * The qualified names written so far (in order of their indices).
+		 *
+		 * Used to undo the names added by a top-level property that was discarded.
+		 */
+		std::vector<qualified_name_key_type> d_qualified_names;
+
+
+		/**
+		 * Writes the property value to @a d_property_value_stream (if it has a binary encoding).
+		 *
+		 * Clears @a d_can_write_property_as_binary if the property value has no binary encoding.
+		 */
+		void
+		write_property_value(
+				const GPlatesModel::PropertyValue &property_value);
+
+		/**
+		 * Writes a time sample of an irregular sampling to @a d_property_value_stream.
+		 *
+		 * Clears @a d_can_write_property_as_binary if the time sample value has no binary encoding.
+		 */
+		void
+		write_gpml_time_sample(
+				const GPlatesPropertyValues::GpmlTimeSample &gpml_time_sample);
+
+		void
+		write_property_as_gpml(
+				const GPlatesModel::TopLevelPropertyInline &top_level_property_inline);
+
+		void
+		write_qualified_name(
+				QDataStream &output_stream,
+				const GPlatesUtils::UnicodeString &namespace_uri,
+				const GPlatesUtils::UnicodeString &namespace_alias,
+				const GPlatesUtils::UnicodeString &name);
+
+		template <class SingletonType>
+		void
+		write_qualified_name(
+				QDataStream &output_stream,
+				const GPlatesModel::QualifiedXmlName<SingletonType> &qualified_name)
+		{
+			write_qualified_name(
+					output_stream,
+					qualified_name.get_namespace(),
+					qualified_name.get_namespace_alias(),
+					qualified_name.get_name());
+		}
+
+		void
+		write_xml_attributes(
+				QDataStream &output_stream,
+				const xml_attributes_type &xml_attributes);
+
+		void
+		write_string(
+				QDataStream &output_stream,
+				const GPlatesUtils::UnicodeString &string);
+	};
+}
+
+#endif // GPLATES_FILEIO_GDATOUTPUTVISITOR_H
@@ -0,0 +1,990 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+#include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+#include <QByteArray>
+#include <QDataStream>
+#include <QFile>
+#include <QString>
+#include <QSysInfo>
+#include <QXmlStreamReader>
+
+#include "GdatReader.h"
+
+#include "ErrorOpeningFileForReadingException.h"
+#include "GdatFormat.h"
+#include "GpmlReaderException.h"
+#include "ReadErrorOccurrence.h"
+#include "ReadErrors.h"
+
+#include "global/PreconditionViolationError.h"
+
+#include "maths/FiniteRotation.h"
+#include "maths/MultiPointOnSphere.h"
+#include "maths/PointOnSphere.h"
+#include "maths/PolygonOnSphere.h"
+#include "maths/PolylineOnSphere.h"
+#include "maths/UnitVector3D.h"
+#include "maths/ViolatedUnitVectorInvariantException.h"
+
+#include "model/FeatureHandle.h"
+#include "model/FeatureId.h"
+#include "model/FeatureType.h"
+#include "model/Gpgim.h"
+#include "model/GpgimVersion.h"
+#include "model/Metadata.h"
+#include "model/PropertyName.h"
+#include "model/RevisionId.h"
+#include "model/TopLevelPropertyInline.h"
+#include "model/XmlAttributeName.h"
+#include "model/XmlAttributeValue.h"
+#include "model/XmlNode.h"
+
+#include "property-values/Enumeration.h"
+#include "property-values/EnumerationType.h"
+#include "property-values/GeoTimeInstant.h"
+#include "property-values/GmlLineString.h"
+#include "property-values/GmlMultiPoint.h"
+#include "property-values/GmlOrientableCurve.h"
+#include "property-values/GmlPoint.h"
+#include "property-values/GmlPolygon.h"
+#include "property-values/GmlTimeInstant.h"
+#include "property-values/GmlTimePeriod.h"
+#include "property-values/GpmlConstantValue.h"
+#include "property-values/GpmlFiniteRotation.h"
+#include "property-values/GpmlFiniteRotationSlerp.h"
+#include "property-values/GpmlIrregularSampling.h"
+#include "property-values/GpmlKeyValueDictionary.h"
+#include "property-values/GpmlPlateId.h"
+#include "property-values/StructuralType.h"
+#include "property-values/XsBoolean.h"
+#include "property-values/XsDouble.h"
+#include "property-values/XsInteger.h"
+#include "property-values/XsString.h"
+
+#include "utils/Profile.h"
+#include "utils/UnicodeStringUtils.h"
+
+
+namespace GPlatesFileIO
+{
+	namespace
+	{
+		/**
+		 * Thrown when the file contents are not a valid 'gdat' stream (eg, truncated or corrupted).
+		 */
+		struct InvalidGdatStream
+		{  };
+
+
+		typedef std::map<GPlatesModel::XmlAttributeName, GPlatesModel::XmlAttributeValue> xml_attributes_type;
+
+
+		/**
+		 * Reads the records (that follow the file header) of a 'gdat' stream.
+		 */
+		class GdatStreamReader
+		{
+		public:
+
+			GdatStreamReader(
+					QDataStream &input_stream,
+					bool swap_raw_data_byte_order,
+					const GPlatesModel::GpgimVersion &gpgim_version,
+					const GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &property_structural_type_reader,
+					const boost::shared_ptr<DataSource> &source,
+					ReadErrorAccumulation &read_errors) :
+				d_input_stream(input_stream),
+				d_swap_raw_data_byte_order(swap_raw_data_byte_order),
+				d_gpgim_version(gpgim_version),
+				d_property_structural_type_reader(property_structural_type_reader),
+				d_source(source),
+				d_read_errors(read_errors),
+				d_feature_number(0)
+			{  }
+
+
+			/**
+			 * Reads the features and adds them to @a feature_collection.
+			 *
+			 * Throws @a InvalidGdatStream if the stream is invalid.
+			 */
+			void
+			read_features(
+					const GPlatesModel::FeatureCollectionHandle::weak_ref &feature_collection)
+			{
+				while (true)
+				{
+					const quint8 record_tag = read<quint8>();
+					if (record_tag == GdatFormat::END_OF_FILE_RECORD)
+					{
+						break;
+					}
+
+					if (record_tag != GdatFormat::FEATURE_RECORD)
+					{
+						throw InvalidGdatStream();
+					}
+
+					++d_feature_number;
+					feature_collection->add(read_feature());
+				}
+			}
+
+		private:
+
+			/**
+			 * A qualified XML name read from the stream.
+			 */
+			struct QualifiedName
+			{
+				GPlatesUtils::UnicodeString namespace_uri;
+				GPlatesUtils::UnicodeString namespace_alias;
+				GPlatesUtils::UnicodeString name;
+			};
+
+
+			QDataStream &d_input_stream;
+			bool d_swap_raw_data_byte_order;
+			GPlatesModel::GpgimVersion d_gpgim_version;
+			GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type d_property_structural_type_reader;
+			boost::shared_ptr<DataSource> d_source;
+			ReadErrorAccumulation &d_read_errors;
+
+			//! The qualified names (in the order they were first written).
+			std::vector<QualifiedName> d_qualified_names;
+
+			//! The current feature number (used to locate read errors).
+			unsigned int d_feature_number;
+
+
+			template <typename Type>
+			Type
+			read()
+			{
+				Type value;
+				d_input_stream >> value;
+
+				if (d_input_stream.status() != QDataStream::Ok)
+				{
+					throw InvalidGdatStream();
+				}
+
+				return value;
+			}
+
+
+			/**
+			 * Throws @a InvalidGdatStream if fewer than @a num_bytes remain in the stream.
+			 */
+			void
+			check_bytes_available(
+					qint64 num_bytes)
+			{
+				if (d_input_stream.device()->bytesAvailable() < num_bytes)
+				{
+					throw InvalidGdatStream();
+				}
+			}
+
+
+			/**
+			 * Reads @a num_bytes of raw data into @a data.
+			 *
+			 * QDataStream::readRawData() only accepts an 'int' length, so large blocks
+			 * (over 2GB) are read in several pieces.
+			 */
+			void
+			read_raw_data(
+					char *data,
+					qint64 num_bytes)
+			{
+				const qint64 max_bytes_per_read = std::numeric_limits<int>::max();
+
+				while (num_bytes > 0)
+				{
+					const int num_bytes_to_read = static_cast<int>((std::min)(num_bytes, max_bytes_per_read));
+					if (d_input_stream.readRawData(data, num_bytes_to_read) != num_bytes_to_read)
+					{
+						throw InvalidGdatStream();
+					}
+
+					data += num_bytes_to_read;
+					num_bytes -= num_bytes_to_read;
+				}
+			}
+
+
+			GPlatesUtils::UnicodeString
+			read_string()
+			{
+				return GPlatesUtils::make_icu_string_from_qstring(read<QString>());
+			}
+
+
+			template <class QualifiedXmlNameType>
+			QualifiedXmlNameType
+			read_qualified_name()
+			{
+				const quint32 index = read<quint32>();
+
+				// The first occurrence of a qualified name assigns it the next index and is followed by the name.
+				if (index == d_qualified_names.size())
+				{
+					QualifiedName qualified_name;
+					qualified_name.namespace_uri = read_string();
+					qualified_name.namespace_alias = read_string();
+					qualified_name.name = read_string();
+
+					d_qualified_names.push_back(qualified_name);
+				}
+				else if (index > d_qualified_names.size())
+				{
+					throw InvalidGdatStream();
+				}
+
+				const QualifiedName &qualified_name = d_qualified_names[index];
+
+				return QualifiedXmlNameType(
+						qualified_name.namespace_uri,
+						boost::optional<const GPlatesUtils::UnicodeString &>(qualified_name.namespace_alias),
+						qualified_name.name);
+			}
+
+
+			void
+			read_xml_attributes(
+					xml_attributes_type &xml_attributes)
+			{
+				const quint32 num_xml_attributes = read<quint32>();
+				for (quint32 n = 0; n < num_xml_attributes; ++n)
+				{
+					const GPlatesModel::XmlAttributeName xml_attribute_name =
+							read_qualified_name<GPlatesModel::XmlAttributeName>();
+					const GPlatesModel::XmlAttributeValue xml_attribute_value(read_string());
+
+					xml_attributes.insert(xml_attributes_type::value_type(xml_attribute_name, xml_attribute_value));
+				}
+			}
+
+
+			/**
+			 * Reads the raw x, y and z components of a sequence of points.
+			 */
+			void
+			read_points(
+					std::vector<GPlatesMaths::PointOnSphere> &points)
+			{
+				const quint32 num_points = read<quint32>();
+				if (num_points == 0)
+				{
+					return;
+				}
+
+				// Guard against a corrupted point count before allocating the components.
+				const qint64 num_bytes = qint64(3) * num_points * sizeof(double);
+				check_bytes_available(num_bytes);
+
+				std::vector<double> components(std::size_t(3) * num_points);
+				read_raw_data(reinterpret_cast<char *>(&components[0]), num_bytes);
+
+				// The components are in the byte order of the machine that wrote the file.
+				if (d_swap_raw_data_byte_order)
+				{
+					char *const component_bytes = reinterpret_cast<char *>(&components[0]);
+					for (std::size_t n = 0; n < components.size(); ++n)
+					{
+						std::reverse(component_bytes + n * sizeof(double), component_bytes + (n + 1) * sizeof(double));
+					}
+				}
+
+				points.reserve(num_points);
+				try
+				{
+					for (std::size_t component_index = 0; component_index < components.size(); component_index += 3)
+					{
+						// The components were written from unit vectors, but the file could be corrupted.
+						points.push_back(
+								GPlatesMaths::PointOnSphere(
+										GPlatesMaths::UnitVector3D(
+												components[component_index],
+												components[component_index + 1],
+												components[component_index + 2])));
+					}
+				}
+				catch (const GPlatesMaths::ViolatedUnitVectorInvariantException &)
+				{
+					throw InvalidGdatStream();
+				}
+			}
+
+
+			/**
+			 * Creates a polyline from @a points read from the stream.
+			 *
+			 * Throws @a InvalidGdatStream if the points cannot form a polyline.
+			 */
+			GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type
+			create_polyline(
+					const std::vector<GPlatesMaths::PointOnSphere> &points)
+			{
+				try
+				{
+					return GPlatesMaths::PolylineOnSphere::create(points);
+				}
+				catch (const GPlatesGlobal::PreconditionViolationError &)
+				{
+					throw InvalidGdatStream();
+				}
+			}
+
+
+			/**
+			 * Creates a multi-point from @a points read from the stream.
+			 *
+			 * Throws @a InvalidGdatStream if the points cannot form a multi-point.
+			 */
+			GPlatesMaths::MultiPointOnSphere::non_null_ptr_to_const_type
+			create_multi_point(
+					const std::vector<GPlatesMaths::PointOnSphere> &points)
+			{
+				try
+				{
+					return GPlatesMaths::MultiPointOnSphere::create(points);
+				}
+				catch (const GPlatesGlobal::PreconditionViolationError &)
+				{
+					throw InvalidGdatStream();
+				}
+			}
+
+
+			/**
+			 * Creates a polygon from rings read from the stream.
+			 *
+			 * Throws @a InvalidGdatStream if the rings cannot form a polygon.
+			 */
+			GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type
+			create_polygon(
+					const std::vector<GPlatesMaths::PointOnSphere> &exterior_ring,
+					const std::vector< std::vector<GPlatesMaths::PointOnSphere> > &interior_rings)
+			{
+				try
+				{
+					return GPlatesMaths::PolygonOnSphere::create(exterior_ring, interior_rings);
+				}
+				catch (const GPlatesGlobal::PreconditionViolationError &)
+				{
+					throw InvalidGdatStream();
+				}
+			}
+
+
+			const GPlatesModel::FeatureHandle::non_null_ptr_type
+			read_feature()
+			{
+				const GPlatesModel::FeatureType feature_type = read_qualified_name<GPlatesModel::FeatureType>();
+				const GPlatesModel::FeatureId feature_id(read_string());
+				const GPlatesModel::RevisionId revision_id(read_string());
+
+				GPlatesModel::FeatureHandle::non_null_ptr_type feature =
+						GPlatesModel::FeatureHandle::create(feature_type, feature_id, revision_id);
+
+				while (true)
+				{
+					const quint8 record_tag = read<quint8>();
+					if (record_tag == GdatFormat::END_OF_FEATURE_RECORD)
+					{
+						break;
+					}
+
+					if (record_tag != GdatFormat::PROPERTY_RECORD)
+					{
+						throw InvalidGdatStream();
+					}
+
+					read_property(*feature);
+				}
+
+				return feature;
+			}
+
+
+			void
+			read_property(
+					GPlatesModel::FeatureHandle &feature)
+			{
+				const GPlatesModel::PropertyName property_name = read_qualified_name<GPlatesModel::PropertyName>();
+
+				xml_attributes_type xml_attributes;
+				read_xml_attributes(xml_attributes);
+
+				const quint8 property_encoding = read<quint8>();
+				if (property_encoding == GdatFormat::BINARY_PROPERTY_ENCODING)
+				{
+					GPlatesModel::TopLevelPropertyInline::container_type property_values;
+
+					const quint32 num_property_values = read<quint32>();
+					for (quint32 n = 0; n < num_property_values; ++n)
+					{
+						property_values.push_back(read_property_value());
+					}
+
+					feature.add(
+							GPlatesModel::TopLevelPropertyInline::create(
+									property_name,
+									property_values,
+									xml_attributes));
+				}
+				else if (property_encoding == GdatFormat::GPML_PROPERTY_ENCODING)
+				{
+					const GPlatesPropertyValues::StructuralType structural_type =
+							read_qualified_name<GPlatesPropertyValues::StructuralType>();
+					const QByteArray gpml_data = read<QByteArray>();
+
+					boost::optional<GPlatesModel::PropertyValue::non_null_ptr_type> property_value =
+							read_gpml_property_value(structural_type, gpml_data);
+					if (!property_value)
+					{
+						// Skip the property (but keep reading the rest of the file).
+						boost::shared_ptr<LocationInDataSource> location(new LineNumber(d_feature_number));
+						d_read_errors.d_warnings.push_back(
+								ReadErrorOccurrence(
+										d_source,
+										location,
+										ReadErrors::ParseError,
+										ReadErrors::PropertyNotInterpreted));
+						return;
+					}
+
+					feature.add(
+							GPlatesModel::TopLevelPropertyInline::create(
+									property_name,
+									property_value.get(),
+									xml_attributes));
+				}
+				else
+				{
+					throw InvalidGdatStream();
+				}
+			}
+
+
+			/**
+			 * Reads a property value that was written as GPML (because it has no binary encoding).
+			 */
+			boost::optional<GPlatesModel::PropertyValue::non_null_ptr_type>
+			read_gpml_property_value(
+					const GPlatesPropertyValues::StructuralType &structural_type,
+					const QByteArray &gpml_data)
+			{
+				boost::optional<GpmlPropertyStructuralTypeReader::structural_type_reader_function_type>
+						structural_type_reader_function =
+								d_property_structural_type_reader->get_structural_type_reader_function(structural_type);
+				if (!structural_type_reader_function)
+				{
+					return boost::none;
+				}
+
+				QXmlStreamReader xml_reader(gpml_data);
+
+				// Find the root element (it declares the namespace aliases used by the property).
+				while (!xml_reader.atEnd())
+				{
+					xml_reader.readNext();
+					if (xml_reader.isStartElement())
+					{
+						break;
+					}
+				}
+
+				boost::shared_ptr<GPlatesModel::XmlElementNode::AliasToNamespaceMap> alias_map(
+						new GPlatesModel::XmlElementNode::AliasToNamespaceMap);
+				const QXmlStreamNamespaceDeclarations ns_decls = xml_reader.namespaceDeclarations();
+				for (int n = 0; n < ns_decls.size(); ++n)
+				{
+					alias_map->insert(
+							std::make_pair(
+									ns_decls[n].prefix().toString(),
+									ns_decls[n].namespaceUri().toString()));
+				}
+
+				// Find the property element.
+				while (!xml_reader.atEnd())
+				{
+					xml_reader.readNext();
+					if (xml_reader.isStartElement())
+					{
+						break;
+					}
+				}
+
+				if (xml_reader.atEnd() || xml_reader.error())
+				{
+					return boost::none;
+				}
+
+				const GPlatesModel::XmlElementNode::non_null_ptr_type property_xml_element =
+						GPlatesModel::XmlElementNode::create(xml_reader, alias_map);
+
+				try
+				{
+					return structural_type_reader_function.get()(property_xml_element, d_gpgim_version, d_read_errors);
+				}
+				catch (const GpmlReaderException &)
+				{
+					return boost::none;
+				}
+			}
+
+
+			const GPlatesModel::PropertyValue::non_null_ptr_type
+			read_property_value()
+			{
+				const quint8 property_value_tag = read<quint8>();
+
+				switch (property_value_tag)
+				{
+				case GdatFormat::ENUMERATION_TAG:
+					{
+						const GPlatesPropertyValues::EnumerationType enumeration_type =
+								read_qualified_name<GPlatesPropertyValues::EnumerationType>();
+						const GPlatesUtils::UnicodeString enumeration_content = read_string();
+
+						return GPlatesPropertyValues::Enumeration::create(enumeration_type, enumeration_content);
+					}
+
+				case GdatFormat::GML_LINE_STRING_TAG:
+					{
+						std::vector<GPlatesMaths::PointOnSphere> points;
+						read_points(points);
+
+						return GPlatesPropertyValues::GmlLineString::create(create_polyline(points));
+					}
+
+				case GdatFormat::GML_MULTI_POINT_TAG:
+					{
+						std::vector<GPlatesMaths::PointOnSphere> points;
+						read_points(points);
+
+						std::vector<GPlatesPropertyValues::GmlPoint::GmlProperty> gml_properties;
+						const quint32 num_gml_properties = read<quint32>();
+						for (quint32 n = 0; n < num_gml_properties; ++n)
+						{
+							gml_properties.push_back(
+									static_cast<GPlatesPropertyValues::GmlPoint::GmlProperty>(read<quint8>()));
+						}
+
+						return GPlatesPropertyValues::GmlMultiPoint::create(
+								create_multi_point(points),
+								gml_properties);
+					}
+
+				case GdatFormat::GML_ORIENTABLE_CURVE_TAG:
+					{
+						xml_attributes_type xml_attributes;
+						read_xml_attributes(xml_attributes);
+
+						std::vector<GPlatesMaths::PointOnSphere> points;
+						read_points(points);
+
+						return GPlatesPropertyValues::GmlOrientableCurve::create(
+								GPlatesPropertyValues::GmlLineString::create(create_polyline(points)),
+								xml_attributes);
+					}
+
+				case GdatFormat::GML_POINT_TAG:
+					{
+						const double first = read<double>();
+						const double second = read<double>();
+						const quint8 gml_property = read<quint8>();
+
+						return GPlatesPropertyValues::GmlPoint::create_from_pos_2d(
+								std::make_pair(first, second),
+								static_cast<GPlatesPropertyValues::GmlPoint::GmlProperty>(gml_property));
+					}
+
+				case GdatFormat::GML_POLYGON_TAG:
+					{
+						std::vector<GPlatesMaths::PointOnSphere> exterior_ring;
+						read_points(exterior_ring);
+
+						// Guard against a corrupted ring count before allocating the rings
+						// (each interior ring is at least its point count).
+						const quint32 num_interior_rings = read<quint32>();
+						check_bytes_available(qint64(num_interior_rings) * sizeof(quint32));
+
+						std::vector< std::vector<GPlatesMaths::PointOnSphere> > interior_rings(num_interior_rings);
+						for (quint32 n = 0; n < num_interior_rings; ++n)
+						{
+							read_points(interior_rings[n]);
+						}
+
+						return GPlatesPropertyValues::GmlPolygon::create(
+								create_polygon(exterior_ring, interior_rings));
+					}
+
+				case GdatFormat::GML_TIME_INSTANT_TAG:
+					return read_gml_time_instant();
+
+				case GdatFormat::GML_TIME_PERIOD_TAG:
+					{
+						if (read<quint8>() != GdatFormat::GML_TIME_INSTANT_TAG)
+						{
+							throw InvalidGdatStream();
+						}
+						const GPlatesPropertyValues::GmlTimeInstant::non_null_ptr_type begin = read_gml_time_instant();
+
+						if (read<quint8>() != GdatFormat::GML_TIME_INSTANT_TAG)
+						{
+							throw InvalidGdatStream();
+						}
+						const GPlatesPropertyValues::GmlTimeInstant::non_null_ptr_type end = read_gml_time_instant();
+
+						return GPlatesPropertyValues::GmlTimePeriod::create(begin, end);
+					}
+
+				case GdatFormat::GPML_CONSTANT_VALUE_TAG:
+					{
+						const GPlatesPropertyValues::StructuralType value_type =
+								read_qualified_name<GPlatesPropertyValues::StructuralType>();
+						const GPlatesUtils::UnicodeString description = read_string();
+						const GPlatesModel::PropertyValue::non_null_ptr_type value = read_property_value();
+
+						return GPlatesPropertyValues::GpmlConstantValue::create(value, value_type, description);
+					}
+
+				case GdatFormat::GPML_FINITE_ROTATION_TAG:
+					{
+						GPlatesModel::MetadataContainer metadata;
+						const quint32 num_metadata = read<quint32>();
+						for (quint32 n = 0; n < num_metadata; ++n)
+						{
+							const QString name = read<QString>();
+							const QString content = read<QString>();
+							metadata.push_back(
+									GPlatesModel::Metadata::shared_ptr_type(
+											new GPlatesModel::Metadata(name, content)));
+						}
+
+						if (read<quint8>())
+						{
+							return GPlatesPropertyValues::GpmlFiniteRotation::create_zero_rotation(metadata);
+						}
+
+						const double axis_x = read<double>();
+						const double axis_y = read<double>();
+						const double axis_z = read<double>();
+						const double angle = read<double>();
+
+						try
+						{
+							const GPlatesMaths::PointOnSphere euler_pole(
+									GPlatesMaths::UnitVector3D(axis_x, axis_y, axis_z));
+
+							return GPlatesPropertyValues::GpmlFiniteRotation::create(
+									GPlatesMaths::FiniteRotation::create(euler_pole, angle),
+									metadata);
+						}
+						catch (const GPlatesMaths::ViolatedUnitVectorInvariantException &)
+						{
+							throw InvalidGdatStream();
+						}
+					}
+
+				case GdatFormat::GPML_FINITE_ROTATION_SLERP_TAG:
+					return GPlatesPropertyValues::GpmlFiniteRotationSlerp::create(
+							read_qualified_name<GPlatesPropertyValues::StructuralType>());
+
+				case GdatFormat::GPML_IRREGULAR_SAMPLING_TAG:
+					{
+						const GPlatesPropertyValues::StructuralType value_type =
+								read_qualified_name<GPlatesPropertyValues::StructuralType>();
+
+						std::vector<GPlatesPropertyValues::GpmlTimeSample> time_samples;
+						const quint32 num_time_samples = read<quint32>();
+						for (quint32 n = 0; n < num_time_samples; ++n)
+						{
+							time_samples.push_back(read_gpml_time_sample());
+						}
+
+						// The interpolation function is optional.
+						GPlatesPropertyValues::GpmlInterpolationFunction::maybe_null_ptr_type interpolation_function;
+						if (read<quint8>())
+						{
+							const GPlatesModel::PropertyValue::non_null_ptr_type property_value = read_property_value();
+							interpolation_function =
+									dynamic_cast<GPlatesPropertyValues::GpmlInterpolationFunction *>(property_value.get());
+							if (!interpolation_function)
+							{
+								throw InvalidGdatStream();
+							}
+						}
+
+						return GPlatesPropertyValues::GpmlIrregularSampling::create(
+								time_samples, interpolation_function, value_type);
+					}
+
+				case GdatFormat::GPML_KEY_VALUE_DICTIONARY_TAG:
+					{
+						std::vector<GPlatesPropertyValues::GpmlKeyValueDictionaryElement> elements;
+
+						const quint32 num_elements = read<quint32>();
+						for (quint32 n = 0; n < num_elements; ++n)
+						{
+							const GPlatesUtils::UnicodeString key = read_string();
+							const GPlatesPropertyValues::StructuralType value_type =
+									read_qualified_name<GPlatesPropertyValues::StructuralType>();
+							const GPlatesModel::PropertyValue::non_null_ptr_type value = read_property_value();
+
+							elements.push_back(
+									GPlatesPropertyValues::GpmlKeyValueDictionaryElement(
+											GPlatesPropertyValues::XsString::create(key),
+											value,
+											value_type));
+						}
+
+						return GPlatesPropertyValues::GpmlKeyValueDictionary::create(elements);
+					}
+
+				case GdatFormat::GPML_PLATE_ID_TAG:
+					return GPlatesPropertyValues::GpmlPlateId::create(read<quint64>());
+
+				case GdatFormat::XS_BOOLEAN_TAG:
+					return GPlatesPropertyValues::XsBoolean::create(read<quint8>() != 0);
+
+				case GdatFormat::XS_DOUBLE_TAG:
+					return GPlatesPropertyValues::XsDouble::create(read<double>());
+
+				case GdatFormat::XS_INTEGER_TAG:
+					return GPlatesPropertyValues::XsInteger::create(read<qint32>());
+
+				case GdatFormat::XS_STRING_TAG:
+					return GPlatesPropertyValues::XsString::create(read_string());
+
+				default:
+					break;
+				}
+
+				throw InvalidGdatStream();
+			}
+
+
+			const GPlatesPropertyValues::GmlTimeInstant::non_null_ptr_type
+			read_gml_time_instant()
+			{
+				// Note that the distant past and distant future are positive and negative infinity.
+				const double time_position = read<double>();
+
+				xml_attributes_type xml_attributes;
+				read_xml_attributes(xml_attributes);
+
+				return GPlatesPropertyValues::GmlTimeInstant::create(
+						GPlatesPropertyValues::GeoTimeInstant(time_position),
+						xml_attributes);
+			}
+
+
+			/**
+			 * Reads a time sample of an irregular sampling.
+			 */
+			GPlatesPropertyValues::GpmlTimeSample
+			read_gpml_time_sample()
+			{
+				const GPlatesPropertyValues::StructuralType value_type =
+						read_qualified_name<GPlatesPropertyValues::StructuralType>();
+				const GPlatesModel::PropertyValue::non_null_ptr_type value = read_property_value();
+
+				if (read<quint8>() != GdatFormat::GML_TIME_INSTANT_TAG)
+				{
+					throw InvalidGdatStream();
+				}
+				const GPlatesPropertyValues::GmlTimeInstant::non_null_ptr_type valid_time = read_gml_time_instant();
+
+				// The description is optional.
+				boost::intrusive_ptr<GPlatesPropertyValues::XsString> description;
+				if (read<quint8>())
+				{
+					description = GPlatesUtils::get_intrusive_ptr(GPlatesPropertyValues::XsString::create(read_string()));
+				}
+
+				const bool is_disabled = (read<quint8>() != 0);
+
+				return GPlatesPropertyValues::GpmlTimeSample(value, valid_time, description, value_type, is_disabled);
+			}
+		};
+
+
+		/**
+		 * Reads the file header and returns the GPGIM version used to write the file
+		 * (or boost::none if the file is not a supported 'gdat' file).
+		 *
+		 * Also sets the byte order of @a input_stream to the byte order used by the file.
+		 */
+		boost::optional<GPlatesModel::GpgimVersion>
+		read_header(
+				QDataStream &input_stream,
+				const boost::shared_ptr<DataSource> &source,
+				ReadErrorAccumulation &read_errors)
+		{
+			boost::shared_ptr<LocationInDataSource> location(new LineNumber(0));
+
+			if (input_stream.atEnd())
+			{
+				read_errors.d_failures_to_begin.push_back(
+						ReadErrorOccurrence(source, location, ReadErrors::FileIsEmpty, ReadErrors::FileNotLoaded));
+				return boost::none;
+			}
+
+			// Check the signature.
+			for (unsigned int n = 0; n < sizeof(GdatFormat::SIGNATURE) - 1; ++n)
+			{
+				qint8 signature_char;
+				input_stream >> signature_char;
+
+				if (input_stream.status() != QDataStream::Ok ||
+					signature_char != GdatFormat::SIGNATURE[n])
+				{
+					read_errors.d_failures_to_begin.push_back(
+							ReadErrorOccurrence(source, location, ReadErrors::FileFormatNotSupported, ReadErrors::FileNotLoaded));
+					return boost::none;
+				}
+			}
+
+			// The byte order used by the rest of the file.
+			quint8 byte_order;
+			input_stream >> byte_order;
+			input_stream.setByteOrder(
+					(byte_order == GdatFormat::BYTE_ORDER_BIG_ENDIAN)
+					? QDataStream::BigEndian
+					: QDataStream::LittleEndian);
+
+			// We cannot read files written by a more recent format version.
+			quint32 version;
+			input_stream >> version;
+
+			QString gpgim_version_string;
+			input_stream >> gpgim_version_string;
+
+			if (input_stream.status() != QDataStream::Ok ||
+				version > GdatFormat::VERSION)
+			{
+				read_errors.d_failures_to_begin.push_back(
+						ReadErrorOccurrence(source, location, ReadErrors::FileFormatNotSupported, ReadErrors::FileNotLoaded));
+				return boost::none;
+			}
+
+			boost::optional<GPlatesModel::GpgimVersion> gpgim_version =
+					GPlatesModel::GpgimVersion::create(gpgim_version_string);
+			if (!gpgim_version)
+			{
+				read_errors.d_warnings.push_back(
+						ReadErrorOccurrence(source, location, ReadErrors::MalformedVersionAttribute, ReadErrors::AssumingCurrentVersion));
+				gpgim_version = GPlatesModel::Gpgim::instance().get_version();
+			}
+			else if (gpgim_version.get() > GPlatesModel::Gpgim::instance().get_version())
+			{
+				// The file was created by a more recent version of GPlates.
+				read_errors.d_warnings.push_back(
+						ReadErrorOccurrence(source, location, ReadErrors::PartiallySupportedVersionAttribute, ReadErrors::AssumingCurrentVersion));
+			}
+
+			return gpgim_version;
+		}
+	}
+}
+
+
+void
+GPlatesFileIO::GdatReader::read_file(
+		File::Reference &file,
+		const GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &property_structural_type_reader,
+		ReadErrorAccumulation &read_errors,
+		bool &contains_unsaved_changes)
+{
+	PROFILE_FUNC();
+
+	contains_unsaved_changes = false;
+
+	const FileInfo &fileinfo = file.get_file_info();
+	const QString filename(fileinfo.get_qfileinfo().filePath());
+
+	QFile input_file(filename);
+	if (!input_file.open(QIODevice::ReadOnly))
+	{
+		throw ErrorOpeningFileForReadingException(GPLATES_EXCEPTION_SOURCE, filename);
+	}
+
+	QDataStream input_stream(&input_file);
+	input_stream.setVersion(GdatFormat::QT_STREAM_VERSION);
+
+	boost::shared_ptr<DataSource> source(
+			new LocalFileDataSource(filename, DataFormats::Gdat));
+
+	const boost::optional<GPlatesModel::GpgimVersion> gpgim_version =
+			read_header(input_stream, source, read_errors);
+	if (!gpgim_version)
+	{
+		return;
+	}
+
+	GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection = file.get_feature_collection();
+
+	// Store the GPGIM version in the feature collection as a tag (like the GPML reader does).
+	feature_collection->tags()[GPlatesModel::GpgimVersion::FEATURE_COLLECTION_TAG] = gpgim_version.get();
+
+	// Vertex arrays are stored in the byte order of the machine that wrote the file.
+	const QDataStream::ByteOrder native_byte_order =
+			(QSysInfo::ByteOrder == QSysInfo::BigEndian) ? QDataStream::BigEndian : QDataStream::LittleEndian;
+
+	GdatStreamReader stream_reader(
+			input_stream,
+			input_stream.byteOrder() != native_byte_order/*swap_raw_data_byte_order*/,
+			gpgim_version.get(),
+			property_structural_type_reader,
+			source,
+			read_errors);
+
+	try
+	{
+		stream_reader.read_features(feature_collection);
+	}
+	catch (const InvalidGdatStream &)
+	{
+		// The file was truncated or corrupted - keep the features read so far.
+		boost::shared_ptr<LocationInDataSource> location(new LineNumber(0));
+		read_errors.d_terminating_errors.push_back(
+				ReadErrorOccurrence(source, location,
+					ReadErrors::ParseError,
+					ReadErrors::ParsingStoppedPrematurely));
+	}
+}
@@ -0,0 +1,61 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILEIO_GDATREADER_H
+#define GPLATES_FILEIO_GDATREADER_H
+
+#include "File.h"
+#include "GpmlPropertyStructuralTypeReader.h"
+#include "ReadErrorAccumulation.h"
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Reads the binary 'gdat' feature collection file format (see @a GdatFormat).
+	 */
+	class GdatReader
+	{
+	public:
+
+		/**
+		 * Reads the features in @a file into its feature collection.
+		 *
+		 * @a property_structural_type_reader is used to read those properties that were
+		 * written as GPML (because they have no binary encoding).
+		 *
+		 * Throws ErrorOpeningFileForReadingException if the file cannot be opened for reading.
+		 */
+		static
+		void
+		read_file(
+				File::Reference &file,
+				const GpmlPropertyStructuralTypeReader::non_null_ptr_to_const_type &property_structural_type_reader,
+				ReadErrorAccumulation &read_errors,
+				bool &contains_unsaved_changes);
+	};
+}
+
+#endif  // GPLATES_FILEIO_GDATREADER_H
@@ -45,6 +45,7 @@
 #include <QFile>
 #include <QFileInfo>
 #include <QString>
+#include <QSysInfo>
 #include <QTemporaryFile>
 
 #include "ErrorOpeningFileForWritingException.h"
@@ -82,6 +83,15 @@ namespace GPlatesFileIO
 		{
 			PROFILE_FUNC();
 
+			// If the stream byte order matches the native byte order then write the data in one go
+			// (bypassing the much slower per-element output operator '<<').
+			if ((out.byteOrder() == QDataStream::LittleEndian) ==
+				(QSysInfo::ByteOrder == QSysInfo::LittleEndian))
+			{
+				out.writeRawData(reinterpret_cast<const char *>(data), len * sizeof(T));
+				return;
+			}
+
 			const T *end = data + len;
 			while (data != end)
 			{
@@ -195,6 +205,9 @@ namespace GPlatesFileIO
 				// Write version number.
 				out << static_cast<quint32>(RasterFileCacheFormat::VERSION_NUMBER);
 
+				// Everything after the version number is written in the byte order of the current version.
+				out.setByteOrder(RasterFileCacheFormat::get_byte_order(RasterFileCacheFormat::VERSION_NUMBER));
+
 				// Write mipmap type.
 				out << static_cast<quint32>(RasterFileCacheFormat::get_type_as_enum<mipmapped_element_type>());
 
@@ -210,8 +223,10 @@ namespace GPlatesFileIO
 				{
 					// Write the total size of the output file so the reader can verify that the
 					// file was not partially written.
+					// NOTE: The file size is always big endian (regardless of the version's byte order).
 					file.seek(file_size_offset);
 					total_output_file_size = file.size();
+					out.setByteOrder(QDataStream::BigEndian);
 					out << total_output_file_size;
 
 					file.close();
@@ -232,14 +247,16 @@ namespace GPlatesFileIO
 					boost::shared_ptr<QTemporaryFile> temporary_mipmap_file(new QTemporaryFile());
 					boost::shared_ptr<QDataStream> temporary_mipmap_file_stream(
 							new QDataStream(temporary_mipmap_file.get()));
-					// Use the same Qt data stream version as the final output file/stream.
+					// Use the same Qt data stream version and byte order as the final output file/stream.
 					temporary_mipmap_file_stream->setVersion(RasterFileCacheFormat::Q_DATA_STREAM_VERSION);
+					temporary_mipmap_file_stream->setByteOrder(out.byteOrder());
 
 					boost::shared_ptr<QByteArray> temporary_mipmap_byte_array(new QByteArray());
 					boost::shared_ptr<QDataStream> temporary_mipmap_byte_stream(
 							new QDataStream(temporary_mipmap_byte_array.get(), QIODevice::ReadWrite));
-					// Use the same Qt data stream version as the final output file/stream.
+					// Use the same Qt data stream version and byte order as the final output file/stream.
 					temporary_mipmap_byte_stream->setVersion(RasterFileCacheFormat::Q_DATA_STREAM_VERSION);
+					temporary_mipmap_byte_stream->setByteOrder(out.byteOrder());
 
 					// Attempt to open mipmap file (for reading/writing) in temporary directory.
 					if (!temporary_mipmap_file->open())
@@ -369,6 +386,9 @@ namespace GPlatesFileIO
 					data_file_pos +=
 							level_info.num_blocks * RasterFileCacheFormat::BlockInfo::STREAM_SIZE;
 
+					// The encoded mipmap data is padded to start on an aligned file offset.
+					data_file_pos += RasterFileCacheFormat::get_block_data_alignment_padding(data_file_pos);
+
 					// The temporary mipmap file contains the encoded mipmap data for the current level and
 					// that will also be written to the output file.
 					data_file_pos += temporary_mipmap_files[level]->size();
@@ -461,9 +481,13 @@ namespace GPlatesFileIO
 					out << raster_standard_deviation;
 
 					// The file offset at which the current mipmap's encoded data will be written to.
-					const qint64 encoded_data_file_pos =
+					// It is aligned so that the (aligned) block offsets, relative to the start of the
+					// encoded data, are also aligned in the output file.
+					const qint64 block_infos_end_file_pos =
 							file.pos() +
 							mipmap_blocks.get_num_blocks() * RasterFileCacheFormat::BlockInfo::STREAM_SIZE;
+					const qint64 encoded_data_file_pos = block_infos_end_file_pos +
+							RasterFileCacheFormat::get_block_data_alignment_padding(block_infos_end_file_pos);
 
 					// Write the current mipmap's block information to the output file.
 					const unsigned int num_blocks = mipmap_blocks.get_num_blocks();
@@ -487,6 +511,9 @@ namespace GPlatesFileIO
 							<< block_info.coverage_offset;
 					}
 
+					// Pad up to the aligned start of the encoded data.
+					RasterFileCacheFormat::write_block_data_alignment_padding(out, block_infos_end_file_pos);
+
 					// Now write the mipmap's encoded data to the output file.
 					// We do this by copying the encoded data from the temporary mipmap file.
 					// The temporary file will get removed on scope exit.
@@ -500,7 +527,9 @@ namespace GPlatesFileIO
 
 				// Write the total size of the output file so the reader can verify that the
 				// file was not partially written.
+				// NOTE: The file size is always big endian (regardless of the version's byte order).
 				file.seek(file_size_offset);
+				out.setByteOrder(QDataStream::BigEndian);
 				out << total_output_file_size;
 			}
 
@@ -850,10 +879,12 @@ namespace GPlatesFileIO
 							mipmap_block_info.height <= RasterFileCacheFormat::BLOCK_SIZE,
 						GPLATES_ASSERTION_SOURCE);
 
-				// Record the file offset of the current block of data.
+				// Record the (aligned) file offset of the current block of data.
 				// The offset is the current file offset plus any unwritten data.
 				mipmap_block_info.main_offset =
-						mipmap_file_stream.device()->pos() + mipmap_byte_array.size();
+						RasterFileCacheFormat::write_block_data_alignment_padding(
+								mipmap_byte_stream,
+								mipmap_file_stream.device()->pos() + mipmap_byte_array.size());
 
 				// Write current main mipmap to the byte stream.
 				// We do this instead of writing to the file in order to avoid constantly
@@ -873,10 +904,12 @@ namespace GPlatesFileIO
 								current_coverage.get()->height() == current_mipmap->height(),
 							GPLATES_ASSERTION_SOURCE);
 
-					// Record the file offset of the current block of coverage data.
+					// Record the (aligned) file offset of the current block of coverage data.
 					// The offset is the current file offset plus any unwritten data.
 					mipmap_block_info.coverage_offset =
-							mipmap_file_stream.device()->pos() + mipmap_byte_array.size();
+							RasterFileCacheFormat::write_block_data_alignment_padding(
+									mipmap_byte_stream,
+									mipmap_file_stream.device()->pos() + mipmap_byte_array.size());
 
 					// Write the current coverage mipmap to the byte stream.
 					// We do this instead of writing to the file in order to avoid constantly
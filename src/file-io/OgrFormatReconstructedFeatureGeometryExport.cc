@@ -106,7 +106,9 @@ GPlatesFileIO::OgrFormatReconstructedFeatureGeometryExport::export_geometries(
 		const referenced_files_collection_type &active_reconstruction_files,
 		const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 		const double &reconstruction_time,
-		bool wrap_to_dateline)
+		bool wrap_to_dateline,
+		const boost::optional<OgrMultiFrameExport::Frame> &multi_frame,
+		boost::optional<unsigned int> transaction_batch_size)
 {
 
 	// Iterate through the reconstructed geometries and check which geometry types we have.
@@ -149,7 +151,9 @@ GPlatesFileIO::OgrFormatReconstructedFeatureGeometryExport::export_geometries(
 	GPlatesFileIO::OgrGeometryExporter geom_exporter(
 		file_path,
 		finder.has_found_multiple_geometry_types(),
-		wrap_to_dateline);
+		wrap_to_dateline,
+		multi_frame,
+		transaction_batch_size);
 
 
 
@@ -219,7 +223,9 @@ GPlatesFileIO::OgrFormatReconstructedFeatureGeometryExport::export_geometries_pe
 		const referenced_files_collection_type &active_reconstruction_files,
 		const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 		const double &reconstruction_time,
-		bool wrap_to_dateline)
+		bool wrap_to_dateline,
+		const boost::optional<OgrMultiFrameExport::Frame> &multi_frame,
+		boost::optional<unsigned int> transaction_batch_size)
 {
 	// Iterate through the reconstructed geometries and check which geometry types we have.
 	GPlatesFeatureVisitors::GeometryTypeFinder finder;
@@ -261,7 +267,9 @@ GPlatesFileIO::OgrFormatReconstructedFeatureGeometryExport::export_geometries_pe
 	GPlatesFileIO::OgrGeometryExporter geom_exporter(
 		file_path,
 		finder.has_found_multiple_geometry_types(),
-		wrap_to_dateline);
+		wrap_to_dateline,
+		multi_frame,
+		transaction_batch_size);
 
 
 
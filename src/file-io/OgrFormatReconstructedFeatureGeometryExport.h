@@ -26,8 +26,10 @@
 #ifndef GPLATES_FILEIO_SHAPEFILEFORMATRECONSTRUCTEDFEATUREGEOMETRYEXPORT_H
 #define GPLATES_FILEIO_SHAPEFILEFORMATRECONSTRUCTEDFEATUREGEOMETRYEXPORT_H
 
+#include <boost/optional.hpp>
 #include <QFileInfo>
 
+#include "OgrMultiFrameExport.h"
 #include "ReconstructionGeometryExportImpl.h"
 
 #include "model/types.h"
@@ -60,6 +62,11 @@ namespace GPlatesFileIO
 		* Exports @a ReconstructedFeatureGeometry objects to ESRI Shapefile format.
 		*
 		* If @a wrap_to_dateline is true then exported polyline/polygon geometries are wrapped/clipped to the dateline.
+		*
+		* If @a multi_frame is specified then the geometries are one frame of a multi-frame export.
+		*
+		* If @a transaction_batch_size is specified then it overrides the default number of features
+		* written per transaction (see @a OgrWriter).
 		*/
 		void
 		export_geometries(
@@ -69,12 +76,19 @@ namespace GPlatesFileIO
 				const referenced_files_collection_type &active_reconstruction_files,
 				const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 				const double &reconstruction_time,
-				bool wrap_to_dateline);
+				bool wrap_to_dateline,
+				const boost::optional<OgrMultiFrameExport::Frame> &multi_frame = boost::none,
+				boost::optional<unsigned int> transaction_batch_size = boost::none);
 
 		/**
 		* Exports @a ReconstructedFeatureGeometry objects to ESRI Shapefile format.
 		*
 		* If @a wrap_to_dateline is true then exported polyline/polygon geometries are wrapped/clipped to the dateline.
+		*
+		* If @a multi_frame is specified then the geometries are one frame of a multi-frame export.
+		*
+		* If @a transaction_batch_size is specified then it overrides the default number of features
+		* written per transaction (see @a OgrWriter).
 		*/
 		void
 		export_geometries_per_collection(
@@ -84,7 +98,9 @@ namespace GPlatesFileIO
 				const referenced_files_collection_type &active_reconstruction_files,
 				const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 				const double &reconstruction_time,
-				bool wrap_to_dateline);
+				bool wrap_to_dateline,
+				const boost::optional<OgrMultiFrameExport::Frame> &multi_frame = boost::none,
+				boost::optional<unsigned int> transaction_batch_size = boost::none);
 	}
 }
 
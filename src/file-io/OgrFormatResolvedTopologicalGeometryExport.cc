@@ -142,7 +142,8 @@ GPlatesFileIO::OgrFormatResolvedTopologicalGeometryExport::export_resolved_topol
 		const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 		const double &reconstruction_time,
 		boost::optional<GPlatesMaths::PolygonOrientation::Orientation> force_polygon_orientation,
-		bool wrap_to_dateline)
+		bool wrap_to_dateline,
+		const boost::optional<OgrMultiFrameExport::Frame> &multi_frame)
 {
 	// Iterate through the reconstructed geometries and check which geometry types we have.
 	GPlatesFeatureVisitors::GeometryTypeFinder finder;
@@ -184,7 +185,8 @@ GPlatesFileIO::OgrFormatResolvedTopologicalGeometryExport::export_resolved_topol
 	GPlatesFileIO::OgrGeometryExporter geom_exporter(
 		file_path,
 		finder.has_found_multiple_geometry_types(),
-		wrap_to_dateline);
+		wrap_to_dateline,
+		multi_frame);
 
 
 
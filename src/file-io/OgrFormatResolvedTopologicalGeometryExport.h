@@ -31,6 +31,7 @@
 
 #include "ReconstructionGeometryExportImpl.h"
 #include "CitcomsResolvedTopologicalBoundaryExportImpl.h"
+#include "OgrMultiFrameExport.h"
 
 #include "maths/PolygonOrientation.h"
 
@@ -77,6 +78,8 @@ namespace GPlatesFileIO
 		 * store exterior rings as clockwise and interior rings as counter-clockwise.
 		 *
 		 * If @a wrap_to_dateline is true then exported polyline/polygon geometries are wrapped/clipped to the dateline.
+		 *
+		 * If @a multi_frame is specified then the geometries are one frame of a multi-frame export.
 		 */
 		void
 		export_resolved_topological_geometries(
@@ -88,7 +91,8 @@ namespace GPlatesFileIO
 				const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 				const double &reconstruction_time,
 				boost::optional<GPlatesMaths::PolygonOrientation::Orientation> force_polygon_orientation,
-				bool wrap_to_dateline);
+				bool wrap_to_dateline,
+				const boost::optional<OgrMultiFrameExport::Frame> &multi_frame = boost::none);
 
 
 		/**
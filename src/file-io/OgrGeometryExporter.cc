@@ -49,9 +49,19 @@
 GPlatesFileIO::OgrGeometryExporter::OgrGeometryExporter(
 	QString &filename,
 	bool multiple_geometry_types,
-	bool wrap_to_dateline):
+	bool wrap_to_dateline,
+	const boost::optional<OgrMultiFrameExport::Frame> &multi_frame,
+	boost::optional<unsigned int> transaction_batch_size):
 	d_filename(filename),
-	d_ogr_writer(new OgrWriter(d_filename, multiple_geometry_types, wrap_to_dateline))
+	d_ogr_writer(
+		new OgrWriter(
+			d_filename,
+			multiple_geometry_types,
+			wrap_to_dateline,
+			boost::none/*original_srs*/,
+			FeatureCollectionFileFormat::OGRConfiguration::WRITE_AS_WGS84_BEHAVIOUR,
+			multi_frame,
+			transaction_batch_size ? transaction_batch_size.get() : OgrWriter::DEFAULT_TRANSACTION_BATCH_SIZE))
 {
 }
 
@@ -36,6 +36,7 @@
 #include <QFile>
 
 #include "GeometryExporter.h"
+#include "OgrMultiFrameExport.h"
 
 #include "maths/ConstGeometryOnSphereVisitor.h"
 #include "maths/MultiPointOnSphere.h"
@@ -60,11 +61,19 @@ namespace GPlatesFileIO
 		/**
 		 * If all the geometry types to be written are not the same type then @a multiple_geometry_types
 		 * should be set to true (this will create multiple exported files - one per geometry type encountered).
+		 *
+		 * If @a multi_frame is specified then the geometries are one frame of a multi-frame export
+		 * (see @a OgrWriter).
+		 *
+		 * If @a transaction_batch_size is specified then it overrides the default number of features
+		 * written per transaction (see @a OgrWriter).
 		 */
 		OgrGeometryExporter(
 			QString &filename,
 			bool multiple_geometry_types,
-			bool wrap_to_dateline);
+			bool wrap_to_dateline,
+			const boost::optional<OgrMultiFrameExport::Frame> &multi_frame = boost::none,
+			boost::optional<unsigned int> transaction_batch_size = boost::none);
 
 		virtual
 			~OgrGeometryExporter();
@@ -0,0 +1,79 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_FILEIO_OGRMULTIFRAMEEXPORT_H
+#define GPLATES_FILEIO_OGRMULTIFRAMEEXPORT_H
+
+
+namespace GPlatesFileIO
+{
+	/**
+	 * Exporting multiple frames (reconstruction times), such as an animation sequence,
+	 * into a single OGR data source (currently only GeoPackage supports this).
+	 *
+	 * Each frame is still exported separately (ie, one export per reconstruction time),
+	 * but instead of overwriting the file each frame is appended to it.
+	 */
+	namespace OgrMultiFrameExport
+	{
+		/**
+		 * How the frames are arranged in the data source.
+		 */
+		enum Layout
+		{
+			//! Each frame is written to its own layers (the layer names are suffixed with the reconstruction time).
+			LAYER_PER_FRAME,
+
+			//! All frames are written to the same layers and distinguished by the "TIME" attribute field.
+			TIME_FIELD
+		};
+
+
+		/**
+		 * Identifies the frame being exported.
+		 */
+		struct Frame
+		{
+			/**
+			 * @a is_first_frame_ should be true for the first frame exported (it replaces any
+			 * existing file) and false for subsequent frames (they get appended to the file).
+			 */
+			Frame(
+					Layout layout_,
+					const double &reconstruction_time_,
+					bool is_first_frame_) :
+				layout(layout_),
+				reconstruction_time(reconstruction_time_),
+				is_first_frame(is_first_frame_)
+			{  }
+
+			Layout layout;
+			double reconstruction_time;
+			bool is_first_frame;
+		};
+	}
+}
+
+#endif // GPLATES_FILEIO_OGRMULTIFRAMEEXPORT_H
@@ -26,6 +26,7 @@
  */
 
 
+#include <exception>
 #include <vector>
 #include <boost/foreach.hpp>
 #include <QDebug>
@@ -82,6 +83,20 @@ namespace{
 		return ((extension == "GMT") || (extension == "gmt"));
 	}
 
+	bool
+	file_type_supports_multiple_frames(
+			const QString &extension)
+	{
+		return (extension == "gpkg");
+	}
+
+	/**
+	 * The attribute field containing the reconstruction time of each frame of a multi-frame export.
+	 *
+	 * This is the same field name used by 'OgrUtils::add_reconstruction_fields_to_kvd()'.
+	 */
+	const char *FRAME_TIME_FIELD_NAME = "TIME";
+
 	enum ogr_driver_string
 	{
 		FORMAT_NAME,
@@ -319,6 +334,11 @@ namespace{
 	/**
 	 * Creates an OGRLayer of type wkb_type and adds it to the GdalUtils::vector_data_source_type.
 	 * Adds any attribute field names provided in key_value_dictionary. 
+	 *
+	 * If @a reuse_existing_layer is true then an existing layer named @a layer_name in the data source
+	 * is used instead (if there is one).
+	 * If @a add_frame_time_field is true then the frame time field is added to a created layer
+	 * (if it's not in the attribute field names).
 	 */
 	void
 	setup_layer(
@@ -328,12 +348,23 @@ namespace{
 		const QString &layer_name,
 		const boost::optional<GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_to_const_type> &field_names_key_value_dictionary,
 		const boost::optional<GPlatesPropertyValues::SpatialReferenceSystem::non_null_ptr_to_const_type> &original_srs,
-		const GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::OgrSrsWriteBehaviour &ogr_srs_behaviour)
+		const GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::OgrSrsWriteBehaviour &ogr_srs_behaviour,
+		bool reuse_existing_layer,
+		bool add_frame_time_field)
 	{
 		if (!ogr_data_source_ptr)
 		{
 			return;
 		}
+		if (!ogr_layer && reuse_existing_layer)
+		{
+			// A previous frame of a multi-frame export might have created the layer.
+			OGRLayer *existing_ogr_layer = ogr_data_source_ptr->GetLayerByName(layer_name.toStdString().c_str());
+			if (existing_ogr_layer != NULL)
+			{
+				ogr_layer = existing_ogr_layer;
+			}
+		}
 		if (!ogr_layer)
 		{
 			OGRSpatialReference spatial_reference; 
@@ -389,6 +420,15 @@ namespace{
 			{
 				set_layer_field_names(*ogr_layer, field_names_key_value_dictionary.get());
 			}
+			if (add_frame_time_field &&
+				(*ogr_layer)->GetLayerDefn()->GetFieldIndex(FRAME_TIME_FIELD_NAME) < 0)
+			{
+				OGRFieldDefn ogr_field(FRAME_TIME_FIELD_NAME, OFTReal);
+				if ((*ogr_layer)->CreateField(&ogr_field) != OGRERR_NONE)
+				{
+					throw GPlatesFileIO::OgrException(GPLATES_EXCEPTION_SOURCE,"Error creating ogr field.");
+				}
+			}
 		}
 	}
 		
@@ -410,6 +450,23 @@ namespace{
 		}
 	}
 
+	/**
+	 * Open an existing ogr data source for update.
+	 */
+	void
+	open_data_source_for_update(
+		GPlatesFileIO::GdalUtils::vector_data_source_type *&data_source_ptr,
+		QString &data_source_name)
+	{
+		data_source_name = QDir::toNativeSeparators(data_source_name);
+		data_source_ptr = GPlatesFileIO::GdalUtils::open_vector(data_source_name, true/*true to allow updates*/);
+
+		if (data_source_ptr == NULL)
+		{
+			throw GPlatesFileIO::OgrException(GPLATES_EXCEPTION_SOURCE,"Ogr data source could not be opened for update.");
+		}
+	}
+
 	void
 	destroy_ogr_data_source(
 			GPlatesFileIO::GdalUtils::vector_data_source_type *&ogr_data_source)
@@ -884,12 +941,17 @@ namespace{
 	}
 }
 
+const unsigned int GPlatesFileIO::OgrWriter::DEFAULT_TRANSACTION_BATCH_SIZE = 10000;
+
+
 GPlatesFileIO::OgrWriter::OgrWriter(
 	QString filename,
 	bool multiple_geometry_types,
 	bool wrap_to_dateline,
 	boost::optional<GPlatesPropertyValues::SpatialReferenceSystem::non_null_ptr_to_const_type> original_srs,
-	const GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::OgrSrsWriteBehaviour &behaviour):
+	const GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::OgrSrsWriteBehaviour &behaviour,
+	const boost::optional<OgrMultiFrameExport::Frame> &multi_frame,
+	unsigned int transaction_batch_size):
 	d_ogr_driver_ptr(0),
 	d_filename(filename),
 	d_layer_basename(QString()),
@@ -900,11 +962,18 @@ GPlatesFileIO::OgrWriter::OgrWriter(
 	d_ogr_point_data_source_ptr(0),
 	d_ogr_line_data_source_ptr(0),
 	d_ogr_polygon_data_source_ptr(0),
+	d_multi_frame(multi_frame),
+	d_transaction_batch_size(transaction_batch_size),
 	d_dateline_wrapper(GPlatesMaths::DateLineWrapper::create()),
 	d_original_srs(original_srs),
 	d_ogr_srs_write_behaviour(behaviour),
 	d_coordinate_transformation(GPlatesPropertyValues::CoordinateTransformation::create())
 {
+	if (d_transaction_batch_size == 0)
+	{
+		throw GPlatesFileIO::OgrException(GPLATES_EXCEPTION_SOURCE,"OGR transaction batch size must be at least one.");
+	}
+
 	GdalUtils::register_all_drivers();
 
 	QFileInfo q_file_info_original(d_filename);
@@ -919,6 +988,12 @@ GPlatesFileIO::OgrWriter::OgrWriter(
 		throw GPlatesFileIO::OgrException(GPLATES_EXCEPTION_SOURCE,"OGR driver not available.");
 	}
 
+	// Appending frames to an existing file requires a format that supports multiple (updatable) layers.
+	if (d_multi_frame &&
+		!file_type_supports_multiple_frames(d_extension))
+	{
+		throw GPlatesFileIO::OgrException(GPLATES_EXCEPTION_SOURCE,"Multi-frame export is only supported for GeoPackage.");
+	}
 
 	// Adjust the filename to include a sub-folder if necessary.
 	// For multiple geometry types we need to export to separate layers, one for each geometry type.
@@ -966,8 +1041,15 @@ GPlatesFileIO::OgrWriter::OgrWriter(
 
 	d_layer_basename = basename;
 
+	// Subsequent frames of a multi-frame export append to the file(s) written by the first frame.
+	const bool remove_existing_files = !d_multi_frame || d_multi_frame->is_first_frame;
+
 	QString full_filename;
-	if (!d_multiple_geometry_types)
+	if (!remove_existing_files)
+	{
+		// Don't remove anything.
+	}
+	else if (!d_multiple_geometry_types)
 	{
 		full_filename = d_filename + "." + d_extension;
 		QFileInfo q_file_info_modified(full_filename);
@@ -1014,6 +1096,26 @@ GPlatesFileIO::OgrWriter::OgrWriter(
 
 GPlatesFileIO::OgrWriter::~OgrWriter()
 {
+	// Commit the features of the open transactions (even if we're being destroyed because writing
+	// failed, so that the features written so far are kept as they are for data sources without
+	// native transactions).
+	//
+	// Note that destructors shouldn't throw exceptions.
+	try
+	{
+		commit_transaction(d_ogr_point_data_source_ptr, d_ogr_point_transaction);
+		commit_transaction(d_ogr_line_data_source_ptr, d_ogr_line_transaction);
+		commit_transaction(d_ogr_polygon_data_source_ptr, d_ogr_polygon_transaction);
+	}
+	catch (const std::exception &exc)
+	{
+		qWarning() << "Failed to commit OGR transaction: " << exc.what();
+	}
+	catch (...)
+	{
+		qWarning() << "Failed to commit OGR transaction: unknown error";
+	}
+
 	destroy_ogr_data_source(d_ogr_data_source_ptr);
 	destroy_ogr_data_source(d_ogr_point_data_source_ptr);
 	destroy_ogr_data_source(d_ogr_line_data_source_ptr);
@@ -1037,17 +1139,17 @@ GPlatesFileIO::OgrWriter::write_point_feature(
 		}
 		data_source_name.append(".").append(d_extension);
 
-		create_data_source(d_ogr_driver_ptr, d_ogr_point_data_source_ptr, data_source_name);
+		create_or_open_data_source(d_ogr_point_data_source_ptr, data_source_name);
 	}
 
 	// Create the layer, if it doesn't already exist, and add any attribute names, and set the desired SRS.
-	setup_layer(d_ogr_point_data_source_ptr,
-				d_ogr_point_layer,
-				wkbPoint,
-				QString(d_layer_basename + "_point"),
-				field_names_key_value_dictionary,
-				d_original_srs,
-				d_ogr_srs_write_behaviour);
+	prepare_layer(
+			d_ogr_point_data_source_ptr,
+			d_ogr_point_transaction,
+			d_ogr_point_layer,
+			wkbPoint,
+			"_point",
+			field_names_key_value_dictionary);
 
 	OGRFeature *ogr_feature = OGRFeature::CreateFeature((*d_ogr_point_layer)->GetLayerDefn());
 
@@ -1074,10 +1176,12 @@ GPlatesFileIO::OgrWriter::write_point_feature(
 	ogr_feature->SetGeometry(&ogr_point);
 
 	// Add the new feature to the layer.
-	if ((*d_ogr_point_layer)->CreateFeature(ogr_feature) != OGRERR_NONE)
-	{
-		throw OgrException(GPLATES_EXCEPTION_SOURCE,"Failed to create point feature.");
-	}
+	add_feature_to_layer(
+			d_ogr_point_data_source_ptr,
+			d_ogr_point_transaction,
+			*d_ogr_point_layer,
+			ogr_feature,
+			"Failed to create point feature.");
 
 	OGRFeature::DestroyFeature(ogr_feature);
 }
@@ -1106,17 +1210,17 @@ GPlatesFileIO::OgrWriter::write_multi_point_feature(
 		}
 		data_source_name.append(".").append(d_extension);
 
-		create_data_source(d_ogr_driver_ptr, d_ogr_point_data_source_ptr, data_source_name);
+		create_or_open_data_source(d_ogr_point_data_source_ptr, data_source_name);
 	}
 
 	// Create the layer, if it doesn't already exist, and add any attribute names.
-	setup_layer(d_ogr_point_data_source_ptr,
-				d_ogr_multi_point_layer,
-				wkbMultiPoint,
-				QString(d_layer_basename + "_multi_point"),
-				field_names_key_value_dictionary,
-				d_original_srs,
-				d_ogr_srs_write_behaviour);
+	prepare_layer(
+			d_ogr_point_data_source_ptr,
+			d_ogr_point_transaction,
+			d_ogr_multi_point_layer,
+			wkbMultiPoint,
+			"_multi_point",
+			field_names_key_value_dictionary);
 
 	OGRFeature *ogr_feature = OGRFeature::CreateFeature((*d_ogr_multi_point_layer)->GetLayerDefn());
 
@@ -1152,10 +1256,12 @@ GPlatesFileIO::OgrWriter::write_multi_point_feature(
 
 
 	// Add the new feature to the layer.
-	if ((*d_ogr_multi_point_layer)->CreateFeature(ogr_feature) != OGRERR_NONE)
-	{
-		throw OgrException(GPLATES_EXCEPTION_SOURCE,"Failed to create multi-point feature.");
-	}
+	add_feature_to_layer(
+			d_ogr_point_data_source_ptr,
+			d_ogr_point_transaction,
+			*d_ogr_multi_point_layer,
+			ogr_feature,
+			"Failed to create multi-point feature.");
 
 	OGRFeature::DestroyFeature(ogr_feature);
 }
@@ -1233,18 +1339,17 @@ GPlatesFileIO::OgrWriter::write_single_or_multi_polyline_feature(
 		}
 		data_source_name.append(".").append(d_extension);
 
-		create_data_source(d_ogr_driver_ptr, d_ogr_line_data_source_ptr, data_source_name);
+		create_or_open_data_source(d_ogr_line_data_source_ptr, data_source_name);
 	}
 
 	// Create the layer, if it doesn't already exist, and add any attribute names.
-	setup_layer(
+	prepare_layer(
 			d_ogr_line_data_source_ptr,
+			d_ogr_line_transaction,
 			d_ogr_polyline_layer,
 			(is_multi_line_string ? wkbMultiLineString : wkbLineString),
-			QString(d_layer_basename + "_polyline"),
-			field_names_key_value_dictionary,
-			d_original_srs,
-			d_ogr_srs_write_behaviour);
+			"_polyline",
+			field_names_key_value_dictionary);
 
 	OGRFeature *ogr_feature = OGRFeature::CreateFeature((*d_ogr_polyline_layer)->GetLayerDefn());
 
@@ -1269,10 +1374,12 @@ GPlatesFileIO::OgrWriter::write_single_or_multi_polyline_feature(
 
 
 	// Add the new feature to the layer.
-	if ((*d_ogr_polyline_layer)->CreateFeature(ogr_feature) != OGRERR_NONE)
-	{
-		throw OgrException(GPLATES_EXCEPTION_SOURCE,"Failed to create multi polyline feature.");
-	}
+	add_feature_to_layer(
+			d_ogr_line_data_source_ptr,
+			d_ogr_line_transaction,
+			*d_ogr_polyline_layer,
+			ogr_feature,
+			"Failed to create multi polyline feature.");
 
 	OGRFeature::DestroyFeature(ogr_feature);
 }
@@ -1342,18 +1449,17 @@ GPlatesFileIO::OgrWriter::write_single_or_multi_polygon_feature(
 		}
 		data_source_name.append(".").append(d_extension);
 
-		create_data_source(d_ogr_driver_ptr, d_ogr_polygon_data_source_ptr, data_source_name);
+		create_or_open_data_source(d_ogr_polygon_data_source_ptr, data_source_name);
 	}
 
 	// Create the layer, if it doesn't already exist, and add any attribute names.
-	setup_layer(
+	prepare_layer(
 			d_ogr_polygon_data_source_ptr,
+			d_ogr_polygon_transaction,
 			d_ogr_polygon_layer,
 			(is_multi_polygon ? wkbMultiPolygon : wkbPolygon),
-			QString(d_layer_basename + "_polygon"),
-			field_names_key_value_dictionary,
-			d_original_srs,
-			d_ogr_srs_write_behaviour);
+			"_polygon",
+			field_names_key_value_dictionary);
 
 	OGRFeature *ogr_feature = OGRFeature::CreateFeature((*d_ogr_polygon_layer)->GetLayerDefn());
 
@@ -1377,11 +1483,151 @@ GPlatesFileIO::OgrWriter::write_single_or_multi_polygon_feature(
 	}
 
 	// Add the new feature to the layer.
-	if ((*d_ogr_polygon_layer)->CreateFeature(ogr_feature) != OGRERR_NONE)
+	add_feature_to_layer(
+			d_ogr_polygon_data_source_ptr,
+			d_ogr_polygon_transaction,
+			*d_ogr_polygon_layer,
+			ogr_feature,
+			"Failed to create polygon feature.");
+
+	OGRFeature::DestroyFeature(ogr_feature);
+}
+
+
+void
+GPlatesFileIO::OgrWriter::create_or_open_data_source(
+	GdalUtils::vector_data_source_type *&ogr_data_source_ptr,
+	QString data_source_name)
+{
+	// Subsequent frames of a multi-frame export append to the file created by the first frame.
+	if (d_multi_frame &&
+		!d_multi_frame->is_first_frame &&
+		QFileInfo(data_source_name).exists())
 	{
-		throw OgrException(GPLATES_EXCEPTION_SOURCE,"Failed to create polygon feature.");
+		open_data_source_for_update(ogr_data_source_ptr, data_source_name);
+		return;
 	}
 
-	OGRFeature::DestroyFeature(ogr_feature);
+	create_data_source(d_ogr_driver_ptr, ogr_data_source_ptr, data_source_name);
+}
+
+
+void
+GPlatesFileIO::OgrWriter::prepare_layer(
+	GdalUtils::vector_data_source_type *ogr_data_source_ptr,
+	Transaction &transaction,
+	boost::optional<OGRLayer*> &ogr_layer,
+	OGRwkbGeometryType wkb_type,
+	const QString &layer_suffix,
+	const boost::optional<GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_to_const_type> &field_names_key_value_dictionary)
+{
+	if (ogr_layer)
+	{
+		return;
+	}
+
+	// Some drivers don't allow layers to be created in the middle of a transaction.
+	commit_transaction(ogr_data_source_ptr, transaction);
+
+	QString layer_name = d_layer_basename + layer_suffix;
+
+	const bool is_time_field_layout =
+			d_multi_frame &&
+			d_multi_frame->layout == OgrMultiFrameExport::TIME_FIELD;
+	if (d_multi_frame &&
+		d_multi_frame->layout == OgrMultiFrameExport::LAYER_PER_FRAME)
+	{
+		layer_name.append(QString("_%1Ma").arg(d_multi_frame->reconstruction_time, 0, 'f', 2));
+	}
+
+	// Create the layer, if it doesn't already exist, and add any attribute names, and set the desired SRS.
+	setup_layer(
+			ogr_data_source_ptr,
+			ogr_layer,
+			wkb_type,
+			layer_name,
+			field_names_key_value_dictionary,
+			d_original_srs,
+			d_ogr_srs_write_behaviour,
+			is_time_field_layout/*reuse_existing_layer*/,
+			is_time_field_layout/*add_frame_time_field*/);
+}
+
+
+void
+GPlatesFileIO::OgrWriter::add_feature_to_layer(
+	GdalUtils::vector_data_source_type *ogr_data_source_ptr,
+	Transaction &transaction,
+	OGRLayer *ogr_layer,
+	OGRFeature *ogr_feature,
+	const char *error_message)
+{
+	// All frames share the same layer so each feature records the time of its frame.
+	if (d_multi_frame &&
+		d_multi_frame->layout == OgrMultiFrameExport::TIME_FIELD)
+	{
+		const int time_field_index = ogr_feature->GetFieldIndex(FRAME_TIME_FIELD_NAME);
+		if (time_field_index >= 0)
+		{
+			ogr_feature->SetField(time_field_index, d_multi_frame->reconstruction_time);
+		}
+	}
+
+#if GPLATES_GDAL_VERSION_NUM >= GPLATES_GDAL_COMPUTE_VERSION(2,0,0)
+	// Start a transaction (if the data source natively supports them) so that the features are
+	// written in batches (instead of, for example, one SQLite transaction per feature for GeoPackage).
+	if (!transaction.is_open &&
+		transaction.is_supported)
+	{
+		if (ogr_data_source_ptr->StartTransaction(FALSE/*bForce*/) == OGRERR_NONE)
+		{
+			transaction.is_open = true;
+			transaction.num_features = 0;
+		}
+		else
+		{
+			// Don't try again for this data source.
+			transaction.is_supported = false;
+		}
+	}
+#endif
+
+	if (ogr_layer->CreateFeature(ogr_feature) != OGRERR_NONE)
+	{
+		// Keep the features successfully written since the last commit (rather than discarding
+		// up to a batch of them because of one failed feature).
+		commit_transaction(ogr_data_source_ptr, transaction);
+
+		throw OgrException(GPLATES_EXCEPTION_SOURCE, error_message);
+	}
+
+	if (transaction.is_open &&
+		++transaction.num_features >= d_transaction_batch_size)
+	{
+		commit_transaction(ogr_data_source_ptr, transaction);
+	}
+}
+
+
+void
+GPlatesFileIO::OgrWriter::commit_transaction(
+	GdalUtils::vector_data_source_type *ogr_data_source_ptr,
+	Transaction &transaction)
+{
+	if (!transaction.is_open)
+	{
+		return;
+	}
+
+	transaction.is_open = false;
+	transaction.num_features = 0;
+
+#if GPLATES_GDAL_VERSION_NUM >= GPLATES_GDAL_COMPUTE_VERSION(2,0,0)
+	if (ogr_data_source_ptr->CommitTransaction() != OGRERR_NONE)
+	{
+		throw OgrException(GPLATES_EXCEPTION_SOURCE, "Failed to commit OGR transaction.");
+	}
+#endif
 }
 
+
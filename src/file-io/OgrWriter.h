@@ -36,6 +36,7 @@
 #include "GdalUtils.h"
 #include "FeatureCollectionFileFormatConfigurations.h"
 #include "Ogr.h"
+#include "OgrMultiFrameExport.h"
 
 #include "maths/DateLineWrapper.h"
 #include "maths/LatLonPoint.h"
@@ -58,13 +59,34 @@ namespace GPlatesFileIO
 	{
 	public:
 
+		/**
+		 * The default number of features written per transaction (for data sources that natively
+		 * support transactions, such as GeoPackage).
+		 *
+		 * Writing many features in one transaction is much faster than the default behaviour of
+		 * GeoPackage (SQLite) which is one transaction per feature.
+		 */
+		static const unsigned int DEFAULT_TRANSACTION_BATCH_SIZE;
+
 		/**
 		 * @a filename: target filename for output.
 		 * @a multiple_layers: whether or not the feature of feature collections to be written contain
 		 * multiple geometry-types. 
 		 * @a wrap_to_dateline whether to wrap/clip polyline/polygon geometries to the dateline (for ArcGIS viewing).
+		 * @a multi_frame: if specified then the features written are one frame of a multi-frame export
+		 * that is appended to (rather than overwrites) the file (only supported for GeoPackage).
 		 *
 		 * Multiple geometry types will be exported to a subfolder of name @a filename (less the file extension).
+		 *
+		 * Features are written in transactions of @a transaction_batch_size features for data sources
+		 * that natively support transactions (such as GeoPackage). Data sources without native
+		 * transactions (such as Shapefile and GeoJSON) are unaffected.
+		 *
+		 * If writing a feature fails then the features successfully written before it are still
+		 * committed (as they are for data sources without native transactions). So a failed export
+		 * leaves a partially written file.
+		 *
+		 * Throws OgrException if @a transaction_batch_size is zero.
 		 */
 		OgrWriter(
 			QString filename,
@@ -72,7 +94,9 @@ namespace GPlatesFileIO
 			bool wrap_to_dateline,
 			boost::optional<GPlatesPropertyValues::SpatialReferenceSystem::non_null_ptr_to_const_type> original_srs = boost::none,
 			const GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::OgrSrsWriteBehaviour &behaviour =
-				GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::WRITE_AS_WGS84_BEHAVIOUR);
+				GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::WRITE_AS_WGS84_BEHAVIOUR,
+			const boost::optional<OgrMultiFrameExport::Frame> &multi_frame = boost::none,
+			unsigned int transaction_batch_size = DEFAULT_TRANSACTION_BATCH_SIZE);
 
 		~OgrWriter();
 
@@ -117,6 +141,29 @@ namespace GPlatesFileIO
 			const boost::optional<GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_to_const_type> &field_values_key_value_dictionary);				
 
 	private:
+
+		/**
+		 * The transaction state of a data source.
+		 */
+		struct Transaction
+		{
+			Transaction() :
+				is_open(false),
+				is_supported(true),
+				num_features(0)
+			{  }
+
+			//! Whether a transaction has been started (and not yet committed).
+			bool is_open;
+
+			//! Whether the data source natively supports transactions (assumed true until a start fails).
+			bool is_supported;
+
+			//! Number of features written in the currently open transaction.
+			unsigned int num_features;
+		};
+
+
 		/**
 		 * The OGR driver.  
 		 *
@@ -167,6 +214,23 @@ namespace GPlatesFileIO
 		boost::optional<OGRLayer*> d_ogr_polyline_layer;
 		boost::optional<OGRLayer*> d_ogr_polygon_layer;
 
+		/**
+		 * Transaction state of each of the geometry type data sources.
+		 */
+		Transaction d_ogr_point_transaction;
+		Transaction d_ogr_line_transaction;
+		Transaction d_ogr_polygon_transaction;
+
+		/**
+		 * The frame being written, if this is one frame of a multi-frame export.
+		 */
+		boost::optional<OgrMultiFrameExport::Frame> d_multi_frame;
+
+		/**
+		 * The number of features written per transaction.
+		 */
+		unsigned int d_transaction_batch_size;
+
 		/**
 		 * Used to wrap/clip polyline/polygon geometries to the dateline (if enabled).
 		 */
@@ -185,6 +249,53 @@ namespace GPlatesFileIO
 		 */
 		GPlatesPropertyValues::CoordinateTransformation::non_null_ptr_to_const_type d_coordinate_transformation;
 
+		/**
+		 * Creates the data source @a ogr_data_source_ptr named @a data_source_name, or opens it
+		 * for update if it's a subsequent frame of a multi-frame export and the file exists.
+		 */
+		void
+		create_or_open_data_source(
+			GdalUtils::vector_data_source_type *&ogr_data_source_ptr,
+			QString data_source_name);
+
+		/**
+		 * Creates the layer @a ogr_layer (if it doesn't already exist) named @a layer_suffix appended
+		 * to the layer basename (and to the reconstruction time if each frame has its own layers).
+		 *
+		 * Any open transaction is committed before the layer is created.
+		 */
+		void
+		prepare_layer(
+			GdalUtils::vector_data_source_type *ogr_data_source_ptr,
+			Transaction &transaction,
+			boost::optional<OGRLayer*> &ogr_layer,
+			OGRwkbGeometryType wkb_type,
+			const QString &layer_suffix,
+			const boost::optional<GPlatesPropertyValues::GpmlKeyValueDictionary::non_null_ptr_to_const_type> &field_names_key_value_dictionary);
+
+		/**
+		 * Adds @a ogr_feature to @a ogr_layer, starting a new transaction if there's not one open
+		 * and committing it once it contains the transaction batch size number of features.
+		 *
+		 * Throws OgrException with @a error_message if the feature could not be added (after committing
+		 * the features successfully added in the open transaction).
+		 */
+		void
+		add_feature_to_layer(
+			GdalUtils::vector_data_source_type *ogr_data_source_ptr,
+			Transaction &transaction,
+			OGRLayer *ogr_layer,
+			OGRFeature *ogr_feature,
+			const char *error_message);
+
+		/**
+		 * Commits the open transaction (if any) on @a ogr_data_source_ptr.
+		 */
+		void
+		commit_transaction(
+			GdalUtils::vector_data_source_type *ogr_data_source_ptr,
+			Transaction &transaction);
+
 		/**
 		 * Common method to write a single polyline or multiple polylines.
 		 */
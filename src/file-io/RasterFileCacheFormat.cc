@@ -29,6 +29,7 @@
 #include <QDebug>
 #include <QFile>
 #include <QFileInfo>
+#include <QSysInfo>
 
 #include "RasterFileCacheFormat.h"
 
@@ -426,6 +427,54 @@ GPlatesFileIO::RasterFileCacheFormat::get_existing_source_cache_filename(
 }
 
 
+QDataStream::ByteOrder
+GPlatesFileIO::RasterFileCacheFormat::get_byte_order(
+		quint32 version_number)
+{
+	return (version_number < 2) ? QDataStream::BigEndian : QDataStream::LittleEndian;
+}
+
+
+bool
+GPlatesFileIO::RasterFileCacheFormat::is_block_data_memory_mappable(
+		quint32 version_number)
+{
+	// Block data is only aligned from version 2 onwards.
+	if (version_number < 2)
+	{
+		return false;
+	}
+
+	return (get_byte_order(version_number) == QDataStream::LittleEndian) ==
+			(QSysInfo::ByteOrder == QSysInfo::LittleEndian);
+}
+
+
+unsigned int
+GPlatesFileIO::RasterFileCacheFormat::get_block_data_alignment_padding(
+		quint64 file_offset)
+{
+	const unsigned int remainder = static_cast<unsigned int>(file_offset % BLOCK_DATA_ALIGNMENT);
+
+	return (remainder == 0) ? 0 : (BLOCK_DATA_ALIGNMENT - remainder);
+}
+
+
+quint64
+GPlatesFileIO::RasterFileCacheFormat::write_block_data_alignment_padding(
+		QDataStream &out,
+		quint64 file_offset)
+{
+	const unsigned int num_padding_bytes = get_block_data_alignment_padding(file_offset);
+	for (unsigned int n = 0; n < num_padding_bytes; ++n)
+	{
+		out << static_cast<quint8>(0);
+	}
+
+	return file_offset + num_padding_bytes;
+}
+
+
 boost::optional<std::size_t>
 GPlatesFileIO::RasterFileCacheFormat::get_colour_palette_id(
 		const GPlatesGui::RasterColourPalette::non_null_ptr_to_const_type &colour_palette)
@@ -105,7 +105,16 @@ namespace GPlatesFileIO
 	 *
 	 * Most of the fields in the header are unsigned 32-bit integers.
 	 * Each RGBA component is stored as an unsigned 8-bit integer.
-	 * The byte order of the entire raster file cache is big endian (the QDataStream default).
+	 *
+	 * The magic number, file size and version number are always big endian (the QDataStream default)
+	 * so that any version of GPlates can identify (and reject) any version of the file.
+	 * In version 1 the remainder of the file is also big endian.
+	 * From version 2 onwards the remainder of the file (header fields and block data) is little endian,
+	 * which is the native byte order of the CPUs GPlates typically runs on, and the encoded data of
+	 * each block starts at a file offset that is a multiple of @a BLOCK_DATA_ALIGNMENT.
+	 * This means a reader on a little endian machine can memory-map the file and copy block data
+	 * directly out of the mapping without any byte swapping.
+	 *
 	 * The file format is independent of the operating system and CPU, with one
 	 * qualification: float is assumed to be 32-bit and double is assumed to be
 	 * 64-bit.
@@ -130,7 +139,16 @@ namespace GPlatesFileIO
 		 * But this is OK since each file format can test sub-ranges of version numbers and perform
 		 * backwards compatible reading of raster file caches as needed.
 		 */
-		const boost::uint32_t VERSION_NUMBER = 1;
+		const boost::uint32_t VERSION_NUMBER = 2;
+
+		/**
+		 * The encoded data of each block (in version 2 onwards) starts at a file offset that is
+		 * a multiple of this number of bytes.
+		 *
+		 * This is a cache line size, and also a multiple of the size of all raster element types,
+		 * so block rows can be copied efficiently out of a memory-mapped file.
+		 */
+		const unsigned int BLOCK_DATA_ALIGNMENT = 64;
 
 		/**
 		 * The type of raster used to store.
@@ -200,6 +218,45 @@ namespace GPlatesFileIO
 		 * The QDataStream serialisation version.
 		 */
 		const int Q_DATA_STREAM_VERSION = QDataStream::Qt_4_4;
+
+		/**
+		 * Returns the byte order of the data following the version number in a raster file cache
+		 * of the specified version (big endian for version 1 and little endian thereafter).
+		 *
+		 * NOTE: The magic number, file size and version number are always big endian.
+		 */
+		QDataStream::ByteOrder
+		get_byte_order(
+				quint32 version_number);
+
+		/**
+		 * Returns true if the encoded block data in a raster file cache of the specified version
+		 * can be used directly from a memory-mapped file on the runtime system.
+		 *
+		 * This requires aligned block data stored in the byte order of the runtime system.
+		 */
+		bool
+		is_block_data_memory_mappable(
+				quint32 version_number);
+
+		/**
+		 * Returns the number of padding bytes needed to round @a file_offset up to the next
+		 * multiple of @a BLOCK_DATA_ALIGNMENT.
+		 */
+		unsigned int
+		get_block_data_alignment_padding(
+				quint64 file_offset);
+
+		/**
+		 * Writes zero padding bytes to @a out so that @a file_offset (the offset of the next
+		 * byte written to @a out) is rounded up to a multiple of @a BLOCK_DATA_ALIGNMENT.
+		 *
+		 * Returns the aligned file offset.
+		 */
+		quint64
+		write_block_data_alignment_padding(
+				QDataStream &out,
+				quint64 file_offset);
 	
 		/**
 		 * Information for the size and file location of a level (base or mipmap) of the mipmap pyramid.
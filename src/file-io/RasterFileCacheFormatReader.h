@@ -76,6 +76,17 @@ namespace GPlatesFileIO
 	{
 	public:
 
+		/**
+		 * Reads the level header (no-data value, statistics and block information) from @a in.
+		 *
+		 * The byte order of @a in should already be set according to @a version_number.
+		 *
+		 * If @a mapped_file_data is non-NULL then it is a memory-mapping of the entire file
+		 * (see @a RasterFileCacheFormat::is_block_data_memory_mappable), of size @a mapped_file_size bytes,
+		 * and block data is copied directly from it instead of being read (and byte-swapped) from @a in.
+		 * Blocks that do not lie within the mapping (eg, a corrupted block offset) are read from @a in.
+		 * The mapping must remain valid for the lifetime of this reader.
+		 */
 		RasterFileCacheFormatReader(
 				quint32 version_number,
 				QFile &file,
@@ -83,9 +94,17 @@ namespace GPlatesFileIO
 				unsigned int image_width,
 				unsigned int image_height,
 				unsigned int num_blocks,
-				bool has_coverage) :
+				bool has_coverage,
+				const uchar *mapped_file_data = NULL,
+				qint64 mapped_file_size = 0) :
 			d_file(file),
 			d_in(in),
+			d_file_byte_order(
+					(in.byteOrder() == QDataStream::LittleEndian)
+					? QSysInfo::LittleEndian
+					: QSysInfo::BigEndian),
+			d_mapped_file_data(mapped_file_data),
+			d_mapped_file_size(mapped_file_size),
 			d_image_width(image_width),
 			d_image_height(image_height),
 			d_has_coverage(has_coverage),
@@ -324,6 +343,35 @@ namespace GPlatesFileIO
 		}
 
 
+		/**
+		 * Returns the memory-mapped data of the specified block, or NULL if the file is not
+		 * memory-mapped or the block does not lie entirely within the mapping.
+		 */
+		template <typename T>
+		const T *
+		get_mapped_block_data(
+				const RasterFileCacheFormat::BlockInfo &block_info,
+				quint64 RasterFileCacheFormat::BlockInfo::*encoded_block_data_offset) const
+		{
+			if (!d_mapped_file_data)
+			{
+				return NULL;
+			}
+
+			const quint64 block_offset = block_info.*encoded_block_data_offset;
+			const quint64 block_size = quint64(block_info.width) * block_info.height * sizeof(T);
+
+			// Written this way to avoid overflow with a corrupted block offset.
+			if (block_offset > quint64(d_mapped_file_size) ||
+				block_size > quint64(d_mapped_file_size) - block_offset)
+			{
+				return NULL;
+			}
+
+			return reinterpret_cast<const T *>(d_mapped_file_data + block_offset);
+		}
+
+
 		template <typename T>
 		void
 		copy_region(
@@ -369,9 +417,8 @@ namespace GPlatesFileIO
 				}
 			}
 
-			// Allocate working space to read block data into.
-			boost::scoped_array<T> block_data(
-					new T[RasterFileCacheFormat::BLOCK_SIZE * RasterFileCacheFormat::BLOCK_SIZE]);
+			// Working space to read block data into (only allocated if a block is not memory-mapped).
+			boost::scoped_array<T> block_data;
 
 			// Read each block in the sorted sequence and write into the appropriate sub-section
 			// of the destination region.
@@ -379,13 +426,28 @@ namespace GPlatesFileIO
 			{
 				const RasterFileCacheFormat::BlockInfo &block_info = blocks_in_region.top();
 
-				//PROFILE_BEGIN(profile_seek, "RasterFileCacheFormatReader seek");
-				// Seek to the beginning of the block's encoded data.
-				d_file.seek(block_info.*encoded_block_data_offset);
-				//PROFILE_END(profile_seek);
+				// If the file is memory-mapped then copy directly from the mapped block data.
+				// The block data is aligned and in the native byte order so no reading or byte-swapping
+				// is needed, and the blocks are still visited in file order for locality of page faults.
+				const T *source_block_data = get_mapped_block_data<T>(block_info, encoded_block_data_offset);
+				if (!source_block_data)
+				{
+					if (!block_data)
+					{
+						block_data.reset(
+								new T[RasterFileCacheFormat::BLOCK_SIZE * RasterFileCacheFormat::BLOCK_SIZE]);
+					}
+
+					//PROFILE_BEGIN(profile_seek, "RasterFileCacheFormatReader seek");
+					// Seek to the beginning of the block's encoded data.
+					d_file.seek(block_info.*encoded_block_data_offset);
+					//PROFILE_END(profile_seek);
 
-				// Read the encoded block data into our block data buffer.
-				read_block_data(block_data.get(), block_info.width * block_info.height);
+					// Read the encoded block data into our block data buffer.
+					read_block_data(block_data.get(), block_info.width * block_info.height);
+
+					source_block_data = block_data.get();
+				}
 
 				// Copy the block data into the appropriate sub-section of the destination region.
 				copy_block_data_into_region(
@@ -394,7 +456,7 @@ namespace GPlatesFileIO
 						region_y_offset,
 						region_width,
 						region_height,
-						block_data.get(),
+						source_block_data,
 						block_info.x_offset,
 						block_info.y_offset,
 						block_info.width,
@@ -496,13 +558,23 @@ namespace GPlatesFileIO
 			}
 
 			//PROFILE_BEGIN(profile_convert, "RasterFileCacheFormatReader: convert endian");
-			GPlatesUtils::Endian::convert(data, data + num_elements, QSysInfo::BigEndian);
+			GPlatesUtils::Endian::convert(data, data + num_elements, d_file_byte_order);
 			//PROFILE_END(profile_convert);
 		}
 
 
 		QFile &d_file;
 		QDataStream &d_in;
+
+		//! The byte order of the data in the file (depends on the file version).
+		QSysInfo::Endian d_file_byte_order;
+
+		//! Memory-mapping of the entire file (or NULL if not memory-mapped).
+		const uchar *d_mapped_file_data;
+
+		//! The size (in bytes) of the memory-mapping.
+		qint64 d_mapped_file_size;
+
 		unsigned int d_image_width;
 		unsigned int d_image_height;
 		bool d_has_coverage;
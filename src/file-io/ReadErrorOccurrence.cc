@@ -61,6 +61,9 @@ GPlatesFileIO::DataFormats::data_format_to_str(
 	case HellingerPick:
 		str = "Hellinger Pick";
 		break;
+	case Gdat:
+		str = "GPlates binary feature collection";
+		break;
 	case Unspecified:
 		str = "Unspecified";
 		break;
@@ -51,6 +51,7 @@ namespace GPlatesFileIO
 			ScalarField3D,
 			Cpt,
 			HellingerPick,
+			Gdat,
 			Unspecified
 		};
 
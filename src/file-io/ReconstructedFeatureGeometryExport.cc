@@ -62,13 +62,16 @@ namespace GPlatesFileIO
 					const std::vector<const File::Reference *> &active_reconstruction_files,
 					const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 					const double &reconstruction_time,
-					bool wrap_to_dateline)
+					bool wrap_to_dateline,
+					const boost::optional<OgrMultiFrameExport::Frame> &multi_frame,
+					boost::optional<unsigned int> transaction_batch_size)
 			{
 				switch (export_format)
 				{
 				case SHAPEFILE:
 				case OGRGMT:
 				case GEOJSON:
+				case GEOPACKAGE:
 					OgrFormatReconstructedFeatureGeometryExport::export_geometries(
 						grouped_recon_geoms_seq,
 						filename,
@@ -76,7 +79,9 @@ namespace GPlatesFileIO
 						active_reconstruction_files,
 						reconstruction_anchor_plate_id,
 						reconstruction_time,
-						wrap_to_dateline);
+						wrap_to_dateline,
+						multi_frame,
+						transaction_batch_size);
 					break;
 
 				case GMT:
@@ -104,13 +109,16 @@ namespace GPlatesFileIO
 					const std::vector<const File::Reference *> &active_reconstruction_files,
 					const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 					const double &reconstruction_time,
-					bool wrap_to_dateline)
+					bool wrap_to_dateline,
+					const boost::optional<OgrMultiFrameExport::Frame> &multi_frame,
+					boost::optional<unsigned int> transaction_batch_size)
 			{
 				switch(export_format)
 				{
 				case SHAPEFILE:
 				case OGRGMT:
 				case GEOJSON:
+				case GEOPACKAGE:
 					OgrFormatReconstructedFeatureGeometryExport::export_geometries_per_collection(
 						grouped_recon_geoms_seq,
 						filename,
@@ -118,7 +126,9 @@ namespace GPlatesFileIO
 						active_reconstruction_files,
 						reconstruction_anchor_plate_id,
 						reconstruction_time,
-						wrap_to_dateline);
+						wrap_to_dateline,
+						multi_frame,
+						transaction_batch_size);
 					break;
 				case GMT:
 					GMTFormatReconstructedFeatureGeometryExport::export_geometries(
@@ -168,6 +178,8 @@ GPlatesFileIO::ReconstructedFeatureGeometryExport::get_export_file_format(
 		return OGRGMT;
 	case FeatureCollectionFileFormat::GEOJSON:
 		return GEOJSON;
+	case FeatureCollectionFileFormat::GEOPACKAGE:
+		return GEOPACKAGE;
 	default:
 		break;
 	}
@@ -188,7 +200,9 @@ GPlatesFileIO::ReconstructedFeatureGeometryExport::export_reconstructed_feature_
 		bool export_single_output_file,
 		bool export_per_input_file,
 		bool export_separate_output_directory_per_input_file,
-		bool wrap_to_dateline)
+		bool wrap_to_dateline,
+		const boost::optional<OgrMultiFrameExport::Frame> &multi_frame,
+		boost::optional<unsigned int> transaction_batch_size)
 {
 	// Get the list of active reconstructable feature collection files that contain
 	// the features referenced by the ReconstructionGeometry objects.
@@ -228,7 +242,9 @@ GPlatesFileIO::ReconstructedFeatureGeometryExport::export_reconstructed_feature_
 					active_reconstruction_files,
 					reconstruction_anchor_plate_id,
 					reconstruction_time,
-					wrap_to_dateline);
+					wrap_to_dateline,
+					multi_frame,
+					transaction_batch_size);
 		}
 		else
 		{
@@ -245,7 +261,9 @@ GPlatesFileIO::ReconstructedFeatureGeometryExport::export_reconstructed_feature_
 					active_reconstruction_files,
 					reconstruction_anchor_plate_id,
 					reconstruction_time,
-					wrap_to_dateline);
+					wrap_to_dateline,
+					multi_frame,
+					transaction_batch_size);
 		}
 	}
 
@@ -272,7 +290,9 @@ GPlatesFileIO::ReconstructedFeatureGeometryExport::export_reconstructed_feature_
 					active_reconstruction_files,
 					reconstruction_anchor_plate_id,
 					reconstruction_time,
-					wrap_to_dateline);
+					wrap_to_dateline,
+					multi_frame,
+					transaction_batch_size);
 		}
 	}
 }
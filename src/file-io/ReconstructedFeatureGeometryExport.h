@@ -28,10 +28,12 @@
 #define GPLATES_FILEIO_RECONSTRUCTEDFEATUREGEOMETRYEXPORT_H
 
 #include <vector>
+#include <boost/optional.hpp>
 #include <QFileInfo>
 #include <QString>
 
 #include "file-io/File.h"
+#include "file-io/OgrMultiFrameExport.h"
 
 #include "model/types.h"
 
@@ -58,7 +60,8 @@ namespace GPlatesFileIO
 			GMT,               //!< '.xy' extension.
 			SHAPEFILE,         //!< '.shp' extension.
 			OGRGMT,            //!< '.gmt' extension.
-			GEOJSON            //!< '.geojson' or '.json' extension.
+			GEOJSON,           //!< '.geojson' or '.json' extension.
+			GEOPACKAGE         //!< '.gpkg' extension.
 		};
 
 
@@ -87,6 +90,11 @@ namespace GPlatesFileIO
 		 *        Only applies if @a export_per_input_file is 'true'.
 		 * @param wrap_to_dateline if true then exported geometries are wrapped/clipped to
 		 *        the dateline (currently ignored by GMT '.xy' format).
+		 * @param multi_frame if specified then this export is one frame of a multi-frame export
+		 *        appended to a single file (only supported by GeoPackage format).
+		 * @param transaction_batch_size the number of features written per transaction for OGR formats
+		 *        that natively support transactions, such as GeoPackage (defaults to
+		 *        OgrWriter::DEFAULT_TRANSACTION_BATCH_SIZE if not specified).
 		 *
 		 * Note that both @a export_single_output_file and @a export_per_input_file can be true
 		 * in which case both a single output file is exported as well as grouped output files.
@@ -106,7 +114,9 @@ namespace GPlatesFileIO
 				bool export_single_output_file,
 				bool export_per_input_file,
 				bool export_separate_output_directory_per_input_file,
-				bool wrap_to_dateline);
+				bool wrap_to_dateline,
+				const boost::optional<OgrMultiFrameExport::Frame> &multi_frame = boost::none,
+				boost::optional<unsigned int> transaction_batch_size = boost::none);
 	}
 }
 
@@ -70,13 +70,15 @@ namespace GPlatesFileIO
 					const GPlatesModel::integer_plate_id_type &reconstruction_anchor_plate_id,
 					const double &reconstruction_time,
 					boost::optional<GPlatesMaths::PolygonOrientation::Orientation> force_polygon_orientation,
-					bool wrap_to_dateline)
+					bool wrap_to_dateline,
+					const boost::optional<OgrMultiFrameExport::Frame> &multi_frame)
 			{
 				switch (export_format)
 				{
 				case SHAPEFILE:
 				case OGRGMT:
 				case GEOJSON:
+				case GEOPACKAGE:
 					OgrFormatResolvedTopologicalGeometryExport::export_resolved_topological_geometries(
 						export_per_collection,
 						grouped_recon_geoms_seq,
@@ -86,7 +88,8 @@ namespace GPlatesFileIO
 						reconstruction_anchor_plate_id,
 						reconstruction_time,
 						force_polygon_orientation,
-						wrap_to_dateline);
+						wrap_to_dateline,
+						multi_frame);
 					break;
 
 				case GMT:
@@ -125,6 +128,7 @@ namespace GPlatesFileIO
 				case SHAPEFILE:
 				case OGRGMT:
 				case GEOJSON:
+				case GEOPACKAGE:
 					OgrFormatResolvedTopologicalGeometryExport::export_resolved_topological_sections(
 						export_per_collection,
 						resolved_topological_sections,
@@ -184,6 +188,8 @@ GPlatesFileIO::ResolvedTopologicalGeometryExport::get_export_file_format(
 		return OGRGMT;
 	case FeatureCollectionFileFormat::GEOJSON:
 		return GEOJSON;
+	case FeatureCollectionFileFormat::GEOPACKAGE:
+		return GEOPACKAGE;
 	default:
 		break;
 	}
@@ -205,7 +211,8 @@ GPlatesFileIO::ResolvedTopologicalGeometryExport::export_resolved_topological_ge
 		bool export_per_input_file,
 		bool export_separate_output_directory_per_input_file,
 		boost::optional<GPlatesMaths::PolygonOrientation::Orientation> force_polygon_orientation,
-		bool wrap_to_dateline)
+		bool wrap_to_dateline,
+		const boost::optional<OgrMultiFrameExport::Frame> &multi_frame)
 {
 	// Get the list of active reconstructable feature collection files that contain
 	// the features referenced by the ReconstructionGeometry objects.
@@ -249,7 +256,8 @@ GPlatesFileIO::ResolvedTopologicalGeometryExport::export_resolved_topological_ge
 				reconstruction_anchor_plate_id,
 				reconstruction_time,
 				force_polygon_orientation,
-				wrap_to_dateline);
+				wrap_to_dateline,
+				multi_frame);
 	}
 
 	if (export_per_input_file)
@@ -277,7 +285,8 @@ GPlatesFileIO::ResolvedTopologicalGeometryExport::export_resolved_topological_ge
 					reconstruction_anchor_plate_id,
 					reconstruction_time,
 					force_polygon_orientation,
-					wrap_to_dateline);
+					wrap_to_dateline,
+					multi_frame);
 		}
 	}
 }
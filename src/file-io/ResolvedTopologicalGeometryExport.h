@@ -32,6 +32,7 @@
 #include <QString>
 
 #include "file-io/File.h"
+#include "file-io/OgrMultiFrameExport.h"
 
 #include "maths/PolygonOrientation.h"
 
@@ -61,7 +62,8 @@ namespace GPlatesFileIO
 			GMT,               //!< '.xy' extension.
 			SHAPEFILE,         //!< '.shp' extension.
 			OGRGMT,            //!< '.gmt' extension.
-			GEOJSON            //!< '.geojson' or '.json' extension.
+			GEOJSON,           //!< '.geojson' or '.json' extension.
+			GEOPACKAGE         //!< '.gpkg' extension.
 		};
 
 
@@ -93,6 +95,8 @@ namespace GPlatesFileIO
 		 *        Only applies to resolved topological boundaries and networks (their polygon boundaries).
 		 * @param wrap_to_dateline if true then exported geometries are wrapped/clipped to
 		 *        the dateline (currently ignored by GMT '.xy' format).
+		 * @param multi_frame if specified then this export is one frame of a multi-frame export
+		 *        appended to a single file (only supported by GeoPackage format).
 		 *
 		 * Note that both @a export_single_output_file and @a export_per_input_file can be true
 		 * in which case both a single output file is exported as well as grouped output files.
@@ -113,7 +117,8 @@ namespace GPlatesFileIO
 				bool export_per_input_file,
 				bool export_separate_output_directory_per_input_file,
 				boost::optional<GPlatesMaths::PolygonOrientation::Orientation> force_polygon_orientation,
-				bool wrap_to_dateline);
+				bool wrap_to_dateline,
+				const boost::optional<OgrMultiFrameExport::Frame> &multi_frame = boost::none);
 
 
 		/**
@@ -506,6 +506,9 @@ GPlatesFileIO::RgbaRasterReader::write_source_raster_file_cache(
 	// Write version number.
 	out << static_cast<quint32>(RasterFileCacheFormat::VERSION_NUMBER);
 
+	// Everything after the version number is written in the byte order of the current version.
+	out.setByteOrder(RasterFileCacheFormat::get_byte_order(RasterFileCacheFormat::VERSION_NUMBER));
+
 	// Write source raster type.
 	out << static_cast<quint32>(
 			RasterFileCacheFormat::get_type_as_enum<GPlatesPropertyValues::Rgba8RawRaster::element_type>());
@@ -593,8 +596,10 @@ GPlatesFileIO::RgbaRasterReader::write_source_raster_file_cache(
 
 	// Write the total size of the cache file so the reader can verify that the
 	// file was not partially written.
+	// NOTE: The file size is always big endian (regardless of the version's byte order).
 	cache_file.seek(file_size_offset);
 	total_cache_file_size = cache_file.size();
+	out.setByteOrder(QDataStream::BigEndian);
 	out << total_cache_file_size;
 }
 
@@ -819,8 +824,9 @@ GPlatesFileIO::RgbaRasterReader::hilbert_curve_traversal(
 			block_info.height = RasterFileCacheFormat::BLOCK_SIZE;
 		}
 
-		// Record the file offset of the current block of data.
-		block_info.main_offset = out.device()->pos();
+		// Record the (aligned) file offset of the current block of data.
+		block_info.main_offset = RasterFileCacheFormat::write_block_data_alignment_padding(
+				out, out.device()->pos());
 
 		// NOTE: There's no coverage data for RGBA rasters.
 		block_info.coverage_offset = 0;
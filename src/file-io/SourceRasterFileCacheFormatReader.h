@@ -158,6 +158,8 @@ namespace GPlatesFileIO
 				const QString &filename) :
 			d_file(filename),
 			d_in(&d_file),
+			d_mapped_file_data(NULL),
+			d_mapped_file_size(0),
 			d_is_closed(false)
 		{
 			// Attempt to open the file for reading.
@@ -215,9 +217,24 @@ namespace GPlatesFileIO
 			d_in >> version_number;
 
 			// Determine which reader to use depending on the version.
-			if (version_number == 1)
+			if (version_number >= 1 && version_number <= RasterFileCacheFormat::VERSION_NUMBER)
 			{
-				d_impl.reset(new VersionOneReader(version_number, d_file, d_in));
+				// Everything after the version number is in the byte order of the file's version.
+				d_in.setByteOrder(RasterFileCacheFormat::get_byte_order(version_number));
+
+				// Memory-map the file if its block data can be used directly.
+				// If mapping fails then we'll just fall back to reading the block data from the file.
+				if (RasterFileCacheFormat::is_block_data_memory_mappable(version_number))
+				{
+					d_mapped_file_data = d_file.map(0, file_info.size());
+					if (d_mapped_file_data)
+					{
+						d_mapped_file_size = file_info.size();
+					}
+				}
+
+				d_impl.reset(new VersionOneReader(
+						version_number, d_file, d_in, d_mapped_file_data, d_mapped_file_size));
 			}
 			// The following demonstrates a possible future scenario where VersionOneReader is used
 			// for versions 1 and 2 and VersionsThreeReader is used for versions 3, 4, 5.
@@ -250,6 +267,12 @@ namespace GPlatesFileIO
 		void
 		close()
 		{
+			if (d_mapped_file_data)
+			{
+				d_file.unmap(d_mapped_file_data);
+				d_mapped_file_data = NULL;
+				d_mapped_file_size = 0;
+			}
 			d_file.close();
 			d_is_closed = true;
 		}
@@ -403,7 +426,9 @@ namespace GPlatesFileIO
 			VersionOneReader(
 					quint32 version_number,
 					QFile &file,
-					QDataStream &in) :
+					QDataStream &in,
+					const uchar *mapped_file_data,
+					qint64 mapped_file_size) :
 				d_file(file),
 				d_in(in),
 				d_raster_width(0),
@@ -447,7 +472,9 @@ namespace GPlatesFileIO
 								source_raster_width,
 								source_raster_height,
 								num_blocks_in_source_raster,
-								has_coverage));
+								has_coverage,
+								mapped_file_data,
+								mapped_file_size));
 			}
 
 			~VersionOneReader()
@@ -511,6 +538,8 @@ namespace GPlatesFileIO
 
 		QFile d_file;
 		QDataStream d_in;
+		uchar *d_mapped_file_data;
+		qint64 d_mapped_file_size;
 		boost::scoped_ptr<ReaderImpl> d_impl;
 		bool d_is_closed;
 	};
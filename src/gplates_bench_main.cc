@@ -0,0 +1,379 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/optional.hpp>
+#include <boost/program_options.hpp>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QTemporaryDir>
+
+#include "bench/Benchmark.h"
+#include "bench/BenchmarkContext.h"
+#include "bench/BenchmarkResult.h"
+#include "bench/BenchmarkRunner.h"
+#include "bench/CoRegistrationBenchmarks.h"
+#include "bench/FileIoBenchmarks.h"
+#include "bench/MathsBenchmarks.h"
+#include "bench/RasterBenchmarks.h"
+#include "bench/ReconstructionBenchmarks.h"
+#include "bench/TopologyBenchmarks.h"
+
+#include "global/GPlatesException.h"
+#include "global/Version.h"
+
+#include "maths/MathsUtils.h"
+
+#include "utils/CommandLineParser.h"
+#include "utils/ParallelUtils.h"
+
+
+namespace
+{
+	const char *SAMPLE_DATA_OPTION_NAME = "sample-data";
+	const char *OUTPUT_OPTION_NAME = "output";
+	const char *BASELINE_OPTION_NAME = "baseline";
+	const char *REGRESSION_THRESHOLD_OPTION_NAME = "regression-threshold";
+	const char *ITERATIONS_OPTION_NAME = "iterations";
+	const char *WARMUP_ITERATIONS_OPTION_NAME = "warmup-iterations";
+	const char *FILTER_OPTION_NAME = "filter";
+	const char *SCOPE_OPTION_NAME = "scope";
+	const char *RASTER_OPTION_NAME = "raster";
+	const char *THREADS_OPTION_NAME = "threads";
+	const char *LIST_OPTION_NAME = "list";
+
+
+	GPlatesBench::benchmark_seq_type
+	create_benchmarks()
+	{
+		GPlatesBench::benchmark_seq_type benchmarks;
+
+		GPlatesBench::add_reconstruction_benchmarks(benchmarks);
+		GPlatesBench::add_topology_benchmarks(benchmarks);
+		GPlatesBench::add_maths_benchmarks(benchmarks);
+		GPlatesBench::add_co_registration_benchmarks(benchmarks);
+		GPlatesBench::add_file_io_benchmarks(benchmarks);
+		GPlatesBench::add_raster_benchmarks(benchmarks);
+
+		return benchmarks;
+	}
+
+
+	/**
+	 * Returns true if @a benchmark is selected by the "filter" and "scope" command-line options.
+	 */
+	bool
+	is_benchmark_selected(
+			const GPlatesBench::Benchmark &benchmark,
+			const std::vector<std::string> &filters,
+			const std::string &scope)
+	{
+		if ((scope == "micro" && benchmark.get_scope() != GPlatesBench::Benchmark::MICRO) ||
+			(scope == "macro" && benchmark.get_scope() != GPlatesBench::Benchmark::MACRO))
+		{
+			return false;
+		}
+
+		if (filters.empty())
+		{
+			return true;
+		}
+
+		for (const std::string &filter : filters)
+		{
+			if (benchmark.get_name().find(filter) != std::string::npos)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+
+	void
+	print_result(
+			std::ostream &os,
+			const GPlatesBench::BenchmarkResult &result)
+	{
+		os << std::left << std::setw(40) << result.name << std::right;
+
+		switch (result.status)
+		{
+		case GPlatesBench::BenchmarkResult::SKIPPED:
+			os << "  skipped: " << result.message;
+			break;
+
+		case GPlatesBench::BenchmarkResult::FAILED:
+			os << "  FAILED: " << result.message;
+			break;
+
+		case GPlatesBench::BenchmarkResult::COMPLETED:
+		default:
+			os << std::fixed << std::setprecision(3)
+				<< "  median " << std::setw(10) << 1000 * result.median_seconds << " ms"
+				<< "  min " << std::setw(10) << 1000 * result.min_seconds << " ms"
+				<< "  items " << result.items_per_iteration;
+			break;
+		}
+
+		os << std::endl;
+	}
+
+
+	void
+	print_comparison(
+			std::ostream &os,
+			const GPlatesBench::BenchmarkComparison &comparison)
+	{
+		os << std::left << std::setw(40) << comparison.name << std::right
+			<< std::fixed << std::setprecision(3)
+			<< "  baseline " << std::setw(10) << 1000 * comparison.baseline_median_seconds << " ms"
+			<< "  current " << std::setw(10) << 1000 * comparison.median_seconds << " ms"
+			<< "  ratio " << std::setprecision(2) << comparison.ratio
+			<< (comparison.is_regression ? "  REGRESSION" : "")
+			<< std::endl;
+	}
+
+
+	/**
+	 * Runs the benchmarks and returns the exit code.
+	 *
+	 * The exit code is non-zero if any benchmark failed or regressed (compared to the baseline).
+	 */
+	int
+	run_benchmarks(
+			int argc,
+			char *argv[])
+	{
+		GPlatesUtils::CommandLineParser::InputOptions input_options;
+		input_options.add_simple_options();
+
+		input_options.generic_options.add_options()
+			(SAMPLE_DATA_OPTION_NAME,
+				boost::program_options::value<std::string>()->default_value(GPLATES_BENCH_SAMPLE_DATA_DIR),
+				"directory containing the GPlates sample data")
+			(OUTPUT_OPTION_NAME,
+				boost::program_options::value<std::string>(),
+				"write the results to this JSON file (can be used as a baseline for later runs)")
+			(BASELINE_OPTION_NAME,
+				boost::program_options::value<std::string>(),
+				"compare the results with a JSON results file written by a previous run")
+			(REGRESSION_THRESHOLD_OPTION_NAME,
+				boost::program_options::value<double>()->default_value(10.0),
+				"percentage increase in median time (over the baseline) reported as a regression")
+			(ITERATIONS_OPTION_NAME,
+				boost::program_options::value<unsigned int>()->default_value(10),
+				"number of timed iterations of each benchmark")
+			(WARMUP_ITERATIONS_OPTION_NAME,
+				boost::program_options::value<unsigned int>()->default_value(1),
+				"number of untimed iterations of each benchmark (before the timed iterations)")
+			(FILTER_OPTION_NAME,
+				boost::program_options::value< std::vector<std::string> >(),
+				"only run benchmarks whose name contains this string (can be specified multiple times)")
+			(SCOPE_OPTION_NAME,
+				boost::program_options::value<std::string>()->default_value("all"),
+				"only run 'micro' or 'macro' benchmarks (or 'all')")
+			(RASTER_OPTION_NAME,
+				boost::program_options::value<std::string>(),
+				"raster file used by the raster benchmarks (by default a raster is generated)")
+			(THREADS_OPTION_NAME,
+				boost::program_options::value<unsigned int>()->default_value(
+						GPlatesUtils::ParallelUtils::get_num_worker_threads()),
+				"number of threads used by multi-threaded operations")
+			(LIST_OPTION_NAME,
+				"list the benchmarks (without running them)");
+
+		boost::program_options::variables_map vm;
+
+		try
+		{
+			GPlatesUtils::CommandLineParser::parse_command_line_options(vm, argc, argv, input_options);
+		}
+		catch (std::exception &exc)
+		{
+			qWarning() << "Error parsing command-line arguments: " << exc.what();
+			return 1;
+		}
+
+		if (GPlatesUtils::CommandLineParser::is_help_requested(vm))
+		{
+			std::cout << GPlatesUtils::CommandLineParser::get_visible_options(input_options) << std::endl;
+			return 0;
+		}
+
+		if (GPlatesUtils::CommandLineParser::is_version_requested(vm))
+		{
+			std::cout << GPlatesGlobal::Version::get_GPlates_version().toLatin1().constData() << std::endl;
+			return 0;
+		}
+
+		const std::vector<std::string> filters = vm.count(FILTER_OPTION_NAME)
+				? vm[FILTER_OPTION_NAME].as< std::vector<std::string> >()
+				: std::vector<std::string>();
+		const std::string scope = vm[SCOPE_OPTION_NAME].as<std::string>();
+
+		GPlatesBench::benchmark_seq_type benchmarks;
+		for (const GPlatesBench::Benchmark::shared_ptr_type &benchmark : create_benchmarks())
+		{
+			if (is_benchmark_selected(*benchmark, filters, scope))
+			{
+				benchmarks.push_back(benchmark);
+			}
+		}
+
+		if (vm.count(LIST_OPTION_NAME))
+		{
+			for (const GPlatesBench::Benchmark::shared_ptr_type &benchmark : benchmarks)
+			{
+				std::cout << benchmark->get_name()
+					<< (benchmark->get_scope() == GPlatesBench::Benchmark::MICRO ? " (micro)" : " (macro)")
+					<< std::endl;
+			}
+			return 0;
+		}
+
+		// Files generated by benchmarks are written here (and removed on exit).
+		QTemporaryDir temporary_dir;
+		if (!temporary_dir.isValid())
+		{
+			qWarning() << "Unable to create a temporary directory.";
+			return 1;
+		}
+
+		const unsigned int num_worker_threads = vm[THREADS_OPTION_NAME].as<unsigned int>();
+
+		GPlatesBench::BenchmarkContext context(
+				QString::fromStdString(vm[SAMPLE_DATA_OPTION_NAME].as<std::string>()),
+				temporary_dir.path(),
+				vm.count(RASTER_OPTION_NAME)
+						? boost::optional<QString>(QString::fromStdString(vm[RASTER_OPTION_NAME].as<std::string>()))
+						: boost::none,
+				num_worker_threads);
+
+		const GPlatesBench::BenchmarkRunner runner(
+				vm[WARMUP_ITERATIONS_OPTION_NAME].as<unsigned int>(),
+				vm[ITERATIONS_OPTION_NAME].as<unsigned int>());
+
+		bool succeeded = true;
+
+		GPlatesBench::benchmark_result_seq_type results;
+		for (const GPlatesBench::Benchmark::shared_ptr_type &benchmark : benchmarks)
+		{
+			const GPlatesBench::BenchmarkResult result = runner.run(*benchmark, context);
+			print_result(std::cout, result);
+
+			if (result.status == GPlatesBench::BenchmarkResult::FAILED)
+			{
+				succeeded = false;
+			}
+
+			results.push_back(result);
+		}
+
+		if (vm.count(OUTPUT_OPTION_NAME))
+		{
+			GPlatesBench::write_benchmark_results(
+					QString::fromStdString(vm[OUTPUT_OPTION_NAME].as<std::string>()),
+					results,
+					num_worker_threads);
+		}
+
+		if (vm.count(BASELINE_OPTION_NAME))
+		{
+			const QString baseline_filename = QString::fromStdString(vm[BASELINE_OPTION_NAME].as<std::string>());
+			const boost::optional<GPlatesBench::benchmark_result_seq_type> baseline_results =
+					GPlatesBench::read_benchmark_results(baseline_filename);
+			if (!baseline_results)
+			{
+				qWarning() << "Baseline file" << baseline_filename << "does not contain benchmark results.";
+				return 1;
+			}
+
+			std::cout << std::endl << "Comparison with baseline:" << std::endl;
+
+			const GPlatesBench::benchmark_comparison_seq_type comparisons =
+					GPlatesBench::compare_benchmark_results(
+							results,
+							baseline_results.get(),
+							vm[REGRESSION_THRESHOLD_OPTION_NAME].as<double>() / 100.0);
+			for (const GPlatesBench::BenchmarkComparison &comparison : comparisons)
+			{
+				print_comparison(std::cout, comparison);
+
+				if (comparison.is_regression)
+				{
+					succeeded = false;
+				}
+			}
+		}
+
+		return succeeded ? 0 : 1;
+	}
+}
+
+
+//
+// To list the benchmarks run 'gplates-bench --list'.
+// To run specific benchmarks run 'gplates-bench --filter topology/ --filter file_io/', for example.
+// To record a baseline run 'gplates-bench --output baseline.json' and then, after making changes,
+// compare against it with 'gplates-bench --baseline baseline.json' (the exit code is non-zero if
+// any benchmark regressed by more than the regression threshold).
+//
+int main(int argc, char* argv[])
+{
+	// Initialise Qt resources that exist in the static 'qt-resources' library.
+	Q_INIT_RESOURCE(opengl);
+	Q_INIT_RESOURCE(python);
+	Q_INIT_RESOURCE(gpgim);
+	Q_INIT_RESOURCE(qt_widgets);
+
+	// Sanity check: Proceed only if we have access to infinity and NaN.
+	// This should pass on all systems that we support.
+	GPlatesMaths::assert_has_infinity_and_nan();
+
+	// The benchmarks do not need a GUI (but file I/O uses Qt, such as image plugins to read rasters).
+	QCoreApplication application(argc, argv);
+
+	try
+	{
+		return run_benchmarks(argc, argv);
+	}
+	catch (const GPlatesGlobal::Exception &exc)
+	{
+		qWarning() << "Error:" << exc;
+	}
+	catch (const std::exception &exc)
+	{
+		qWarning() << "Error:" << exc.what();
+	}
+
+	return 1;
+}
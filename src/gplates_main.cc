@@ -69,6 +69,7 @@
 
 #include "utils/CommandLineParser.h"
 #include "utils/ComponentManager.h"
+#include "utils/Environment.h"
 #include "utils/Profile.h"
 
 
@@ -974,6 +975,15 @@ internal_main(int argc, char* argv[])
 int
 main(int argc, char* argv[])
 {
+	// If the "GPLATES_PROFILE_TRACE" environment variable is set to a filename then record trace events
+	// of profiled code (on all threads) and write them to that file (as Chrome trace-event JSON) on exit.
+	// This works in all build types (unlike the "ProfileGplates" call-graph profile below).
+	const QString profile_trace_filename = GPlatesUtils::getenv("GPLATES_PROFILE_TRACE");
+	if (!profile_trace_filename.isEmpty())
+	{
+		GPlatesUtils::profile_trace_set_enabled(true);
+	}
+
 	// The first of two reasons to wrap 'main()' around 'internal_main()' is to
 	// handle any uncaught exceptions that occur in main() but outside the Qt event thread.
 	// Any uncaught exceptions occurring in the Qt event thread will get caught by the
@@ -989,6 +999,13 @@ main(int argc, char* argv[])
 	// in Visual Studio or you used the "-DCMAKE_BUILD_TYPE:STRING=profilegplates"
 	// command-line option in "cmake" on Linux or Mac.
 	PROFILE_REPORT_TO_FILE("profile.txt");
+
+	if (!profile_trace_filename.isEmpty())
+	{
+		GPlatesUtils::profile_trace_set_enabled(false);
+		GPlatesUtils::profile_trace_write_to_file(profile_trace_filename.toStdString());
+	}
+
 	return return_code;
 }
 
@@ -43,12 +43,12 @@ GPlatesGui::PythonStyleAdapter::get_style(
 		d_cfg_dirty = false;
 	}
 
-	GPlatesApi::Feature py_feature(f);
 	DrawStyle ds; 
 	try
 	{
-		GPlatesApi::PythonInterpreterLocker lock;
-		d_py_obj.attr("get_style")(py_feature, boost::ref(ds));
+		// Acquire the GIL unless it's already held for a sequence of calls (see 'begin_get_styles').
+		GPlatesApi::PythonInterpreterLocker lock(!d_get_styles_interpreter_locker);
+		d_py_obj.attr("get_style")(GPlatesApi::Feature(f), boost::ref(ds));
 	}
 	catch (const boost::python::error_already_set &)
 	{
@@ -58,6 +58,23 @@ GPlatesGui::PythonStyleAdapter::get_style(
 }
 
 
+void
+GPlatesGui::PythonStyleAdapter::begin_get_styles() const
+{
+	if (!d_get_styles_interpreter_locker)
+	{
+		d_get_styles_interpreter_locker.reset(new GPlatesApi::PythonInterpreterLocker());
+	}
+}
+
+
+void
+GPlatesGui::PythonStyleAdapter::end_get_styles() const
+{
+	d_get_styles_interpreter_locker.reset();
+}
+
+
 GPlatesGui::PythonStyleAdapter::PythonStyleAdapter(
 		boost::python::object& obj,
 		const GPlatesGui::StyleCategory& cata) : 
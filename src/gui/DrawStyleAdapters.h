@@ -29,7 +29,10 @@
 #define GPLATES_GUI_DRAWSTYLEADAPTERS_H
 #include <iostream>
 #include <boost/foreach.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
 #include <boost/ref.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <map>
 #include <string>
 #include <QVariant>
@@ -74,6 +77,23 @@ namespace GPlatesGui
 		const DrawStyle
 		get_style(
 				GPlatesModel::FeatureHandle::weak_ref f) const = 0;
+
+		/**
+		 * Called before a sequence of @a get_style calls (such as when drawing a layer) so that
+		 * state shared by those calls can be set up once - see @a StyleAdapterScope.
+		 */
+		virtual
+		void
+		begin_get_styles() const
+		{  }
+
+		/**
+		 * Called after the sequence of @a get_style calls started by @a begin_get_styles.
+		 */
+		virtual
+		void
+		end_get_styles() const
+		{  }
 	
 		
 		const Configuration&
@@ -163,6 +183,15 @@ namespace GPlatesGui
 		get_style(
 				GPlatesModel::FeatureHandle::weak_ref f) const;
 
+		/**
+		 * Acquires the GIL for the sequence of @a get_style calls (instead of for each call).
+		 */
+		void
+		begin_get_styles() const;
+
+		void
+		end_get_styles() const;
+
 		
 		StyleAdapter*
 		deep_clone() const;
@@ -212,6 +241,9 @@ namespace GPlatesGui
 
 	private:
 		mutable bp::object d_py_obj;
+
+		//! Holds the GIL between @a begin_get_styles and @a end_get_styles.
+		mutable boost::scoped_ptr<GPlatesApi::PythonInterpreterLocker> d_get_styles_interpreter_locker;
 	};
 
 
@@ -248,6 +280,38 @@ namespace GPlatesGui
 	private:
 		const boost::shared_ptr<const ColourScheme> d_scheme;
 	};
+
+
+	/**
+	 * Brackets a sequence of StyleAdapter::get_style calls (such as drawing a layer) with
+	 * StyleAdapter::begin_get_styles and StyleAdapter::end_get_styles.
+	 */
+	class StyleAdapterScope :
+			private boost::noncopyable
+	{
+	public:
+		explicit
+		StyleAdapterScope(
+				boost::optional<const StyleAdapter &> style_adapter) :
+			d_style_adapter(style_adapter)
+		{
+			if (d_style_adapter)
+			{
+				d_style_adapter->begin_get_styles();
+			}
+		}
+
+		~StyleAdapterScope()
+		{
+			if (d_style_adapter)
+			{
+				d_style_adapter->end_get_styles();
+			}
+		}
+
+	private:
+		boost::optional<const StyleAdapter &> d_style_adapter;
+	};
 }
 
 #endif  // GPLATES_GUI_DRAWSTYLEADAPTERS_H
@@ -308,6 +308,28 @@ namespace GPlatesGui
 							// The 'true' allows user to turn on/off dateline wrapping of geometries...
 							_1, _2, _3, true),
 					&ExportFileNameTemplateValidationUtils::is_valid_template_filename_sequence_without_percent_P);
+
+			// All frames are exported to a single GeoPackage file, unless the user adds a time varying
+			// format (eg, '%0.2f') to the filename, in which case each frame is exported to its own file.
+			registry.register_exporter(
+					ExportAnimationType::get_export_id(
+							ExportAnimationType::RECONSTRUCTED_GEOMETRIES,
+							ExportAnimationType::GEOPACKAGE),
+					ExportReconstructedGeometryAnimationStrategy::const_configuration_ptr(
+						new ExportReconstructedGeometryAnimationStrategy::Configuration(
+								add_export_filename_extension("reconstructed", ExportAnimationType::GEOPACKAGE),
+								ExportReconstructedGeometryAnimationStrategy::Configuration::GEOPACKAGE,
+								default_reconstructed_geometry_file_export_options,
+								false/*wrap_to_dateline*/)),
+					&create_animation_strategy<ExportReconstructedGeometryAnimationStrategy>,
+					boost::bind(
+							&create_export_options_widget<
+									GPlatesQtWidgets::ExportReconstructedGeometryOptionsWidget,
+									ExportReconstructedGeometryAnimationStrategy,
+									bool>,
+							// The 'true' allows user to turn on/off dateline wrapping of geometries...
+							_1, _2, _3, true),
+					&ExportFileNameTemplateValidationUtils::is_valid_multi_frame_template_filename_without_percent_P);
 		}
 
 
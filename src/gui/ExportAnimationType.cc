@@ -242,6 +242,7 @@ namespace GPlatesGui
 				export_format_description_map[SHAPEFILE]       =QObject::tr("Shapefiles (*.shp)");
 				export_format_description_map[OGRGMT]          =QObject::tr("OGR-GMT (*.gmt)");
 				export_format_description_map[GEOJSON]         =QObject::tr("GeoJSON (*.geojson)");
+				export_format_description_map[GEOPACKAGE]      =QObject::tr("GeoPackage (*.gpkg)");
 				export_format_description_map[SVG]             =QObject::tr("SVG (*.svg)");
 				export_format_description_map[CSV_COMMA]       =QObject::tr("CSV file (comma delimited) (*.csv)");
 				export_format_description_map[CSV_SEMICOLON]   =QObject::tr("CSV file (semicolon delimited) (*.csv)");
@@ -276,6 +277,7 @@ namespace GPlatesGui
 				export_format_filename_extension_map[SHAPEFILE]       ="shp";
 				export_format_filename_extension_map[OGRGMT]          ="gmt";
 				export_format_filename_extension_map[GEOJSON]         ="geojson";
+				export_format_filename_extension_map[GEOPACKAGE]      ="gpkg";
 				export_format_filename_extension_map[SVG]             ="svg";
 				export_format_filename_extension_map[CSV_COMMA]       ="csv";
 				export_format_filename_extension_map[CSV_SEMICOLON]   ="csv";
@@ -82,6 +82,7 @@ namespace GPlatesGui
 			SHAPEFILE,
 			OGRGMT,
 			GEOJSON,
+			GEOPACKAGE,
 			SVG,
 			GPML,
 			CSV_COMMA,
@@ -144,6 +144,20 @@ GPlatesGui::ExportFileNameTemplateValidationUtils::is_valid_template_filename_se
 }
 
 
+bool
+GPlatesGui::ExportFileNameTemplateValidationUtils::is_valid_multi_frame_template_filename_without_percent_P(
+		const QString &filename_template,
+		QString &filename_template_validation_message,
+		bool check_filename_variation)
+{
+	// All frames are written to the same file, so the filename doesn't need to vary.
+	return is_valid_template_filename_sequence_without_percent_P(
+			filename_template,
+			filename_template_validation_message,
+			false/*check_filename_variation*/);
+}
+
+
 bool
 GPlatesGui::ExportFileNameTemplateValidationUtils::is_valid_template_filename_sequence_with_percent_P(
 		const QString &filename_template,
@@ -86,6 +86,19 @@ namespace GPlatesGui
 				bool check_filename_variation = true);
 
 
+		/**
+		 * Same as @a is_valid_template_filename_sequence_without_percent_P except the filename is
+		 * not required to vary with reconstruction time (@a check_filename_variation is ignored).
+		 *
+		 * This is for exports that write all frames to a single file (such as GeoPackage).
+		 */
+		bool
+		is_valid_multi_frame_template_filename_without_percent_P(
+				const QString &filename_template,
+				QString &filename_template_validation_message,
+				bool check_filename_variation = true);
+
+
 		/**
 		 * A common usage of the above functions.
 		 *
@@ -32,6 +32,9 @@
 #include "app-logic/FeatureCollectionFileState.h"
 #include "app-logic/Layer.h"
 
+#include "file-io/ExportTemplateFilenameSequence.h"
+#include "file-io/OgrMultiFrameExport.h"
+
 #include "gui/ExportAnimationContext.h"
 #include "gui/AnimationController.h"
 
@@ -42,7 +45,13 @@ GPlatesGui::ExportReconstructedGeometryAnimationStrategy::ExportReconstructedGeo
 		GPlatesGui::ExportAnimationContext &export_animation_context,
 		const const_configuration_ptr &cfg) :
 	ExportAnimationStrategy(export_animation_context),
-	d_configuration(cfg)
+	d_configuration(cfg),
+	// GeoPackage exports all frames to the same file, unless the filename varies with time
+	// (in which case each frame is a separate file that replaces any existing file).
+	d_export_frames_to_single_file(
+			d_configuration->file_format == Configuration::GEOPACKAGE &&
+			!GPlatesFileIO::ExportTemplateFilename::does_filename_template_vary_with_time(
+					d_configuration->get_filename_template()))
 {
 	set_template_filename(d_configuration->get_filename_template());
 	
@@ -116,6 +125,17 @@ GPlatesGui::ExportReconstructedGeometryAnimationStrategy::do_export_iteration(
 			.arg(basename)
 			.arg(frame_index) );
 
+	// When all frames are exported to the same file they are distinguished by a time attribute.
+	// The first frame replaces any existing file and subsequent frames are appended to it.
+	boost::optional<GPlatesFileIO::OgrMultiFrameExport::Frame> multi_frame;
+	if (d_export_frames_to_single_file)
+	{
+		multi_frame = GPlatesFileIO::OgrMultiFrameExport::Frame(
+				GPlatesFileIO::OgrMultiFrameExport::TIME_FIELD,
+				d_export_animation_context_ptr->view_time(),
+				frame_index == 0/*is_first_frame*/);
+	}
+
 	// Here's where we do the actual work of exporting of the RFGs,
 	// given frame_index, filename, reconstructable files and geoms, and target_dir. Etc.
 	try
@@ -132,7 +152,8 @@ GPlatesGui::ExportReconstructedGeometryAnimationStrategy::do_export_iteration(
 			d_configuration->file_options.export_to_a_single_file,
 			d_configuration->file_options.export_to_multiple_files,
 			d_configuration->file_options.separate_output_directory_per_file,
-			d_configuration->wrap_to_dateline);
+			d_configuration->wrap_to_dateline,
+			multi_frame);
 
 	}
 	catch (std::exception &exc)
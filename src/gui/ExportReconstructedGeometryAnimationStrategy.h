@@ -76,7 +76,8 @@ namespace GPlatesGui
 				SHAPEFILE,
 				OGRGMT,
 				GMT,
-				GEOJSON
+				GEOJSON,
+				GEOPACKAGE // All frames are exported to a single file (unless the filename varies with time).
 			};
 
 			explicit
@@ -154,6 +155,9 @@ namespace GPlatesGui
 
 		//! Export configuration parameters.
 		const_configuration_ptr d_configuration;
+
+		//! Whether all frames are appended to a single file (GeoPackage without a time varying filename).
+		bool d_export_frames_to_single_file;
 	};
 }
 
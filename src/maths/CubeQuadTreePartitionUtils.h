@@ -26,15 +26,19 @@
 #ifndef GPLATES_MATHS_CUBEQUADTREEPARTITIONUTILS_H
 #define GPLATES_MATHS_CUBEQUADTREEPARTITIONUTILS_H
 
+#include <cmath>
+#include <limits>
 #include <utility>  // std::pair
 #include <boost/mpl/if.hpp>
 #include <boost/optional.hpp>
 #include <boost/type_traits/is_const.hpp>
 #include <boost/utility/in_place_factory.hpp>
 
+#include "AngularExtent.h"
 #include "CubeCoordinateFrame.h"
 #include "CubeQuadTreeLocation.h"
 #include "CubeQuadTreePartition.h"
+#include "UnitVector3D.h"
 
 #include "global/AssertionFailureException.h"
 #include "global/GPlatesAssert.h"
@@ -109,6 +113,55 @@ namespace GPlatesMaths
 				const VisitElementPairFunctionType &visit_element_pair_function);
 
 
+		/**
+		 * Visits those elements in @a spatial_partition whose bounds potentially intersect the
+		 * small circle region centred at @a region_centre with radius @a region_extent.
+		 *
+		 * This only uses the 'loose' bounds of the quad tree nodes, so the visited elements
+		 * are only *candidates* - the caller still needs to test each one for an actual intersection.
+		 * However elements that cannot intersect the region are not visited (with the exception of
+		 * elements in the root of the cube which are always visited since they are not partitioned).
+		 *
+		 * Elements are visited in the order they are encountered during traversal
+		 * (which is not necessarily the order in which they were added).
+		 *
+		 * The function signature is:
+		 *
+		 *   void
+		 *   visit_element_function(
+		 *       const ElementType &element);
+		 */
+		template <typename ElementType, typename VisitElementFunctionType>
+		void
+		visit_potentially_intersecting_elements(
+				const CubeQuadTreePartition<ElementType> &spatial_partition,
+				const UnitVector3D &region_centre,
+				const AngularExtent &region_extent,
+				const VisitElementFunctionType &visit_element_function);
+
+
+		/**
+		 * Visits those elements in @a spatial_partition whose bounds potentially contain @a point.
+		 *
+		 * This is the same as the region overload of @a visit_potentially_intersecting_elements
+		 * but with a region of zero extent. Typically an element has at most a few (loose) quad tree
+		 * nodes to visit per cube face making this roughly logarithmic in the number of elements.
+		 */
+		template <typename ElementType, typename VisitElementFunctionType>
+		void
+		visit_elements_potentially_containing_point(
+				const CubeQuadTreePartition<ElementType> &spatial_partition,
+				const UnitVector3D &point,
+				const VisitElementFunctionType &visit_element_function)
+		{
+			visit_potentially_intersecting_elements(
+					spatial_partition,
+					point,
+					AngularExtent::ZERO,
+					visit_element_function);
+		}
+
+
 		// Forward declaration.
 		template <typename ElementType, class CubeQuadTreePartitionType>
 		class CubeQuadTreeIntersectingNodes;
@@ -789,6 +842,155 @@ namespace GPlatesMaths
 		}
 
 
+		namespace Implementation
+		{
+			template <typename ElementType, typename VisitElementFunctionType>
+			void
+			visit_potentially_intersecting_elements_quad_tree(
+					const CubeQuadTreePartition<ElementType> &spatial_partition,
+					typename CubeQuadTreePartition<ElementType>::const_node_reference_type node_reference,
+					const double &node_centre_x,
+					const double &node_centre_y,
+					const double &node_half_width,
+					const double &region_centre_x,
+					const double &region_centre_y,
+					const double &region_radius,
+					const VisitElementFunctionType &visit_element_function)
+			{
+				// The 'loose' bounds of a node are twice the size of the node (about the node centre).
+				// An element's bounds are contained within the loose bounds of the node it's stored in,
+				// so if the region does not overlap the loose bounds then neither do the elements
+				// in this node (or in any child nodes since their loose bounds are inside ours).
+				const double max_separation = 2 * node_half_width + region_radius;
+				const double separation_x = region_centre_x - node_centre_x;
+				const double separation_y = region_centre_y - node_centre_y;
+				if (separation_x > max_separation || separation_x < -max_separation ||
+					separation_y > max_separation || separation_y < -max_separation)
+				{
+					return;
+				}
+
+				// Visit the elements in the current node.
+				for (auto element_iter = node_reference.begin(); element_iter != node_reference.end(); ++element_iter)
+				{
+					visit_element_function(*element_iter);
+				}
+
+				const double child_node_half_width = 0.5 * node_half_width;
+
+				// Iterate over the child nodes.
+				for (unsigned int child_y_offset = 0; child_y_offset < 2; ++child_y_offset)
+				{
+					for (unsigned int child_x_offset = 0; child_x_offset < 2; ++child_x_offset)
+					{
+						const auto child_node = spatial_partition.get_child_node(node_reference, child_x_offset, child_y_offset);
+						if (child_node)
+						{
+							visit_potentially_intersecting_elements_quad_tree(
+									spatial_partition,
+									child_node,
+									node_centre_x + (child_x_offset ? child_node_half_width : -child_node_half_width),
+									node_centre_y + (child_y_offset ? child_node_half_width : -child_node_half_width),
+									child_node_half_width,
+									region_centre_x,
+									region_centre_y,
+									region_radius,
+									visit_element_function);
+						}
+					}
+				}
+			}
+		}
+
+
+		template <typename ElementType, typename VisitElementFunctionType>
+		void
+		visit_potentially_intersecting_elements(
+				const CubeQuadTreePartition<ElementType> &spatial_partition,
+				const UnitVector3D &region_centre,
+				const AngularExtent &region_extent,
+				const VisitElementFunctionType &visit_element_function)
+		{
+			// Elements in the root of the spatial partition (not in any cube-face quadtrees) are not
+			// partitioned and so they potentially intersect any region.
+			for (auto root_element_iter = spatial_partition.begin_root_elements();
+				root_element_iter != spatial_partition.end_root_elements();
+				++root_element_iter)
+			{
+				visit_element_function(*root_element_iter);
+			}
+
+			const double cos_region_extent = region_extent.get_cosine().dval();
+			const double sin_region_extent = region_extent.get_sine().dval();
+
+			// Iterate over the faces of the cube and then traverse the quad tree of each face.
+			for (unsigned int face = 0; face < 6; ++face)
+			{
+				const CubeCoordinateFrame::CubeFaceType cube_face =
+						static_cast<CubeCoordinateFrame::CubeFaceType>(face);
+
+				// See if there is the current quad tree root node in the spatial partition.
+				const auto root_node_reference = spatial_partition.get_quad_tree_root_node(cube_face);
+				if (!root_node_reference)
+				{
+					continue;
+				}
+
+				const UnitVector3D region_centre_in_cube_face_coords =
+						CubeCoordinateFrame::transform_into_cube_face_coordinate_frame(cube_face, region_centre);
+
+				// Negate the local z coordinate to convert it to global coordinate.
+				const double cos_e = -region_centre_in_cube_face_coords.z().dval();
+				const double sin_e = std::sqrt(1+1e-12 - cos_e * cos_e);
+
+				const double cos_e_cos_a = cos_e * cos_region_extent;
+				const double sin_e_sin_a = sin_e * sin_region_extent;
+
+				// Elements were only added to this cube face if their bounds are entirely within the
+				// hemisphere centred on the cube face. So if the region is entirely outside that
+				// hemisphere then it cannot intersect any elements in this cube face.
+				if (cos_e_cos_a + sin_e_sin_a < 1e-6)
+				{
+					continue;
+				}
+
+				// See if the region is entirely within the hemisphere centred on the cube face.
+				// If it isn't then the projection of the region onto the cube face is not well-defined
+				// and so we just visit all elements in this cube face (in its quad tree).
+				if (cos_e_cos_a < sin_e_sin_a + 1e-6)
+				{
+					Implementation::visit_potentially_intersecting_elements_quad_tree(
+							spatial_partition,
+							root_node_reference,
+							0, 0, 1.0/*root node half width*/,
+							0, 0, (std::numeric_limits<double>::max)()/*region radius*/,
+							visit_element_function);
+					continue;
+				}
+
+				// Project the region centre onto the cube face.
+				const double inv_cos_e = 1.0 / cos_e;
+				const double region_centre_x = inv_cos_e * region_centre_in_cube_face_coords.x().dval();
+				const double region_centre_y = inv_cos_e * region_centre_in_cube_face_coords.y().dval();
+
+				// The maximum projected radius of the region onto the cube face
+				// (calculated the same way as when adding elements to the spatial partition).
+				// Add a little bit to give a bit of padding to the bounds for numerical tolerance.
+				const double max_projected_region_radius =
+						sin_region_extent / (cos_e * (cos_e_cos_a - sin_e_sin_a)) + 1e-6;
+
+				Implementation::visit_potentially_intersecting_elements_quad_tree(
+						spatial_partition,
+						root_node_reference,
+						0, 0, 1.0/*root node half width*/,
+						region_centre_x,
+						region_centre_y,
+						max_projected_region_radius,
+						visit_element_function);
+			}
+		}
+
+
 		template <typename ElementType, class CubeQuadTreePartitionType>
 		CubeQuadTreePartitionIntersectingNodes<ElementType, CubeQuadTreePartitionType>::CubeQuadTreePartitionIntersectingNodes(
 				CubeQuadTreePartitionType &spatial_partition,
@@ -43,6 +43,7 @@
 #include "PointOnSphere.h"
 #include "PolygonOnSphere.h"
 #include "PolylineOnSphere.h"
+#include "RotationMatrix.h"
 #include "SmallCircle.h"
 #include "UnitVector3D.h"
 #include "Vector3D.h"
@@ -473,19 +474,11 @@ GPlatesMaths::operator*(
 		const FiniteRotation &r,
 		const GPlatesUtils::non_null_intrusive_ptr<const MultiPointOnSphere> &mp)
 {
-	// TODO: If there are enough points, convert quaternion to 3x3 matrix and
-	//       use that to rotate all points (since it's cheaper). There needs to
-	//       be enough points to cover the cost of converting quaternion to a matrix.
+	// Copy the points once and rotate them in place.
+	std::vector<PointOnSphere> rotated_points(mp->begin(), mp->end());
 
-	std::vector<PointOnSphere> rotated_points;
-	rotated_points.reserve(mp->number_of_points());
-
-	MultiPointOnSphere::const_iterator iter = mp->begin();
-	MultiPointOnSphere::const_iterator end = mp->end();
-	for ( ; iter != end; ++iter)
-	{
-		rotated_points.push_back(PointOnSphere(r * iter->position_vector()));
-	}
+	// Rotating many points with a matrix is cheaper than with the quaternion.
+	RotationMatrix(r).rotate(rotated_points.begin(), rotated_points.end());
 
 	return MultiPointOnSphere::create(rotated_points);
 }
@@ -496,20 +489,10 @@ GPlatesMaths::operator*(
 		const FiniteRotation &r,
 		const GPlatesUtils::non_null_intrusive_ptr<const PolylineOnSphere> &p)
 {
-	// TODO: If there are enough points, convert quaternion to 3x3 matrix and
-	//       use that to rotate all points (since it's cheaper). There needs to
-	//       be enough points to cover the cost of converting quaternion to a matrix.
-
-	std::vector<PointOnSphere> rotated_points;
-	rotated_points.reserve(p->number_of_vertices());
-
-	PolylineOnSphere::vertex_const_iterator iter = p->vertex_begin();
-	PolylineOnSphere::vertex_const_iterator end = p->vertex_end();
-	for ( ; iter != end; ++iter) {
-		rotated_points.push_back(PointOnSphere(r * iter->position_vector()));
-	}
-
-	return PolylineOnSphere::create(rotated_points);
+	// Rotating many vertices with a matrix is cheaper than with the quaternion.
+	// Any segments already created are rotated (keeping their cached quantities) instead of being
+	// re-created from the rotated vertices.
+	return PolylineOnSphere::create_rotated_polyline(RotationMatrix(r), *p);
 }
 
 
@@ -518,43 +501,10 @@ GPlatesMaths::operator*(
 		const FiniteRotation &r,
 		const GPlatesUtils::non_null_intrusive_ptr<const PolygonOnSphere> &p)
 {
-	// TODO: If there are enough points, convert quaternion to 3x3 matrix and
-	//       use that to rotate all points (since it's cheaper). There needs to
-	//       be enough points to cover the cost of converting quaternion to a matrix.
-
-	std::vector<PointOnSphere> rotated_exterior_ring;
-	rotated_exterior_ring.reserve(p->number_of_vertices_in_exterior_ring());
-
-	// Rotate the exterior ring.
-	PolygonOnSphere::ring_vertex_const_iterator exterior_iter = p->exterior_ring_vertex_begin();
-	PolygonOnSphere::ring_vertex_const_iterator exterior_end = p->exterior_ring_vertex_end();
-	for ( ; exterior_iter != exterior_end; ++exterior_iter)
-	{
-		rotated_exterior_ring.push_back(PointOnSphere(r * exterior_iter->position_vector()));
-	}
-
-	const unsigned int num_interior_rings = p->number_of_interior_rings();
-	if (num_interior_rings == 0)
-	{
-		return PolygonOnSphere::create(rotated_exterior_ring);
-	}
-
-	std::vector< std::vector<PointOnSphere> > rotated_interior_rings(num_interior_rings);
-
-	// Rotate the interior rings.
-	for (unsigned int interior_ring_index = 0; interior_ring_index < num_interior_rings; interior_ring_index++)
-	{
-		rotated_interior_rings[interior_ring_index].reserve(p->number_of_vertices_in_interior_ring(interior_ring_index));
-
-		PolygonOnSphere::ring_vertex_const_iterator interior_iter = p->interior_ring_vertex_begin(interior_ring_index);
-		PolygonOnSphere::ring_vertex_const_iterator interior_end = p->interior_ring_vertex_end(interior_ring_index);
-		for ( ; interior_iter != interior_end; ++interior_iter)
-		{
-			rotated_interior_rings[interior_ring_index].push_back(PointOnSphere(r * interior_iter->position_vector()));
-		}
-	} // loop over interior rings
-
-	return PolygonOnSphere::create(rotated_exterior_ring, rotated_interior_rings);
+	// Rotating many vertices with a matrix is cheaper than with the quaternion.
+	// Any ring segments already created are rotated (keeping their cached quantities) instead of
+	// being re-created from the rotated vertices.
+	return PolygonOnSphere::create_rotated_polygon(RotationMatrix(r), *p);
 }
 
 
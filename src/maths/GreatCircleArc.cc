@@ -27,6 +27,7 @@
 
 #include <cmath>
 #include <sstream>
+#include <thread>
 #include <boost/optional.hpp>
 #include <boost/utility/in_place_factory.hpp>
 
@@ -36,6 +37,7 @@
 #include "IndeterminateArcRotationAxisException.h"
 #include "PolylineOnSphere.h"
 #include "Rotation.h"
+#include "RotationMatrix.h"
 #include "Vector3D.h"
 
 
@@ -400,7 +402,7 @@ GPlatesMaths::GreatCircleArc::create_rotated_arc(
 
 	// If the rotation axis has been cached (ie, rotation info calculated and not zero length)
 	// then rotate the cached rotation axis.
-	if (rotated_arc.d_cached_on_demand.d_have_calculated_rotation_info)
+	if (rotated_arc.d_cached_on_demand.have_calculated_rotation_info())
 	{
 		if (!rotated_arc.d_cached_on_demand.d_is_zero_length)
 		{
@@ -412,6 +414,68 @@ GPlatesMaths::GreatCircleArc::create_rotated_arc(
 }
 
 
+void
+GPlatesMaths::GreatCircleArc::create_rotated_arcs(
+		std::vector<GreatCircleArc> &rotated_arcs,
+		const RotationMatrix &rotation,
+		const std::vector<GreatCircleArc> &arcs)
+{
+	if (arcs.empty())
+	{
+		return;
+	}
+
+	const unsigned int num_arcs = arcs.size();
+
+	// Gather the vertices (the start point of each arc and the end point of the last arc)
+	// followed by the cached rotation axes (if any).
+	std::vector<UnitVector3D> unit_vectors;
+	unit_vectors.reserve(2 * num_arcs + 1);
+	for (unsigned int arc_index = 0; arc_index < num_arcs; ++arc_index)
+	{
+		unit_vectors.push_back(arcs[arc_index].d_start_point.position_vector());
+	}
+	unit_vectors.push_back(arcs.back().d_end_point.position_vector());
+	for (unsigned int arc_index = 0; arc_index < num_arcs; ++arc_index)
+	{
+		const CachedOnDemand &cached_on_demand = arcs[arc_index].d_cached_on_demand;
+		if (cached_on_demand.have_calculated_rotation_info() &&
+			!cached_on_demand.d_is_zero_length)
+		{
+			unit_vectors.push_back(cached_on_demand.d_rotation_axis);
+		}
+	}
+
+	std::vector<UnitVector3D> rotated_unit_vectors;
+	rotation.rotate(rotated_unit_vectors, unit_vectors);
+
+	rotated_arcs.reserve(rotated_arcs.size() + num_arcs);
+
+	unsigned int rotated_axis_index = num_arcs + 1;
+	for (unsigned int arc_index = 0; arc_index < num_arcs; ++arc_index)
+	{
+		// Copy the arc (and any cached-on-demand quantities).
+		GreatCircleArc rotated_arc(arcs[arc_index]);
+
+		// Rotate the start/end points.
+		rotated_arc.d_start_point = PointOnSphere(rotated_unit_vectors[arc_index]);
+		rotated_arc.d_end_point = PointOnSphere(rotated_unit_vectors[arc_index + 1]);
+
+		// Note: The dot product of the start/end points remains unchanged by rotation.
+		//       As does the arc length (if it was calculated/cached).
+
+		// If the rotation axis has been cached then use the rotated rotation axis.
+		if (rotated_arc.d_cached_on_demand.have_calculated_rotation_info() &&
+			!rotated_arc.d_cached_on_demand.d_is_zero_length)
+		{
+			rotated_arc.d_cached_on_demand.d_rotation_axis = rotated_unit_vectors[rotated_axis_index++];
+		}
+
+		rotated_arcs.push_back(rotated_arc);
+	}
+}
+
+
 const GPlatesMaths::GreatCircleArc
 GPlatesMaths::GreatCircleArc::create_antipodal_arc(
 		const GreatCircleArc &arc)
@@ -433,10 +497,7 @@ GPlatesMaths::GreatCircleArc::create_antipodal_arc(
 const GPlatesMaths::real_t &
 GPlatesMaths::GreatCircleArc::arc_length() const
 {
-	if (!d_cached_on_demand.d_have_calculated_arc_length)
-	{
-		d_cached_on_demand.calculate_arc_length(dot_of_endpoints());
-	}
+	d_cached_on_demand.ensure_arc_length(dot_of_endpoints());
 
 	return d_cached_on_demand.d_arc_length;
 }
@@ -445,10 +506,7 @@ GPlatesMaths::GreatCircleArc::arc_length() const
 bool
 GPlatesMaths::GreatCircleArc::is_zero_length() const
 {
-	if (!d_cached_on_demand.d_have_calculated_rotation_info)
-	{
-		d_cached_on_demand.calculate_rotation_info(d_start_point, d_end_point);
-	}
+	d_cached_on_demand.ensure_rotation_info(d_start_point, d_end_point);
 
 	return d_cached_on_demand.d_is_zero_length;
 }
@@ -457,10 +515,7 @@ GPlatesMaths::GreatCircleArc::is_zero_length() const
 const GPlatesMaths::UnitVector3D &
 GPlatesMaths::GreatCircleArc::rotation_axis() const
 {
-	if (!d_cached_on_demand.d_have_calculated_rotation_info)
-	{
-		d_cached_on_demand.calculate_rotation_info(d_start_point, d_end_point);
-	}
+	d_cached_on_demand.ensure_rotation_info(d_start_point, d_end_point);
 
 	if (d_cached_on_demand.d_is_zero_length)
 	{
@@ -620,11 +675,79 @@ GPlatesMaths::GreatCircleArc::evaluate_construction_parameter_validity(
 }
 
 
+GPlatesMaths::GreatCircleArc::CachedOnDemand::CachedOnDemand(
+		const CachedOnDemand &other) :
+	d_rotation_info_state(NOT_CALCULATED),
+	d_arc_length_state(NOT_CALCULATED),
+	d_is_zero_length(true),
+	d_rotation_axis(UnitVector3D::zBasis())
+{
+	*this = other;
+}
+
+
+GPlatesMaths::GreatCircleArc::CachedOnDemand &
+GPlatesMaths::GreatCircleArc::CachedOnDemand::operator=(
+		const CachedOnDemand &other)
+{
+	// Only copy quantities that 'other' has finished calculating (another thread might
+	// still be calculating them), otherwise they'll just get calculated again when requested.
+	if (other.have_calculated_rotation_info())
+	{
+		d_is_zero_length = other.d_is_zero_length;
+		d_rotation_axis = other.d_rotation_axis;
+		d_rotation_info_state.store(CALCULATED, std::memory_order_release);
+	}
+	else
+	{
+		d_rotation_info_state.store(NOT_CALCULATED, std::memory_order_release);
+	}
+
+	if (other.d_arc_length_state.load(std::memory_order_acquire) == CALCULATED)
+	{
+		d_arc_length = other.d_arc_length;
+		d_arc_length_state.store(CALCULATED, std::memory_order_release);
+	}
+	else
+	{
+		d_arc_length_state.store(NOT_CALCULATED, std::memory_order_release);
+	}
+
+	return *this;
+}
+
+
+bool
+GPlatesMaths::GreatCircleArc::CachedOnDemand::begin_calculation(
+		std::atomic<unsigned char> &state)
+{
+	unsigned char expected_state = NOT_CALCULATED;
+	if (state.compare_exchange_strong(expected_state, CALCULATING, std::memory_order_acquire))
+	{
+		return true;
+	}
+
+	// Another thread is calculating (or has just calculated) the quantity.
+	// The calculation is only a handful of floating-point operations so just spin until it's published.
+	while (state.load(std::memory_order_acquire) != CALCULATED)
+	{
+		std::this_thread::yield();
+	}
+
+	return false;
+}
+
+
 void
 GPlatesMaths::GreatCircleArc::CachedOnDemand::calculate_rotation_info(
 		const PointOnSphere &start_point,
 		const PointOnSphere &end_point)
 {
+	if (!begin_calculation(d_rotation_info_state))
+	{
+		return;
+	}
+
 	/*
 	 * Now we want to calculate the unit vector normal to the plane
 	 * of rotation (this vector also known as the "rotation axis").
@@ -650,7 +773,26 @@ GPlatesMaths::GreatCircleArc::CachedOnDemand::calculate_rotation_info(
 		d_is_zero_length = false;
 	}
 
-	d_have_calculated_rotation_info = true;
+	// Publish the rotation info to other threads.
+	d_rotation_info_state.store(CALCULATED, std::memory_order_release);
+}
+
+
+void
+GPlatesMaths::GreatCircleArc::CachedOnDemand::calculate_arc_length(
+		const real_t &dot_of_endpoints_)
+{
+	if (!begin_calculation(d_arc_length_state))
+	{
+		return;
+	}
+
+	// Note: We use GPlatesMaths::acos instead of std::acos since it's possible the
+	// dot product is just outside the range [-1,1] which would result in NaN.
+	d_arc_length = acos(dot_of_endpoints_);
+
+	// Publish the arc length to other threads.
+	d_arc_length_state.store(CALCULATED, std::memory_order_release);
 }
 
 
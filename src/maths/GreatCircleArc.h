@@ -28,6 +28,7 @@
 #ifndef GPLATES_MATHS_GREATCIRCLEARC_H
 #define GPLATES_MATHS_GREATCIRCLEARC_H
 
+#include <atomic>
 #include <utility>  /* std::pair */
 #include <vector>
 #include <boost/cstdint.hpp>
@@ -46,6 +47,7 @@ namespace GPlatesMaths
 {
 	class FiniteRotation;
 	class PolylineOnSphere;
+	class RotationMatrix;
 
 
 	/** 
@@ -131,6 +133,25 @@ namespace GPlatesMaths
 				const GreatCircleArc &arc);
 
 
+		/**
+		 * Rotate a connected sequence of arcs @a arcs (where each arc starts at the end point
+		 * of the previous arc, such as the segments of a polyline or polygon ring) and append
+		 * the rotated arcs to @a rotated_arcs.
+		 *
+		 * This gives the same arcs as @a create_rotated_arc, but each vertex shared by adjacent arcs
+		 * is only rotated once and all vertices (and cached rotation axes) are rotated together.
+		 * Since a rotation preserves the validity of arcs, the rotated arcs are not re-created from
+		 * their end points (ie, there are no validity checks, and the dot product of end points
+		 * and any cached rotation information are retained).
+		 */
+		static
+		void
+		create_rotated_arcs(
+				std::vector<GreatCircleArc> &rotated_arcs,
+				const RotationMatrix &rotation,
+				const std::vector<GreatCircleArc> &arcs);
+
+
 		/**
 		 * Create the antipodal great circle arc of @a arc.
 		 *
@@ -282,7 +303,7 @@ namespace GPlatesMaths
 	private:
 
 		/**
-		 * Purpose of this structure is two-fold:
+		 * Purpose of this structure is three-fold:
 		 * 
 		 * 1) To delay calculating some quantities until they are requested.
 		 *    This saves CPU since, in some cases, the quantities might never be queried.
@@ -294,64 +315,93 @@ namespace GPlatesMaths
 		 *    boost::optional for each cached quantity since each boost::optional stores an extra boolean
 		 *    which actually consumes an extra 8 bytes per boost::optional in our case due to alignment
 		 *    restrictions (we're storing 'double' floating-point values which are aligned to 8 bytes).
+		 *
+		 * 3) Allow the same arc to be queried from multiple threads (eg, when partitioning or
+		 *    resolving against geometries shared across threads). Each cached quantity has a
+		 *    single-byte atomic state - the first thread to request a quantity calculates it and
+		 *    publishes it (with release semantics) while any other thread requesting it at the same
+		 *    time waits until it's published. So the memory used is the same as with plain booleans.
 		 */
 		class CachedOnDemand
 		{
 		public:
 			CachedOnDemand() :
-				d_have_calculated_rotation_info(false),
-				d_have_calculated_arc_length(false),
+				d_rotation_info_state(NOT_CALCULATED),
+				d_arc_length_state(NOT_CALCULATED),
 				d_is_zero_length(true),  // arbitrary value - we could instead just leave uninitialized/undefined
 				d_rotation_axis(UnitVector3D::zBasis())  // arbitrary value - there's no default constructor
 			{  }
 
+			/**
+			 * Copies only those quantities that have been fully calculated in @a other.
+			 */
+			CachedOnDemand(
+					const CachedOnDemand &other);
+
+			CachedOnDemand &
+			operator=(
+					const CachedOnDemand &other);
+
 
 			/**
-			 * Initialises @a d_is_zero_length and @a d_rotation_axis.
+			 * Whether @a d_is_zero_length and @a d_rotation_axis have been calculated.
+			 */
+			bool
+			have_calculated_rotation_info() const
+			{
+				return d_rotation_info_state.load(std::memory_order_acquire) == CALCULATED;
+			}
+
+			/**
+			 * Initialises @a d_is_zero_length and @a d_rotation_axis (if not already calculated).
 			 *
-			 * Call this if @a d_have_calculated_rotation_info is false (after which it will be true).
-			 * Then you can access @a d_is_zero_length and @a d_rotation_axis.
+			 * After this returns you can access @a d_is_zero_length and @a d_rotation_axis.
 			 */
 			void
-			calculate_rotation_info(
+			ensure_rotation_info(
 					const PointOnSphere &start_point,
-					const PointOnSphere &end_point);
+					const PointOnSphere &end_point)
+			{
+				if (!have_calculated_rotation_info())
+				{
+					calculate_rotation_info(start_point, end_point);
+				}
+			}
 
 			/**
-			 * Initialises @a d_arc_length.
+			 * Initialises @a d_arc_length (if not already calculated).
 			 *
-			 * Call this if @a d_have_calculated_arc_length is false (after which it will be true).
-			 * Then you can access @a d_arc_length.
+			 * After this returns you can access @a d_arc_length.
 			 */
 			void
-			calculate_arc_length(
+			ensure_arc_length(
 					const real_t &dot_of_endpoints_)
 			{
-				// Note: We use GPlatesMaths::acos instead of std::acos since it's possible the
-				// dot product is just outside the range [-1,1] which would result in NaN.
-				d_arc_length = acos(dot_of_endpoints_);
-				d_have_calculated_arc_length = true;
+				if (d_arc_length_state.load(std::memory_order_acquire) != CALCULATED)
+				{
+					calculate_arc_length(dot_of_endpoints_);
+				}
 			}
 
 
 			//
-			// NOTE: Put all the booleans together so they pack more tightly in memory.
+			// NOTE: Put all the states/booleans together so they pack more tightly in memory.
 			//       Otherwise if they are interspersed with the other 'double'-like quantities
-			//       then each 'bool' will consume 8 bytes.
-			//       Also, due to alignment with 8-byte 'double' quantities, we can have up to 8 booleans
-			//       here (assuming a bool takes up 1 byte) without changing the memory usage. Using fewer
-			//       than 8 booleans (as we do here) just means compiler inserts unused padding into this structure.
+			//       then each one will consume 8 bytes.
+			//       Also, due to alignment with 8-byte 'double' quantities, we can have up to 8 single-byte
+			//       members here without changing the memory usage. Using fewer than 8 (as we do here)
+			//       just means compiler inserts unused padding into this structure.
 			//
 
 			/**
 			 * Whether we've calculated @a d_is_zero_length and @a d_rotation_axis.
 			 */
-			bool d_have_calculated_rotation_info;
+			std::atomic<unsigned char> d_rotation_info_state;
 
 			/**
 			 * Whether we've calculated @a d_arc_length.
 			 */
-			bool d_have_calculated_arc_length;
+			std::atomic<unsigned char> d_arc_length_state;
 
 			/**
 			 * Whether the arc is zero-length and hence has no valid rotation axis.
@@ -367,6 +417,36 @@ namespace GPlatesMaths
 			 * Length of the arc (in radians).
 			 */
 			real_t d_arc_length;
+
+		private:
+
+			/**
+			 * States of each cached quantity.
+			 */
+			enum State
+			{
+				NOT_CALCULATED,
+				CALCULATING,
+				CALCULATED
+			};
+
+			void
+			calculate_rotation_info(
+					const PointOnSphere &start_point,
+					const PointOnSphere &end_point);
+
+			void
+			calculate_arc_length(
+					const real_t &dot_of_endpoints_);
+
+			/**
+			 * Makes @a state ours to calculate (returns true), or waits for another thread to
+			 * finish calculating it (returns false).
+			 */
+			static
+			bool
+			begin_calculation(
+					std::atomic<unsigned char> &state);
 		};
 
 
@@ -39,6 +39,7 @@
 #include "PolygonProximityHitDetail.h"
 #include "PolyGreatCircleArcBoundingTree.h"
 #include "ProximityCriteria.h"
+#include "RotationMatrix.h"
 #include "SmallCircleBounds.h"
 #include "SphericalArea.h"
 
@@ -204,6 +205,25 @@ namespace GPlatesMaths
 				tessellated_ring_points.pop_back();
 			}
 		}
+
+
+		/**
+		 * Extract the ring vertices (arc start points) of @a ring.
+		 */
+		void
+		get_ring_vertices(
+				PolygonOnSphere::ring_vertex_seq_type &ring_vertices,
+				const PolygonOnSphere::ring_type &ring)
+		{
+			ring_vertices.reserve(ring.size());
+
+			PolygonOnSphere::ring_const_iterator ring_iter = ring.begin();
+			PolygonOnSphere::ring_const_iterator ring_end = ring.end();
+			for ( ; ring_iter != ring_end; ++ring_iter)
+			{
+				ring_vertices.push_back(ring_iter->start_point());
+			}
+		}
 	}
 }
 
@@ -220,7 +240,8 @@ GPlatesMaths::PolygonOnSphere::~PolygonOnSphere()
 
 
 GPlatesMaths::PolygonOnSphere::PolygonOnSphere() :
-	GeometryOnSphere()
+	GeometryOnSphere(),
+	d_rings_created(false)
 {
 	// Constructor defined in '.cc' so ~boost::intrusive_ptr<> has access to
 	// PolygonOnSphereImpl::CachedCalculations - because compiler must
@@ -228,6 +249,101 @@ GPlatesMaths::PolygonOnSphere::PolygonOnSphere() :
 }
 
 
+const GPlatesMaths::PolygonOnSphere::non_null_ptr_to_const_type
+GPlatesMaths::PolygonOnSphere::create_rotated_polygon(
+		const RotationMatrix &rotation,
+		const PolygonOnSphere &polygon)
+{
+	non_null_ptr_type rotated_polygon(new PolygonOnSphere());
+
+	const unsigned int num_interior_rings = polygon.d_interior_ring_vertices.size();
+	rotated_polygon->d_interior_ring_vertices.resize(num_interior_rings);
+
+	if (polygon.d_rings_created.load(std::memory_order_acquire))
+	{
+		// The arcs have been created so rotate them (retaining any cached-on-demand quantities),
+		// which also rotates the vertices, and then extract the rotated vertices from them.
+		GreatCircleArc::create_rotated_arcs(rotated_polygon->d_exterior_ring, rotation, polygon.d_exterior_ring);
+		get_ring_vertices(rotated_polygon->d_exterior_ring_vertices, rotated_polygon->d_exterior_ring);
+
+		rotated_polygon->d_interior_rings.resize(num_interior_rings);
+		for (unsigned int interior_ring_index = 0; interior_ring_index < num_interior_rings; ++interior_ring_index)
+		{
+			GreatCircleArc::create_rotated_arcs(
+					rotated_polygon->d_interior_rings[interior_ring_index],
+					rotation,
+					polygon.d_interior_rings[interior_ring_index]);
+			get_ring_vertices(
+					rotated_polygon->d_interior_ring_vertices[interior_ring_index],
+					rotated_polygon->d_interior_rings[interior_ring_index]);
+		}
+
+		rotated_polygon->d_rings_created.store(true, std::memory_order_release);
+	}
+	else
+	{
+		// Only rotate the vertices (the rotated arcs will get created if/when requested).
+		rotation.rotate(rotated_polygon->d_exterior_ring_vertices, polygon.d_exterior_ring_vertices);
+
+		for (unsigned int interior_ring_index = 0; interior_ring_index < num_interior_rings; ++interior_ring_index)
+		{
+			rotation.rotate(
+					rotated_polygon->d_interior_ring_vertices[interior_ring_index],
+					polygon.d_interior_ring_vertices[interior_ring_index]);
+		}
+	}
+
+	return rotated_polygon;
+}
+
+
+void
+GPlatesMaths::PolygonOnSphere::generate_ring(
+		ring_type &ring,
+		const ring_vertex_seq_type &ring_vertices)
+{
+	// Observe that the number of vertices in a ring is also the number of segments in the ring.
+	const unsigned int num_ring_vertices = ring_vertices.size();
+	ring.reserve(num_ring_vertices);
+
+	for (unsigned int n = 0; n < num_ring_vertices - 1; ++n)
+	{
+		ring.push_back(GreatCircleArc::create(ring_vertices[n], ring_vertices[n + 1]));
+	}
+
+	// Now, an additional step, for the last->first point wrap-around.
+	ring.push_back(GreatCircleArc::create(ring_vertices.back(), ring_vertices.front()));
+}
+
+
+void
+GPlatesMaths::PolygonOnSphere::create_rings() const
+{
+	boost::mutex::scoped_lock rings_lock(d_rings_mutex);
+
+	// Another thread might have created them while we were waiting for the lock.
+	if (d_rings_created.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	ring_type exterior;
+	generate_ring(exterior, d_exterior_ring_vertices);
+
+	const unsigned int num_interior_rings = d_interior_ring_vertices.size();
+	ring_sequence_type interiors(num_interior_rings);
+	for (unsigned int interior_ring_index = 0; interior_ring_index < num_interior_rings; ++interior_ring_index)
+	{
+		generate_ring(interiors[interior_ring_index], d_interior_ring_vertices[interior_ring_index]);
+	}
+
+	d_exterior_ring.swap(exterior);
+	d_interior_rings.swap(interiors);
+
+	d_rings_created.store(true, std::memory_order_release);
+}
+
+
 GPlatesMaths::PolygonOnSphere::ConstructionParameterValidity
 GPlatesMaths::PolygonOnSphere::evaluate_segment_endpoint_validity(
 		const PointOnSphere &p1,
@@ -506,9 +622,6 @@ GPlatesMaths::PolygonOnSphere::is_point_in_polygon(
 		d_cached_calculations = new PolygonOnSphereImpl::CachedCalculations();
 	}
 
-	// Keep track of the total number of calls for the adaptive speed mode.
-	++d_cached_calculations->num_point_in_polygon_calls;
-
 	switch (speed_and_memory)
 	{
 	case MEDIUM_SPEED_MEDIUM_SETUP_MEDIUM_MEMORY_USAGE:
@@ -526,6 +639,20 @@ GPlatesMaths::PolygonOnSphere::is_point_in_polygon(
 		break;
 
 	case ADAPTIVE:
+		// Once the highest speed has been set up there's nothing left to adapt, so we don't modify
+		// the cached calculations (and point-in-polygon tests can then be performed concurrently).
+		if (d_cached_calculations->point_in_polygon_speed_and_memory == HIGH_SPEED_HIGH_SETUP_HIGH_MEMORY_USAGE)
+		{
+			break;
+		}
+
+		// Keep track of the total number of calls for the adaptive speed mode.
+		//
+		// Note that only the adaptive mode modifies the cached calculations on every call.
+		// The other modes only modify them when first setting up the requested speed, after which
+		// point-in-polygon tests can be performed concurrently by multiple threads.
+		++d_cached_calculations->num_point_in_polygon_calls;
+
 		// Adapt the speed according to the number of point-in-polygon calls made so far.
 		//
 		// This is based on:
@@ -28,6 +28,7 @@
 #ifndef GPLATES_MATHS_POLYGONONSPHERE_H
 #define GPLATES_MATHS_POLYGONONSPHERE_H
 
+#include <atomic>
 #include <cstddef>  // For std::size_t
 #include <vector>
 #include <algorithm> 
@@ -37,6 +38,7 @@
 #include <boost/intrusive_ptr.hpp>
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/iterator/iterator_facade.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "GeometryOnSphere.h"
 #include "GreatCircleArc.h"
@@ -55,6 +57,7 @@ namespace GPlatesMaths
 	}
 	class BoundingSmallCircle;
 	class InnerOuterBoundingSmallCircle;
+	class RotationMatrix;
 
 	template <typename GreatCircleArcConstIteratorType, bool RequireRandomAccessIterator>
 	class PolyGreatCircleArcBoundingTree;
@@ -63,9 +66,12 @@ namespace GPlatesMaths
 	/** 
 	 * Represents a polygon on the surface of a sphere. 
 	 *
-	 * Internally, this is stored as a sequence of GreatCircleArc for the polygon exterior and optional
-	 * sequences for interior rings (holes). You can iterate over this sequence of GreatCircleArc in the
-	 * usual manner using the const_iterators returned by the functions @a begin and @a end.
+	 * Internally, the vertices are stored once in a contiguous sequence of PointOnSphere for the polygon
+	 * exterior and optional sequences for interior rings (holes). You can iterate over the sequence of
+	 * GreatCircleArc in the usual manner using the const_iterators returned by the functions @a begin and @a end.
+	 * The arcs are derived from the vertices the first time they are accessed (and then retained for the
+	 * lifetime of the polygon), so a polygon that is only ever accessed through its ring vertices
+	 * never pays for its arcs.
 	 *
 	 * You can also iterate over the @em vertices of the polygon using the vertex_const_iterator
 	 * returned by the functions @a vertex_begin and @a vertex_end.
@@ -146,51 +152,25 @@ namespace GPlatesMaths
 
 
 		/**
-		 * This class enables const_iteration over vertices in an exterior or interior ring of PolygonOnSphere.
+		 * The type of the sequence of vertices in a closed ring.
 		 *
-		 * An instance of this class @em actually iterates over the sequence of GreatCircleArc by which
-		 * a PolygonOnSphere is implemented, but it pretends it's iterating over a sequence of PointOnSphere.
+		 * The number of vertices in a ring is the same as its number of arcs.
 		 */
-		class RingVertexConstIterator :
-				public boost::iterator_adaptor<
-						RingVertexConstIterator,
-						ring_const_iterator,
-						const PointOnSphere>
-		{
-		public:
-
-			/**
-			 * Default-construct a vertex iterator (mandated by iterator interface).
-			 */
-			RingVertexConstIterator() :
-				iterator_adaptor_(ring_const_iterator())
-			{  }
-
-			/**
-			 * Construct a vertex iterator from a ring iterator.
-			 */
-			explicit
-			RingVertexConstIterator(
-					const ring_const_iterator &ring_const_iter) :
-				iterator_adaptor_(ring_const_iter)
-			{  }
-
-		private:
-
-			const PointOnSphere &
-			dereference() const
-			{
-				return base_reference()->start_point();
-			}
-
-			// Give access to boost::iterator_adaptor.
-			friend class boost::iterator_core_access;
-		};
+		typedef std::vector<PointOnSphere> ring_vertex_seq_type;
 
 		/**
 		 * The type used to const_iterate over the vertices in a ring.
+		 *
+		 * This iterates directly over the stored ring vertices (it does not require the arcs).
+		 */
+		typedef ring_vertex_seq_type::const_iterator ring_vertex_const_iterator;
+
+		/**
+		 * The type used to const_iterate over the arcs in a ring without creating the cached rings.
+		 *
+		 * See @a PolylineOnSphere::UncachedArcConstIterator (the last arc wraps around to the first vertex).
 		 */
-		typedef RingVertexConstIterator ring_vertex_const_iterator;
+		typedef PolylineOnSphere::UncachedArcConstIterator ring_uncached_const_iterator;
 
 
 		/**
@@ -224,7 +204,7 @@ namespace GPlatesMaths
 			create_begin(
 					const PolygonOnSphere &polygon)
 			{
-				return ConstIterator(polygon, 0/*exterior ring id*/, polygon.d_exterior_ring.begin());
+				return ConstIterator(polygon, 0/*exterior ring id*/, polygon.exterior_ring().begin());
 			}
 
 			/**
@@ -237,12 +217,12 @@ namespace GPlatesMaths
 			{
 				return ConstIterator(
 						polygon,
-						polygon.d_interior_rings.size(), // Id of last ring (either exterior, or interior if any).
+						polygon.number_of_interior_rings(), // Id of last ring (either exterior, or interior if any).
 						// "End" ring is either the exterior ring (if no interior rings), or the last interior ring.
 						// And "end" ring iterator is the end of that ring.
-						(polygon.d_interior_rings.empty()
-								? polygon.d_exterior_ring
-								: polygon.d_interior_rings.back()
+						(polygon.interior_rings().empty()
+								? polygon.exterior_ring()
+								: polygon.interior_rings().back()
 								).end());
 			}
 
@@ -710,6 +690,20 @@ namespace GPlatesMaths
 					check_distinct_points);
 		}
 
+		/**
+		 * Create a new PolygonOnSphere instance on the heap that is @a polygon rotated by @a rotation.
+		 *
+		 * This is a faster alternative to rotating the ring vertices and passing them to @a create.
+		 * Since a rotation preserves the validity of a polygon, the rotated ring segments are not
+		 * re-created from the rotated vertices (see @a GreatCircleArc::create_rotated_arcs),
+		 * and hence no validity checks are performed and no exceptions are thrown.
+		 */
+		static
+		const non_null_ptr_to_const_type
+		create_rotated_polygon(
+				const RotationMatrix &rotation,
+				const PolygonOnSphere &polygon);
+
 
 		virtual
 		~PolygonOnSphere();
@@ -806,14 +800,13 @@ namespace GPlatesMaths
 		number_of_segments() const
 		{
 			// Exterior ring.
-			unsigned int num_segments = d_exterior_ring.size();
+			unsigned int num_segments = d_exterior_ring_vertices.size();
 
 			// Interior rings.
-			ring_sequence_const_iterator ring_seq_iter = d_interior_rings.begin();
-			ring_sequence_const_iterator ring_seq_end = d_interior_rings.end();
-			for ( ; ring_seq_iter != ring_seq_end; ++ring_seq_iter)
+			const unsigned int num_interior_rings = d_interior_ring_vertices.size();
+			for (unsigned int interior_ring_index = 0; interior_ring_index < num_interior_rings; ++interior_ring_index)
 			{
-				num_segments += ring_seq_iter->size();
+				num_segments += d_interior_ring_vertices[interior_ring_index].size();
 			}
 
 			return num_segments;
@@ -914,11 +907,21 @@ namespace GPlatesMaths
 					vertex_index < number_of_vertices(),
 					GPLATES_ASSERTION_SOURCE);
 
-			vertex_const_iterator vertex_iter = vertex_begin();
-			// This should be fast since iterator type is random access...
-			std::advance(vertex_iter, vertex_index);
+			// Look up the vertex directly in the ring vertices (avoids creating the arcs).
+			if (vertex_index < d_exterior_ring_vertices.size())
+			{
+				return d_exterior_ring_vertices[vertex_index];
+			}
+			vertex_index -= d_exterior_ring_vertices.size();
+
+			unsigned int interior_ring_index = 0;
+			while (vertex_index >= d_interior_ring_vertices[interior_ring_index].size())
+			{
+				vertex_index -= d_interior_ring_vertices[interior_ring_index].size();
+				++interior_ring_index;
+			}
 
-			return *vertex_iter;
+			return d_interior_ring_vertices[interior_ring_index][vertex_index];
 		}
 
 
@@ -929,7 +932,7 @@ namespace GPlatesMaths
 		ring_const_iterator
 		exterior_ring_begin() const
 		{
-			return d_exterior_ring.begin();
+			return exterior_ring().begin();
 		}
 
 		/**
@@ -939,7 +942,7 @@ namespace GPlatesMaths
 		ring_const_iterator
 		exterior_ring_end() const
 		{
-			return d_exterior_ring.end();
+			return exterior_ring().end();
 		}
 
 		/**
@@ -962,12 +965,33 @@ namespace GPlatesMaths
 			return exterior_segment_iter;
 		}
 
+		/**
+		 * Return the 'begin' ring_uncached_const_iterator over the sequence of GreatCircleArc
+		 * which defines the exterior of this polygon, without creating (or requiring) the cached rings.
+		 */
+		ring_uncached_const_iterator
+		exterior_ring_uncached_begin() const
+		{
+			return ring_uncached_const_iterator(d_exterior_ring_vertices, 0);
+		}
+
+		/**
+		 * Return the 'end' ring_uncached_const_iterator over the sequence of GreatCircleArc
+		 * which defines the exterior of this polygon, without creating (or requiring) the cached rings.
+		 */
+		ring_uncached_const_iterator
+		exterior_ring_uncached_end() const
+		{
+			return ring_uncached_const_iterator(d_exterior_ring_vertices, d_exterior_ring_vertices.size());
+		}
+
 		/**
 		 * Return the exterior ring of this polygon.
 		 */
 		const ring_type &
 		exterior_ring() const
 		{
+			ensure_rings_created();
 			return d_exterior_ring;
 		}
 
@@ -977,7 +1001,7 @@ namespace GPlatesMaths
 		unsigned int
 		number_of_segments_in_exterior_ring() const
 		{
-			return d_exterior_ring.size();
+			return d_exterior_ring_vertices.size();
 		}
 
 		/**
@@ -991,7 +1015,7 @@ namespace GPlatesMaths
 					exterior_segment_index < number_of_segments_in_exterior_ring(),
 					GPLATES_ASSERTION_SOURCE);
 
-			return d_exterior_ring[exterior_segment_index];
+			return exterior_ring()[exterior_segment_index];
 		}
 
 
@@ -1001,7 +1025,7 @@ namespace GPlatesMaths
 		ring_vertex_const_iterator
 		exterior_ring_vertex_begin() const
 		{
-			return ring_vertex_const_iterator(d_exterior_ring.begin());
+			return d_exterior_ring_vertices.begin();
 		}
 
 		/**
@@ -1010,7 +1034,7 @@ namespace GPlatesMaths
 		ring_vertex_const_iterator
 		exterior_ring_vertex_end() const
 		{
-			return ring_vertex_const_iterator(d_exterior_ring.end());
+			return d_exterior_ring_vertices.end();
 		}
 
 		/**
@@ -1053,11 +1077,7 @@ namespace GPlatesMaths
 					exterior_vertex_index < number_of_vertices_in_exterior_ring(),
 					GPLATES_ASSERTION_SOURCE);
 
-			ring_vertex_const_iterator exterior_vertex_iter = exterior_ring_vertex_begin();
-			// This should be fast since iterator type is random access...
-			std::advance(exterior_vertex_iter, exterior_vertex_index);
-
-			return *exterior_vertex_iter;
+			return d_exterior_ring_vertices[exterior_vertex_index];
 		}
 
 		/**
@@ -1068,8 +1088,7 @@ namespace GPlatesMaths
 		const PointOnSphere &
 		first_exterior_ring_vertex() const
 		{
-			const GreatCircleArc &first_exterior_gca = *(exterior_ring_begin());
-			return first_exterior_gca.start_point();
+			return d_exterior_ring_vertices.front();
 		}
 
 		/**
@@ -1081,8 +1100,7 @@ namespace GPlatesMaths
 		const PointOnSphere &
 		last_exterior_ring_vertex() const
 		{
-			const GreatCircleArc &last_exterior_gca = *(--(exterior_ring_end()));
-			return last_exterior_gca.end_point();
+			return d_exterior_ring_vertices.back();
 		}
 
 
@@ -1096,7 +1114,7 @@ namespace GPlatesMaths
 		polyline_vertex_const_iterator
 		exterior_polyline_vertex_begin() const
 		{
-			return polyline_vertex_const_iterator::create_begin(d_exterior_ring.begin());
+			return polyline_vertex_const_iterator::create_begin(exterior_ring().begin());
 		}
 
 		/**
@@ -1109,7 +1127,8 @@ namespace GPlatesMaths
 		polyline_vertex_const_iterator
 		exterior_polyline_vertex_end() const
 		{
-			return polyline_vertex_const_iterator::create_end(d_exterior_ring.begin(), d_exterior_ring.end());
+			const ring_type &exterior = exterior_ring();
+			return polyline_vertex_const_iterator::create_end(exterior.begin(), exterior.end());
 		}
 
 		/**
@@ -1159,7 +1178,7 @@ namespace GPlatesMaths
 		ring_sequence_const_iterator
 		interior_rings_begin() const
 		{
-			return d_interior_rings.begin();
+			return interior_rings().begin();
 		}
 
 		/**
@@ -1170,7 +1189,7 @@ namespace GPlatesMaths
 		ring_sequence_const_iterator
 		interior_rings_end() const
 		{
-			return d_interior_rings.end();
+			return interior_rings().end();
 		}
 		
 		/**
@@ -1181,6 +1200,7 @@ namespace GPlatesMaths
 		const ring_sequence_type &
 		interior_rings() const
 		{
+			ensure_rings_created();
 			return d_interior_rings;
 		}
 
@@ -1190,7 +1210,7 @@ namespace GPlatesMaths
 		unsigned int
 		number_of_interior_rings() const
 		{
-			return d_interior_rings.size();
+			return d_interior_ring_vertices.size();
 		}
 
 		/**
@@ -1205,7 +1225,7 @@ namespace GPlatesMaths
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
 
-			return d_interior_rings[interior_ring_index].begin();
+			return interior_rings()[interior_ring_index].begin();
 		}
 
 		/**
@@ -1220,7 +1240,7 @@ namespace GPlatesMaths
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
 
-			return d_interior_rings[interior_ring_index].end();
+			return interior_rings()[interior_ring_index].end();
 		}
 
 		/**
@@ -1237,7 +1257,7 @@ namespace GPlatesMaths
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
 
-			const ring_type &interior_ring = d_interior_rings[interior_ring_index];
+			const ring_type &interior_ring = interior_rings()[interior_ring_index];
 
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
 					segment_index <= interior_ring.size(),
@@ -1250,6 +1270,39 @@ namespace GPlatesMaths
 			return interior_segment_iter;
 		}
 
+		/**
+		 * Return the 'begin' ring_uncached_const_iterator over the sequence of GreatCircleArc which
+		 * defines the interior ring of this polygon at the specified interior ring index,
+		 * without creating (or requiring) the cached rings.
+		 */
+		ring_uncached_const_iterator
+		interior_ring_uncached_begin(
+				unsigned int interior_ring_index) const
+		{
+			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+					interior_ring_index < number_of_interior_rings(),
+					GPLATES_ASSERTION_SOURCE);
+
+			return ring_uncached_const_iterator(d_interior_ring_vertices[interior_ring_index], 0);
+		}
+
+		/**
+		 * Return the 'end' ring_uncached_const_iterator over the sequence of GreatCircleArc which
+		 * defines the interior ring of this polygon at the specified interior ring index,
+		 * without creating (or requiring) the cached rings.
+		 */
+		ring_uncached_const_iterator
+		interior_ring_uncached_end(
+				unsigned int interior_ring_index) const
+		{
+			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+					interior_ring_index < number_of_interior_rings(),
+					GPLATES_ASSERTION_SOURCE);
+
+			const ring_vertex_seq_type &interior_ring_vertices = d_interior_ring_vertices[interior_ring_index];
+			return ring_uncached_const_iterator(interior_ring_vertices, interior_ring_vertices.size());
+		}
+
 		/**
 		 * Return the number of segments in the interior ring in this polygon at the specified interior ring index.
 		 */
@@ -1261,7 +1314,7 @@ namespace GPlatesMaths
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
 
-			return d_interior_rings[interior_ring_index].size();
+			return d_interior_ring_vertices[interior_ring_index].size();
 		}
 
 		/**
@@ -1277,7 +1330,7 @@ namespace GPlatesMaths
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
 
-			const ring_type &interior_ring = d_interior_rings[interior_ring_index];
+			const ring_type &interior_ring = interior_rings()[interior_ring_index];
 
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
 					segment_index < interior_ring.size(),
@@ -1298,7 +1351,7 @@ namespace GPlatesMaths
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
-			return ring_vertex_const_iterator(d_interior_rings[interior_ring_index].begin());
+			return d_interior_ring_vertices[interior_ring_index].begin();
 		}
 
 		/**
@@ -1312,7 +1365,7 @@ namespace GPlatesMaths
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
-			return ring_vertex_const_iterator(d_interior_rings[interior_ring_index].end());
+			return d_interior_ring_vertices[interior_ring_index].end();
 		}
 
 		/**
@@ -1329,15 +1382,13 @@ namespace GPlatesMaths
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
 
-			const ring_type &interior_ring = d_interior_rings[interior_ring_index];
+			const ring_vertex_seq_type &interior_ring_vertices = d_interior_ring_vertices[interior_ring_index];
 
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
-					// A ring contains same number of vertices and segments,
-					// so we can compare with number of segments in ring...
-					vertex_index <= interior_ring.size(),
+					vertex_index <= interior_ring_vertices.size(),
 					GPLATES_ASSERTION_SOURCE);
 
-			ring_vertex_const_iterator interior_vertex_iter(interior_ring.begin());
+			ring_vertex_const_iterator interior_vertex_iter = interior_ring_vertices.begin();
 			// This should be fast since iterator type is random access...
 			std::advance(interior_vertex_iter, vertex_index);
 
@@ -1368,19 +1419,13 @@ namespace GPlatesMaths
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
 
-			const ring_type &interior_ring = d_interior_rings[interior_ring_index];
+			const ring_vertex_seq_type &interior_ring_vertices = d_interior_ring_vertices[interior_ring_index];
 
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
-					// A ring contains same number of vertices and segments,
-					// so we can compare with number of segments in ring...
-					vertex_index < interior_ring.size(),
+					vertex_index < interior_ring_vertices.size(),
 					GPLATES_ASSERTION_SOURCE);
 
-			ring_vertex_const_iterator interior_vertex_iter(interior_ring.begin());
-			// This should be fast since iterator type is random access...
-			std::advance(interior_vertex_iter, vertex_index);
-
-			return *interior_vertex_iter;
+			return interior_ring_vertices[vertex_index];
 		}
 
 		/**
@@ -1390,8 +1435,11 @@ namespace GPlatesMaths
 		first_interior_ring_vertex(
 				unsigned int interior_ring_index) const
 		{
-			const GreatCircleArc &first_interior_gca = *(interior_ring_begin(interior_ring_index));
-			return first_interior_gca.start_point();
+			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+					interior_ring_index < number_of_interior_rings(),
+					GPLATES_ASSERTION_SOURCE);
+
+			return d_interior_ring_vertices[interior_ring_index].front();
 		}
 
 		/**
@@ -1404,8 +1452,11 @@ namespace GPlatesMaths
 		last_interior_ring_vertex(
 				unsigned int interior_ring_index) const
 		{
-			const GreatCircleArc &last_interior_gca = *(--(interior_ring_end(interior_ring_index)));
-			return last_interior_gca.end_point();
+			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
+					interior_ring_index < number_of_interior_rings(),
+					GPLATES_ASSERTION_SOURCE);
+
+			return d_interior_ring_vertices[interior_ring_index].back();
 		}
 
 
@@ -1423,7 +1474,7 @@ namespace GPlatesMaths
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
-			return polyline_vertex_const_iterator::create_begin(d_interior_rings[interior_ring_index].begin());
+			return polyline_vertex_const_iterator::create_begin(interior_rings()[interior_ring_index].begin());
 		}
 
 		/**
@@ -1440,9 +1491,8 @@ namespace GPlatesMaths
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
-			return polyline_vertex_const_iterator::create_end(
-					d_interior_rings[interior_ring_index].begin(),
-					d_interior_rings[interior_ring_index].end());
+			const ring_type &interior_ring = interior_rings()[interior_ring_index];
+			return polyline_vertex_const_iterator::create_end(interior_ring.begin(), interior_ring.end());
 		}
 
 		/**
@@ -1464,7 +1514,7 @@ namespace GPlatesMaths
 					interior_ring_index < number_of_interior_rings(),
 					GPLATES_ASSERTION_SOURCE);
 
-			const ring_type &interior_ring = d_interior_rings[interior_ring_index];
+			const ring_type &interior_ring = interior_rings()[interior_ring_index];
 
 			GPlatesGlobal::Assert<GPlatesGlobal::PreconditionViolationError>(
 					// A polyline contains one extra vertex compared to number of ring segments/vertices...
@@ -1472,7 +1522,7 @@ namespace GPlatesMaths
 					GPLATES_ASSERTION_SOURCE);
 
 			polyline_vertex_const_iterator interior_vertex_iter =
-					polyline_vertex_const_iterator::create_begin(d_interior_rings[interior_ring_index].begin());
+					polyline_vertex_const_iterator::create_begin(interior_ring.begin());
 			// This should be fast since iterator type is random access...
 			std::advance(interior_vertex_iter, vertex_index);
 
@@ -1515,14 +1565,14 @@ namespace GPlatesMaths
 
 
 		/**
-		 * Equality operator compares great circle arc subsegments.
+		 * Equality operator compares ring vertices (and hence great circle arc subsegments).
 		 */
 		bool
 		operator==(
 				const PolygonOnSphere &other) const
 		{
-			return d_exterior_ring == other.d_exterior_ring &&
-					d_interior_rings == other.d_interior_rings;
+			return d_exterior_ring_vertices == other.d_exterior_ring_vertices &&
+					d_interior_ring_vertices == other.d_interior_ring_vertices;
 		}
 
 		/**
@@ -1863,17 +1913,49 @@ namespace GPlatesMaths
 
 
 		/**
-		 * Generate a ring from a sequence of points.
+		 * Generate the vertices of a ring from a sequence of points.
 		 */
 		template <typename PointForwardIter>
 		static
 		void
-		generate_ring(
-				ring_type &ring,
+		generate_ring_vertices(
+				ring_vertex_seq_type &ring_vertices,
 	 			PointForwardIter begin,
 				PointForwardIter end);
 
 
+		/**
+		 * Generate the arcs of a ring from the vertices of the ring.
+		 */
+		static
+		void
+		generate_ring(
+				ring_type &ring,
+				const ring_vertex_seq_type &ring_vertices);
+
+
+		/**
+		 * Creates the arcs of the exterior and interior rings, if they haven't already been created.
+		 */
+		void
+		ensure_rings_created() const
+		{
+			// Only the first request (or concurrent first requests) need to create the rings.
+			if (!d_rings_created.load(std::memory_order_acquire))
+			{
+				create_rings();
+			}
+		}
+
+
+		/**
+		 * Creates @a d_exterior_ring and @a d_interior_rings from the ring vertices
+		 * (if another thread has not already done so).
+		 */
+		void
+		create_rings() const;
+
+
 		/**
 		 * This is the minimum number of (distinct) ring points to be passed into the 'create'
 		 * function (for each ring) to enable creation of closed, well-defined polygon rings.
@@ -1882,17 +1964,44 @@ namespace GPlatesMaths
 
 
 		/**
-		 * The exterior ring of this polygon.
+		 * The vertices of the exterior ring of this polygon.
+		 *
+		 * This is the only storage of the exterior vertices until the arcs are requested.
 		 */
-		ring_type d_exterior_ring;
+		ring_vertex_seq_type d_exterior_ring_vertices;
 
 
 		/**
-		 * The interior rings of this polygon (if any).
+		 * The vertices of the interior rings of this polygon (if any).
 		 *
 		 * If any interior rings are present then the polygon is a donut polygon (a polygon with holes).
 		 */
-		ring_sequence_type d_interior_rings;
+		std::vector<ring_vertex_seq_type> d_interior_ring_vertices;
+
+
+		/**
+		 * The exterior ring of this polygon (empty until the arcs are first requested).
+		 *
+		 * Once created it's never modified, so references to its arcs (and iterators)
+		 * remain valid for the lifetime of the polygon.
+		 */
+		mutable ring_type d_exterior_ring;
+
+
+		/**
+		 * The interior rings of this polygon (empty until the arcs are first requested).
+		 */
+		mutable ring_sequence_type d_interior_rings;
+
+		/**
+		 * Whether @a d_exterior_ring and @a d_interior_rings have been fully created (read without locking).
+		 */
+		mutable std::atomic<bool> d_rings_created;
+
+		/**
+		 * Serialises creation of the rings (in case the polygon is shared by multiple threads).
+		 */
+		mutable boost::mutex d_rings_mutex;
 
 		/**
 		 * Useful calculations on the polygon data.
@@ -2183,11 +2292,13 @@ namespace GPlatesMaths
 			throw InvalidPointsForPolygonConstructionError(GPLATES_EXCEPTION_SOURCE, v);
 		}
 
-		// Make it easier to provide strong exception safety by appending the new segments
-		// to a temporary sequence (rather than putting them directly into 'd_exterior_ring').
-		ring_type exterior;
-		generate_ring(exterior, exterior_begin, exterior_end);
-		polygon.d_exterior_ring.swap(exterior);
+		// Make it easier to provide strong exception safety by appending the new vertices
+		// to a temporary sequence (rather than putting them directly into 'd_exterior_ring_vertices').
+		//
+		// Only the vertices are stored - the arcs are created from them when first requested.
+		ring_vertex_seq_type exterior;
+		generate_ring_vertices(exterior, exterior_begin, exterior_end);
+		polygon.d_exterior_ring_vertices.swap(exterior);
 	}
 
 
@@ -2214,10 +2325,10 @@ namespace GPlatesMaths
 		// Make it easier to provide strong exception safety by appending to temporary rings
 		// and then swapping them into 'polygon'.
 
-		ring_type exterior;
-		generate_ring(exterior, exterior_begin, exterior_end);
+		ring_vertex_seq_type exterior;
+		generate_ring_vertices(exterior, exterior_begin, exterior_end);
 
-		ring_sequence_type interiors;
+		std::vector<ring_vertex_seq_type> interiors;
 		interiors.resize(std::distance(interior_rings_begin, interior_rings_end));
 
 		unsigned int interior_index = 0;
@@ -2235,52 +2346,34 @@ namespace GPlatesMaths
 				throw InvalidPointsForPolygonConstructionError(GPLATES_EXCEPTION_SOURCE, interior_validity);
 			}
 
-			generate_ring(
+			generate_ring_vertices(
 					interiors[interior_index],
 					interior_rings_iter->begin(),
 					interior_rings_iter->end());
 		}
 
-		polygon.d_exterior_ring.swap(exterior);
-		polygon.d_interior_rings.swap(interiors);
+		polygon.d_exterior_ring_vertices.swap(exterior);
+		polygon.d_interior_ring_vertices.swap(interiors);
 	}
 
 
 	template <typename PointForwardIter>
 	void
-	PolygonOnSphere::generate_ring(
-			ring_type &ring,
+	PolygonOnSphere::generate_ring_vertices(
+			ring_vertex_seq_type &ring_vertices,
 	 		PointForwardIter begin,
 			PointForwardIter end)
 	{
-		const unsigned int num_ring_points = std::distance(begin, end);
-
-		// Observe that the number of points used to define a ring (which will become
-		// the number of vertices in the ring) is also the number of segments in the ring.
-		ring.reserve(num_ring_points);
-
-		// This for-loop is identical to the corresponding code in PolylineOnSphere.
-		PointForwardIter prev;
-		PointForwardIter iter = begin;
-		for (prev = iter++ ; iter != end; prev = iter++)
-		{
-			const PointOnSphere &p1 = *prev;
-			const PointOnSphere &p2 = *iter;
-			ring.push_back(GreatCircleArc::create(p1, p2));
-		}
+		// Observe that the number of points used to define a ring is the number of vertices
+		// in the ring (and also the number of segments in the ring).
+		ring_vertices.assign(begin, end);
 
-		// Now, an additional step, for the last->first point wrap-around.
-		iter = begin;
+		// Only keep last ring vertex if it's not the same as the first
+		// (provided the ring will have at least 3 vertices).
+		if (ring_vertices.size() != s_min_num_ring_points &&
+			ring_vertices.back() == ring_vertices.front())
 		{
-			const PointOnSphere &p1 = *prev;
-			const PointOnSphere &p2 = *iter;
-			// Only add last ring vertex if it's not the same as the first
-			// (provided the ring will have at least 3 vertices).
-			if (num_ring_points == s_min_num_ring_points ||
-				p1 != p2)
-			{
-				ring.push_back(GreatCircleArc::create(p1, p2));
-			}
+			ring_vertices.pop_back();
 		}
 	}
 }
@@ -39,6 +39,7 @@
 #include "PolylineProximityHitDetail.h"
 #include "PolyGreatCircleArcBoundingTree.h"
 #include "ProximityCriteria.h"
+#include "RotationMatrix.h"
 #include "SmallCircleBounds.h"
 
 #include "global/InvalidParametersException.h"
@@ -77,7 +78,8 @@ GPlatesMaths::PolylineOnSphere::~PolylineOnSphere()
 
 
 GPlatesMaths::PolylineOnSphere::PolylineOnSphere() :
-	GeometryOnSphere()
+	GeometryOnSphere(),
+	d_seq_created(false)
 {
 	// Constructor defined in '.cc' so ~boost::intrusive_ptr<> has access to
 	// PolylineOnSphereImpl::CachedCalculations - because compiler must
@@ -85,6 +87,67 @@ GPlatesMaths::PolylineOnSphere::PolylineOnSphere() :
 }
 
 
+const GPlatesMaths::PolylineOnSphere::non_null_ptr_to_const_type
+GPlatesMaths::PolylineOnSphere::create_rotated_polyline(
+		const RotationMatrix &rotation,
+		const PolylineOnSphere &polyline)
+{
+	non_null_ptr_type rotated_polyline(new PolylineOnSphere());
+
+	if (polyline.d_seq_created.load(std::memory_order_acquire))
+	{
+		// The segments have been created so rotate them (retaining any cached-on-demand quantities),
+		// which also rotates the vertices, and then extract the rotated vertices from them.
+		GreatCircleArc::create_rotated_arcs(rotated_polyline->d_seq, rotation, polyline.d_seq);
+
+		const seq_type &rotated_seq = rotated_polyline->d_seq;
+		rotated_polyline->d_vertices.reserve(rotated_seq.size() + 1);
+		for (const_iterator rotated_gca_iter = rotated_seq.begin(); rotated_gca_iter != rotated_seq.end(); ++rotated_gca_iter)
+		{
+			rotated_polyline->d_vertices.push_back(rotated_gca_iter->start_point());
+		}
+		rotated_polyline->d_vertices.push_back(rotated_seq.back().end_point());
+
+		rotated_polyline->d_seq_created.store(true, std::memory_order_release);
+	}
+	else
+	{
+		// Only rotate the vertices (the rotated segments will get created if/when requested).
+		rotation.rotate(rotated_polyline->d_vertices, polyline.d_vertices);
+	}
+
+	return rotated_polyline;
+}
+
+
+void
+GPlatesMaths::PolylineOnSphere::create_segments() const
+{
+	boost::mutex::scoped_lock seq_lock(d_seq_mutex);
+
+	// Another thread might have created them while we were waiting for the lock.
+	if (d_seq_created.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	// Observe that the number of vertices is one greater than the number of segments.
+	seq_type seq;
+	seq.reserve(d_vertices.size() - 1);
+
+	vertex_const_iterator prev_vertex_iter = d_vertices.begin();
+	vertex_const_iterator vertex_iter = prev_vertex_iter;
+	for (++vertex_iter; vertex_iter != d_vertices.end(); prev_vertex_iter = vertex_iter++)
+	{
+		seq.push_back(GreatCircleArc::create(*prev_vertex_iter, *vertex_iter));
+	}
+
+	d_seq.swap(seq);
+
+	d_seq_created.store(true, std::memory_order_release);
+}
+
+
 GPlatesMaths::PolylineOnSphere::ConstructionParameterValidity
 GPlatesMaths::PolylineOnSphere::evaluate_segment_endpoint_validity(
 		const PointOnSphere &p1,
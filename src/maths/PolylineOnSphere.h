@@ -32,11 +32,13 @@
 #define GPLATES_MATHS_POLYLINEONSPHERE_H
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>  // std::iterator, std::bidirectional_iterator_tag, std::distance
 #include <utility>  // std::pair
 #include <vector>
 #include <boost/intrusive_ptr.hpp>
 #include <boost/iterator/iterator_facade.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "AngularExtent.h"
 #include "GeometryOnSphere.h"
@@ -54,6 +56,7 @@ namespace GPlatesMaths
 		struct CachedCalculations;
 	}
 	class BoundingSmallCircle;
+	class RotationMatrix;
 
 	template <typename GreatCircleArcConstIteratorType, bool RequireRandomAccessIterator>
 	class PolyGreatCircleArcBoundingTree;
@@ -62,10 +65,12 @@ namespace GPlatesMaths
 	/** 
 	 * Represents a polyline on the surface of a sphere. 
 	 *
-	 * Internally, this is stored as a sequence of GreatCircleArc.  You
-	 * can iterate over this sequence of GreatCircleArc in the usual manner
+	 * Internally, the vertices are stored once in a contiguous sequence of PointOnSphere.
+	 * You can iterate over the sequence of GreatCircleArc in the usual manner
 	 * using the const_iterators returned by the functions @a begin and
-	 * @a end.
+	 * @a end.  The arcs are derived from the vertices the first time they are
+	 * accessed (and then retained for the lifetime of the polyline), so a polyline
+	 * that is only ever accessed through its vertices never pays for its arcs.
 	 *
 	 * You can also iterate over the @em vertices of the polyline using the
 	 * vertex_const_iterators returned by the functions @a vertex_begin and
@@ -417,10 +422,166 @@ namespace GPlatesMaths
 		};
 
 
+		/**
+		 * The type of the sequence of vertices.
+		 */
+		typedef std::vector<PointOnSphere> vertex_seq_type;
+
+
 		/**
 		 * The type used to const_iterate over the vertices.
+		 *
+		 * This iterates directly over the stored vertices (it does not require the arcs).
 		 */
-		typedef VertexConstIterator<const_iterator> vertex_const_iterator;
+		typedef vertex_seq_type::const_iterator vertex_const_iterator;
+
+
+		/**
+		 * This class enables const_iteration over the GreatCircleArc segments between adjacent
+		 * vertices in a sequence of vertices, without creating the cached sequence of arcs.
+		 *
+		 * Each GreatCircleArc is created from its start and end vertices when the iterator is
+		 * dereferenced (and returned by value), so the rotation axis of an arc is recalculated
+		 * each time it's read. This suits a single pass over the arcs of a geometry whose
+		 * cached arcs are not otherwise needed (and hence never pays for their storage).
+		 * Use @a const_iterator when iterating over the arcs repeatedly.
+		 *
+		 * The end vertex of the last arc in the vertex sequence wraps around to the first vertex.
+		 * So iterating over all vertices of a sequence gives the closing segment of a polygon ring,
+		 * whereas a polyline's "end" iterator is one vertex before the end of its vertex sequence.
+		 *
+		 * Since the arcs are created from vertices that have already passed construction validity
+		 * checks (in the polyline or polygon 'create' functions) the arcs are not checked again.
+		 */
+		class UncachedArcConstIterator :
+				public boost::iterator_facade<
+						UncachedArcConstIterator,
+						const GreatCircleArc,
+						// Keep the iterator as "random access" so that std::advance can do fast indexing...
+						std::random_access_iterator_tag,
+						// Arcs are created on dereference so they are returned by value...
+						const GreatCircleArc>
+		{
+		public:
+
+			/**
+			 * Default-construct an arc iterator (mandated by the iterator interface).
+			 *
+			 * A default-constructed iterator will be uninitialised and should not be dereferenced.
+			 */
+			UncachedArcConstIterator() :
+				d_vertices(NULL),
+				d_arc_index(0)
+			{  }
+
+			/**
+			 * Construct an iterator referencing the arc starting at vertex @a arc_index of @a vertices.
+			 */
+			UncachedArcConstIterator(
+					const vertex_seq_type &vertices,
+					unsigned int arc_index) :
+				d_vertices(&vertices),
+				d_arc_index(arc_index)
+			{  }
+
+			/**
+			 * Return the start vertex of the currently-pointed-at arc.
+			 *
+			 * Unlike the arc itself, this references the stored vertex.
+			 */
+			const PointOnSphere &
+			start_vertex() const
+			{
+				return (*d_vertices)[d_arc_index];
+			}
+
+		private:
+
+			/**
+			 * Iterator dereference - for boost::iterator_facade.
+			 */
+			const GreatCircleArc
+			dereference() const
+			{
+				const unsigned int end_vertex_index = d_arc_index + 1;
+
+				return GreatCircleArc::create(
+						(*d_vertices)[d_arc_index],
+						(*d_vertices)[(end_vertex_index < d_vertices->size()) ? end_vertex_index : 0],
+						false/*check_validity*/);
+			}
+
+			/**
+			 * Iterator increment - for boost::iterator_facade.
+			 */
+			void
+			increment()
+			{
+				++d_arc_index;
+			}
+
+			/**
+			 * Iterator decrement - for boost::iterator_facade.
+			 */
+			void
+			decrement()
+			{
+				--d_arc_index;
+			}
+
+			/**
+			 * Iterator equality comparison - for boost::iterator_facade.
+			 */
+			bool
+			equal(
+					const UncachedArcConstIterator &other) const
+			{
+				return d_vertices == other.d_vertices &&
+						d_arc_index == other.d_arc_index;
+			}
+
+			/**
+			 * Iterator advancement - for boost::iterator_facade.
+			 */
+			void
+			advance(
+					difference_type n)
+			{
+				d_arc_index += n;
+			}
+
+			/**
+			 * Distance between two iterators - for boost::iterator_facade.
+			 */
+			difference_type
+			distance_to(
+					const UncachedArcConstIterator &other) const
+			{
+				return static_cast<difference_type>(other.d_arc_index) -
+						static_cast<difference_type>(d_arc_index);
+			}
+
+
+			// Give access to boost::iterator_facade.
+			friend class boost::iterator_core_access;
+
+
+			/**
+			 * The sequence of vertices that the arcs are created from.
+			 */
+			const vertex_seq_type *d_vertices;
+
+			/**
+			 * Index of the start vertex of the current arc.
+			 */
+			unsigned int d_arc_index;
+		};
+
+
+		/**
+		 * The type used to const_iterate over the arcs without creating the cached sequence of arcs.
+		 */
+		typedef UncachedArcConstIterator uncached_const_iterator;
 
 
 		/**
@@ -539,6 +700,20 @@ namespace GPlatesMaths
 			return create(coll.begin(), coll.end(), check_distinct_points);
 		}
 
+		/**
+		 * Create a new PolylineOnSphere instance on the heap that is @a polyline rotated by @a rotation.
+		 *
+		 * This is a faster alternative to rotating the vertices and passing them to @a create.
+		 * Since a rotation preserves the validity of a polyline, the rotated segments are not
+		 * re-created from the rotated vertices (see @a GreatCircleArc::create_rotated_arcs),
+		 * and hence no validity checks are performed and no exceptions are thrown.
+		 */
+		static
+		const non_null_ptr_to_const_type
+		create_rotated_polyline(
+				const RotationMatrix &rotation,
+				const PolylineOnSphere &polyline);
+
 
 		virtual
 		~PolylineOnSphere();
@@ -584,7 +759,7 @@ namespace GPlatesMaths
 		const_iterator
 		begin() const
 		{
-			return d_seq.begin();
+			return get_segments().begin();
 		}
 
 
@@ -595,7 +770,31 @@ namespace GPlatesMaths
 		const_iterator
 		end() const
 		{
-			return d_seq.end();
+			return get_segments().end();
+		}
+
+
+		/**
+		 * Return the "begin" uncached_const_iterator to iterate over the sequence of GreatCircleArc
+		 * which defines this polyline, without creating (or requiring) the cached arcs.
+		 *
+		 * See @a UncachedArcConstIterator for when to use this instead of @a begin.
+		 */
+		uncached_const_iterator
+		uncached_begin() const
+		{
+			return uncached_const_iterator(d_vertices, 0);
+		}
+
+
+		/**
+		 * Return the "end" uncached_const_iterator to iterate over the sequence of GreatCircleArc
+		 * which defines this polyline, without creating (or requiring) the cached arcs.
+		 */
+		uncached_const_iterator
+		uncached_end() const
+		{
+			return uncached_const_iterator(d_vertices, number_of_segments());
 		}
 
 
@@ -627,7 +826,7 @@ namespace GPlatesMaths
 		unsigned int
 		number_of_segments() const
 		{
-			return d_seq.size();
+			return d_vertices.size() - 1;
 		}
 
 
@@ -642,7 +841,7 @@ namespace GPlatesMaths
 					segment_index < number_of_segments(),
 					GPLATES_ASSERTION_SOURCE);
 
-			return d_seq[segment_index];
+			return get_segments()[segment_index];
 		}
 
 
@@ -656,7 +855,7 @@ namespace GPlatesMaths
 		vertex_const_iterator
 		vertex_begin() const
 		{
-			return vertex_const_iterator::create_begin(begin());
+			return d_vertices.begin();
 		}
 
 
@@ -670,7 +869,7 @@ namespace GPlatesMaths
 		vertex_const_iterator
 		vertex_end() const
 		{
-			return vertex_const_iterator::create_end(begin(), end());
+			return d_vertices.end();
 		}
 
 
@@ -701,7 +900,7 @@ namespace GPlatesMaths
 		unsigned int
 		number_of_vertices() const
 		{
-			return d_seq.size() + 1;
+			return d_vertices.size();
 		}
 
 
@@ -716,11 +915,7 @@ namespace GPlatesMaths
 					vertex_index < number_of_vertices(),
 					GPLATES_ASSERTION_SOURCE);
 
-			vertex_const_iterator vertex_iter = vertex_begin();
-			// This should be fast since iterator type is random access...
-			std::advance(vertex_iter, vertex_index);
-
-			return *vertex_iter;
+			return d_vertices[vertex_index];
 		}
 
 
@@ -730,8 +925,7 @@ namespace GPlatesMaths
 		const PointOnSphere &
 		start_point() const
 		{
-			const GreatCircleArc &first_gca = *(begin());
-			return first_gca.start_point();
+			return d_vertices.front();
 		}
 
 
@@ -741,8 +935,7 @@ namespace GPlatesMaths
 		const PointOnSphere &
 		end_point() const
 		{
-			const GreatCircleArc &last_gca = *(--(end()));
-			return last_gca.end_point();
+			return d_vertices.back();
 		}
 
 
@@ -763,13 +956,13 @@ namespace GPlatesMaths
 
 
 		/**
-		 * Equality operator compares great circle arc subsegments.
+		 * Equality operator compares vertices (and hence great circle arc subsegments).
 		 */
 		bool
 		operator==(
 				const PolylineOnSphere &other) const
 		{
-			return d_seq == other.d_seq;
+			return d_vertices == other.d_vertices;
 		}
 
 		/**
@@ -875,6 +1068,30 @@ namespace GPlatesMaths
 				bool check_distinct_points);
 
 
+		/**
+		 * Returns the sequence of polyline segments, creating them from the vertices if this
+		 * is the first time they've been requested.
+		 */
+		const seq_type &
+		get_segments() const
+		{
+			// Only the first request (or concurrent first requests) need to create the segments.
+			if (!d_seq_created.load(std::memory_order_acquire))
+			{
+				create_segments();
+			}
+
+			return d_seq;
+		}
+
+
+		/**
+		 * Creates @a d_seq from @a d_vertices (if another thread has not already done so).
+		 */
+		void
+		create_segments() const;
+
+
 		/**
 		 * This is the minimum number of (distinct) collection points to be passed into the
 		 * 'create' function to enable creation of a closed, well-defined polyline.
@@ -883,9 +1100,29 @@ namespace GPlatesMaths
 
 
 		/**
-		 * This is the sequence of polyline segments.
+		 * This is the sequence of polyline vertices.
+		 *
+		 * This is the only storage of the vertices until the segments are requested.
+		 */
+		vertex_seq_type d_vertices;
+
+		/**
+		 * This is the sequence of polyline segments (empty until first requested).
+		 *
+		 * Once created it's never modified, so references to its arcs (and iterators)
+		 * remain valid for the lifetime of the polyline.
 		 */
-		seq_type d_seq;
+		mutable seq_type d_seq;
+
+		/**
+		 * Whether @a d_seq has been fully created (read without locking).
+		 */
+		mutable std::atomic<bool> d_seq_created;
+
+		/**
+		 * Serialises creation of @a d_seq (in case the polyline is shared by multiple threads).
+		 */
+		mutable boost::mutex d_seq_mutex;
 
 		/**
 		 * Useful calculations on the polyline data.
@@ -1091,25 +1328,12 @@ namespace GPlatesMaths
 			throw InvalidPointsForPolylineConstructionError(GPLATES_EXCEPTION_SOURCE, v);
 		}
 
-		// Make it easier to provide strong exception safety by appending the new segments
-		// to a temporary sequence (rather than putting them directly into 'd_seq').
-		seq_type tmp_seq;
-		// Observe that the number of points used to define a polyline (which will become
-		// the number of vertices in the polyline, counting the begin-point and end-point
-		// of the polyline as vertices) is one greater than the number of segments in the
-		// polyline.
-		const seq_type::size_type num_points = std::distance(begin, end);
-		tmp_seq.reserve(num_points - 1);
-
-		PointForwardIter prev;
-		PointForwardIter iter = begin;
-		for (prev = iter++ ; iter != end; prev = iter++)
-		{
-			const PointOnSphere &p1 = *prev;
-			const PointOnSphere &p2 = *iter;
-			tmp_seq.push_back(GreatCircleArc::create(p1, p2));
-		}
-		poly.d_seq.swap(tmp_seq);
+		// Make it easier to provide strong exception safety by appending the new vertices
+		// to a temporary sequence (rather than putting them directly into 'd_vertices').
+		//
+		// Only the vertices are stored - the segments are created from them when first requested.
+		vertex_seq_type tmp_vertices(begin, end);
+		poly.d_vertices.swap(tmp_vertices);
 	}
 
 
@@ -0,0 +1,261 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "RotationMatrix.h"
+
+#include "FiniteRotation.h"
+#include "MathsUtils.h"
+#include "PointOnSphere.h"
+#include "UnitQuaternion3D.h"
+
+
+namespace GPlatesMaths
+{
+	namespace
+	{
+		/**
+		 * The number of vectors rotated per block by @a RotationMatrix::rotate.
+		 *
+		 * The component arrays of a block fit comfortably in the L1 cache (and on the stack).
+		 */
+		const unsigned int NUM_VECTORS_PER_ROTATE_BLOCK = 256;
+
+
+		/**
+		 * Create a unit vector from a rotated unit vector (renormalising it if necessary).
+		 *
+		 * This mirrors the renormalisation done when rotating a unit vector with a @a FiniteRotation.
+		 */
+		const UnitVector3D
+		create_rotated_unit_vector(
+				double x,
+				double y,
+				double z)
+		{
+			const double mag_sqrd = x * x + y * y + z * z;
+			if (!are_slightly_more_strictly_equal(mag_sqrd, 1.0))
+			{
+				const double inv_mag = 1.0 / std::sqrt(mag_sqrd);
+				x *= inv_mag;
+				y *= inv_mag;
+				z *= inv_mag;
+			}
+
+			// NOTE: We don't check validity because we've already ensured unit magnitude above.
+			return UnitVector3D(x, y, z, false/*check_validity*/);
+		}
+
+
+		const UnitVector3D &
+		get_unit_vector(
+				const UnitVector3D &unit_vector)
+		{
+			return unit_vector;
+		}
+
+		const UnitVector3D &
+		get_unit_vector(
+				const PointOnSphere &point)
+		{
+			return point.position_vector();
+		}
+
+
+		/**
+		 * Rotates @a num_elements unit vectors (or points) starting at @a input_iter, in blocks using
+		 * the batch kernel, and writes them to @a output_iter.
+		 *
+		 * Since each block is read before it is written, @a output_iter can be the same as
+		 * @a input_iter (to rotate in place).
+		 */
+		template <typename InputIterator, typename OutputIterator>
+		void
+		rotate_in_blocks(
+				const RotationMatrix &rotation_matrix,
+				InputIterator input_iter,
+				OutputIterator output_iter,
+				unsigned int num_elements)
+		{
+			typedef typename std::iterator_traits<InputIterator>::value_type element_type;
+
+			double x[NUM_VECTORS_PER_ROTATE_BLOCK];
+			double y[NUM_VECTORS_PER_ROTATE_BLOCK];
+			double z[NUM_VECTORS_PER_ROTATE_BLOCK];
+			double rotated_x[NUM_VECTORS_PER_ROTATE_BLOCK];
+			double rotated_y[NUM_VECTORS_PER_ROTATE_BLOCK];
+			double rotated_z[NUM_VECTORS_PER_ROTATE_BLOCK];
+
+			for (unsigned int block_begin = 0;
+				block_begin < num_elements;
+				block_begin += NUM_VECTORS_PER_ROTATE_BLOCK)
+			{
+				const unsigned int num_vectors_in_block =
+						(std::min)(NUM_VECTORS_PER_ROTATE_BLOCK, num_elements - block_begin);
+
+				// Separate the components so the batch kernel can vectorise.
+				for (unsigned int n = 0; n < num_vectors_in_block; ++n, ++input_iter)
+				{
+					const UnitVector3D &unit_vector = get_unit_vector(*input_iter);
+					x[n] = unit_vector.x().dval();
+					y[n] = unit_vector.y().dval();
+					z[n] = unit_vector.z().dval();
+				}
+
+				rotation_matrix.rotate(x, y, z, rotated_x, rotated_y, rotated_z, num_vectors_in_block);
+
+				for (unsigned int n = 0; n < num_vectors_in_block; ++n, ++output_iter)
+				{
+					*output_iter = element_type(
+							create_rotated_unit_vector(rotated_x[n], rotated_y[n], rotated_z[n]));
+				}
+			}
+		}
+	}
+}
+
+
+GPlatesMaths::RotationMatrix::RotationMatrix(
+		const UnitQuaternion3D &unit_quat)
+{
+	const double w = unit_quat.scalar_part().dval();
+	const double x = unit_quat.vector_part().x().dval();
+	const double y = unit_quat.vector_part().y().dval();
+	const double z = unit_quat.vector_part().z().dval();
+
+	//
+	// The rotation of a vector by a unit quaternion (see 'FiniteRotation::operator*') expressed as a
+	// matrix (using the unit norm of the quaternion to simplify the diagonal).
+	//
+
+	d_m[0][0] = 1.0 - 2.0 * (y * y + z * z);
+	d_m[0][1] = 2.0 * (x * y - w * z);
+	d_m[0][2] = 2.0 * (x * z + w * y);
+
+	d_m[1][0] = 2.0 * (x * y + w * z);
+	d_m[1][1] = 1.0 - 2.0 * (x * x + z * z);
+	d_m[1][2] = 2.0 * (y * z - w * x);
+
+	d_m[2][0] = 2.0 * (x * z - w * y);
+	d_m[2][1] = 2.0 * (y * z + w * x);
+	d_m[2][2] = 1.0 - 2.0 * (x * x + y * y);
+}
+
+
+GPlatesMaths::RotationMatrix::RotationMatrix(
+		const FiniteRotation &finite_rotation)
+{
+	*this = RotationMatrix(finite_rotation.unit_quat());
+}
+
+
+const GPlatesMaths::UnitVector3D
+GPlatesMaths::RotationMatrix::operator*(
+		const UnitVector3D &unit_vect) const
+{
+	const double x = unit_vect.x().dval();
+	const double y = unit_vect.y().dval();
+	const double z = unit_vect.z().dval();
+
+	return create_rotated_unit_vector(
+			d_m[0][0] * x + d_m[0][1] * y + d_m[0][2] * z,
+			d_m[1][0] * x + d_m[1][1] * y + d_m[1][2] * z,
+			d_m[2][0] * x + d_m[2][1] * y + d_m[2][2] * z);
+}
+
+
+void
+GPlatesMaths::RotationMatrix::rotate(
+		std::vector<UnitVector3D> &rotated_unit_vectors,
+		const std::vector<UnitVector3D> &unit_vectors) const
+{
+	const unsigned int num_unit_vectors = unit_vectors.size();
+
+	rotated_unit_vectors.reserve(rotated_unit_vectors.size() + num_unit_vectors);
+
+	rotate_in_blocks(
+			*this,
+			unit_vectors.begin(),
+			std::back_inserter(rotated_unit_vectors),
+			num_unit_vectors);
+}
+
+
+void
+GPlatesMaths::RotationMatrix::rotate(
+		std::vector<PointOnSphere> &rotated_points,
+		const std::vector<PointOnSphere> &points) const
+{
+	const unsigned int num_points = points.size();
+
+	rotated_points.reserve(rotated_points.size() + num_points);
+
+	rotate_in_blocks(
+			*this,
+			points.begin(),
+			std::back_inserter(rotated_points),
+			num_points);
+}
+
+
+void
+GPlatesMaths::RotationMatrix::rotate(
+		std::vector<PointOnSphere>::iterator points_begin,
+		std::vector<PointOnSphere>::iterator points_end) const
+{
+	rotate_in_blocks(
+			*this,
+			points_begin,
+			points_begin/*rotate in place*/,
+			points_end - points_begin);
+}
+
+
+void
+GPlatesMaths::RotationMatrix::rotate(
+		const double *x,
+		const double *y,
+		const double *z,
+		double *rotated_x,
+		double *rotated_y,
+		double *rotated_z,
+		unsigned int num_vectors) const
+{
+	// Copy the matrix elements into locals so the compiler knows they're not modified by
+	// the stores to the rotated arrays (and can keep them in registers).
+	const double m00 = d_m[0][0], m01 = d_m[0][1], m02 = d_m[0][2];
+	const double m10 = d_m[1][0], m11 = d_m[1][1], m12 = d_m[1][2];
+	const double m20 = d_m[2][0], m21 = d_m[2][1], m22 = d_m[2][2];
+
+	for (unsigned int n = 0; n < num_vectors; ++n)
+	{
+		rotated_x[n] = m00 * x[n] + m01 * y[n] + m02 * z[n];
+		rotated_y[n] = m10 * x[n] + m11 * y[n] + m12 * z[n];
+		rotated_z[n] = m20 * x[n] + m21 * y[n] + m22 * z[n];
+	}
+}
@@ -0,0 +1,157 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_MATHS_ROTATIONMATRIX_H
+#define GPLATES_MATHS_ROTATIONMATRIX_H
+
+#include <vector>
+
+#include "UnitVector3D.h"
+#include "Vector3D.h"
+
+
+namespace GPlatesMaths
+{
+	// Forward declarations.
+	class FiniteRotation;
+	class PointOnSphere;
+	class UnitQuaternion3D;
+
+
+	/**
+	 * A 3x3 rotation matrix.
+	 *
+	 * Rotating a vector by a matrix takes fewer operations than rotating it by a unit quaternion
+	 * (as done by @a FiniteRotation), but converting the quaternion to a matrix has a cost.
+	 * So a matrix is used when rotating many vectors by the same rotation, such as the vertices
+	 * of a polyline or polygon.
+	 */
+	class RotationMatrix
+	{
+	public:
+
+		/**
+		 * Create the rotation matrix equivalent to the unit quaternion @a unit_quat.
+		 */
+		explicit
+		RotationMatrix(
+				const UnitQuaternion3D &unit_quat);
+
+		/**
+		 * Create the rotation matrix equivalent to the finite rotation @a finite_rotation.
+		 */
+		explicit
+		RotationMatrix(
+				const FiniteRotation &finite_rotation);
+
+
+		/**
+		 * Rotates the vector @a vect.
+		 */
+		const Vector3D
+		operator*(
+				const Vector3D &vect) const
+		{
+			const double x = vect.x().dval();
+			const double y = vect.y().dval();
+			const double z = vect.z().dval();
+
+			return Vector3D(
+					d_m[0][0] * x + d_m[0][1] * y + d_m[0][2] * z,
+					d_m[1][0] * x + d_m[1][1] * y + d_m[1][2] * z,
+					d_m[2][0] * x + d_m[2][1] * y + d_m[2][2] * z);
+		}
+
+		/**
+		 * Rotates the unit vector @a unit_vect.
+		 *
+		 * The rotated vector is renormalised (if necessary) to counter numerical drift.
+		 */
+		const UnitVector3D
+		operator*(
+				const UnitVector3D &unit_vect) const;
+
+
+		/**
+		 * Rotates the unit vectors @a unit_vectors and appends them to @a rotated_unit_vectors.
+		 *
+		 * This gives the same results as rotating each unit vector with the above operator, but it
+		 * rotates the unit vectors in blocks using the batch kernel below.
+		 */
+		void
+		rotate(
+				std::vector<UnitVector3D> &rotated_unit_vectors,
+				const std::vector<UnitVector3D> &unit_vectors) const;
+
+		/**
+		 * Rotates the points @a points and appends them to @a rotated_points.
+		 *
+		 * Like the above overload this uses the batch kernel below.
+		 */
+		void
+		rotate(
+				std::vector<PointOnSphere> &rotated_points,
+				const std::vector<PointOnSphere> &points) const;
+
+		/**
+		 * Rotates, in place, the points in the range [@a points_begin, @a points_end).
+		 *
+		 * Like the above overload this uses the batch kernel below.
+		 */
+		void
+		rotate(
+				std::vector<PointOnSphere>::iterator points_begin,
+				std::vector<PointOnSphere>::iterator points_end) const;
+
+
+		/**
+		 * The batch kernel that rotates @a num_vectors vectors stored as separate contiguous
+		 * x, y and z component arrays, and writes the rotated components to @a rotated_x,
+		 * @a rotated_y and @a rotated_z.
+		 *
+		 * The loop has unit-stride access and no dependencies between vectors, so the compiler
+		 * can vectorise it using whichever SIMD instructions the build targets.
+		 *
+		 * The rotated arrays must not overlap the input arrays.
+		 * The rotated vectors are *not* renormalised.
+		 */
+		void
+		rotate(
+				const double *x,
+				const double *y,
+				const double *z,
+				double *rotated_x,
+				double *rotated_y,
+				double *rotated_z,
+				unsigned int num_vectors) const;
+
+	private:
+
+		//! Row-major matrix elements.
+		double d_m[3][3];
+	};
+}
+
+#endif // GPLATES_MATHS_ROTATIONMATRIX_H
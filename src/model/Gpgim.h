@@ -29,11 +29,9 @@
 #include <map>
 #include <vector>
 #include <boost/optional.hpp>
-#include <boost/shared_ptr.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_comparison.hpp>
 #include <QString>
-#include <QXmlStreamReader>
 
 #include "FeatureType.h"
 #include "GpgimEnumerationType.h"
@@ -43,7 +41,6 @@
 #include "GpgimTemplateStructuralType.h"
 #include "GpgimVersion.h"
 #include "PropertyName.h"
-#include "XmlNode.h"
 
 #include "property-values/StructuralType.h"
 
@@ -60,15 +57,11 @@ namespace GPlatesModel
 	 *
 	 * This is a singleton that can be accessed via 'Gpgim::instance()':
 	 *
-	 *   Currently this loads the 'core' GPGIM resource XML file.
+	 *   Currently this creates the 'core' GPGIM from the tables in @a GpgimTables, which are
+	 *   generated at build time from the core GPGIM XML file (so no XML is parsed at startup).
 	 *   In the future there will be the option to also load one or more 'extension' GPGIM
 	 *   resource files that are created by the external community and that model data outside
 	 *   the core Geological information model.
-	 *
-	 *   Throws @a ErrorOpeningFileForReadingException upon failure to open XML file for reading.
-	 *
-	 *   Throws @a GpgimInitialisationException upon failure to properly initialise the GPGIM
-	 *   when reading/parsing the XML file.
 	 */
 	class Gpgim :
 			public GPlatesUtils::Singleton<Gpgim>
@@ -301,17 +294,6 @@ namespace GPlatesModel
 
 	private:
 
-		/**
-		 * The filename for the 'core' GPGIM resource XML file.
-		 *
-		 * This is loaded into the GPlates executable as a Qt resource via the 'qt-resources' library.
-		 */
-		static const QString CORE_GPGIM_RESOURCE_FILENAME;
-
-
-		//! Typedef for mapping from feature type to associated feature class XML element nodes.
-		typedef std::map<FeatureType, XmlElementNode::non_null_ptr_type> feature_class_xml_element_node_map_type;
-
 		//! Typedef for a map of feature type to feature class.
 		typedef std::map<FeatureType, GpgimFeatureClass::non_null_ptr_to_const_type> feature_class_map_type;
 
@@ -418,207 +400,37 @@ namespace GPlatesModel
 
 
 		/**
-		 * Loads a GPGIM resource XML file.
-		 *
-		 * Currently there is only the 'core' GPGIM, but in the future there will also be
-		 * 'extension' GPGIMs that model data outside the core geological information model.
-		 */
-		void
-		load_gpgim_resource(
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the root 'gpgim:GPGIM' element in the GPGIM XML document and returns the GPGIM version.
-		 */
-		GpgimVersion
-		read_gpgim_element(
-				boost::optional<XmlElementNode::non_null_ptr_type> &property_type_list_xml_element,
-				boost::optional<XmlElementNode::non_null_ptr_type> &property_list_xml_element,
-				boost::optional<XmlElementNode::non_null_ptr_type> &feature_class_list_xml_element,
-				QXmlStreamReader &xml_reader,
-				const QString &gpgim_resource_filename,
-				boost::shared_ptr<XmlElementNode::AliasToNamespaceMap> alias_to_namespace_map);
-
-		/**
-		 * Compiles the property structural type definitions from their respective XML element nodes.
+		 * Creates the property structural types from the GPGIM tables (see @a GpgimTables).
 		 */
 		void
-		create_property_structural_types(
-				const XmlElementNode::non_null_ptr_type &property_type_list_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Compiles a property structural type from the specified XML element node.
-		 */
-		GpgimStructuralType::non_null_ptr_to_const_type
-		create_property_structural_type(
-				const XmlElementNode::non_null_ptr_type &property_type_xml_element,
-				bool is_enumeration,
-				const QString &gpgim_resource_filename);
+		create_property_structural_types();
 
 		/**
-		 * Create the GPGIM feature properties listed in (children of) the specified XML element node.
+		 * Creates the properties from the GPGIM tables.
 		 */
 		void
-		create_properties(
-				const XmlElementNode::non_null_ptr_type &property_list_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Create the GPGIM feature property associated with the specified XML element node.
-		 */
-		GpgimProperty::non_null_ptr_type
-		create_property(
-				const XmlElementNode::non_null_ptr_type &property_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the feature property name from the specified property XML element.
-		 */
-		PropertyName
-		read_feature_property_name(
-				const XmlElementNode::non_null_ptr_type &property_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the feature property user-friendly name from the specified property XML element.
-		 */
-		QString
-		read_feature_property_user_friendly_name(
-				const XmlElementNode::non_null_ptr_type &property_xml_element,
-				const PropertyName &property_name,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the feature property description from the specified property XML element.
-		 */
-		QString
-		read_feature_property_description(
-				const XmlElementNode::non_null_ptr_type &property_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the feature property multiplicity from the specified property XML element.
-		 */
-		GpgimProperty::MultiplicityType
-		read_feature_property_multiplicity(
-				const XmlElementNode::non_null_ptr_type &property_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the feature property structural types from the specified property XML element.
-		 *
-		 * Returns the default structural type as an iterator to the sequence @a gpgim_property_structural_types.
-		 */
-		unsigned int
-		read_feature_property_structural_types(
-				GpgimProperty::structural_type_seq_type &gpgim_property_structural_types,
-				const XmlElementNode::non_null_ptr_type &property_xml_element,
-				const QString &gpgim_resource_filename);
+		create_properties();
 
 		/**
-		 * Reads the non-template structural type from the specified property type XML element.
-		 *
-		 * Also adds the returned @a GpgimStructuralType to @a gpgim_property_structural_types.
-		 */
-		GpgimStructuralType::non_null_ptr_to_const_type
-		read_feature_property_non_template_structural_type(
-				GpgimProperty::structural_type_seq_type &gpgim_property_structural_types,
-				const XmlElementNode::non_null_ptr_type &property_type_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the template structural type from the specified property type XML element.
-		 *
-		 * Also adds the returned @a GpgimTemplateStructuralType to @a gpgim_property_structural_types.
+		 * Returns the instantiation of the template structural type @a gpgim_structural_type
+		 * with the value type @a value_type (creating it if it hasn't already been instantiated).
 		 */
 		GpgimTemplateStructuralType::non_null_ptr_to_const_type
-		read_feature_property_template_structural_type(
-				GpgimProperty::structural_type_seq_type &gpgim_property_structural_types,
-				const XmlElementNode::non_null_ptr_type &property_template_type_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the default feature property structural type as an attribute of the specified property XML element.
-		 */
-		GPlatesPropertyValues::StructuralType
-		read_default_feature_property_structural_type(
-				const XmlElementNode::non_null_ptr_type &property_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the feature property time-dependent types from the specified property XML element.
-		 */
-		GpgimProperty::time_dependent_flags_type
-		read_feature_property_time_dependent_types(
-				const XmlElementNode::non_null_ptr_type &property_xml_element,
-				const QString &gpgim_resource_filename);
-
-		boost::optional<GPlatesModel::PropertyName>
-		read_feature_class_default_geometry_property_name(
-				const XmlElementNode::non_null_ptr_type &feature_class_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Reads the GPGIM feature class definitions in the GPGIM XML document.
-		 */
-		void
-		read_feature_class_xml_elements(
-				feature_class_xml_element_node_map_type &feature_class_xml_element_node_map,
-				const XmlElementNode::non_null_ptr_type &feature_class_list_xml_element,
-				const QString &gpgim_resource_filename);
+		get_property_template_structural_type_instantiation(
+				const GpgimStructuralType &gpgim_structural_type,
+				const GPlatesPropertyValues::StructuralType &value_type);
 
 		/**
-		 * Compiles the feature class definitions from their respective XML element nodes.
+		 * Creates the feature classes from the GPGIM tables.
 		 */
 		void
-		create_feature_classes(
-				const feature_class_xml_element_node_map_type &feature_class_xml_element_node_map,
-				const QString &gpgim_resource_filename);
+		create_feature_classes();
 
 		/**
 		 * Creates the special-case feature class 'gpml:UnclassifiedFeature'.
 		 */
 		GpgimFeatureClass::non_null_ptr_to_const_type
-		create_unclassified_feature_class(
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Compiles a feature class definition from the specified XML element node, if it hasn't already been.
-		 */
-		GpgimFeatureClass::non_null_ptr_to_const_type
-		create_feature_class_if_necessary(
-				const FeatureType &feature_type,
-				const XmlElementNode::non_null_ptr_type &feature_class_reference_xml_element,
-				const feature_class_xml_element_node_map_type &feature_class_xml_element_node_map,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Compiles a feature class definition from the specified XML element node.
-		 */
-		GpgimFeatureClass::non_null_ptr_to_const_type
-		create_feature_class(
-				const FeatureType &feature_type,
-				const XmlElementNode::non_null_ptr_type &feature_class_xml_element,
-				const feature_class_xml_element_node_map_type &feature_class_xml_element_node_map,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Create GPGIM feature properties for the feature class associated with the specified XML element node.
-		 */
-		void
-		create_feature_properties(
-				GpgimFeatureClass::gpgim_property_seq_type &gpgim_feature_properties,
-				const XmlElementNode::non_null_ptr_type &feature_class_xml_element,
-				const QString &gpgim_resource_filename);
-
-		/**
-		 * Returns true if the feature class (associated with the specified XML element) is concrete.
-		 */
-		bool
-		is_concrete_feature_class(
-				const XmlElementNode::non_null_ptr_type &feature_class_xml_element,
-				const QString &gpgim_resource_filename) const;
+		create_unclassified_feature_class();
 	};
 }
 
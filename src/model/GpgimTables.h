@@ -0,0 +1,173 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef GPLATES_MODEL_GPGIMTABLES_H
+#define GPLATES_MODEL_GPGIMTABLES_H
+
+#include "GpgimProperty.h"
+
+
+namespace GPlatesModel
+{
+	/**
+	 * The core GPGIM compiled into tables at build time.
+	 *
+	 * The tables are defined in the source file 'GpgimTables.cc' which is generated (in the build directory)
+	 * from the GPGIM XML file 'qt-resources/gpgim/gpgim.xml' by the script 'cmake/generate_gpgim_tables.py'.
+	 * That script also validates the GPGIM XML file (so an invalid GPGIM fails the build).
+	 *
+	 * This enables @a Gpgim to create its feature classes, properties and property structural types
+	 * without parsing XML at startup, while the GPGIM XML file remains the source of truth.
+	 *
+	 * All strings are UTF-8 encoded.
+	 *
+	 * Note that each table contains one unused entry if it is empty (since C++ has no zero-sized arrays),
+	 * so use the associated 'NUM_*' constant for the number of entries.
+	 */
+	namespace GpgimTables
+	{
+		/**
+		 * A qualified XML name (a null @a name means no name).
+		 */
+		struct QualifiedName
+		{
+			const char *namespace_uri;
+			const char *namespace_alias;
+			const char *name;
+		};
+
+
+		/**
+		 * An allowed value of an enumeration type (see @a GpgimEnumerationType::Content).
+		 */
+		struct EnumerationContent
+		{
+			const char *value;
+			const char *description;
+		};
+
+
+		/**
+		 * A property structural type (native property type or enumeration type).
+		 */
+		struct StructuralType
+		{
+			QualifiedName structural_type;
+			const char *description;
+			bool is_geometry;
+			bool is_enumeration;
+
+			//! The range of enumeration contents in @a ENUMERATION_CONTENTS (empty if not an enumeration).
+			unsigned int enumeration_contents_begin;
+			unsigned int enumeration_contents_end;
+		};
+
+
+		/**
+		 * A structural type of a property.
+		 */
+		struct PropertyStructuralType
+		{
+			//! Index into @a STRUCTURAL_TYPES.
+			unsigned int structural_type_index;
+
+			//! The value type of a template structural type (has a null name if not a template type).
+			QualifiedName value_type;
+		};
+
+
+		/**
+		 * A property (see @a GpgimProperty).
+		 */
+		struct Property
+		{
+			QualifiedName property_name;
+			const char *user_friendly_name;
+			const char *description;
+			GpgimProperty::MultiplicityType multiplicity;
+
+			//! The range of structural types in @a PROPERTY_STRUCTURAL_TYPES (non-template types first).
+			unsigned int structural_types_begin;
+			unsigned int structural_types_end;
+
+			//! The default structural type (relative to @a structural_types_begin).
+			unsigned int default_structural_type_index;
+
+			bool constant_value;
+			bool piecewise_aggregation;
+			bool irregular_sampling;
+		};
+
+
+		/**
+		 * A feature class (see @a GpgimFeatureClass).
+		 *
+		 * Feature classes are listed in inheritance order (a parent class is listed before its child classes).
+		 */
+		struct FeatureClass
+		{
+			QualifiedName feature_type;
+			const char *description;
+
+			//! Index into @a FEATURE_CLASSES of the parent feature class (or -1 if no parent).
+			int parent_feature_class_index;
+
+			//! The range of property indices in @a FEATURE_CLASS_PROPERTIES.
+			unsigned int properties_begin;
+			unsigned int properties_end;
+
+			//! The default geometry property (relative to @a properties_begin), or -1 if none.
+			int default_geometry_property_index;
+
+			bool is_concrete;
+		};
+
+
+		//! The GPGIM version string.
+		extern const char *const GPGIM_VERSION;
+
+		extern const EnumerationContent ENUMERATION_CONTENTS[];
+		extern const unsigned int NUM_ENUMERATION_CONTENTS;
+
+		extern const StructuralType STRUCTURAL_TYPES[];
+		extern const unsigned int NUM_STRUCTURAL_TYPES;
+
+		extern const PropertyStructuralType PROPERTY_STRUCTURAL_TYPES[];
+		extern const unsigned int NUM_PROPERTY_STRUCTURAL_TYPES;
+
+		extern const Property PROPERTIES[];
+		extern const unsigned int NUM_PROPERTIES;
+
+		//! Indices into @a PROPERTIES.
+		extern const unsigned int FEATURE_CLASS_PROPERTIES[];
+		extern const unsigned int NUM_FEATURE_CLASS_PROPERTIES;
+
+		extern const FeatureClass FEATURE_CLASSES[];
+		extern const unsigned int NUM_FEATURE_CLASSES;
+	}
+}
+
+#endif // GPLATES_MODEL_GPGIMTABLES_H
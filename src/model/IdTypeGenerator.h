@@ -31,6 +31,8 @@
 #include <vector>
 #include <boost/operators.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "StringSetSingletons.h"
 
@@ -106,7 +108,8 @@ namespace GPlatesModel
 			BackRef(
 					back_ref_target_type &target,
 					shared_iterator_type &sh_iter):
-				d_target_ptr(&target)
+				d_target_ptr(&target),
+				d_sh_iter(sh_iter)
 			{
 				// For some reason, VS2008 is giving us warning C4355 ('this'
 				// used in base member initializer list) - which makes no sense.
@@ -115,12 +118,17 @@ namespace GPlatesModel
 						new back_ref_list_type::Node(this));
 
 				// Register this BackRef as a back-reference for this ID.
-				sh_iter.back_refs().append(*d_node_for_back_ref_registration);
+				boost::lock_guard<boost::mutex> lock(d_sh_iter.back_refs_mutex());
+				d_sh_iter.back_refs().append(*d_node_for_back_ref_registration);
 			}
 
 			virtual
 			~BackRef()
-			{  }
+			{
+				// Destroying the node splices it out of the list of back-references.
+				boost::lock_guard<boost::mutex> lock(d_sh_iter.back_refs_mutex());
+				d_node_for_back_ref_registration.reset();
+			}
 
 			/**
 			 * Access the target of this back-reference, an object which defines this
@@ -147,6 +155,14 @@ namespace GPlatesModel
 			 */
 			back_ref_target_type *d_target_ptr;
 
+			/**
+			 * The ID element whose list of back-references contains our node.
+			 *
+			 * This keeps the list alive (and gives access to its mutex) until our node is
+			 * spliced out of it.
+			 */
+			shared_iterator_type d_sh_iter;
+
 			/**
 			 * The smart node which is linked into the list of back-references.
 			 *
@@ -288,6 +304,8 @@ namespace GPlatesModel
 		find_back_ref_targets(
 				Inserter inserter) const
 		{
+			boost::lock_guard<boost::mutex> lock(d_sh_iter.back_refs_mutex());
+
 			back_ref_list_type::iterator iter = d_sh_iter.back_refs().begin();
 			back_ref_list_type::iterator end = d_sh_iter.back_refs().end();
 			for ( ; iter != end; ++iter) {
@@ -28,6 +28,27 @@
 #include "StringSetSingletons.h"
 #include "utils/Singleton.h"
 
+
+void
+GPlatesModel::StringSetSingletons::create_instances()
+{
+	feature_id_instance();
+	feature_type_instance();
+	property_name_instance();
+	structural_type_instance();
+	text_content_instance();
+	timescale_band_instance();
+	timescale_name_instance();
+	xml_attribute_name_instance();
+	xml_attribute_value_instance();
+	xml_namespace_instance();
+	xml_namespace_alias_instance();
+	xml_element_name_instance();
+	enumeration_content_instance();
+	enumeration_type_instance();
+}
+
+
 GPlatesUtils::IdStringSet &
 GPlatesModel::StringSetSingletons::feature_id_instance()
 {
@@ -36,6 +36,15 @@ namespace GPlatesModel
 {
 	namespace StringSetSingletons
 	{
+		/**
+		 * Create all the string set singletons.
+		 *
+		 * Creation of a singleton on first access is not thread-safe (the string sets themselves
+		 * are), so this should be called before the string sets are accessed by multiple threads.
+		 */
+		void
+		create_instances();
+
 		GPlatesUtils::IdStringSet &
 		feature_id_instance();
 
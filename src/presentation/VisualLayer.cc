@@ -36,6 +36,7 @@
 #include "app-logic/ApplicationState.h"
 #include "app-logic/Layer.h"
 
+#include "gui/DrawStyleAdapters.h"
 #include "gui/Symbol.h"
 
 #include "file-io/FileInfo.h"
@@ -162,6 +163,9 @@ GPlatesPresentation::VisualLayer::create_rendered_geometries()
 	LayerOutputRenderer layer_output_renderer(
 			reconstruction_geometry_renderer,
 			*d_rendered_geometry_layer);
+
+	// Let the draw style adapter set up once for all features in the layer (eg, acquire the Python GIL).
+	GPlatesGui::StyleAdapterScope draw_style_adapter_scope(draw_style_adapter);
 	layer_output.get()->accept_visitor(layer_output_renderer);
 }
 
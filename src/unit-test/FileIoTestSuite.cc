@@ -28,6 +28,8 @@
 
 #include "unit-test/FileIoTestSuite.h"
 #include "unit-test/TestSuiteFilter.h"
+#include "unit-test/GdatTest.h"
+#include "unit-test/OgrWriterTest.h"
 
 GPlatesUnitTest::FileIoTestSuite::FileIoTestSuite(
 		unsigned level) : 
@@ -41,5 +43,7 @@ void
 GPlatesUnitTest::FileIoTestSuite::construct_maps()
 {
 	//ADD YOUR TEST SUITE HERE
+	ADD_TESTSUITE(Gdat);
+	ADD_TESTSUITE(OgrWriter);
 }
 
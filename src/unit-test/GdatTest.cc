@@ -0,0 +1,329 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <vector>
+#include <boost/optional.hpp>
+#include <QFile>
+
+#include "unit-test/GdatTest.h"
+
+#include "app-logic/GeometryUtils.h"
+
+#include "file-io/FileInfo.h"
+#include "file-io/ReadErrorAccumulation.h"
+
+#include "maths/GeometryOnSphere.h"
+#include "maths/PointOnSphere.h"
+#include "maths/UnitQuaternion3D.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/FeatureHandle.h"
+#include "model/TopLevelPropertyInline.h"
+
+#include "property-values/GpmlFiniteRotation.h"
+#include "property-values/GpmlIrregularSampling.h"
+
+
+namespace
+{
+	/**
+	 * Checks the geometry properties of @a feature and @a original_feature have the same points.
+	 *
+	 * The 'gdat' format stores the raw point components so they should be exactly equal.
+	 */
+	void
+	check_feature_geometries(
+			const GPlatesModel::FeatureHandle::non_null_ptr_type &feature,
+			const GPlatesModel::FeatureHandle::non_null_ptr_type &original_feature)
+	{
+		GPlatesModel::FeatureHandle::iterator properties_iter = feature->begin();
+		GPlatesModel::FeatureHandle::iterator original_properties_iter = original_feature->begin();
+		for ( ;
+			properties_iter != feature->end() && original_properties_iter != original_feature->end();
+			++properties_iter, ++original_properties_iter)
+		{
+			BOOST_CHECK((*properties_iter)->property_name() == (*original_properties_iter)->property_name());
+
+			const boost::optional<GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type> original_geometry =
+					GPlatesAppLogic::GeometryUtils::get_geometry_from_property(original_properties_iter);
+			if (!original_geometry)
+			{
+				continue;
+			}
+
+			const boost::optional<GPlatesMaths::GeometryOnSphere::non_null_ptr_to_const_type> geometry =
+					GPlatesAppLogic::GeometryUtils::get_geometry_from_property(properties_iter);
+			BOOST_CHECK(geometry);
+			if (!geometry)
+			{
+				continue;
+			}
+
+			std::vector<GPlatesMaths::PointOnSphere> points;
+			std::vector<GPlatesMaths::PointOnSphere> original_points;
+			BOOST_CHECK(
+					GPlatesAppLogic::GeometryUtils::get_geometry_points(*geometry.get(), points) ==
+						GPlatesAppLogic::GeometryUtils::get_geometry_points(*original_geometry.get(), original_points));
+			BOOST_CHECK(points == original_points);
+		}
+	}
+
+
+	/**
+	 * Returns the irregular sampling of @a property (if it is an irregularly sampled property).
+	 */
+	boost::optional<const GPlatesPropertyValues::GpmlIrregularSampling &>
+	get_irregular_sampling(
+			const GPlatesModel::TopLevelProperty &property)
+	{
+		const GPlatesModel::TopLevelPropertyInline *property_inline =
+				dynamic_cast<const GPlatesModel::TopLevelPropertyInline *>(&property);
+		if (property_inline == NULL ||
+			property_inline->size() != 1)
+		{
+			return boost::none;
+		}
+
+		const GPlatesPropertyValues::GpmlIrregularSampling *irregular_sampling =
+				dynamic_cast<const GPlatesPropertyValues::GpmlIrregularSampling *>((*property_inline->begin()).get());
+		if (irregular_sampling == NULL)
+		{
+			return boost::none;
+		}
+
+		return *irregular_sampling;
+	}
+
+
+	/**
+	 * Checks the irregularly sampled rotation properties of @a feature and @a original_feature
+	 * have the same time samples.
+	 *
+	 * Returns the number of irregularly sampled properties compared.
+	 */
+	unsigned int
+	check_feature_irregular_samplings(
+			const GPlatesModel::FeatureHandle::non_null_ptr_type &feature,
+			const GPlatesModel::FeatureHandle::non_null_ptr_type &original_feature)
+	{
+		unsigned int num_irregular_samplings = 0;
+
+		GPlatesModel::FeatureHandle::iterator properties_iter = feature->begin();
+		GPlatesModel::FeatureHandle::iterator original_properties_iter = original_feature->begin();
+		for ( ;
+			properties_iter != feature->end() && original_properties_iter != original_feature->end();
+			++properties_iter, ++original_properties_iter)
+		{
+			const boost::optional<const GPlatesPropertyValues::GpmlIrregularSampling &> original_irregular_sampling =
+					get_irregular_sampling(**original_properties_iter);
+			if (!original_irregular_sampling)
+			{
+				continue;
+			}
+
+			const boost::optional<const GPlatesPropertyValues::GpmlIrregularSampling &> irregular_sampling =
+					get_irregular_sampling(**properties_iter);
+			BOOST_CHECK(irregular_sampling);
+			if (!irregular_sampling)
+			{
+				continue;
+			}
+
+			++num_irregular_samplings;
+
+			BOOST_CHECK(irregular_sampling->value_type() == original_irregular_sampling->value_type());
+			BOOST_CHECK(
+					bool(irregular_sampling->interpolation_function()) ==
+						bool(original_irregular_sampling->interpolation_function()));
+
+			const std::vector<GPlatesPropertyValues::GpmlTimeSample> &time_samples =
+					irregular_sampling->time_samples();
+			const std::vector<GPlatesPropertyValues::GpmlTimeSample> &original_time_samples =
+					original_irregular_sampling->time_samples();
+			BOOST_CHECK(time_samples.size() == original_time_samples.size());
+			for (unsigned int n = 0; n < time_samples.size() && n < original_time_samples.size(); ++n)
+			{
+				BOOST_CHECK(time_samples[n].is_disabled() == original_time_samples[n].is_disabled());
+				BOOST_CHECK(
+						time_samples[n].valid_time()->time_position().is_coincident_with(
+								original_time_samples[n].valid_time()->time_position()));
+
+				const GPlatesPropertyValues::GpmlFiniteRotation *finite_rotation =
+						dynamic_cast<const GPlatesPropertyValues::GpmlFiniteRotation *>(time_samples[n].value().get());
+				const GPlatesPropertyValues::GpmlFiniteRotation *original_finite_rotation =
+						dynamic_cast<const GPlatesPropertyValues::GpmlFiniteRotation *>(original_time_samples[n].value().get());
+				BOOST_CHECK(finite_rotation && original_finite_rotation);
+				if (finite_rotation && original_finite_rotation)
+				{
+					BOOST_CHECK(
+							finite_rotation->finite_rotation().unit_quat() ==
+								original_finite_rotation->finite_rotation().unit_quat());
+					BOOST_CHECK(finite_rotation->metadata().size() == original_finite_rotation->metadata().size());
+				}
+			}
+		}
+
+		return num_irregular_samplings;
+	}
+}
+
+
+GPlatesUnitTest::GdatTestSuite::GdatTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"GdatTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::GdatTestSuite::construct_maps()
+{
+	boost::shared_ptr<GdatTest> instance(
+		new GdatTest());
+
+	ADD_TESTCASE(GdatTest,test_round_trip);
+	ADD_TESTCASE(GdatTest,test_rotation_round_trip);
+	ADD_TESTCASE(GdatTest,test_truncated_file);
+}
+
+
+GPlatesFileIO::File::non_null_ptr_type
+GPlatesUnitTest::GdatTest::write_gdat_file(
+		const QString &gpml_filename,
+		const QString &gdat_filename)
+{
+	GPlatesFileIO::File::non_null_ptr_type gpml_file = d_test_data_files.load_file(gpml_filename);
+
+	GPlatesFileIO::File::Reference::non_null_ptr_type gdat_file_ref =
+			GPlatesFileIO::File::create_file_reference(
+					GPlatesFileIO::FileInfo(gdat_filename),
+					gpml_file->get_reference().get_feature_collection());
+	d_test_data_files.get_file_format_registry().write_feature_collection(*gdat_file_ref);
+
+	return gpml_file;
+}
+
+
+void
+GPlatesUnitTest::GdatTest::test_round_trip()
+{
+	// Between them these contain points, multi-points, polylines and polygons.
+	const char *const gpml_filenames[] = { "coreg_seed_points.gpml", "coreg_target.gpml" };
+
+	for (unsigned int file_index = 0; file_index < sizeof(gpml_filenames) / sizeof(gpml_filenames[0]); ++file_index)
+	{
+		const QString gdat_filename("./gdat_round_trip_test.gdat");
+		const GPlatesFileIO::File::non_null_ptr_type gpml_file =
+				write_gdat_file(gpml_filenames[file_index], gdat_filename);
+
+		GPlatesFileIO::File::non_null_ptr_type gdat_file =
+				GPlatesFileIO::File::create_file(GPlatesFileIO::FileInfo(gdat_filename));
+		GPlatesFileIO::ReadErrorAccumulation read_errors;
+		d_test_data_files.get_file_format_registry().read_feature_collection(gdat_file->get_reference(), read_errors);
+		BOOST_CHECK(read_errors.d_terminating_errors.empty());
+		BOOST_CHECK(read_errors.d_failures_to_begin.empty());
+
+		const GPlatesModel::FeatureCollectionHandle::weak_ref original_feature_collection =
+				gpml_file->get_reference().get_feature_collection();
+		const GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection =
+				gdat_file->get_reference().get_feature_collection();
+		BOOST_CHECK(original_feature_collection->size() != 0);
+		BOOST_CHECK(feature_collection->size() == original_feature_collection->size());
+
+		GPlatesModel::FeatureCollectionHandle::iterator features_iter = feature_collection->begin();
+		GPlatesModel::FeatureCollectionHandle::iterator original_features_iter = original_feature_collection->begin();
+		for ( ;
+			features_iter != feature_collection->end() && original_features_iter != original_feature_collection->end();
+			++features_iter, ++original_features_iter)
+		{
+			BOOST_CHECK((*features_iter)->feature_type() == (*original_features_iter)->feature_type());
+			BOOST_CHECK((*features_iter)->feature_id() == (*original_features_iter)->feature_id());
+			BOOST_CHECK((*features_iter)->size() == (*original_features_iter)->size());
+
+			check_feature_geometries(*features_iter, *original_features_iter);
+		}
+	}
+}
+
+
+void
+GPlatesUnitTest::GdatTest::test_rotation_round_trip()
+{
+	const QString gdat_filename("./gdat_rotation_round_trip_test.gdat");
+	const GPlatesFileIO::File::non_null_ptr_type rotation_file =
+			write_gdat_file("coreg_rotation.rot", gdat_filename);
+
+	GPlatesFileIO::File::non_null_ptr_type gdat_file =
+			GPlatesFileIO::File::create_file(GPlatesFileIO::FileInfo(gdat_filename));
+	GPlatesFileIO::ReadErrorAccumulation read_errors;
+	d_test_data_files.get_file_format_registry().read_feature_collection(gdat_file->get_reference(), read_errors);
+	BOOST_CHECK(read_errors.d_terminating_errors.empty());
+	BOOST_CHECK(read_errors.d_failures_to_begin.empty());
+
+	const GPlatesModel::FeatureCollectionHandle::weak_ref original_feature_collection =
+			rotation_file->get_reference().get_feature_collection();
+	const GPlatesModel::FeatureCollectionHandle::weak_ref feature_collection =
+			gdat_file->get_reference().get_feature_collection();
+	BOOST_CHECK(feature_collection->size() == original_feature_collection->size());
+
+	unsigned int num_irregular_samplings = 0;
+
+	GPlatesModel::FeatureCollectionHandle::iterator features_iter = feature_collection->begin();
+	GPlatesModel::FeatureCollectionHandle::iterator original_features_iter = original_feature_collection->begin();
+	for ( ;
+		features_iter != feature_collection->end() && original_features_iter != original_feature_collection->end();
+		++features_iter, ++original_features_iter)
+	{
+		BOOST_CHECK((*features_iter)->feature_type() == (*original_features_iter)->feature_type());
+		BOOST_CHECK((*features_iter)->size() == (*original_features_iter)->size());
+
+		num_irregular_samplings += check_feature_irregular_samplings(*features_iter, *original_features_iter);
+	}
+
+	// The rotation file should contain at least one total reconstruction sequence.
+	BOOST_CHECK(num_irregular_samplings != 0);
+}
+
+
+void
+GPlatesUnitTest::GdatTest::test_truncated_file()
+{
+	const QString gdat_filename("./gdat_truncated_test.gdat");
+	write_gdat_file("coreg_target.gpml", gdat_filename);
+
+	// Cut the file off part way through its features.
+	QFile gdat_file_on_disk(gdat_filename);
+	BOOST_REQUIRE(gdat_file_on_disk.size() > 0);
+	BOOST_REQUIRE(gdat_file_on_disk.resize(gdat_file_on_disk.size() / 2));
+
+	GPlatesFileIO::File::non_null_ptr_type gdat_file =
+			GPlatesFileIO::File::create_file(GPlatesFileIO::FileInfo(gdat_filename));
+	GPlatesFileIO::ReadErrorAccumulation read_errors;
+	d_test_data_files.get_file_format_registry().read_feature_collection(gdat_file->get_reference(), read_errors);
+
+	BOOST_CHECK(!read_errors.d_terminating_errors.empty());
+}
@@ -0,0 +1,91 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UNIT_TEST_GDAT_TEST_H
+#define GPLATES_UNIT_TEST_GDAT_TEST_H
+
+#include <boost/test/unit_test.hpp>
+#include <QString>
+
+#include "unit-test/GPlatesTestSuite.h"
+#include "unit-test/TestDataFiles.h"
+
+#include "file-io/File.h"
+
+
+namespace GPlatesUnitTest
+{
+	class GdatTest
+	{
+	public:
+
+		/**
+		 * Writes GPML files to 'gdat' and checks the features read back are the same.
+		 */
+		void
+		test_round_trip();
+
+		/**
+		 * Writes a rotation file to 'gdat' and checks the total reconstruction poles read back are the same.
+		 */
+		void
+		test_rotation_round_trip();
+
+		/**
+		 * Checks a truncated 'gdat' file is reported as a read error (instead of crashing).
+		 */
+		void
+		test_truncated_file();
+
+	private:
+
+		/**
+		 * Reads the GPML file @a gpml_filename and writes its features to the 'gdat' file @a gdat_filename.
+		 *
+		 * Returns the file read from GPML.
+		 */
+		GPlatesFileIO::File::non_null_ptr_type
+		write_gdat_file(
+				const QString &gpml_filename,
+				const QString &gdat_filename);
+
+		TestDataFiles d_test_data_files;
+	};
+
+
+	class GdatTestSuite :
+		public GPlatesUnitTest::GPlatesTestSuite
+	{
+	public:
+		GdatTestSuite(
+				unsigned depth);
+
+	protected:
+		void
+		construct_maps();
+	};
+}
+
+#endif // GPLATES_UNIT_TEST_GDAT_TEST_H
@@ -0,0 +1,195 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <QString>
+
+#include "unit-test/OgrWriterTest.h"
+
+#include "file-io/GdalUtils.h"
+#include "file-io/Ogr.h"
+#include "file-io/OgrMultiFrameExport.h"
+#include "file-io/OgrWriter.h"
+
+#include "maths/LatLonPoint.h"
+#include "maths/PointOnSphere.h"
+
+
+namespace
+{
+	const double FRAME_TIMES[] = { 0.0, 10.0, 20.0 };
+	const unsigned int NUM_FRAMES = sizeof(FRAME_TIMES) / sizeof(FRAME_TIMES[0]);
+
+
+	/**
+	 * Writes one point per frame to @a filename, each frame appended to the same GeoPackage.
+	 */
+	void
+	write_frames(
+			const QString &filename,
+			GPlatesFileIO::OgrMultiFrameExport::Layout layout)
+	{
+		for (unsigned int frame_index = 0; frame_index < NUM_FRAMES; ++frame_index)
+		{
+			// Each frame is written (and committed) by its own writer, just like an animation export.
+			GPlatesFileIO::OgrWriter writer(
+					filename,
+					false/*multiple_layers*/,
+					false/*wrap_to_dateline*/,
+					boost::none/*original_srs*/,
+					GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::WRITE_AS_WGS84_BEHAVIOUR,
+					GPlatesFileIO::OgrMultiFrameExport::Frame(
+							layout,
+							FRAME_TIMES[frame_index],
+							frame_index == 0/*is_first_frame*/));
+
+			writer.write_point_feature(
+					GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(10.0 * frame_index, 20.0)),
+					boost::none,
+					boost::none);
+		}
+	}
+}
+
+
+GPlatesUnitTest::OgrWriterTestSuite::OgrWriterTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"OgrWriterTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::OgrWriterTestSuite::construct_maps()
+{
+	boost::shared_ptr<OgrWriterTest> instance(
+		new OgrWriterTest());
+
+	ADD_TESTCASE(OgrWriterTest,test_multi_frame_time_field);
+	ADD_TESTCASE(OgrWriterTest,test_multi_frame_layer_per_frame);
+	ADD_TESTCASE(OgrWriterTest,test_transaction_batch_size);
+}
+
+
+void
+GPlatesUnitTest::OgrWriterTest::test_multi_frame_time_field()
+{
+	const QString filename("./ogr_writer_test_time_field.gpkg");
+	write_frames(filename, GPlatesFileIO::OgrMultiFrameExport::TIME_FIELD);
+
+	GPlatesFileIO::GdalUtils::vector_data_source_type *data_source =
+			GPlatesFileIO::GdalUtils::open_vector(filename);
+	BOOST_REQUIRE(data_source);
+
+	// All frames share the same point layer.
+	BOOST_CHECK(data_source->GetLayerCount() == 1);
+	if (data_source->GetLayerCount() == 1)
+	{
+		OGRLayer *layer = data_source->GetLayer(0);
+		BOOST_CHECK(layer->GetFeatureCount() == NUM_FRAMES);
+
+		const int time_field_index = layer->GetLayerDefn()->GetFieldIndex("TIME");
+		BOOST_CHECK(time_field_index >= 0);
+		if (time_field_index >= 0)
+		{
+			layer->ResetReading();
+			unsigned int frame_index = 0;
+			OGRFeature *feature;
+			while ((feature = layer->GetNextFeature()) != NULL)
+			{
+				if (frame_index < NUM_FRAMES)
+				{
+					BOOST_CHECK(feature->GetFieldAsDouble(time_field_index) == FRAME_TIMES[frame_index]);
+				}
+				++frame_index;
+				OGRFeature::DestroyFeature(feature);
+			}
+			BOOST_CHECK(frame_index == NUM_FRAMES);
+		}
+	}
+
+	GPlatesFileIO::GdalUtils::close_vector(data_source);
+}
+
+
+void
+GPlatesUnitTest::OgrWriterTest::test_multi_frame_layer_per_frame()
+{
+	const QString filename("./ogr_writer_test_layer_per_frame.gpkg");
+	write_frames(filename, GPlatesFileIO::OgrMultiFrameExport::LAYER_PER_FRAME);
+
+	GPlatesFileIO::GdalUtils::vector_data_source_type *data_source =
+			GPlatesFileIO::GdalUtils::open_vector(filename);
+	BOOST_REQUIRE(data_source);
+
+	// Each frame gets its own point layer containing just that frame's point.
+	BOOST_CHECK(data_source->GetLayerCount() == static_cast<int>(NUM_FRAMES));
+	for (int layer_index = 0; layer_index < data_source->GetLayerCount(); ++layer_index)
+	{
+		BOOST_CHECK(data_source->GetLayer(layer_index)->GetFeatureCount() == 1);
+	}
+
+	GPlatesFileIO::GdalUtils::close_vector(data_source);
+}
+
+
+void
+GPlatesUnitTest::OgrWriterTest::test_transaction_batch_size()
+{
+	const QString filename("./ogr_writer_test_transaction_batch_size.gpkg");
+	const unsigned int num_features = 5;
+
+	{
+		GPlatesFileIO::OgrWriter writer(
+				filename,
+				false/*multiple_layers*/,
+				false/*wrap_to_dateline*/,
+				boost::none/*original_srs*/,
+				GPlatesFileIO::FeatureCollectionFileFormat::OGRConfiguration::WRITE_AS_WGS84_BEHAVIOUR,
+				boost::none/*multi_frame*/,
+				2/*transaction_batch_size*/);
+
+		for (unsigned int feature_index = 0; feature_index < num_features; ++feature_index)
+		{
+			writer.write_point_feature(
+					GPlatesMaths::make_point_on_sphere(GPlatesMaths::LatLonPoint(10.0 * feature_index, 20.0)),
+					boost::none,
+					boost::none);
+		}
+	}
+
+	GPlatesFileIO::GdalUtils::vector_data_source_type *data_source =
+			GPlatesFileIO::GdalUtils::open_vector(filename);
+	BOOST_REQUIRE(data_source);
+
+	BOOST_CHECK(data_source->GetLayerCount() == 1);
+	if (data_source->GetLayerCount() == 1)
+	{
+		BOOST_CHECK(data_source->GetLayer(0)->GetFeatureCount() == num_features);
+	}
+
+	GPlatesFileIO::GdalUtils::close_vector(data_source);
+}
@@ -0,0 +1,73 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UNIT_TEST_OGR_WRITER_TEST_H
+#define GPLATES_UNIT_TEST_OGR_WRITER_TEST_H
+
+#include <boost/test/unit_test.hpp>
+
+#include "unit-test/GPlatesTestSuite.h"
+
+namespace GPlatesUnitTest
+{
+	class OgrWriterTest
+	{
+	public:
+
+		/**
+		 * Exports several frames to one GeoPackage, distinguished by the "TIME" attribute field.
+		 */
+		void
+		test_multi_frame_time_field();
+
+		/**
+		 * Exports several frames to one GeoPackage, each frame in its own layer.
+		 */
+		void
+		test_multi_frame_layer_per_frame();
+
+		/**
+		 * Exports more features than the transaction batch size (so some are committed in full
+		 * batches and the remainder when the writer is destroyed).
+		 */
+		void
+		test_transaction_batch_size();
+	};
+
+
+	class OgrWriterTestSuite :
+		public GPlatesUnitTest::GPlatesTestSuite
+	{
+	public:
+		OgrWriterTestSuite(
+				unsigned depth);
+
+	protected:
+		void
+		construct_maps();
+	};
+}
+
+#endif // GPLATES_UNIT_TEST_OGR_WRITER_TEST_H
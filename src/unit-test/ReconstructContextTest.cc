@@ -0,0 +1,147 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <QString>
+
+#include "unit-test/ReconstructContextTest.h"
+
+#include "app-logic/GeometryUtils.h"
+#include "app-logic/ReconstructContext.h"
+#include "app-logic/ReconstructedFeatureGeometry.h"
+#include "app-logic/ReconstructionTreeCreator.h"
+#include "app-logic/ReconstructMethodInterface.h"
+#include "app-logic/ReconstructMethodRegistry.h"
+#include "app-logic/ReconstructParams.h"
+
+#include "maths/PointOnSphere.h"
+
+
+namespace
+{
+	/**
+	 * Bulk reconstructed points are rotated by a matrix instead of a quaternion so they
+	 * only agree with the reconstructed feature geometries to within numerical precision.
+	 */
+	const double MIN_POINT_DOT_PRODUCT = 1.0 - 1e-12;
+}
+
+
+GPlatesUnitTest::ReconstructContextTestSuite::ReconstructContextTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"ReconstructContextTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::ReconstructContextTestSuite::construct_maps()
+{
+	boost::shared_ptr<ReconstructContextTest> instance(
+		new ReconstructContextTest());
+
+	ADD_TESTCASE(ReconstructContextTest,test_bulk_reconstruction);
+}
+
+
+GPlatesUnitTest::ReconstructContextTest::ReconstructContextTest()
+{
+	d_rotation_feature_collections = d_test_data_files.load_files(
+			std::vector<QString>(1, "coreg_rotation.rot"));
+
+	std::vector<QString> reconstructable_filenames;
+	reconstructable_filenames.push_back("coreg_seed_points.gpml");
+	reconstructable_filenames.push_back("coreg_target.gpml");
+	d_reconstructable_feature_collections = d_test_data_files.load_files(reconstructable_filenames);
+}
+
+
+void
+GPlatesUnitTest::ReconstructContextTest::test_bulk_reconstruction()
+{
+	GPlatesAppLogic::ReconstructMethodRegistry reconstruct_method_registry;
+	GPlatesAppLogic::ReconstructContext reconstruct_context(reconstruct_method_registry);
+	reconstruct_context.set_features(d_reconstructable_feature_collections);
+
+	const GPlatesAppLogic::ReconstructContext::context_state_reference_type context_state =
+			reconstruct_context.create_context_state(
+					GPlatesAppLogic::ReconstructMethodInterface::Context(
+							GPlatesAppLogic::ReconstructParams(),
+							GPlatesAppLogic::create_cached_reconstruction_tree_creator(
+									d_rotation_feature_collections)));
+
+	for (double reconstruction_time = 0; reconstruction_time <= 100; reconstruction_time += 50)
+	{
+		std::vector<GPlatesAppLogic::ReconstructedFeatureGeometry::non_null_ptr_type> reconstructed_feature_geometries;
+		reconstruct_context.get_reconstructed_feature_geometries(
+				reconstructed_feature_geometries,
+				context_state,
+				reconstruction_time);
+
+		GPlatesAppLogic::ReconstructContext::BulkReconstruction bulk_reconstruction;
+		reconstruct_context.get_bulk_reconstruction(
+				bulk_reconstruction,
+				context_state,
+				reconstruction_time);
+
+		// Both reconstruct the features in the same order (and each feature's geometries in the same order).
+		BOOST_CHECK(!reconstructed_feature_geometries.empty());
+		BOOST_CHECK(bulk_reconstruction.geometries.size() == reconstructed_feature_geometries.size());
+
+		const unsigned int num_geometries =
+				(std::min)(bulk_reconstruction.geometries.size(), reconstructed_feature_geometries.size());
+		for (unsigned int geometry_index = 0; geometry_index < num_geometries; ++geometry_index)
+		{
+			const GPlatesAppLogic::ReconstructContext::BulkReconstruction::Geometry &bulk_geometry =
+					bulk_reconstruction.geometries[geometry_index];
+			const GPlatesAppLogic::ReconstructedFeatureGeometry &rfg =
+					*reconstructed_feature_geometries[geometry_index];
+
+			BOOST_CHECK(
+					bulk_geometry.reconstruction_plate_id ==
+						(rfg.reconstruction_plate_id() ? rfg.reconstruction_plate_id().get() : 0));
+
+			std::vector<GPlatesMaths::PointOnSphere> rfg_points;
+			BOOST_CHECK(
+					bulk_geometry.geometry_type ==
+						GPlatesAppLogic::GeometryUtils::get_geometry_points(*rfg.reconstructed_geometry(), rfg_points));
+
+			BOOST_CHECK(bulk_geometry.points_end - bulk_geometry.points_begin == rfg_points.size());
+			if (bulk_geometry.points_end - bulk_geometry.points_begin != rfg_points.size())
+			{
+				continue;
+			}
+
+			for (unsigned int point_index = 0; point_index < rfg_points.size(); ++point_index)
+			{
+				BOOST_CHECK(
+						dot(bulk_reconstruction.points[bulk_geometry.points_begin + point_index].position_vector(),
+								rfg_points[point_index].position_vector()).dval() > MIN_POINT_DOT_PRODUCT);
+			}
+		}
+	}
+}
@@ -0,0 +1,72 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UNIT_TEST_RECONSTRUCT_CONTEXT_TEST_H
+#define GPLATES_UNIT_TEST_RECONSTRUCT_CONTEXT_TEST_H
+
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#include "unit-test/GPlatesTestSuite.h"
+#include "unit-test/TestDataFiles.h"
+
+#include "model/FeatureCollectionHandle.h"
+
+
+namespace GPlatesUnitTest
+{
+	class ReconstructContextTest
+	{
+	public:
+		ReconstructContextTest();
+
+		/**
+		 * Checks that the bulk reconstruction matches the reconstructed feature geometries.
+		 */
+		void
+		test_bulk_reconstruction();
+
+	private:
+
+		TestDataFiles d_test_data_files;
+		std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> d_rotation_feature_collections;
+		std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> d_reconstructable_feature_collections;
+	};
+
+
+	class ReconstructContextTestSuite :
+		public GPlatesUnitTest::GPlatesTestSuite
+	{
+	public:
+		ReconstructContextTestSuite(
+				unsigned depth);
+
+	protected:
+		void
+		construct_maps();
+	};
+}
+
+#endif // GPLATES_UNIT_TEST_RECONSTRUCT_CONTEXT_TEST_H
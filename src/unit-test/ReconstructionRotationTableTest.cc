@@ -0,0 +1,298 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <boost/foreach.hpp>
+#include <boost/optional.hpp>
+#include <QString>
+
+#include "unit-test/ReconstructionRotationTableTest.h"
+
+#include "app-logic/PlateVelocityUtils.h"
+#include "app-logic/ReconstructionGraph.h"
+#include "app-logic/ReconstructionRotationTable.h"
+#include "app-logic/ReconstructionTree.h"
+#include "app-logic/ReconstructionTreeCreator.h"
+
+#include "maths/FiniteRotation.h"
+#include "maths/UnitQuaternion3D.h"
+
+#include "model/types.h"
+
+
+namespace
+{
+	/**
+	 * The number of (evenly spaced) reconstruction times - a prime number so that stepping through
+	 * them with a stride visits each time once (in an unsorted order).
+	 */
+	const unsigned int NUM_RECONSTRUCTION_TIMES = 1601;
+	const unsigned int RECONSTRUCTION_TIME_STRIDE = 7919;
+
+	/**
+	 * The spacing of reconstruction times.
+	 *
+	 * It's exactly representable so that times land exactly on the rotation pole times
+	 * (and hence on the boundaries of the time ranges of total reconstruction sequences).
+	 */
+	const double RECONSTRUCTION_TIME_SPACING = 0.25;
+
+	/**
+	 * Table rotations are composed in a different order than tree rotations so they
+	 * only agree to within numerical precision.
+	 */
+	const double MIN_QUATERNION_DOT_PRODUCT = 1.0 - 1e-12;
+
+
+	/**
+	 * Returns true if @a rotation1 and @a rotation2 are both none, or are the same rotation.
+	 */
+	bool
+	are_rotations_equivalent(
+			const boost::optional<GPlatesMaths::FiniteRotation> &rotation1,
+			const boost::optional<GPlatesMaths::FiniteRotation> &rotation2)
+	{
+		if (!rotation1 || !rotation2)
+		{
+			return !rotation1 && !rotation2;
+		}
+
+		// Quaternions 'q' and '-q' represent the same rotation.
+		return std::fabs(dot(rotation1->unit_quat(), rotation2->unit_quat()).dval()) >
+				MIN_QUATERNION_DOT_PRODUCT;
+	}
+}
+
+
+GPlatesUnitTest::ReconstructionRotationTableTestSuite::ReconstructionRotationTableTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"ReconstructionRotationTableTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::ReconstructionRotationTableTestSuite::construct_maps()
+{
+	boost::shared_ptr<ReconstructionRotationTableTest> instance(
+		new ReconstructionRotationTableTest());
+
+	ADD_TESTCASE(ReconstructionRotationTableTest,test_rotations_match_reconstruction_trees);
+	ADD_TESTCASE(ReconstructionRotationTableTest,test_reconstruction_time_index);
+	ADD_TESTCASE(ReconstructionRotationTableTest,test_stage_rotations_match_reconstruction_trees);
+}
+
+
+GPlatesUnitTest::ReconstructionRotationTableTest::ReconstructionRotationTableTest()
+{
+	d_rotation_feature_collections = d_test_data_files.load_files(
+			std::vector<QString>(1, "coreg_rotation.rot"));
+
+	// The plates in the rotation file (and one that isn't).
+	d_plate_ids.push_back(0);
+	d_plate_ids.push_back(1);
+	d_plate_ids.push_back(101);
+	d_plate_ids.push_back(102);
+	d_plate_ids.push_back(103);
+	d_plate_ids.push_back(104);
+	d_plate_ids.push_back(999);
+	d_plate_ids.push_back(500);
+
+	// Times from present day to beyond the oldest rotation pole (300Ma) in an unsorted order.
+	for (unsigned int n = 0; n < NUM_RECONSTRUCTION_TIMES; ++n)
+	{
+		const unsigned int time_step = (n * RECONSTRUCTION_TIME_STRIDE) % NUM_RECONSTRUCTION_TIMES;
+		d_reconstruction_times.push_back(time_step * RECONSTRUCTION_TIME_SPACING);
+	}
+
+	// Some duplicate times (including rotation pole times).
+	d_reconstruction_times.push_back(0.0);
+	d_reconstruction_times.push_back(20.0);
+	d_reconstruction_times.push_back(40.0);
+	d_reconstruction_times.push_back(300.0);
+	d_reconstruction_times.push_back(20.0);
+}
+
+
+void
+GPlatesUnitTest::ReconstructionRotationTableTest::test_rotations_match_reconstruction_trees()
+{
+	const GPlatesAppLogic::ReconstructionTreeCreator reconstruction_tree_creator =
+			GPlatesAppLogic::create_cached_reconstruction_tree_creator(d_rotation_feature_collections);
+	const GPlatesAppLogic::ReconstructionGraph::non_null_ptr_to_const_type reconstruction_graph =
+			reconstruction_tree_creator.get_reconstruction_tree(0)->get_reconstruction_graph();
+
+	// Anchoring to a non-zero plate reverses tree edges (which can also have limited time ranges).
+	std::vector<GPlatesModel::integer_plate_id_type> anchor_plate_ids;
+	anchor_plate_ids.push_back(0);
+	anchor_plate_ids.push_back(102);
+	anchor_plate_ids.push_back(104);
+
+	BOOST_FOREACH(GPlatesModel::integer_plate_id_type anchor_plate_id, anchor_plate_ids)
+	{
+		const GPlatesAppLogic::ReconstructionRotationTable::non_null_ptr_to_const_type rotation_table =
+				GPlatesAppLogic::ReconstructionRotationTable::create(
+						reconstruction_graph,
+						d_reconstruction_times,
+						anchor_plate_id);
+
+		BOOST_CHECK(rotation_table->get_anchor_plate_id() == anchor_plate_id);
+		BOOST_CHECK(rotation_table->get_reconstruction_times() == d_reconstruction_times);
+
+		for (unsigned int time_index = 0; time_index < d_reconstruction_times.size(); ++time_index)
+		{
+			const GPlatesAppLogic::ReconstructionTree::non_null_ptr_to_const_type reconstruction_tree =
+					GPlatesAppLogic::ReconstructionTree::create(
+							reconstruction_graph,
+							d_reconstruction_times[time_index],
+							anchor_plate_id);
+
+			BOOST_FOREACH(GPlatesModel::integer_plate_id_type plate_id, d_plate_ids)
+			{
+				// The table returns the identity rotation for the anchor plate (but the tree returns none).
+				if (plate_id == anchor_plate_id)
+				{
+					continue;
+				}
+
+				BOOST_CHECK(
+						are_rotations_equivalent(
+								rotation_table->get_composed_absolute_rotation_or_none(time_index, plate_id),
+								reconstruction_tree->get_composed_absolute_rotation_or_none(plate_id)));
+			}
+		}
+	}
+}
+
+
+void
+GPlatesUnitTest::ReconstructionRotationTableTest::test_reconstruction_time_index()
+{
+	const GPlatesAppLogic::ReconstructionRotationTable::non_null_ptr_to_const_type rotation_table =
+			GPlatesAppLogic::ReconstructionRotationTable::create(
+					GPlatesAppLogic::create_cached_reconstruction_tree_creator(d_rotation_feature_collections),
+					d_reconstruction_times);
+
+	for (unsigned int time_index = 0; time_index < d_reconstruction_times.size(); ++time_index)
+	{
+		// Duplicate times can return the index of any of the duplicates.
+		const boost::optional<unsigned int> found_time_index =
+				rotation_table->get_reconstruction_time_index(d_reconstruction_times[time_index]);
+		BOOST_CHECK(found_time_index);
+		if (found_time_index)
+		{
+			BOOST_CHECK(d_reconstruction_times[found_time_index.get()] == d_reconstruction_times[time_index]);
+		}
+
+		// Times half way between the (evenly spaced) reconstruction times are not in the table.
+		BOOST_CHECK(
+				!rotation_table->get_reconstruction_time_index(
+						d_reconstruction_times[time_index] + 0.5 * RECONSTRUCTION_TIME_SPACING));
+	}
+
+	BOOST_CHECK(!rotation_table->get_reconstruction_time_index(-RECONSTRUCTION_TIME_SPACING));
+}
+
+
+void
+GPlatesUnitTest::ReconstructionRotationTableTest::test_stage_rotations_match_reconstruction_trees()
+{
+	const GPlatesAppLogic::ReconstructionTreeCreator reconstruction_tree_creator =
+			GPlatesAppLogic::create_cached_reconstruction_tree_creator(d_rotation_feature_collections);
+
+	const double velocity_delta_time = 1.0;
+
+	// Times near present day (where the delta time interval can extend into negative times)
+	// and beyond the oldest rotation pole (300Ma).
+	std::vector<double> reconstruction_times;
+	reconstruction_times.push_back(0.0);
+	reconstruction_times.push_back(0.5);
+	reconstruction_times.push_back(20.0);
+	reconstruction_times.push_back(40.0);
+	reconstruction_times.push_back(299.5);
+	reconstruction_times.push_back(300.0);
+
+	std::vector<GPlatesAppLogic::VelocityDeltaTime::Type> velocity_delta_time_types;
+	velocity_delta_time_types.push_back(GPlatesAppLogic::VelocityDeltaTime::T_PLUS_DELTA_T_TO_T);
+	velocity_delta_time_types.push_back(GPlatesAppLogic::VelocityDeltaTime::T_TO_T_MINUS_DELTA_T);
+	velocity_delta_time_types.push_back(GPlatesAppLogic::VelocityDeltaTime::T_PLUS_MINUS_HALF_DELTA_T);
+
+	BOOST_FOREACH(GPlatesAppLogic::VelocityDeltaTime::Type velocity_delta_time_type, velocity_delta_time_types)
+	{
+		// A table with all the times needed by the stage rotations.
+		std::vector<double> stage_rotation_times;
+		BOOST_FOREACH(const double &reconstruction_time, reconstruction_times)
+		{
+			GPlatesAppLogic::PlateVelocityUtils::get_stage_rotation_times(
+					stage_rotation_times,
+					reconstruction_time,
+					velocity_delta_time,
+					velocity_delta_time_type);
+		}
+		const GPlatesAppLogic::ReconstructionRotationTable::non_null_ptr_to_const_type full_rotation_table =
+				GPlatesAppLogic::ReconstructionRotationTable::create(reconstruction_tree_creator, stage_rotation_times);
+
+		// A table with only the reconstruction times (the other times fall back to reconstruction trees).
+		const GPlatesAppLogic::ReconstructionRotationTable::non_null_ptr_to_const_type partial_rotation_table =
+				GPlatesAppLogic::ReconstructionRotationTable::create(reconstruction_tree_creator, reconstruction_times);
+
+		BOOST_FOREACH(const double &reconstruction_time, reconstruction_times)
+		{
+			BOOST_FOREACH(GPlatesModel::integer_plate_id_type plate_id, d_plate_ids)
+			{
+				const GPlatesMaths::FiniteRotation tree_stage_rotation =
+						GPlatesAppLogic::PlateVelocityUtils::calculate_stage_rotation(
+								plate_id,
+								reconstruction_tree_creator,
+								reconstruction_time,
+								velocity_delta_time,
+								velocity_delta_time_type);
+
+				BOOST_CHECK(
+						are_rotations_equivalent(
+								GPlatesAppLogic::PlateVelocityUtils::calculate_stage_rotation(
+										plate_id,
+										*full_rotation_table,
+										reconstruction_tree_creator,
+										reconstruction_time,
+										velocity_delta_time,
+										velocity_delta_time_type),
+								tree_stage_rotation));
+				BOOST_CHECK(
+						are_rotations_equivalent(
+								GPlatesAppLogic::PlateVelocityUtils::calculate_stage_rotation(
+										plate_id,
+										*partial_rotation_table,
+										reconstruction_tree_creator,
+										reconstruction_time,
+										velocity_delta_time,
+										velocity_delta_time_type),
+								tree_stage_rotation));
+			}
+		}
+	}
+}
@@ -0,0 +1,96 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UNIT_TEST_RECONSTRUCTION_ROTATION_TABLE_TEST_H
+#define GPLATES_UNIT_TEST_RECONSTRUCTION_ROTATION_TABLE_TEST_H
+
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#include "unit-test/GPlatesTestSuite.h"
+#include "unit-test/TestDataFiles.h"
+
+#include "model/FeatureCollectionHandle.h"
+#include "model/types.h"
+
+
+namespace GPlatesUnitTest
+{
+	class ReconstructionRotationTableTest
+	{
+	public:
+		ReconstructionRotationTableTest();
+
+		/**
+		 * Checks that the rotations in the table match those of reconstruction trees created
+		 * separately at each reconstruction time (for several anchor plates).
+		 */
+		void
+		test_rotations_match_reconstruction_trees();
+
+		/**
+		 * Checks that reconstruction times are found (and only those times).
+		 */
+		void
+		test_reconstruction_time_index();
+
+		/**
+		 * Checks that stage rotations calculated from a table match those calculated from
+		 * reconstruction trees, including when the table is missing some of the times needed.
+		 */
+		void
+		test_stage_rotations_match_reconstruction_trees();
+
+	private:
+
+		TestDataFiles d_test_data_files;
+		std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> d_rotation_feature_collections;
+
+		/**
+		 * The plates in the rotation file (and one that isn't).
+		 */
+		std::vector<GPlatesModel::integer_plate_id_type> d_plate_ids;
+
+		/**
+		 * Unsorted reconstruction times (including duplicates and the times of rotation poles).
+		 */
+		std::vector<double> d_reconstruction_times;
+	};
+
+
+	class ReconstructionRotationTableTestSuite :
+		public GPlatesUnitTest::GPlatesTestSuite
+	{
+	public:
+		ReconstructionRotationTableTestSuite(
+				unsigned depth);
+
+	protected:
+		void
+		construct_maps();
+	};
+}
+
+#endif // GPLATES_UNIT_TEST_RECONSTRUCTION_ROTATION_TABLE_TEST_H
@@ -0,0 +1,158 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "unit-test/RotationMatrixTest.h"
+
+#include "maths/FiniteRotation.h"
+#include "maths/LatLonPoint.h"
+#include "maths/MathsUtils.h"
+#include "maths/PointOnSphere.h"
+#include "maths/RotationMatrix.h"
+#include "maths/UnitVector3D.h"
+#include "maths/Vector3D.h"
+
+
+namespace
+{
+	/**
+	 * The matrix and quaternion rotations differ only by numerical round-off.
+	 */
+	const double MIN_DOT_PRODUCT = 1.0 - 1e-12;
+
+	const unsigned int NUM_ROTATIONS = 20;
+
+	/**
+	 * More than one block of the batch kernel (and not a multiple of the block size).
+	 */
+	const unsigned int NUM_POINTS = 1000;
+
+
+	/**
+	 * Returns a random point uniformly distributed on the sphere.
+	 */
+	const GPlatesMaths::PointOnSphere
+	create_random_point(
+			std::mt19937 &random_number_generator)
+	{
+		std::uniform_real_distribution<double> sin_latitude(-1.0, 1.0);
+		std::uniform_real_distribution<double> longitude(-180.0, 180.0);
+
+		return GPlatesMaths::make_point_on_sphere(
+				GPlatesMaths::LatLonPoint(
+						GPlatesMaths::convert_rad_to_deg(std::asin(sin_latitude(random_number_generator))),
+						longitude(random_number_generator)));
+	}
+
+
+	bool
+	are_close(
+			const GPlatesMaths::UnitVector3D &u1,
+			const GPlatesMaths::UnitVector3D &u2)
+	{
+		return dot(u1, u2).dval() > MIN_DOT_PRODUCT;
+	}
+}
+
+
+GPlatesUnitTest::RotationMatrixTestSuite::RotationMatrixTestSuite(
+		unsigned level) :
+	GPlatesUnitTest::GPlatesTestSuite(
+			"RotationMatrixTestSuite")
+{
+	init(level);
+}
+
+
+void
+GPlatesUnitTest::RotationMatrixTestSuite::construct_maps()
+{
+	boost::shared_ptr<RotationMatrixTest> instance(
+		new RotationMatrixTest());
+
+	ADD_TESTCASE(RotationMatrixTest,test_rotate_matches_finite_rotation);
+}
+
+
+void
+GPlatesUnitTest::RotationMatrixTest::test_rotate_matches_finite_rotation()
+{
+	// Use a fixed seed so that any failure is reproducible.
+	std::mt19937 random_number_generator(12345);
+	std::uniform_real_distribution<double> rotation_angle(-180.0, 180.0);
+
+	for (unsigned int rotation_index = 0; rotation_index < NUM_ROTATIONS; ++rotation_index)
+	{
+		const GPlatesMaths::FiniteRotation finite_rotation = GPlatesMaths::FiniteRotation::create(
+				create_random_point(random_number_generator),
+				GPlatesMaths::convert_deg_to_rad(rotation_angle(random_number_generator)));
+		const GPlatesMaths::RotationMatrix rotation_matrix(finite_rotation);
+
+		std::vector<GPlatesMaths::UnitVector3D> unit_vectors;
+		std::vector<GPlatesMaths::PointOnSphere> points;
+		for (unsigned int point_index = 0; point_index < NUM_POINTS; ++point_index)
+		{
+			const GPlatesMaths::PointOnSphere point = create_random_point(random_number_generator);
+			unit_vectors.push_back(point.position_vector());
+			points.push_back(point);
+		}
+
+		// Rotate in batches.
+		std::vector<GPlatesMaths::UnitVector3D> rotated_unit_vectors;
+		rotation_matrix.rotate(rotated_unit_vectors, unit_vectors);
+		BOOST_CHECK(rotated_unit_vectors.size() == NUM_POINTS);
+
+		// Rotate points in batches (before the points are rotated in place below).
+		std::vector<GPlatesMaths::PointOnSphere> rotated_points;
+		rotation_matrix.rotate(rotated_points, points);
+		BOOST_CHECK(rotated_points.size() == NUM_POINTS);
+
+		// Rotate in place.
+		rotation_matrix.rotate(points.begin(), points.end());
+
+		for (unsigned int point_index = 0;
+			point_index < NUM_POINTS &&
+				point_index < rotated_unit_vectors.size() &&
+				point_index < rotated_points.size();
+			++point_index)
+		{
+			const GPlatesMaths::UnitVector3D &unit_vector = unit_vectors[point_index];
+			const GPlatesMaths::UnitVector3D expected_rotated_unit_vector = finite_rotation * unit_vector;
+
+			// Rotate one at a time (both the unit vector and non-unit vector overloads).
+			BOOST_CHECK(are_close(rotation_matrix * unit_vector, expected_rotated_unit_vector));
+			BOOST_CHECK(are_close(
+					(rotation_matrix * GPlatesMaths::Vector3D(unit_vector)).get_normalisation(),
+					expected_rotated_unit_vector));
+
+			BOOST_CHECK(are_close(rotated_unit_vectors[point_index], expected_rotated_unit_vector));
+			BOOST_CHECK(are_close(rotated_points[point_index].position_vector(), expected_rotated_unit_vector));
+			BOOST_CHECK(are_close(points[point_index].position_vector(), expected_rotated_unit_vector));
+		}
+	}
+}
@@ -0,0 +1,77 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <boost/foreach.hpp>
+
+#include "unit-test/TestDataFiles.h"
+
+#include "file-io/FileInfo.h"
+#include "file-io/ReadErrorAccumulation.h"
+
+
+namespace
+{
+	const QString UNIT_TEST_DATA_PATH = "./unit-test-data/";
+}
+
+
+QString
+GPlatesUnitTest::TestDataFiles::get_file_path(
+		const QString &filename)
+{
+	return UNIT_TEST_DATA_PATH + filename;
+}
+
+
+GPlatesFileIO::File::non_null_ptr_type
+GPlatesUnitTest::TestDataFiles::load_file(
+		const QString &filename)
+{
+	GPlatesFileIO::File::non_null_ptr_type file =
+			GPlatesFileIO::File::create_file(GPlatesFileIO::FileInfo(get_file_path(filename)));
+
+	GPlatesFileIO::ReadErrorAccumulation read_errors;
+	d_file_format_registry.read_feature_collection(file->get_reference(), read_errors);
+
+	d_loaded_files.push_back(file);
+
+	return file;
+}
+
+
+std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref>
+GPlatesUnitTest::TestDataFiles::load_files(
+		const std::vector<QString> &filenames)
+{
+	std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref> feature_collections;
+
+	BOOST_FOREACH(const QString &filename, filenames)
+	{
+		feature_collections.push_back(
+				load_file(filename)->get_reference().get_feature_collection());
+	}
+
+	return feature_collections;
+}
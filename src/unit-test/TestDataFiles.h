@@ -0,0 +1,90 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UNIT_TEST_TEST_DATA_FILES_H
+#define GPLATES_UNIT_TEST_TEST_DATA_FILES_H
+
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <QString>
+
+#include "file-io/FeatureCollectionFileFormatRegistry.h"
+#include "file-io/File.h"
+
+#include "model/FeatureCollectionHandle.h"
+
+
+namespace GPlatesUnitTest
+{
+	/**
+	 * Loads feature collection files from the unit test data directory, and keeps them loaded
+	 * for the lifetime of this object.
+	 */
+	class TestDataFiles :
+			private boost::noncopyable
+	{
+	public:
+
+		/**
+		 * Returns the path of the file @a filename in the unit test data directory.
+		 */
+		static
+		QString
+		get_file_path(
+				const QString &filename);
+
+
+		/**
+		 * Loads the feature collection in the file @a filename (relative to the unit test data directory).
+		 */
+		GPlatesFileIO::File::non_null_ptr_type
+		load_file(
+				const QString &filename);
+
+		/**
+		 * Loads the feature collections in the files @a filenames (relative to the unit test data directory).
+		 */
+		std::vector<GPlatesModel::FeatureCollectionHandle::weak_ref>
+		load_files(
+				const std::vector<QString> &filenames);
+
+
+		/**
+		 * The registry used to read the files (it can also be used to read/write other files).
+		 */
+		GPlatesFileIO::FeatureCollectionFileFormat::Registry &
+		get_file_format_registry()
+		{
+			return d_file_format_registry;
+		}
+
+	private:
+
+		GPlatesFileIO::FeatureCollectionFileFormat::Registry d_file_format_registry;
+		std::vector<GPlatesFileIO::File::non_null_ptr_type> d_loaded_files;
+	};
+}
+
+#endif // GPLATES_UNIT_TEST_TEST_DATA_FILES_H
@@ -65,7 +65,10 @@ GPlatesUtils::IdStringSet::SharedIterator::increment_ref_count()
 		// This instance is uninitialised.
 		return;
 	}
-	++(d_iter->d_ref_count);
+
+	// No locking needed since we're copying an existing reference (or we're in 'insert' or
+	// 'contains' where the mutex is already locked) so the element cannot be removed.
+	d_iter->d_ref_count.fetch_add(1, std::memory_order_relaxed);
 }
 
 
@@ -77,7 +80,23 @@ GPlatesUtils::IdStringSet::SharedIterator::decrement_ref_count()
 		// This instance is uninitialised.
 		return;
 	}
-	if (--(d_iter->d_ref_count) == 0)
+
+	// Release a reference that is not the last one without locking.
+	long ref_count = d_iter->d_ref_count.load(std::memory_order_relaxed);
+	while (ref_count > 1)
+	{
+		if (d_iter->d_ref_count.compare_exchange_weak(
+				ref_count, ref_count - 1,
+				std::memory_order_acq_rel, std::memory_order_relaxed))
+		{
+			return;
+		}
+	}
+
+	// We might hold the last reference so decrement with the mutex locked, otherwise 'insert'
+	// or 'contains' could find the element while we're removing it.
+	boost::lock_guard<boost::mutex> lock(d_impl_ptr->mutex());
+	if (d_iter->d_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
 	{
 		// There are no more references to the element in the set.
 		d_impl_ptr->collection().erase(d_iter);
@@ -90,6 +109,8 @@ GPlatesUtils::IdStringSet::contains(
 		const GPlatesUtils::UnicodeString &s) const
 {
 	UnicodeStringAndRefCountWithBackRef elem(s);
+
+	boost::lock_guard<boost::mutex> lock(d_impl->mutex());
 	collection_type::iterator iter = d_impl->collection().find(elem);
 	if (iter != d_impl->collection().end())
 	{
@@ -109,6 +130,8 @@ GPlatesUtils::IdStringSet::insert(
 		const GPlatesUtils::UnicodeString &s)
 {
 	UnicodeStringAndRefCountWithBackRef elem(s);
+
+	boost::lock_guard<boost::mutex> lock(d_impl->mutex());
 	collection_type::iterator iter = d_impl->collection().find(elem);
 	if (iter != d_impl->collection().end())
 	{
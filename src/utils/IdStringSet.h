@@ -33,10 +33,13 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <set>
 #include <boost/intrusive_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/optional.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "SmartNodeLinkedList.h"
 #include "ReferenceCount.h"
@@ -79,6 +82,9 @@ namespace GPlatesUtils
 	 * Further, it is assumed that in general, most (if not all) IDs will have one back-ref. 
 	 * As a result, the classes below (particularly class UnicodeStringAndRefCountWithBackRef)
 	 * were optimised for the presence of back-references.
+	 *
+	 * Like StringSet, this class is safe to access concurrently.  In addition, the back-reference
+	 * lists must only be accessed with the mutex returned by SharedIterator::back_refs_mutex locked.
 	 */
 	class IdStringSet
 	{
@@ -116,7 +122,7 @@ namespace GPlatesUtils
 		struct UnicodeStringAndRefCountWithBackRef
 		{
 			GPlatesUtils::UnicodeString d_str;
-			mutable long d_ref_count;
+			mutable std::atomic<long> d_ref_count;
 			mutable back_ref_list_type d_back_refs;
 
 			/**
@@ -204,8 +210,28 @@ namespace GPlatesUtils
 				return d_collection;
 			}
 
+			/**
+			 * The mutex that must be locked while searching or modifying the collection.
+			 */
+			boost::mutex &
+			mutex()
+			{
+				return d_mutex;
+			}
+
+			/**
+			 * The mutex that must be locked while accessing the back-reference lists.
+			 */
+			boost::mutex &
+			back_refs_mutex()
+			{
+				return d_back_refs_mutex;
+			}
+
 		private:
 			IdStringSet::collection_type d_collection;
+			boost::mutex d_mutex;
+			boost::mutex d_back_refs_mutex;
 
 			// This constructor should not be public, because we don't want to allow
 			// instantiation of this type on the stack.
@@ -426,6 +452,17 @@ namespace GPlatesUtils
 				return d_iter->d_back_refs;
 			}
 
+			/**
+			 * The mutex that must be locked while accessing @a back_refs.
+			 *
+			 * Note that this instance must be initialised.
+			 */
+			boost::mutex &
+			back_refs_mutex() const
+			{
+				return d_impl_ptr->back_refs_mutex();
+			}
+
 			/**
 			 * Swap the internals of this instance with @a other.
 			 *
@@ -595,6 +632,7 @@ namespace GPlatesUtils
 		size_type
 		size() const
 		{
+			boost::lock_guard<boost::mutex> lock(d_impl->mutex());
 			return d_impl->collection().size();
 		}
 
@@ -0,0 +1,90 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "ParallelUtils.h"
+
+
+namespace GPlatesUtils
+{
+	namespace ParallelUtils
+	{
+		namespace
+		{
+			/**
+			 * The number of worker threads requested by the user (zero means number of hardware threads).
+			 */
+			std::atomic<unsigned int> s_num_worker_threads(0);
+
+			/**
+			 * Whether the current thread is running a task of 'parallel_for()'.
+			 */
+			thread_local bool t_in_parallel_task = false;
+		}
+	}
+}
+
+
+unsigned int
+GPlatesUtils::ParallelUtils::get_num_worker_threads()
+{
+	const unsigned int num_worker_threads = s_num_worker_threads;
+	if (num_worker_threads != 0)
+	{
+		return num_worker_threads;
+	}
+
+	// Note that this can return zero if it cannot be determined.
+	const unsigned int num_hardware_threads = boost::thread::hardware_concurrency();
+
+	return (num_hardware_threads != 0) ? num_hardware_threads : 1;
+}
+
+
+void
+GPlatesUtils::ParallelUtils::set_num_worker_threads(
+		unsigned int num_worker_threads)
+{
+	s_num_worker_threads = num_worker_threads;
+}
+
+
+bool
+GPlatesUtils::ParallelUtils::is_in_parallel_task()
+{
+	return t_in_parallel_task;
+}
+
+
+GPlatesUtils::ParallelUtils::Implementation::ParallelTaskScope::ParallelTaskScope() :
+	d_was_in_parallel_task(t_in_parallel_task)
+{
+	t_in_parallel_task = true;
+}
+
+
+GPlatesUtils::ParallelUtils::Implementation::ParallelTaskScope::~ParallelTaskScope()
+{
+	t_in_parallel_task = d_was_in_parallel_task;
+}
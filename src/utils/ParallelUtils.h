@@ -0,0 +1,233 @@
+/* $Id$ */
+
+/**
+ * \file
+ * $Revision$
+ * $Date$
+ *
+ * Copyright (C) 2026 The University of Sydney, Australia
+ *
+ * This file is part of GPlates.
+ *
+ * GPlates is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License, version 2, as published by
+ * the Free Software Foundation.
+ *
+ * GPlates is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef GPLATES_UTILS_PARALLELUTILS_H
+#define GPLATES_UTILS_PARALLELUTILS_H
+
+#include <atomic>
+#include <exception>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+
+namespace GPlatesUtils
+{
+	/**
+	 * Utilities for running independent tasks on multiple threads.
+	 */
+	namespace ParallelUtils
+	{
+		/**
+		 * Returns the number of threads used by parallel algorithms (such as @a parallel_for).
+		 *
+		 * This is a global setting shared by the GPlates application (via its user preferences)
+		 * and the Python API. If it has not been set (or was set to zero) then it is the number of
+		 * hardware threads (processor cores) available.
+		 *
+		 * This is always at least one.
+		 */
+		unsigned int
+		get_num_worker_threads();
+
+
+		/**
+		 * Sets the number of threads used by parallel algorithms.
+		 *
+		 * A value of zero means use the number of hardware threads (processor cores) available.
+		 * A value of one means run tasks serially on the calling thread.
+		 */
+		void
+		set_num_worker_threads(
+				unsigned int num_worker_threads);
+
+
+		/**
+		 * Returns true if the calling thread is currently executing a task of @a parallel_for.
+		 */
+		bool
+		is_in_parallel_task();
+
+
+		/**
+		 * Calls @a task_function with each task index in the range [0, @a num_tasks) using up to
+		 * @a num_threads threads (including the calling thread).
+		 *
+		 * @a task_function must have the signature 'void (unsigned int task_index)' and it must be
+		 * safe to call it concurrently with different task indices.
+		 *
+		 * Tasks are handed out to the threads in task index order as each thread finishes its previous
+		 * task, so tasks of uneven duration are balanced across the threads.
+		 *
+		 * If any task throws an exception then no further tasks are started and, once all threads have
+		 * finished, the first exception thrown is re-thrown in the calling thread.
+		 *
+		 * If some threads cannot be started (eg, due to a system limit) then the tasks are run by the
+		 * threads that were started (which always includes the calling thread).
+		 *
+		 * Tasks are run serially on the calling thread if there's only one task or one thread, or if the
+		 * calling thread is itself running a task of an outer @a parallel_for (to avoid creating more
+		 * threads than there are processor cores).
+		 */
+		template <typename TaskFunctionType>
+		void
+		parallel_for(
+				unsigned int num_tasks,
+				const TaskFunctionType &task_function,
+				unsigned int num_threads = get_num_worker_threads());
+
+
+		namespace Implementation
+		{
+			/**
+			 * Marks the calling thread as running parallel tasks for the lifetime of this object.
+			 */
+			class ParallelTaskScope
+			{
+			public:
+				ParallelTaskScope();
+				~ParallelTaskScope();
+
+			private:
+				bool d_was_in_parallel_task;
+			};
+
+
+			template <typename TaskFunctionType>
+			void
+			run_parallel_tasks(
+					std::atomic<unsigned int> &next_task_index,
+					const unsigned int num_tasks,
+					const TaskFunctionType &task_function,
+					std::exception_ptr &first_exception,
+					boost::mutex &first_exception_mutex)
+			{
+				ParallelTaskScope parallel_task_scope;
+
+				try
+				{
+					for (unsigned int task_index = next_task_index++;
+						task_index < num_tasks;
+						task_index = next_task_index++)
+					{
+						task_function(task_index);
+					}
+				}
+				catch (...)
+				{
+					// Stop the other threads from starting any more tasks.
+					next_task_index = num_tasks;
+
+					boost::mutex::scoped_lock first_exception_lock(first_exception_mutex);
+					if (!first_exception)
+					{
+						first_exception = std::current_exception();
+					}
+				}
+			}
+		}
+
+
+		////////////////////
+		// Implementation //
+		////////////////////
+
+
+		template <typename TaskFunctionType>
+		void
+		parallel_for(
+				unsigned int num_tasks,
+				const TaskFunctionType &task_function,
+				unsigned int num_threads)
+		{
+			if (num_threads > num_tasks)
+			{
+				num_threads = num_tasks;
+			}
+
+			if (num_threads <= 1 ||
+				is_in_parallel_task())
+			{
+				for (unsigned int task_index = 0; task_index < num_tasks; ++task_index)
+				{
+					task_function(task_index);
+				}
+
+				return;
+			}
+
+			std::atomic<unsigned int> next_task_index(0);
+			std::exception_ptr first_exception;
+			boost::mutex first_exception_mutex;
+
+			// The calling thread is one of the threads so start one less.
+			std::vector<boost::thread> threads;
+			threads.reserve(num_threads - 1);
+			try
+			{
+				for (unsigned int thread_index = 1; thread_index < num_threads; ++thread_index)
+				{
+					threads.push_back(
+							boost::thread(
+									[&]()
+									{
+										Implementation::run_parallel_tasks(
+												next_task_index,
+												num_tasks,
+												task_function,
+												first_exception,
+												first_exception_mutex);
+									}));
+				}
+			}
+			catch (...)
+			{
+				// Unable to start another thread (eg, the system's thread limit has been reached).
+				// Continue with the threads already started (the calling thread runs tasks too).
+				// Note that the started threads must be joined before 'threads' is destroyed
+				// (destroying a joinable thread terminates the program), which happens below.
+			}
+
+			Implementation::run_parallel_tasks(
+					next_task_index,
+					num_tasks,
+					task_function,
+					first_exception,
+					first_exception_mutex);
+
+			for (boost::thread &thread : threads)
+			{
+				thread.join();
+			}
+
+			if (first_exception)
+			{
+				std::rethrow_exception(first_exception);
+			}
+		}
+	}
+}
+
+#endif // GPLATES_UTILS_PARALLELUTILS_H
@@ -28,7 +28,10 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/operators.hpp>
 #include <boost/bind/bind.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
 
+#include <chrono>
 #include <stack>
 #include <vector>
 #include <string>
@@ -41,6 +44,7 @@
 #include <iomanip>
 #include <numeric>
 #include <functional>
+#include <QDebug>
 
 #if defined(_WIN32)
 // Note: Prevent windows.h from defining min/max macros since these
@@ -1437,6 +1441,29 @@ namespace
 	const ticks_t g_ticks_taken_in_get_ticks_call = calc_ticks_taken_in_get_ticks_call();
 
 
+	/**
+	 * The call-graph profile is only recorded on the main thread (the thread that initialises
+	 * static data) since @a ProfileManager is not thread-safe.
+	 *
+	 * Profiled code running on other threads is only recorded as trace events.
+	 */
+	const boost::thread::id g_call_graph_thread_id = boost::this_thread::get_id();
+
+	inline
+	bool
+	is_call_graph_thread()
+	{
+		return boost::this_thread::get_id() == g_call_graph_thread_id;
+	}
+
+	/**
+	 * Protects the profile graph when looking up profile caches.
+	 *
+	 * Profile caches are looked up once per profiled section of code, which can happen on any thread.
+	 */
+	boost::mutex g_profile_cache_mutex;
+
+
 	/**
 	 * Used to set global variable when inside a PROFILE API function.
 	 * Used to determine when to profile memory allocation - memory allocations
@@ -1592,6 +1619,8 @@ namespace GPlatesUtils
 	profile_get_cache(
 			const char *profile_name)
 	{
+		boost::mutex::scoped_lock profile_cache_lock(g_profile_cache_mutex);
+
 		ProfileApiGuard profile_api_guard;
 
 		return ProfileManager::instance().get_profile_cache(profile_name);
@@ -1601,6 +1630,11 @@ namespace GPlatesUtils
 	profile_begin(
 			void *profile_cache)
 	{
+		if (!is_call_graph_thread())
+		{
+			return;
+		}
+
 		ProfileApiGuard profile_api_guard;
 
 		ticks_t suspend_parent_ticks = get_ticks();
@@ -1622,6 +1656,11 @@ namespace GPlatesUtils
 	void
 	profile_end()
 	{
+		if (!is_call_graph_thread())
+		{
+			return;
+		}
+
 		ProfileApiGuard profile_api_guard;
 
 		ticks_t stop_ticks = get_ticks();
@@ -1674,3 +1713,281 @@ namespace GPlatesUtils
 		profile_report_to_ostream(output_file);
 	}
 }
+
+
+namespace
+{
+	/**
+	 * A completed trace event.
+	 */
+	struct TraceEvent
+	{
+		TraceEvent(
+				const char *name_,
+				boost::uint64_t start_time_,
+				boost::uint64_t duration_) :
+			name(name_),
+			start_time(start_time_),
+			duration(duration_)
+		{  }
+
+		const char *name;
+		boost::uint64_t start_time;  //!< Nanoseconds.
+		boost::uint64_t duration;    //!< Nanoseconds.
+	};
+
+
+	/**
+	 * The trace events recorded by a single thread.
+	 *
+	 * The mutex is only contended when the events are being cleared or written
+	 * (by another thread) while this thread is recording.
+	 */
+	struct ThreadTraceBuffer
+	{
+		explicit
+		ThreadTraceBuffer(
+				unsigned int thread_index_) :
+			thread_index(thread_index_),
+			num_dropped_events(0)
+		{  }
+
+		/**
+		 * Limit the memory used by each thread (each event is 24 bytes) in case tracing
+		 * is left enabled for a long time.
+		 */
+		static const std::size_t MAX_NUM_EVENTS = 4 * 1024 * 1024;
+
+		boost::mutex mutex;
+		unsigned int thread_index;
+		std::vector<TraceEvent> events;
+		boost::uint64_t num_dropped_events;
+	};
+
+
+	/**
+	 * Keeps track of the trace buffers of all threads that have recorded trace events.
+	 *
+	 * Buffers are retained after their threads exit so their events can still be written.
+	 */
+	class TraceBufferRegistry
+	{
+	public:
+		static
+		TraceBufferRegistry &
+		instance()
+		{
+			static TraceBufferRegistry s_instance;
+			return s_instance;
+		}
+
+		boost::shared_ptr<ThreadTraceBuffer>
+		create_thread_buffer()
+		{
+			boost::mutex::scoped_lock lock(d_mutex);
+
+			boost::shared_ptr<ThreadTraceBuffer> thread_buffer(new ThreadTraceBuffer(d_thread_buffers.size()));
+			d_thread_buffers.push_back(thread_buffer);
+
+			return thread_buffer;
+		}
+
+		std::vector< boost::shared_ptr<ThreadTraceBuffer> >
+		get_thread_buffers()
+		{
+			boost::mutex::scoped_lock lock(d_mutex);
+			return d_thread_buffers;
+		}
+
+	private:
+		boost::mutex d_mutex;
+		std::vector< boost::shared_ptr<ThreadTraceBuffer> > d_thread_buffers;
+	};
+
+
+	ThreadTraceBuffer &
+	get_thread_trace_buffer()
+	{
+		thread_local boost::shared_ptr<ThreadTraceBuffer> t_thread_buffer =
+				TraceBufferRegistry::instance().create_thread_buffer();
+
+		return *t_thread_buffer;
+	}
+
+
+	/**
+	 * The time that trace timestamps are relative to.
+	 */
+	const std::chrono::steady_clock::time_point g_trace_epoch = std::chrono::steady_clock::now();
+
+
+	/**
+	 * Writes @a str as a JSON string (including the enclosing quotes).
+	 */
+	void
+	write_json_string(
+			std::ostream &output_stream,
+			const char *str)
+	{
+		output_stream << '"';
+		for ( ; *str; ++str)
+		{
+			const char c = *str;
+			if (c == '"' || c == '\\')
+			{
+				output_stream << '\\' << c;
+			}
+			else if (static_cast<unsigned char>(c) < 0x20)
+			{
+				output_stream << ' ';
+			}
+			else
+			{
+				output_stream << c;
+			}
+		}
+		output_stream << '"';
+	}
+
+
+	/**
+	 * Writes nanoseconds as (fractional) microseconds (the time unit of the trace-event format).
+	 */
+	void
+	write_json_microseconds(
+			std::ostream &output_stream,
+			boost::uint64_t nanoseconds)
+	{
+		output_stream << nanoseconds / 1000 << '.'
+				<< std::setw(3) << std::setfill('0') << nanoseconds % 1000 << std::setfill(' ');
+	}
+}
+
+
+std::atomic<bool> GPlatesUtils::ProfileTraceInternals::g_trace_enabled(false);
+
+
+boost::uint64_t
+GPlatesUtils::ProfileTraceInternals::get_trace_time()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - g_trace_epoch).count();
+}
+
+
+void
+GPlatesUtils::ProfileTraceInternals::record_trace_event(
+		const char *name,
+		boost::uint64_t start_time,
+		boost::uint64_t end_time)
+{
+	ThreadTraceBuffer &thread_buffer = get_thread_trace_buffer();
+
+	boost::mutex::scoped_lock lock(thread_buffer.mutex);
+
+	if (thread_buffer.events.size() >= ThreadTraceBuffer::MAX_NUM_EVENTS)
+	{
+		++thread_buffer.num_dropped_events;
+		return;
+	}
+
+	thread_buffer.events.push_back(
+			TraceEvent(name, start_time, (end_time > start_time) ? (end_time - start_time) : 0));
+}
+
+
+void
+GPlatesUtils::profile_trace_set_enabled(
+		bool enabled)
+{
+	ProfileTraceInternals::g_trace_enabled.store(enabled);
+}
+
+
+void
+GPlatesUtils::profile_trace_clear()
+{
+	const std::vector< boost::shared_ptr<ThreadTraceBuffer> > thread_buffers =
+			TraceBufferRegistry::instance().get_thread_buffers();
+
+	for (const boost::shared_ptr<ThreadTraceBuffer> &thread_buffer : thread_buffers)
+	{
+		boost::mutex::scoped_lock lock(thread_buffer->mutex);
+
+		// Release the memory (rather than just clearing).
+		std::vector<TraceEvent>().swap(thread_buffer->events);
+		thread_buffer->num_dropped_events = 0;
+	}
+}
+
+
+void
+GPlatesUtils::profile_trace_write_to_ostream(
+		std::ostream &output_stream)
+{
+	const std::vector< boost::shared_ptr<ThreadTraceBuffer> > thread_buffers =
+			TraceBufferRegistry::instance().get_thread_buffers();
+
+	output_stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	bool first_event = true;
+	for (const boost::shared_ptr<ThreadTraceBuffer> &thread_buffer : thread_buffers)
+	{
+		// Copy the events so the thread can continue recording while we write.
+		std::vector<TraceEvent> events;
+		boost::uint64_t num_dropped_events;
+		{
+			boost::mutex::scoped_lock lock(thread_buffer->mutex);
+			events = thread_buffer->events;
+			num_dropped_events = thread_buffer->num_dropped_events;
+		}
+
+		if (events.empty())
+		{
+			continue;
+		}
+
+		if (num_dropped_events > 0)
+		{
+			qWarning() << "Profile trace buffer of thread" << thread_buffer->thread_index
+					<< "was full -" << num_dropped_events << "trace events were not recorded.";
+		}
+
+		// Name the thread (in the trace viewer).
+		output_stream << (first_event ? "\n" : ",\n");
+		first_event = false;
+		output_stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread_buffer->thread_index
+				<< ",\"args\":{\"name\":\"Thread " << thread_buffer->thread_index << "\"}}";
+
+		// Each event is a "complete" event (has both a start time and a duration).
+		for (const TraceEvent &event : events)
+		{
+			output_stream << ",\n{\"name\":";
+			write_json_string(output_stream, event.name);
+			output_stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread_buffer->thread_index << ",\"ts\":";
+			write_json_microseconds(output_stream, event.start_time);
+			output_stream << ",\"dur\":";
+			write_json_microseconds(output_stream, event.duration);
+			output_stream << '}';
+		}
+	}
+
+	output_stream << "\n]}\n";
+}
+
+
+bool
+GPlatesUtils::profile_trace_write_to_file(
+		const std::string &filename)
+{
+	std::ofstream output_file(filename.c_str());
+	if (!output_file)
+	{
+		qWarning() << "Failed to open file" << filename.c_str() << "for writing.";
+		return false;
+	}
+
+	profile_trace_write_to_ostream(output_file);
+
+	return true;
+}
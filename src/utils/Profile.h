@@ -27,8 +27,10 @@
 #ifndef GPLATES_UTILS_PROFILE_H
 #define GPLATES_UTILS_PROFILE_H
 
+#include <atomic>
 #include <iosfwd>
 #include <string>
+#include <boost/cstdint.hpp>
 
 #include "global/config.h"  // To see if GPLATES_PROFILE_CODE is defined.
 
@@ -140,6 +142,24 @@
  * to avoid linker errors due to multiple operator new and delete symbols.
  */
 
+/**
+ * Trace events.
+ *
+ * Regardless of whether GPLATES_PROFILE_CODE is defined, each profiled section of code
+ * (PROFILE_BEGIN/PROFILE_END, PROFILE_BLOCK, PROFILE_FUNC and PROFILE_CODE) can also record
+ * a trace event (its name, thread, start time and duration) when tracing is enabled at runtime
+ * with 'GPlatesUtils::profile_trace_set_enabled()'. When tracing is disabled (the default) the
+ * cost of each profiled section is a single (relaxed) atomic load and branch, so tracing is
+ * available in release builds without recompiling.
+ *
+ * Each thread records its trace events into its own buffer, so tracing works for code running
+ * on multiple threads. The recorded events can be written (as Chrome trace-event JSON, viewable
+ * in "chrome://tracing" or Perfetto) using 'GPlatesUtils::profile_trace_write_to_file()'.
+ *
+ * Note that the call-graph profile (reported by PROFILE_REPORT_TO_FILE when GPLATES_PROFILE_CODE
+ * is defined) only records profiled sections of code running on the main thread.
+ */
+
 #if defined(GPLATES_PROFILE_CODE)
 
 /**
@@ -170,7 +190,9 @@
 	GPlatesUtils::profile_begin(PROFILE_ANONYMOUS_VARIABLE(gplates_profile_cache)); \
 	/* Make sure PROFILE_END() is called if it is not reached - */ \
 	/* this can happen if an exception is thrown or function 'return's early. */ \
-	GPlatesUtils::ProfileBlockEnd PROFILE_SCOPE_VARIABLE(profile_tag);
+	GPlatesUtils::ProfileBlockEnd PROFILE_SCOPE_VARIABLE(profile_tag); \
+	/* Record a trace event (if tracing is enabled at runtime). */ \
+	PROFILE_TRACE_BEGIN(profile_tag, name)
 
 /**
  * Stops profiling the matching PROFILE_BEGIN call.
@@ -182,11 +204,37 @@
  * the profile node identified by the matching PROFILE_BEGIN with same @a profile_tag.
  */
 #define PROFILE_END(profile_tag) \
+	/* Finish the trace event (if tracing is enabled at runtime). */ \
+	PROFILE_TRACE_END(profile_tag) \
 	/* If PROFILE_END() has been reached then we can dismiss exception-safe/early-return. */ \
 	PROFILE_SCOPE_VARIABLE(profile_tag).dismiss(); \
 	/* Stop profiling that begin with matching PROFILE_BEGIN() call. */ \
 	GPlatesUtils::profile_end();
 
+/**
+ * Writes the profiling data as text to the output stream @a output_stream where
+ * @a output_stream is a @a std::ostream &.
+ */
+#define PROFILE_REPORT_TO_OSTREAM(output_stream) \
+	GPlatesUtils::profile_report_to_ostream(output_stream);
+
+/**
+ * Writes the profiling data as text to the file @a filename where
+ * @a filename is a @a std::string.
+ */
+#define PROFILE_REPORT_TO_FILE(filename) \
+	GPlatesUtils::profile_report_to_file(filename);
+
+#else // if defined(GPLATES_PROFILE_CODE) ...
+
+// Only trace events (if enabled at runtime) are recorded.
+#define PROFILE_BEGIN(profile_tag, name) PROFILE_TRACE_BEGIN(profile_tag, name)
+#define PROFILE_END(profile_tag) PROFILE_TRACE_END(profile_tag)
+#define PROFILE_REPORT_TO_OSTREAM(output_stream)
+#define PROFILE_REPORT_TO_FILE(filename)
+
+#endif // if defined(GPLATES_PROFILE_CODE) ... else ...
+
 /**
  * Starts profiling until the end of the current scope in which this PROFILE_BLOCK
  * call was made. The end of the scope is the same as when the destructor of a
@@ -244,35 +292,25 @@
 	PROFILE_END(PROFILE_CONCATENATE(code_, profile_tag));
 
 /**
- * Writes the profiling data as text to the output stream @a output_stream where
- * @a output_stream is a @a std::ostream &.
+ * Records a trace event, if tracing is enabled at runtime, until the matching PROFILE_TRACE_END
+ * or the end of the current scope (whichever comes first).
+ *
+ * This is used by PROFILE_BEGIN (so there's usually no need to use it directly).
  */
-#define PROFILE_REPORT_TO_OSTREAM(output_stream) \
-	GPlatesUtils::profile_report_to_ostream(output_stream);
+#define PROFILE_TRACE_BEGIN(profile_tag, name) \
+	GPlatesUtils::ProfileTraceScope PROFILE_TRACE_SCOPE_VARIABLE(profile_tag)(name);
 
 /**
- * Writes the profiling data as text to the file @a filename where
- * @a filename is a @a std::string.
+ * Finishes the trace event started by the matching PROFILE_TRACE_BEGIN.
  */
-#define PROFILE_REPORT_TO_FILE(filename) \
-	GPlatesUtils::profile_report_to_file(filename);
-
-#else // if defined(GPLATES_PROFILE_CODE) ...
-
-#define PROFILE_BEGIN(profile_tag, name)
-#define PROFILE_END(profile_tag)
-#define PROFILE_BLOCK(name)
-#define PROFILE_FUNC()
-#define PROFILE_CODE(profile_tag, code) code
-#define PROFILE_REPORT_TO_OSTREAM(output_stream)
-#define PROFILE_REPORT_TO_FILE(filename)
-
-#endif // if defined(GPLATES_PROFILE_CODE) ... else ...
+#define PROFILE_TRACE_END(profile_tag) \
+	PROFILE_TRACE_SCOPE_VARIABLE(profile_tag).end();
 
 
 #define PROFILE_CONCATENATE_DIRECT(s1, s2)   s1##s2
 #define PROFILE_CONCATENATE(s1, s2)          PROFILE_CONCATENATE_DIRECT(s1, s2)
 #define PROFILE_SCOPE_VARIABLE(name)         PROFILE_CONCATENATE(gplates_profile_scope_, name)
+#define PROFILE_TRACE_SCOPE_VARIABLE(name)   PROFILE_CONCATENATE(gplates_profile_trace_scope_, name)
 #define PROFILE_ANONYMOUS_VARIABLE(name)     PROFILE_CONCATENATE(name, __LINE__)
 
 #if defined (__GNUG__)
@@ -338,6 +376,125 @@ namespace GPlatesUtils
 	private:
 		bool d_dismiss;
 	};
+
+
+	namespace ProfileTraceInternals
+	{
+		//! Is true if trace events are currently being recorded.
+		extern std::atomic<bool> g_trace_enabled;
+
+		/**
+		 * Returns the time, in nanoseconds, since tracing was first enabled.
+		 */
+		boost::uint64_t
+		get_trace_time();
+
+		/**
+		 * Records a trace event in the calling thread's trace buffer.
+		 */
+		void
+		record_trace_event(
+				const char *name,
+				boost::uint64_t start_time,
+				boost::uint64_t end_time);
+	}
+
+	/**
+	 * Returns true if trace events are currently being recorded.
+	 */
+	inline
+	bool
+	profile_trace_is_enabled()
+	{
+		return ProfileTraceInternals::g_trace_enabled.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Starts (or stops) recording trace events.
+	 *
+	 * This can be called at any time (from any thread). Previously recorded events are retained
+	 * until @a profile_trace_clear is called.
+	 */
+	void
+	profile_trace_set_enabled(
+			bool enabled);
+
+	/**
+	 * Discards all recorded trace events (of all threads).
+	 */
+	void
+	profile_trace_clear();
+
+	/**
+	 * Writes the recorded trace events (of all threads) to @a output_stream in the
+	 * Chrome trace-event JSON format.
+	 */
+	void
+	profile_trace_write_to_ostream(
+			std::ostream &output_stream);
+
+	/**
+	 * Writes the recorded trace events (of all threads) to the file @a filename in the
+	 * Chrome trace-event JSON format.
+	 *
+	 * Returns false if the file could not be opened for writing.
+	 */
+	bool
+	profile_trace_write_to_file(
+			const std::string &filename);
+
+
+	/**
+	 * Records a trace event spanning the lifetime of this object (or until @a end is called),
+	 * but only if tracing was enabled when this object was created.
+	 *
+	 * @a name must be a string literal (or otherwise outlive the recorded events).
+	 */
+	class ProfileTraceScope
+	{
+	public:
+		explicit
+		ProfileTraceScope(
+				const char *name) :
+			d_name(NULL),
+			d_start_time(0)
+		{
+			if (profile_trace_is_enabled())
+			{
+				d_name = name;
+				d_start_time = ProfileTraceInternals::get_trace_time();
+			}
+		}
+
+		void
+		end()
+		{
+			if (d_name)
+			{
+				ProfileTraceInternals::record_trace_event(
+						d_name,
+						d_start_time,
+						ProfileTraceInternals::get_trace_time());
+				d_name = NULL;
+			}
+		}
+
+		~ProfileTraceScope()
+		{
+			// Since this is a destructor we cannot let any exceptions escape.
+			try
+			{
+				end();
+			}
+			catch (...)
+			{
+			}
+		}
+
+	private:
+		const char *d_name;
+		boost::uint64_t d_start_time;
+	};
 }
 
 #endif // GPLATES_UTILS_PROFILE_H
@@ -33,9 +33,12 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <set>
 #include <boost/intrusive_ptr.hpp>
 #include <boost/optional.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include "ReferenceCount.h"
 
@@ -149,6 +152,14 @@ namespace GPlatesUtils
 	 *  -# The location in memory of the element for a particular UnicodeString will not change
 	 * as long as the reference count of that element is greater than zero.
 	 *  -# The class does not contain any elements which have a reference-count less than one.
+	 *
+	 * @par Thread-safety:
+	 * StringSet instances are process-wide (see "model/StringSetSingletons.h") so they can be
+	 * accessed concurrently (eg, by Python threads loading files into separate models).
+	 * The @c std::set is only searched or modified with the StringSetImpl mutex locked.
+	 * Copying a SharedIterator only atomically increments the element reference-count (the
+	 * element cannot be removed while the copied-from instance references it), and only the
+	 * release of what might be the last reference locks the mutex (to remove the element).
 	 */
 	class StringSet
 	{
@@ -159,7 +170,7 @@ namespace GPlatesUtils
 		struct UnicodeStringAndRefCount
 		{
 			GPlatesUtils::UnicodeString d_str;
-			mutable long d_ref_count;
+			mutable std::atomic<long> d_ref_count;
 
 			/**
 			 * Construct a UnicodeStringAndRefCount instance for the UnicodeString
@@ -240,8 +251,18 @@ namespace GPlatesUtils
 				return d_collection;
 			}
 
+			/**
+			 * The mutex that must be locked while searching or modifying the collection.
+			 */
+			boost::mutex &
+			mutex()
+			{
+				return d_mutex;
+			}
+
 		private:
 			StringSet::collection_type d_collection;
+			boost::mutex d_mutex;
 
 			// This constructor should not be public, because we don't want to allow
 			// instantiation of this type on the stack.
@@ -613,6 +634,7 @@ namespace GPlatesUtils
 		size_type
 		size() const
 		{
+			boost::lock_guard<boost::mutex> lock(d_impl->mutex());
 			return d_impl->collection().size();
 		}
 
@@ -257,7 +257,8 @@ GPlatesViewOperations::VisibleReconstructionGeometryExport::export_visible_recon
 		bool export_single_output_file,
 		bool export_per_input_file,
 		bool export_separate_output_directory_per_input_file,
-		bool wrap_to_dateline)
+		bool wrap_to_dateline,
+		const boost::optional<GPlatesFileIO::OgrMultiFrameExport::Frame> &multi_frame)
 {
 	// Get any ReconstructionGeometry objects that are visible in any active layers
 	// of the RenderedGeometryCollection.
@@ -287,7 +288,8 @@ GPlatesViewOperations::VisibleReconstructionGeometryExport::export_visible_recon
 			export_single_output_file,
 			export_per_input_file,
 			export_separate_output_directory_per_input_file,
-			wrap_to_dateline);
+			wrap_to_dateline,
+			multi_frame);
 }
 
 
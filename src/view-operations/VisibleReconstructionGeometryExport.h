@@ -32,6 +32,7 @@
 #include <QString>
 
 #include "file-io/File.h"
+#include "file-io/OgrMultiFrameExport.h"
 
 #include "maths/PolygonOrientation.h"
 
@@ -68,6 +69,8 @@ namespace GPlatesViewOperations
 		 * @param export_per_input_file write output files corresponding to input files.
 		 * @param export_separate_output_directory_per_input_file save each file to a different directory.
 		 * @param wrap_to_dateline if true then exported geometries are wrapped/clipped to the dateline.
+		 * @param multi_frame if specified then this export is one frame of a multi-frame export
+		 *        (appended to a single GeoPackage file).
 		 *
 		 * @throws ErrorOpeningFileForWritingException if file is not writable.
 		 * @throws FileFormatNotSupportedException if file format not supported.
@@ -84,7 +87,8 @@ namespace GPlatesViewOperations
 				bool export_single_output_file,
 				bool export_per_input_file,
 				bool export_separate_output_directory_per_input_file,
-				bool wrap_to_dateline);
+				bool wrap_to_dateline,
+				const boost::optional<GPlatesFileIO::OgrMultiFrameExport::Frame> &multi_frame = boost::none);
 
 
 		/**